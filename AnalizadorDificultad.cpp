@@ -0,0 +1,456 @@
+/**
+ * @file AnalizadorDificultad.cpp
+ * @brief Implementación del TAD AnalizadorDificultad para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD
+ * AnalizadorDificultad (AnalizadorDificultad.h). La exploración es una búsqueda
+ * en anchura sobre estados canónicos que guarda los sucesores de cada estado
+ * (con repetición, uno por movimiento real) en un vector compacto. En la misma
+ * pasada se cuentan los caminos mínimos a cada estado; después se recorre el
+ * grafo invertido desde las posiciones resueltas para marcar los estados con
+ * solución. Como los tableros que solo difieren en el orden de los tubos tienen
+ * las mismas secuencias de movimientos, los recuentos son los del tablero real.
+ *
+ * Formato de la caché: una línea por informe con el estado canónico (tubos
+ * separados por '.', de abajo arriba, '-' para los vacíos) y las medidas,
+ * entre ellas si el análisis fue completo y si se decidió si tiene solución.
+ */
+
+#include "AnalizadorDificultad.h"
+#include "Resolutor.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+InformeDificultad::InformeDificultad()
+{
+    completo = false;
+    decidido = false;
+    resoluble = false;
+    longitudOptima = -1;
+    numSolucionesOptimas = 0;
+    numEstados = 0;
+    ramificacionMedia = 0;
+    numCallejones = 0;
+    numTrampas = 0;
+    movimientosResolubles = 0;
+    puntuacion = -1;
+}
+
+/**
+ * Convierte un estado al texto de la caché
+ */
+static std::string estadoATexto(const EstadoCompacto &estado)
+{
+    std::string texto;
+    for (int pila = 0; pila < estado.getNumPilas(); pila++)
+    {
+        if (pila > 0)
+        {
+            texto += '.';
+        }
+        if (estado.getAltura(pila) == 0)
+        {
+            texto += '-';
+        }
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            texto += EstadoCompacto::colorIndice(estado.getBola(pila, posicion));
+        }
+    }
+    return texto;
+}
+
+/**
+ * Reconstruye un estado a partir del texto de la caché
+ */
+static bool textoAEstado(const std::string &texto, EstadoCompacto &estado)
+{
+    std::vector<std::string> tubos;
+    std::stringstream flujo(texto);
+    std::string tubo;
+    while (std::getline(flujo, tubo, '.'))
+    {
+        tubos.push_back(tubo);
+    }
+    if (tubos.size() < 2 || tubos.size() > (size_t)Tablero::MAX_PILAS)
+    {
+        return false;
+    }
+
+    Tablero tablero;
+    tablero.inicializar((int)tubos.size());
+    for (size_t i = 0; i < tubos.size(); i++)
+    {
+        if (tubos[i] == "-")
+        {
+            continue;
+        }
+        for (char color : tubos[i])
+        {
+            if (!tablero.colocarBola((int)i, color))
+            {
+                return false;
+            }
+        }
+    }
+    return estado.desdeTablero(tablero);
+}
+
+/**
+ * Constructor
+ * @param maxEstados - Estados máximos de la exploración completa
+ * @complexity O(1)
+ */
+AnalizadorDificultad::AnalizadorDificultad(long long maxEstados)
+{
+    this->maxEstados = maxEstados;
+    aciertosCache = 0;
+}
+
+/**
+ * Explora el grafo de estados de un nivel y calcula sus medidas
+ */
+InformeDificultad AnalizadorDificultad::explorar(const EstadoCompacto &raiz) const
+{
+    InformeDificultad informe;
+
+    std::vector<EstadoCompacto> estados(1, raiz);
+    std::unordered_map<EstadoCompacto, uint32_t, HashEstadoCompacto> indices;
+    indices[raiz] = 0;
+    std::vector<int> profundidades(1, 0);
+    std::vector<double> caminos(1, 1.0);
+    std::vector<uint32_t> inicioSucesores;
+    std::vector<uint32_t> sucesores;
+    std::vector<uint32_t> resueltos;
+
+    long long movimientos = 0;
+    long long estadosNoFinales = 0;
+    bool completo = true;
+    Tablero tablero;
+
+    for (size_t i = 0; i < estados.size(); i++)
+    {
+        inicioSucesores.push_back((uint32_t)sucesores.size());
+        estados[i].aTablero(tablero);
+        if (tablero.juegoTerminado())
+        {
+            resueltos.push_back((uint32_t)i);
+            continue;
+        }
+        if ((long long)estados.size() > maxEstados)
+        {
+            completo = false;
+            break;
+        }
+
+        estadosNoFinales++;
+        Movimiento validos[Tablero::MAX_MOVIMIENTOS];
+        int numValidos = tablero.generarMovimientos(validos);
+        for (int m = 0; m < numValidos; m++)
+        {
+            int origen = validos[m].origen;
+            int destino = validos[m].destino;
+            EstadoCompacto hijo = estados[i];
+            hijo.trasladarBola(origen, destino);
+            hijo = hijo.canonico();
+            movimientos++;
+
+            auto insertado = indices.emplace(hijo, (uint32_t)estados.size());
+            uint32_t indiceHijo = insertado.first->second;
+            if (insertado.second)
+            {
+                estados.push_back(hijo);
+                profundidades.push_back(profundidades[i] + 1);
+                caminos.push_back(0.0);
+            }
+            if (profundidades[indiceHijo] == profundidades[i] + 1)
+            {
+                caminos[indiceHijo] += caminos[i];
+            }
+            sucesores.push_back(indiceHijo);
+        }
+    }
+    inicioSucesores.push_back((uint32_t)sucesores.size());
+    indices.clear();
+
+    informe.numEstados = (long long)estados.size();
+    informe.ramificacionMedia = estadosNoFinales > 0 ? (double)movimientos / estadosNoFinales : 0.0;
+
+    if (!completo)
+    {
+        // Grafo demasiado grande: solo la longitud óptima, con el resolutor. Sin
+        // el grafo entero no se cuentan las soluciones óptimas, y si el resolutor
+        // agota sus nodos sin encontrar solución no se sabe si la hay
+        Tablero inicial;
+        raiz.aTablero(inicial);
+        OpcionesResolutor opciones;
+        ResultadoResolucion resultado = Resolutor(opciones).resolver(inicial);
+        informe.decidido = resultado.resuelto || resultado.nodosExpandidos < opciones.maxNodos;
+        informe.resoluble = resultado.resuelto;
+        informe.longitudOptima = resultado.resuelto ? (int)resultado.movimientos.size() : -1;
+        informe.puntuacion = calcularPuntuacion(informe);
+        return informe;
+    }
+
+    // La primera posición resuelta en orden de anchura está a la distancia óptima
+    informe.completo = true;
+    informe.decidido = true;
+    if (!resueltos.empty())
+    {
+        informe.resoluble = true;
+        informe.longitudOptima = profundidades[resueltos[0]];
+        for (uint32_t resuelto : resueltos)
+        {
+            if (profundidades[resuelto] == informe.longitudOptima)
+            {
+                informe.numSolucionesOptimas += caminos[resuelto];
+            }
+        }
+    }
+
+    // Grafo invertido para marcar los estados desde los que se llega a la solución
+    size_t n = estados.size();
+    std::vector<uint32_t> inicioPredecesores(n + 1, 0);
+    for (uint32_t sucesor : sucesores)
+    {
+        inicioPredecesores[sucesor + 1]++;
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        inicioPredecesores[i + 1] += inicioPredecesores[i];
+    }
+    std::vector<uint32_t> predecesores(sucesores.size());
+    std::vector<uint32_t> ocupados(inicioPredecesores.begin(), inicioPredecesores.end() - 1);
+    for (size_t i = 0; i < n; i++)
+    {
+        for (uint32_t k = inicioSucesores[i]; k < inicioSucesores[i + 1]; k++)
+        {
+            predecesores[ocupados[sucesores[k]]++] = (uint32_t)i;
+        }
+    }
+
+    std::vector<bool> conSolucion(n, false);
+    std::vector<uint32_t> pendientes(resueltos);
+    for (uint32_t resuelto : resueltos)
+    {
+        conSolucion[resuelto] = true;
+    }
+    while (!pendientes.empty())
+    {
+        uint32_t estado = pendientes.back();
+        pendientes.pop_back();
+        for (uint32_t k = inicioPredecesores[estado]; k < inicioPredecesores[estado + 1]; k++)
+        {
+            if (!conSolucion[predecesores[k]])
+            {
+                conSolucion[predecesores[k]] = true;
+                pendientes.push_back(predecesores[k]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!conSolucion[i])
+        {
+            informe.numCallejones++;
+            continue;
+        }
+        for (uint32_t k = inicioSucesores[i]; k < inicioSucesores[i + 1]; k++)
+        {
+            informe.movimientosResolubles++;
+            if (!conSolucion[sucesores[k]])
+            {
+                informe.numTrampas++;
+            }
+        }
+    }
+
+    informe.puntuacion = calcularPuntuacion(informe);
+    return informe;
+}
+
+/**
+ * Analiza un tablero
+ * @param tablero - Tablero de partida
+ * @return InformeDificultad - Medidas del nivel
+ * @complexity O(S * n^2) donde S es el número de estados y n el de pilas
+ */
+InformeDificultad AnalizadorDificultad::analizar(const Tablero &tablero)
+{
+    EstadoCompacto raiz;
+    if (!raiz.desdeTablero(tablero))
+    {
+        return InformeDificultad();
+    }
+    raiz = raiz.canonico();
+
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojo);
+        auto encontrado = cache.find(raiz);
+        if (encontrado != cache.end())
+        {
+            aciertosCache++;
+            return encontrado->second;
+        }
+    }
+
+    InformeDificultad informe = explorar(raiz);
+
+    std::lock_guard<std::mutex> bloqueo(cerrojo);
+    cache[raiz] = informe;
+    return informe;
+}
+
+/**
+ * Analiza varios tableros en paralelo
+ * @param tableros - Tableros de partida
+ * @param numHilos - Hilos de trabajo (0 = todos los núcleos)
+ * @return std::vector<InformeDificultad> - Un informe por tablero
+ * @complexity O(suma de los costes de analizar / numHilos)
+ */
+std::vector<InformeDificultad> AnalizadorDificultad::analizarNiveles(const std::vector<Tablero> &tableros,
+                                                                     int numHilos)
+{
+    if (numHilos <= 0)
+    {
+        numHilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+    numHilos = std::min(numHilos, (int)std::max((size_t)1, tableros.size()));
+
+    std::vector<InformeDificultad> informes(tableros.size());
+    std::atomic<size_t> siguiente(0);
+    std::vector<std::thread> hilos;
+    for (int h = 0; h < numHilos; h++)
+    {
+        hilos.emplace_back([this, &tableros, &informes, &siguiente]()
+                           {
+                               for (size_t i = siguiente++; i < tableros.size(); i = siguiente++)
+                               {
+                                   informes[i] = analizar(tableros[i]);
+                               }
+                           });
+    }
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+    return informes;
+}
+
+/**
+ * Carga informes de un archivo de caché
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si el archivo existe y tiene un formato válido
+ * @complexity O(m) donde m es el número de informes del archivo
+ */
+bool AnalizadorDificultad::cargarCache(const std::string &nombreArchivo)
+{
+    std::ifstream archivo(nombreArchivo);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+
+    // Se lee todo antes de tocar la caché, para no dejar a medias un archivo dañado
+    std::unordered_map<EstadoCompacto, InformeDificultad, HashEstadoCompacto> leidos;
+    std::string linea;
+    while (std::getline(archivo, linea))
+    {
+        if (linea.empty())
+        {
+            continue;
+        }
+
+        std::istringstream campos(linea);
+        std::string texto;
+        InformeDificultad informe;
+        EstadoCompacto estado;
+        if (!(campos >> texto >> informe.completo >> informe.decidido >> informe.resoluble >>
+              informe.longitudOptima >> informe.numSolucionesOptimas >> informe.numEstados >>
+              informe.ramificacionMedia >> informe.numCallejones >> informe.numTrampas >>
+              informe.movimientosResolubles) ||
+            !textoAEstado(texto, estado))
+        {
+            return false;
+        }
+        informe.puntuacion = calcularPuntuacion(informe);
+        leidos[estado] = informe;
+    }
+    if (archivo.bad())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> bloqueo(cerrojo);
+    for (const std::pair<const EstadoCompacto, InformeDificultad> &entrada : leidos)
+    {
+        cache[entrada.first] = entrada.second;
+    }
+    return true;
+}
+
+/**
+ * Guarda la caché en un archivo
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si se pudo escribir
+ * @complexity O(m) donde m es el número de informes de la caché
+ */
+bool AnalizadorDificultad::guardarCache(const std::string &nombreArchivo) const
+{
+    std::ofstream archivo(nombreArchivo);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+
+    archivo.precision(17);
+    std::lock_guard<std::mutex> bloqueo(cerrojo);
+    for (const auto &par : cache)
+    {
+        const InformeDificultad &informe = par.second;
+        archivo << estadoATexto(par.first) << ' ' << informe.completo << ' ' << informe.decidido << ' '
+                << informe.resoluble << ' ' << informe.longitudOptima << ' ' << informe.numSolucionesOptimas << ' '
+                << informe.numEstados << ' ' << informe.ramificacionMedia << ' ' << informe.numCallejones << ' '
+                << informe.numTrampas << ' ' << informe.movimientosResolubles << '\n';
+    }
+    return archivo.good();
+}
+
+/**
+ * Obtiene el número de análisis resueltos con la caché
+ * @return long long - Aciertos de caché
+ * @complexity O(1)
+ */
+long long AnalizadorDificultad::getAciertosCache() const
+{
+    std::lock_guard<std::mutex> bloqueo(cerrojo);
+    return aciertosCache;
+}
+
+/**
+ * Calcula la puntuación de dificultad de un informe
+ * @param informe - Medidas del nivel
+ * @return double - Puntuación (mayor es más difícil)
+ * @complexity O(1)
+ */
+double AnalizadorDificultad::calcularPuntuacion(const InformeDificultad &informe)
+{
+    if (!informe.resoluble)
+    {
+        return -1.0;
+    }
+
+    double proporcionTrampas =
+        informe.movimientosResolubles > 0 ? (double)informe.numTrampas / informe.movimientosResolubles : 0.0;
+    double puntuacion = informe.longitudOptima * (1.0 + proporcionTrampas) +
+                        2.0 * std::log2(1.0 + informe.ramificacionMedia) -
+                        0.5 * std::log2(std::max(1.0, informe.numSolucionesOptimas));
+    return std::max(0.0, puntuacion);
+}
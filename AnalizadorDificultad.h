@@ -0,0 +1,138 @@
+/**
+ * @file AnalizadorDificultad.h
+ * @brief TAD AnalizadorDificultad para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) AnalizadorDificultad,
+ * que estima la dificultad de un nivel explorando en memoria todo su grafo de
+ * estados canónicos: longitud de la solución óptima, número de soluciones
+ * óptimas distintas, factor de ramificación medio, estados sin salida
+ * (callejones) y movimientos trampa, que llevan de un estado con solución a un
+ * callejón. Con estas medidas calcula una puntuación que permite ordenar un
+ * paquete de niveles.
+ *
+ * Los informes se guardan en una caché indexada por el estado canónico de
+ * partida (dos niveles que solo difieren en el orden de los tubos comparten
+ * informe) que se puede guardar y cargar de un archivo de texto. Varios
+ * niveles se analizan en paralelo.
+ */
+
+#ifndef ANALIZADOR_DIFICULTAD_H
+#define ANALIZADOR_DIFICULTAD_H
+
+#include "EstadoCompacto.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Medidas de dificultad de un nivel
+ */
+struct InformeDificultad
+{
+    bool completo;                   // true si se exploraron todos los estados alcanzables
+    bool decidido;                   // true si se sabe si el nivel tiene solución
+    bool resoluble;                  // true si el nivel tiene solución
+    int longitudOptima;              // Movimientos de la solución óptima (-1 si no tiene o no se sabe)
+    double numSolucionesOptimas;     // Secuencias de movimientos distintas de longitud óptima (0 si !completo)
+    long long numEstados;            // Estados canónicos explorados
+    double ramificacionMedia;        // Movimientos válidos medios por estado no final
+    long long numCallejones;         // Estados desde los que no se puede resolver
+    long long numTrampas;            // Movimientos de un estado con solución a un callejón
+    long long movimientosResolubles; // Movimientos que parten de estados con solución
+    double puntuacion;               // Dificultad estimada (-1 si no tiene solución o no se sabe)
+
+    InformeDificultad();
+};
+
+/**
+ * @brief TAD AnalizadorDificultad que mide y puntúa niveles
+ */
+class AnalizadorDificultad
+{
+private:
+    long long maxEstados; // Estados máximos de la exploración completa
+    std::unordered_map<EstadoCompacto, InformeDificultad, HashEstadoCompacto> cache;
+    long long aciertosCache;
+    mutable std::mutex cerrojo; // Protege la caché y sus contadores
+
+    InformeDificultad explorar(const EstadoCompacto &raiz) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @pre maxEstados > 0
+     * @post Crea un analizador con la caché vacía
+     * @param maxEstados - Estados a partir de los cuales se renuncia a la exploración completa
+     * @complexity O(1)
+     */
+    explicit AnalizadorDificultad(long long maxEstados = 5000000);
+
+    /**
+     * @brief Analiza un tablero
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Si el grafo tiene como mucho maxEstados estados el informe es
+     *       completo; si no, solo contiene la longitud óptima (calculada con el
+     *       Resolutor) y la ramificación de la parte explorada, y si el
+     *       Resolutor se rinde por su límite de nodos queda sin decidir
+     * @param tablero - Tablero de partida
+     * @return InformeDificultad - Medidas del nivel (de la caché si ya se analizó)
+     * @complexity O(S * n^2) donde S es el número de estados y n el de pilas
+     */
+    InformeDificultad analizar(const Tablero &tablero);
+
+    /**
+     * @brief Analiza varios tableros en paralelo
+     * @pre numHilos >= 0 (0 = todos los núcleos)
+     * @post informes[i] es el informe de tableros[i]
+     * @param tableros - Tableros de partida
+     * @param numHilos - Hilos de trabajo
+     * @return std::vector<InformeDificultad> - Un informe por tablero
+     * @complexity O(suma de los costes de analizar / numHilos)
+     */
+    std::vector<InformeDificultad> analizarNiveles(const std::vector<Tablero> &tableros, int numHilos = 0);
+
+    /**
+     * @brief Carga informes de un archivo de caché
+     * @pre No hay precondiciones
+     * @post Si el archivo es válido, sus informes se añaden a la caché; si no,
+     *       la caché no cambia
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si el archivo existe y tiene un formato válido
+     * @complexity O(m) donde m es el número de informes del archivo
+     */
+    bool cargarCache(const std::string &nombreArchivo);
+
+    /**
+     * @brief Guarda la caché en un archivo
+     * @pre No hay precondiciones
+     * @post El archivo contiene una línea por informe
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si se pudo escribir
+     * @complexity O(m) donde m es el número de informes de la caché
+     */
+    bool guardarCache(const std::string &nombreArchivo) const;
+
+    /**
+     * @brief Obtiene el número de análisis resueltos con la caché
+     * @return long long - Aciertos de caché
+     * @complexity O(1)
+     */
+    long long getAciertosCache() const;
+
+    /**
+     * @brief Calcula la puntuación de dificultad de un informe
+     * @pre No hay precondiciones
+     * @post Devuelve -1 si el nivel no tiene solución; si no, la longitud óptima
+     *       aumentada por la proporción de trampas y la ramificación y reducida
+     *       cuando hay muchas soluciones óptimas
+     * @param informe - Medidas del nivel
+     * @return double - Puntuación (mayor es más difícil)
+     * @complexity O(1)
+     */
+    static double calcularPuntuacion(const InformeDificultad &informe);
+};
+
+#endif // ANALIZADOR_DIFICULTAD_H
@@ -0,0 +1,227 @@
+/**
+ * @file AnalizadorDificultadPruebas.cpp
+ * @brief Pruebas para el TAD AnalizadorDificultad del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD AnalizadorDificultad
+ * (AnalizadorDificultad.h/AnalizadorDificultad.cpp). Las medidas se contrastan
+ * con una exploración por fuerza bruta de los tableros reales, sin formas
+ * canónicas, de un nivel pequeño.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "AnalizadorDificultad.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <set>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "AnalizadorDificultad.cpp"
+
+/**
+ * @brief Medidas de un nivel calculadas sobre los tableros reales
+ */
+struct MedidasReales
+{
+    int longitudOptima;
+    double numSoluciones;
+    std::set<EstadoCompacto> callejonesCanonicos;
+};
+
+/**
+ * @brief Explora por fuerza bruta el grafo de tableros reales
+ * @param inicial - Tablero de partida
+ * @return MedidasReales - Longitud óptima, soluciones óptimas y callejones
+ */
+MedidasReales explorarReal(const Tablero &inicial)
+{
+    std::vector<EstadoCompacto> estados(1);
+    estados[0].desdeTablero(inicial);
+    std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> indice;
+    indice[estados[0]] = 0;
+    std::vector<int> profundidad(1, 0);
+    std::vector<double> caminos(1, 1.0);
+    std::vector<std::vector<int>> predecesores(1);
+    std::vector<int> resueltos;
+
+    for (size_t i = 0; i < estados.size(); i++)
+    {
+        Tablero tablero;
+        estados[i].aTablero(tablero);
+        if (tablero.juegoTerminado())
+        {
+            resueltos.push_back((int)i);
+            continue;
+        }
+        for (int o = 0; o < tablero.getNumPilas(); o++)
+        {
+            for (int d = 0; d < tablero.getNumPilas(); d++)
+            {
+                Tablero hijo = tablero;
+                EstadoCompacto sucesor;
+                if (!hijo.moverBola(o, d) || !sucesor.desdeTablero(hijo))
+                {
+                    continue;
+                }
+                auto insertado = indice.emplace(sucesor, (int)estados.size());
+                int j = insertado.first->second;
+                if (insertado.second)
+                {
+                    estados.push_back(sucesor);
+                    profundidad.push_back(profundidad[i] + 1);
+                    caminos.push_back(0.0);
+                    predecesores.push_back(std::vector<int>());
+                }
+                if (profundidad[j] == profundidad[i] + 1)
+                {
+                    caminos[j] += caminos[i];
+                }
+                predecesores[j].push_back((int)i);
+            }
+        }
+    }
+
+    MedidasReales medidas;
+    medidas.longitudOptima = -1;
+    medidas.numSoluciones = 0;
+    for (int r : resueltos)
+    {
+        if (medidas.longitudOptima < 0 || profundidad[r] < medidas.longitudOptima)
+        {
+            medidas.longitudOptima = profundidad[r];
+            medidas.numSoluciones = 0;
+        }
+        if (profundidad[r] == medidas.longitudOptima)
+        {
+            medidas.numSoluciones += caminos[r];
+        }
+    }
+
+    std::vector<bool> conSolucion(estados.size(), false);
+    std::vector<int> pendientes = resueltos;
+    for (int r : resueltos)
+    {
+        conSolucion[r] = true;
+    }
+    while (!pendientes.empty())
+    {
+        int i = pendientes.back();
+        pendientes.pop_back();
+        for (int p : predecesores[i])
+        {
+            if (!conSolucion[p])
+            {
+                conSolucion[p] = true;
+                pendientes.push_back(p);
+            }
+        }
+    }
+    for (size_t i = 0; i < estados.size(); i++)
+    {
+        if (!conSolucion[i])
+        {
+            medidas.callejonesCanonicos.insert(estados[i].canonico());
+        }
+    }
+    return medidas;
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD AnalizadorDificultad..." << std::endl;
+
+    // Prueba 1: Nivel ya resuelto y nivel sin movimientos
+    AnalizadorDificultad analizador;
+    InformeDificultad resuelto = analizador.analizar(crearTablero(3, {"RRRR", "GGGG"}));
+    assert(resuelto.completo && resuelto.resoluble);
+    assert(resuelto.longitudOptima == 0 && resuelto.numSolucionesOptimas == 1);
+    assert(resuelto.numCallejones == 0 && resuelto.numTrampas == 0);
+    InformeDificultad bloqueado = analizador.analizar(crearTablero(2, {"RGRG", "GRGR"}));
+    assert(bloqueado.completo && bloqueado.decidido && !bloqueado.resoluble);
+    assert(bloqueado.longitudOptima == -1 && bloqueado.numCallejones == 1);
+    assert(bloqueado.puntuacion < 0);
+    std::cout << "Prueba 1 superada: Niveles triviales" << std::endl;
+
+    // Prueba 2: Medidas iguales a las de la exploración de tableros reales
+    Tablero pequeno = crearTablero(4, {"BRBR", "GRBB", "RGGG"});
+    InformeDificultad informe = analizador.analizar(pequeno);
+    MedidasReales reales = explorarReal(pequeno);
+    assert(informe.completo && informe.resoluble);
+    assert(informe.longitudOptima == reales.longitudOptima);
+    assert(informe.numSolucionesOptimas == reales.numSoluciones);
+    assert(informe.numCallejones == (long long)reales.callejonesCanonicos.size());
+    assert(informe.numCallejones > 0);
+    assert(informe.numTrampas > 0 && informe.numTrampas < informe.movimientosResolubles);
+    assert(informe.ramificacionMedia > 1.0);
+    std::cout << "Prueba 2 superada: " << informe.longitudOptima << " movimientos, " << informe.numSolucionesOptimas
+              << " soluciones óptimas, " << informe.numCallejones << " callejones" << std::endl;
+
+    // Prueba 3: Caché por estado canónico
+    long long aciertos = analizador.getAciertosCache();
+    InformeDificultad permutado = analizador.analizar(crearTablero(4, {"", "RGGG", "BRBR", "GRBB"}));
+    assert(analizador.getAciertosCache() == aciertos + 1);
+    assert(permutado.numSolucionesOptimas == informe.numSolucionesOptimas);
+    assert(analizador.guardarCache("cache_pruebas.tmp"));
+    AnalizadorDificultad otro;
+    assert(otro.cargarCache("cache_pruebas.tmp"));
+    std::remove("cache_pruebas.tmp");
+    InformeDificultad cargado = otro.analizar(pequeno);
+    assert(otro.getAciertosCache() == 1);
+    assert(cargado.longitudOptima == informe.longitudOptima && cargado.numCallejones == informe.numCallejones);
+    assert(cargado.numSolucionesOptimas == informe.numSolucionesOptimas);
+    assert(cargado.puntuacion == informe.puntuacion);
+    assert(!otro.cargarCache("no_existe.tmp"));
+    assert(analizador.guardarCache("cache_pruebas.tmp"));
+    {
+        std::ofstream danado("cache_pruebas.tmp", std::ios::app);
+        danado << "basura\n";
+    }
+    AnalizadorDificultad vacio;
+    assert(!vacio.cargarCache("cache_pruebas.tmp"));
+    std::remove("cache_pruebas.tmp");
+    vacio.analizar(pequeno);
+    assert(vacio.getAciertosCache() == 0); // Un archivo dañado no deja informes a medias
+    std::cout << "Prueba 3 superada: Caché de informes" << std::endl;
+
+    // Prueba 4: Análisis en paralelo del nivel de ejemplo
+    std::vector<Tablero> paquete;
+    paquete.push_back(crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"}));
+    paquete.push_back(pequeno);
+    paquete.push_back(crearTablero(3, {"RRRR", "GGGG"}));
+    AnalizadorDificultad paralelo;
+    std::vector<InformeDificultad> informes = paralelo.analizarNiveles(paquete, 2);
+    assert(informes.size() == 3);
+    assert(informes[0].longitudOptima == 15);
+    assert(informes[1].numSolucionesOptimas == informe.numSolucionesOptimas);
+    assert(informes[2].longitudOptima == 0);
+    assert(informes[2].puntuacion < informes[0].puntuacion && informes[2].puntuacion < informes[1].puntuacion);
+    std::cout << "Prueba 4 superada: Paquete ordenable (" << informes[0].numEstados << " estados en el ejemplo)"
+              << std::endl;
+
+    // Prueba 5: Grafo mayor que el límite de estados
+    AnalizadorDificultad limitado(1000);
+    InformeDificultad parcial = limitado.analizar(paquete[0]);
+    assert(!parcial.completo && parcial.decidido && parcial.resoluble);
+    assert(parcial.longitudOptima == 15);
+    std::cout << "Prueba 5 superada: Análisis parcial" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD AnalizadorDificultad han sido superadas!" << std::endl;
+    return 0;
+}
@@ -13,18 +13,63 @@
  * ballSort.cnf, buscándolo en varias ubicaciones posibles. Una vez cargado, permite
  * al usuario jugar moviendo bolas entre tubos según las reglas del juego, hasta que
  * se complete el puzzle o el usuario decida salir.
+ *
+ * La entrada se lee con el TAD EntradaTeclado: en un terminal cada tubo se elige
+ * con una sola pulsación y, si la entrada está redirigida, se leen números
+ * separados por espacios. El tablero solo se vuelve a dibujar tras un
+ * movimiento realizado, y no mientras quedan órdenes leídas por procesar.
+ *
+ * La tecla p pide una pista: la solución óptima se busca en segundo plano con
+ * el TAD ResolucionAsincrona mientras se sigue leyendo la entrada, se muestra
+ * el progreso de la búsqueda y, al terminar, el primer movimiento. Si el
+ * jugador mueve antes, la búsqueda se cancela.
+ *
+ * Con la opción --grabar archivo la partida se graba y, al terminar, se guarda
+ * como repetición binaria (TAD Repeticion) para verificarla más tarde.
+ *
+ * Con la opción --script [archivo] no hay interfaz: se leen de una vez todos los
+ * movimientos del archivo (o de la entrada estándar), se aplican sin dibujar el
+ * tablero y solo se muestran el estado final y las estadísticas. El programa
+ * devuelve 0 si el puzzle queda resuelto y 2 si no, para usarlo en pruebas
+ * automáticas. --nivel archivo cambia el archivo de configuración.
+ *
+ * Con la opción --tutorial N se juega el nivel de aprendizaje N (TAD
+ * NivelesIntegrados), que viene dentro del programa y se ha comprobado al
+ * compilar, en lugar del archivo de configuración.
+ *
+ * Si se compila con -DBALLSORT_INSTRUMENTACION, --metricas archivo guarda al
+ * salir los contadores y latencias del TAD Instrumentacion en formato Prometheus.
  */
 
 #include "Juego.h"
+#include "ResolucionAsincrona.h"
+#include "Repeticion.h"
+#include "EntradaTeclado.h"
+#include "Instrumentacion.h"
+#include "NivelesIntegrados.h"
+#include <chrono>
+#include <cstdio>
 #include <iostream>
 #include <string>
 #include <cstdlib>
-#include <cctype>
 
 // Incluir las implementaciones directamente para evitar errores de "undefined reference"
 #include "Pila.cpp"
 #include "Tablero.cpp"
 #include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ResolucionAsincrona.cpp"
+#include "Repeticion.cpp"
+#include "EntradaTeclado.cpp"
+#include "Instrumentacion.cpp"
+#include "NivelesIntegrados.cpp"
+
+// Milisegundos de espera de la entrada mientras se busca una pista
+const int ESPERA_PISTA_MS = 200;
 
 // Definiciones para los colores en la consola (para Windows)
 #define COLOR_RESET "\033[0m"
@@ -36,29 +81,60 @@
 #define COLOR_CYAN "\033[36m"
 #define COLOR_WHITE "\033[37m"
 
+/**
+ * @brief Devuelve el código de color de consola de una bola
+ * @param color - Carácter del color
+ * @return const char* - Secuencia de escape del color (vacía si no tiene)
+ */
+const char *codigoColor(char color)
+{
+    switch (color)
+    {
+    case 'R':
+        return COLOR_RED;
+    case 'G':
+        return COLOR_GREEN;
+    case 'B':
+        return COLOR_BLUE;
+    case 'Y':
+        return COLOR_YELLOW;
+    case 'M':
+        return COLOR_MAGENTA;
+    case 'C':
+        return COLOR_CYAN;
+    default:
+        return "";
+    }
+}
+
 /**
  * @brief Muestra el estado actual del tablero en la consola
  * @param juego - Referencia al objeto Juego
+ *
+ * El tablero se compone en una cadena y se escribe de una vez, para que cada
+ * dibujo sea una sola escritura en la consola.
  */
 void mostrarTablero(const Juego &juego)
 {
+    INSTRUMENTAR_MEDIR(MEDIDA_DIBUJO);
     const Tablero &tablero = juego.getTablero();
     int numPilas = tablero.getNumPilas();
+    std::string salida;
 
-    std::cout << "\n+----------------------------+" << std::endl;
+    salida += "\n+----------------------------+\n";
 
     // Mostrar números de tubo en la parte superior
-    std::cout << "| ";
+    salida += "| ";
     for (int i = 0; i < numPilas; i++)
     {
-        std::cout << " " << i + 1 << "  ";
+        salida += " " + std::to_string(i + 1) + "  ";
     }
-    std::cout << " |" << std::endl;
+    salida += " |\n";
 
     // Mostrar contenido de los tubos
     for (int fila = 3; fila >= 0; fila--)
     {
-        std::cout << "| ";
+        salida += "| ";
 
         for (int pila = 0; pila < numPilas; pila++)
         {
@@ -67,71 +143,58 @@ void mostrarTablero(const Juego &juego)
             if (p.numElementos() > fila)
             {
                 char color = p.getElemento(fila);
-
-                // Asignar color según el carácter
-                switch (color)
-                {
-                case 'R':
-                    std::cout << COLOR_RED;
-                    break;
-                case 'G':
-                    std::cout << COLOR_GREEN;
-                    break;
-                case 'B':
-                    std::cout << COLOR_BLUE;
-                    break;
-                case 'Y':
-                    std::cout << COLOR_YELLOW;
-                    break;
-                case 'M':
-                    std::cout << COLOR_MAGENTA;
-                    break;
-                case 'C':
-                    std::cout << COLOR_CYAN;
-                    break;
-                default:
-                    break;
-                }
-
-                std::cout << " " << color << " " << COLOR_RESET;
+                salida += codigoColor(color);
+                salida += ' ';
+                salida += color;
+                salida += " " COLOR_RESET;
             }
             else
             {
-                std::cout << " . ";
+                salida += " . ";
             }
 
-            std::cout << " ";
+            salida += ' ';
         }
 
-        std::cout << " |" << std::endl;
+        salida += " |\n";
     }
 
     // Mostrar base de los tubos
-    std::cout << "| ";
+    salida += "| ";
     for (int i = 0; i < numPilas; i++)
     {
-        std::cout << "=== ";
+        salida += "=== ";
     }
-    std::cout << " |" << std::endl;
+    salida += " |\n";
 
-    std::cout << "+----------------------------+" << std::endl;
-    std::cout << "Movimientos: " << juego.getNumMovimientos() << std::endl;
+    salida += "+----------------------------+\n";
+    salida += "Movimientos: " + std::to_string(juego.getNumMovimientos()) + "\n";
+    std::cout << salida << std::flush;
 }
 
 /**
  * @brief Muestra las instrucciones del juego
+ * @param interactiva - true si se juega pulsando teclas, false si la entrada está redirigida
  */
-void mostrarInstrucciones()
+void mostrarInstrucciones(bool interactiva)
 {
     std::cout << "\n============= BALL SORT PUZZLE =============\n"
               << std::endl;
     std::cout << "El objetivo del juego es ordenar las bolas de colores" << std::endl;
     std::cout << "para que cada tubo contenga bolas de un solo color." << std::endl;
     std::cout << "\nInstrucciones:" << std::endl;
-    std::cout << "- Ingresa el número del tubo origen y destino (1-N)" << std::endl;
+    if (interactiva)
+    {
+        std::cout << "- Pulsa la tecla del tubo origen y después la del destino (1-9, 0 = tubo 10)" << std::endl;
+        std::cout << "- Pulsa otra vez el tubo origen para cancelar la selección" << std::endl;
+    }
+    else
+    {
+        std::cout << "- Escribe el número del tubo origen y destino (1-N)" << std::endl;
+    }
     std::cout << "- Solo puedes mover bolas si son del mismo color que la cima del tubo destino" << std::endl;
     std::cout << "  o si el tubo destino está vacío" << std::endl;
-    std::cout << "- Para salir del juego, escribe 'q'" << std::endl;
+    std::cout << "- Para salir del juego, " << (interactiva ? "pulsa 'q' o Esc" : "escribe 'q'") << std::endl;
     std::cout << "\n===========================================\n"
               << std::endl;
 }
@@ -153,23 +216,387 @@ void mostrarFinJuego(bool victoria, int numMovimientos)
     }
 }
 
+/**
+ * @brief Devuelve el mensaje de un movimiento rechazado
+ * @param resultado - Motivo del rechazo
+ * @return const char* - Mensaje para el jugador
+ */
+const char *mensajeRechazo(ResultadoMovimiento resultado)
+{
+    switch (resultado)
+    {
+    case MOVIMIENTO_INDICE_NO_VALIDO:
+        return "Ese tubo no existe.";
+    case MOVIMIENTO_MISMO_TUBO:
+        return "El origen y el destino son el mismo tubo.";
+    case MOVIMIENTO_ORIGEN_VACIO:
+        return "El tubo origen está vacío.";
+    case MOVIMIENTO_DESTINO_LLENO:
+        return "El tubo destino está lleno.";
+    case MOVIMIENTO_COLOR_DISTINTO:
+        return "La bola no es del color de la cima del tubo destino.";
+    case MOVIMIENTO_JUEGO_TERMINADO:
+        return "La partida ha terminado.";
+    default:
+        return "Movimiento no válido.";
+    }
+}
+
+/**
+ * @brief Muestra el progreso o el resultado de la pista pedida, sin bloquearse
+ * @param pista - Resolución en segundo plano de la pista
+ * @param progresoMostrado - Nodos expandidos del último progreso mostrado
+ * @return bool - true si la pista ha terminado y se ha mostrado
+ */
+bool atenderPista(const ResolucionAsincrona &pista, long long &progresoMostrado)
+{
+    if (pista.getEstado() == RESOLUCION_EN_CURSO)
+    {
+        ProgresoResolucion progreso = pista.getProgreso();
+        if (progreso.nodosExpandidos != progresoMostrado)
+        {
+            progresoMostrado = progreso.nodosExpandidos;
+            std::cout << "\rBuscando pista: profundidad " << progreso.profundidad << ", al menos " << progreso.cota
+                      << " movimientos, " << progreso.nodosExpandidos << " nodos " << std::flush;
+        }
+        return false;
+    }
+
+    ResultadoResolucion resultado;
+    if (!pista.obtenerResultado(resultado))
+    {
+        return false;
+    }
+    if (resultado.resuelto && !resultado.movimientos.empty())
+    {
+        std::cout << "\nPista: mueve del tubo " << resultado.movimientos[0].origen + 1 << " al tubo "
+                  << resultado.movimientos[0].destino + 1 << " (solución en " << resultado.movimientos.size()
+                  << " movimientos)." << std::endl;
+    }
+    else
+    {
+        std::cout << "\nNo se ha encontrado ninguna solución desde esta posición." << std::endl;
+    }
+    return true;
+}
+
+/**
+ * @brief Guarda la partida grabada, si la hay
+ * @param juego - Juego con la grabación
+ * @param archivoRepeticion - Ruta de la repetición (vacía = no se graba)
+ */
+void guardarRepeticion(const Juego &juego, const std::string &archivoRepeticion)
+{
+    if (archivoRepeticion.empty())
+    {
+        return;
+    }
+
+    Repeticion repeticion;
+    if (repeticion.desdeJuego(juego) && repeticion.guardar(archivoRepeticion))
+    {
+        std::cout << "Partida guardada en: " << archivoRepeticion << std::endl;
+    }
+    else
+    {
+        std::cerr << "Error: No se pudo guardar la partida en " << archivoRepeticion << std::endl;
+    }
+}
+
+/**
+ * @brief Guarda las métricas de la instrumentación, si se han pedido
+ * @param archivoMetricas - Ruta del archivo de Prometheus (vacía = no se guardan)
+ */
+void guardarMetricas(const std::string &archivoMetricas)
+{
+    if (archivoMetricas.empty())
+    {
+        return;
+    }
+
+    if (!Instrumentacion::ACTIVA)
+    {
+        std::cerr << "Aviso: El juego se compiló sin -DBALLSORT_INSTRUMENTACION; las métricas están a cero"
+                  << std::endl;
+    }
+    if (!Instrumentacion::guardarPrometheus(archivoMetricas))
+    {
+        std::cerr << "Error: No se pudieron guardar las métricas en " << archivoMetricas << std::endl;
+    }
+}
+
+/**
+ * @brief Resultado de aplicar un guion de movimientos
+ */
+struct ResultadoGuion
+{
+    int leidos;                              // Movimientos leídos (pares origen destino)
+    int realizados;                          // Movimientos aceptados por el juego
+    int rechazados;                          // Movimientos no válidos según las reglas
+    int primerRechazado;                     // Posición (desde 1) del primer rechazado, 0 si no hay
+    ResultadoMovimiento motivoPrimerRechazo; // Motivo del primer movimiento rechazado
+    int noValidas;                           // Palabras que no son números de tubo
+};
+
+/**
+ * @brief Lee un archivo completo (o la entrada estándar) en memoria
+ * @param archivo - Ruta del archivo ("" o "-" = entrada estándar)
+ * @param texto - Cadena donde se deja el contenido
+ * @return bool - false si no se pudo abrir o leer el archivo
+ */
+bool leerGuion(const std::string &archivo, std::string &texto)
+{
+    bool estandar = archivo.empty() || archivo == "-";
+    FILE *entrada = estandar ? stdin : std::fopen(archivo.c_str(), "rb");
+    if (entrada == nullptr)
+    {
+        return false;
+    }
+
+    char bloque[1 << 16];
+    size_t leidos;
+    while ((leidos = std::fread(bloque, 1, sizeof(bloque), entrada)) > 0)
+    {
+        texto.append(bloque, leidos);
+    }
+    bool correcto = !std::ferror(entrada); // fread devuelve 0 tanto al final como ante un error
+    if (!estandar)
+    {
+        std::fclose(entrada);
+    }
+    return correcto;
+}
+
+/**
+ * @brief Aplica de una vez todos los movimientos de un guion, sin dibujar nada
+ * @param juego - Juego sobre el que se aplican
+ * @param texto - Números de tubo (desde 1) separados por espacios; 'q' termina el guion
+ * @return ResultadoGuion - Movimientos aplicados, rechazados y entradas no válidas
+ */
+ResultadoGuion ejecutarGuion(Juego &juego, const std::string &texto)
+{
+    ResultadoGuion resultado = {0, 0, 0, 0, MOVIMIENTO_VALIDO, 0};
+    const char *actual = texto.data();
+    const char *final = actual + texto.size();
+    int origen = -1;
+
+    while (actual < final)
+    {
+        if (*actual == ' ' || *actual == '\t' || *actual == '\n' || *actual == '\r')
+        {
+            actual++;
+            continue;
+        }
+        const char *palabra = actual;
+        while (actual < final && *actual != ' ' && *actual != '\t' && *actual != '\n' && *actual != '\r')
+        {
+            actual++;
+        }
+
+        EventoEntrada evento = EntradaTeclado::interpretarPalabra(palabra, (int)(actual - palabra));
+        if (evento.tipo == EVENTO_SALIR)
+        {
+            break;
+        }
+        if (evento.tipo != EVENTO_TUBO)
+        {
+            resultado.noValidas++;
+            continue;
+        }
+        if (origen < 0)
+        {
+            origen = evento.tubo;
+            continue;
+        }
+
+        resultado.leidos++;
+        ResultadoMovimiento motivo;
+        if (juego.realizarMovimiento(origen, evento.tubo, motivo))
+        {
+            resultado.realizados++;
+        }
+        else
+        {
+            resultado.rechazados++;
+            if (resultado.primerRechazado == 0)
+            {
+                resultado.primerRechazado = resultado.leidos;
+                resultado.motivoPrimerRechazo = motivo;
+            }
+        }
+        origen = -1;
+    }
+
+    // Un origen sin destino al final del guion no es un movimiento
+    if (origen >= 0)
+    {
+        resultado.noValidas++;
+    }
+    return resultado;
+}
+
+/**
+ * @brief Inicia el juego con un nivel de aprendizaje
+ * @param juego - Juego a inicializar
+ * @param numero - Número del nivel integrado (desde 1)
+ * @return bool - true si el nivel se cargó
+ */
+bool cargarTutorial(Juego &juego, int numero)
+{
+    Tablero tablero;
+    return NivelesIntegrados::cargarNivel(numero - 1, tablero) && juego.inicializar(tablero);
+}
+
+/**
+ * @brief Muestra el estado final y las estadísticas de un guion
+ * @param juego - Juego tras aplicar el guion
+ * @param resultado - Resultado del guion
+ * @param milisegundos - Tiempo empleado en aplicarlo
+ */
+void mostrarResultadoGuion(const Juego &juego, const ResultadoGuion &resultado, double milisegundos)
+{
+    const Tablero &tablero = juego.getTablero();
+    std::string estado;
+    for (int pila = 0; pila < tablero.getNumPilas(); pila++)
+    {
+        if (pila > 0)
+        {
+            estado += '.';
+        }
+        const Pila &p = tablero.getPila(pila);
+        if (p.estaVacia())
+        {
+            estado += '-';
+        }
+        for (int posicion = 0; posicion < p.numElementos(); posicion++)
+        {
+            estado += p.getElemento(posicion);
+        }
+    }
+
+    std::cout << "Movimientos leídos: " << resultado.leidos << "\n";
+    std::cout << "Movimientos realizados: " << resultado.realizados << "\n";
+    std::cout << "Movimientos no válidos: " << resultado.rechazados;
+    if (resultado.primerRechazado > 0)
+    {
+        std::cout << " (el primero es el " << resultado.primerRechazado << ": "
+                  << mensajeRechazo(resultado.motivoPrimerRechazo) << ")";
+    }
+    std::cout << "\n";
+    std::cout << "Entradas no válidas: " << resultado.noValidas << "\n";
+    std::cout << "Estado final: " << estado << "\n";
+    std::cout << "Resuelto: " << (juego.juegoTerminado() ? "sí" : "no") << "\n";
+    std::cout << "Tiempo: " << milisegundos << " ms" << std::endl;
+}
+
 /**
  * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
  * @return int - Estado de salida del programa
  */
-int main()
+int main(int argc, char *argv[])
 {
+    // Archivo donde guardar la repetición de la partida (--grabar archivo), guion de
+    // movimientos (--script [archivo], "-" o nada = entrada estándar) y nivel (--nivel archivo
+    // o --tutorial N para un nivel integrado)
+    std::string archivoRepeticion;
+    std::string archivoGuion;
+    std::string archivoNivel = "ballSort.cnf";
+    std::string archivoMetricas;
+    int tutorial = 0;
+    bool modoGuion = false;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--grabar" && i + 1 < argc)
+        {
+            archivoRepeticion = argv[++i];
+        }
+        else if (opcion == "--nivel" && i + 1 < argc)
+        {
+            archivoNivel = argv[++i];
+        }
+        else if (opcion == "--tutorial" && i + 1 < argc)
+        {
+            tutorial = std::atoi(argv[++i]);
+            if (tutorial < 1 || tutorial > NivelesIntegrados::NUM_NIVELES)
+            {
+                std::cerr << "Error: El nivel de aprendizaje debe estar entre 1 y " << NivelesIntegrados::NUM_NIVELES
+                          << std::endl;
+                return 1;
+            }
+        }
+        else if (opcion == "--metricas" && i + 1 < argc)
+        {
+            archivoMetricas = argv[++i];
+        }
+        else if (opcion == "--script")
+        {
+            modoGuion = true;
+            if (i + 1 < argc && std::string(argv[i + 1]).compare(0, 2, "--") != 0)
+            {
+                archivoGuion = argv[++i];
+            }
+        }
+        else
+        {
+            std::cerr << "Uso: BallSortPuzzle [--grabar archivo.rep] [--nivel archivo.cnf] [--script [movimientos.txt]]"
+                      << std::endl;
+            std::cerr << "                      [--tutorial N] [--metricas archivo.prom]" << std::endl;
+            return 1;
+        }
+    }
+
+    // En modo guion se aplican todos los movimientos de una vez y solo se muestra el resultado
+    if (modoGuion)
+    {
+        Juego juego;
+        std::string texto;
+        if (tutorial > 0 ? !cargarTutorial(juego, tutorial) : !juego.inicializar(archivoNivel))
+        {
+            std::cerr << "Error: No se pudo cargar el nivel "
+                      << (tutorial > 0 ? "de aprendizaje " + std::to_string(tutorial) : archivoNivel) << std::endl;
+            return 1;
+        }
+        if (!leerGuion(archivoGuion, texto))
+        {
+            std::cerr << "Error: No se pudo leer el guion " << archivoGuion << std::endl;
+            return 1;
+        }
+        juego.activarGrabacion(!archivoRepeticion.empty());
+
+        auto inicio = std::chrono::steady_clock::now();
+        ResultadoGuion resultado = ejecutarGuion(juego, texto);
+        double milisegundos =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+
+        mostrarResultadoGuion(juego, resultado, milisegundos);
+        guardarRepeticion(juego, archivoRepeticion);
+        guardarMetricas(archivoMetricas);
+        return juego.juegoTerminado() ? 0 : 2;
+    }
+
     // Lista de ubicaciones donde buscar el archivo de configuración
     const int NUM_RUTAS = 1;
     std::string rutasPosibles[NUM_RUTAS] = {
-        "ballSort.cnf" // Solo la ruta correcta en la ubicación actual
+        archivoNivel // Por defecto ballSort.cnf en la ubicación actual
     };
 
     bool configuracionCargada = false;
     Juego juego;
 
+    // Los niveles de aprendizaje no necesitan archivo
+    if (tutorial > 0 && cargarTutorial(juego, tutorial))
+    {
+        const NivelIntegrado &nivel = NivelesIntegrados::getNivel(tutorial - 1);
+        std::cout << "Nivel de aprendizaje " << tutorial << ": " << nivel.nombre << " (se puede resolver en "
+                  << nivel.movimientosOptimos << " movimientos)" << std::endl;
+        configuracionCargada = true;
+    }
+
     // Intentar cargar el archivo desde cada posible ubicación
-    for (int i = 0; i < NUM_RUTAS; i++)
+    for (int i = 0; i < NUM_RUTAS && !configuracionCargada; i++)
     {
         const std::string &ruta = rutasPosibles[i];
         std::cout << "Intentando cargar configuración desde: " << ruta << std::endl;
@@ -202,7 +629,7 @@ int main()
     if (!configuracionCargada)
     {
         std::cerr << "Error: No se pudo cargar la configuración del juego." << std::endl;
-        std::cerr << "Por favor, asegúrate de que el archivo ballSort.cnf existe en alguna de estas ubicaciones:" << std::endl;
+        std::cerr << "Por favor, asegúrate de que el archivo de configuración existe en alguna de estas ubicaciones:" << std::endl;
         for (int i = 0; i < NUM_RUTAS; i++)
         {
             std::cerr << " - " << rutasPosibles[i] << std::endl;
@@ -212,63 +639,128 @@ int main()
         return 1;
     }
 
-    // Mostrar instrucciones
-    mostrarInstrucciones();
+    // Preparar la entrada: pulsaciones sueltas en un terminal, palabras si está redirigida
+    EntradaTeclado entrada;
+    bool interactiva = entrada.activarModoCrudo();
 
-    // Bucle principal del juego
+    // Mostrar instrucciones
+    mostrarInstrucciones(interactiva);
+    juego.activarGrabacion(!archivoRepeticion.empty());
+    mostrarTablero(juego);
+
+    // Bucle principal del juego: el tablero solo se dibuja tras un movimiento
+    // realizado y cuando no quedan más órdenes leídas por procesar
+    int origen = -1;
+    bool pedirOrigen = true;
+    ResultadoMovimiento resultado;
+    ResolucionAsincrona pista;
+    bool esperandoPista = false; // Hay una pista pedida que aún no se ha mostrado
+    long long progresoMostrado = -1;
     while (juego.estaEnCurso())
     {
-        // Mostrar el estado actual del tablero
-        mostrarTablero(juego);
-
-        // Solicitar movimiento
-        std::cout << "Ingresa tubo origen y destino (o 'q' para salir): ";
-        std::string entrada;
-        std::cin >> entrada;
+        if (pedirOrigen && !entrada.hayPendiente())
+        {
+            std::cout << "Tubo origen ('p' para una pista, 'q' para salir): " << std::flush;
+            pedirOrigen = false;
+        }
 
-        // Comprobar si el usuario quiere salir
-        if (entrada == "q" || entrada == "Q")
+        // Mientras se busca una pista la lectura espera poco, para mostrar su progreso
+        EventoEntrada evento = entrada.leerEvento(esperandoPista ? ESPERA_PISTA_MS : -1);
+        if (esperandoPista && atenderPista(pista, progresoMostrado))
+        {
+            // La selección en curso se conserva: el evento leído puede ser su destino
+            esperandoPista = false;
+            if (evento.tipo == EVENTO_NINGUNO)
+            {
+                if (origen < 0)
+                {
+                    pedirOrigen = true;
+                }
+                else
+                {
+                    std::cout << origen + 1 << " -> destino: " << std::flush;
+                }
+            }
+        }
+        if (evento.tipo == EVENTO_SALIR || evento.tipo == EVENTO_FIN)
         {
             juego.terminarJuego();
+            entrada.restaurar();
             mostrarFinJuego(false, juego.getNumMovimientos());
             break;
         }
-
-        // Procesar movimiento
-        int origen, destino;
-
-        try
+        if (evento.tipo == EVENTO_PISTA)
         {
-            origen = std::stoi(entrada) - 1; // Restar 1 para convertir a índice base 0
-
-            std::cin >> entrada;
-            if (entrada == "q" || entrada == "Q")
+            if (pista.iniciar(juego))
             {
-                juego.terminarJuego();
-                mostrarFinJuego(false, juego.getNumMovimientos());
-                break;
+                std::cout << "\nBuscando pista; puedes seguir jugando mientras tanto." << std::endl;
+                esperandoPista = true;
+                progresoMostrado = -1;
             }
+            origen = -1;
+            pedirOrigen = true;
+            continue;
+        }
+        if (evento.tipo == EVENTO_NO_VALIDO)
+        {
+            std::cout << "\nEntrada no válida. " << (interactiva ? "Pulsa" : "Escribe")
+                      << " un número de tubo, 'p' para una pista o 'q' para salir." << std::endl;
+            origen = -1;
+            pedirOrigen = true;
+            continue;
+        }
+        if (evento.tipo != EVENTO_TUBO)
+        {
+            continue;
+        }
 
-            destino = std::stoi(entrada) - 1; // Restar 1 para convertir a índice base 0
-
-            if (!juego.realizarMovimiento(origen, destino))
+        // Primera pulsación: elegir el tubo origen
+        if (origen < 0)
+        {
+            origen = evento.tubo;
+            if (!entrada.hayPendiente())
             {
-                std::cout << "Movimiento no válido. Inténtalo de nuevo." << std::endl;
+                std::cout << origen + 1 << " -> destino: " << std::flush;
             }
+            continue;
+        }
+
+        // Segunda pulsación: el mismo tubo cancela la selección; otro intenta el movimiento
+        int destino = evento.tubo;
+        if (destino == origen)
+        {
+            std::cout << "\nSelección cancelada." << std::endl;
+        }
+        else if (!juego.realizarMovimiento(origen, destino, resultado))
+        {
+            std::cout << "\nMovimiento no válido: " << mensajeRechazo(resultado) << " Inténtalo de nuevo." << std::endl;
         }
-        catch (const std::invalid_argument &)
+        else
         {
-            std::cout << "Entrada no válida. Ingresa números o 'q' para salir." << std::endl;
+            // La pista pedida ya no sirve para la nueva posición
+            if (esperandoPista && !pista.actualizar(juego))
+            {
+                std::cout << "\nBúsqueda de pista cancelada." << std::endl;
+                esperandoPista = false;
+            }
+            if (!entrada.hayPendiente() || juego.juegoTerminado())
+            {
+                mostrarTablero(juego);
+            }
         }
+        origen = -1;
+        pedirOrigen = true;
 
         // Comprobar si el juego ha terminado
         if (juego.juegoTerminado())
         {
-            mostrarTablero(juego);
+            entrada.restaurar();
             mostrarFinJuego(true, juego.getNumMovimientos());
             break;
         }
     }
 
+    guardarRepeticion(juego, archivoRepeticion);
+    guardarMetricas(archivoMetricas);
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+/**
+ * @file BallSortPuzzlePruebas.cpp
+ * @brief Pruebas del modo guion del programa principal del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del modo --script de BallSortPuzzle.cpp. El
+ * programa se incluye con otro nombre para su función main y se ejecuta con
+ * argumentos preparados, con guiones en archivos temporales y por la entrada
+ * estándar redirigida, comprobando el código de salida y el informe del
+ * primer movimiento rechazado.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// El programa del juego, con su main renombrado para poder llamarlo desde las pruebas
+#define main mainBallSortPuzzle
+#include "BallSortPuzzle.cpp"
+#undef main
+
+/**
+ * @brief Ejecuta el programa del juego y recoge lo que escribe
+ * @param argumentos - Argumentos de la línea de órdenes, sin el nombre del programa
+ * @param salida - Texto escrito en la salida estándar
+ * @return int - Código de salida del programa
+ */
+int ejecutarJuego(const std::vector<std::string> &argumentos, std::string &salida)
+{
+    std::vector<std::string> textos = argumentos;
+    textos.insert(textos.begin(), "BallSortPuzzle");
+    std::vector<char *> argv;
+    for (std::string &texto : textos)
+    {
+        argv.push_back(&texto[0]);
+    }
+    argv.push_back(nullptr);
+
+    std::ostringstream capturada;
+    std::streambuf *anteriorSalida = std::cout.rdbuf(capturada.rdbuf());
+    std::streambuf *anteriorError = std::cerr.rdbuf(capturada.rdbuf());
+    int codigo = mainBallSortPuzzle((int)textos.size(), argv.data());
+    std::cout.rdbuf(anteriorSalida);
+    std::cerr.rdbuf(anteriorError);
+    salida = capturada.str();
+    return codigo;
+}
+
+/**
+ * @brief Escribe un guion en un archivo
+ * @param archivo - Ruta del archivo
+ * @param texto - Contenido del guion
+ */
+void escribirGuion(const std::string &archivo, const std::string &texto)
+{
+    std::ofstream guion(archivo, std::ios::binary);
+    guion << texto;
+    assert(guion.good());
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del modo guion de BallSortPuzzle..." << std::endl;
+
+    // Solución óptima del primer nivel de aprendizaje, con los tubos numerados desde 1
+    Tablero tutorial;
+    assert(NivelesIntegrados::cargarNivel(0, tutorial));
+    ResultadoResolucion optima = Resolutor().resolver(tutorial);
+    assert(optima.resuelto && !optima.movimientos.empty());
+    std::string solucion;
+    for (const Movimiento &movimiento : optima.movimientos)
+    {
+        solucion += std::to_string(movimiento.origen + 1) + " " + std::to_string(movimiento.destino + 1) + "\n";
+    }
+    const std::string archivo = "guion_pruebas.tmp";
+    std::string salida;
+
+    // Prueba 1: Guion que resuelve el nivel
+    escribirGuion(archivo, solucion);
+    assert(ejecutarJuego({"--tutorial", "1", "--script", archivo}, salida) == 0);
+    assert(salida.find("Movimientos realizados: " + std::to_string(optima.movimientos.size())) != std::string::npos);
+    assert(salida.find("Movimientos no válidos: 0\n") != std::string::npos);
+    assert(salida.find("Resuelto: sí") != std::string::npos);
+    std::cout << "Prueba 1 superada: Guion de " << optima.movimientos.size() << " movimientos con código 0"
+              << std::endl;
+
+    // Prueba 2: Guion con movimientos rechazados y entradas no válidas
+    std::string primero = solucion.substr(0, solucion.find('\n') + 1);
+    escribirGuion(archivo, "1 1\nx\n9 1\n" + primero);
+    assert(ejecutarJuego({"--tutorial", "1", "--script", archivo}, salida) == 2);
+    assert(salida.find("Movimientos no válidos: 2 (el primero es el 1: ") != std::string::npos);
+    assert(salida.find(mensajeRechazo(MOVIMIENTO_MISMO_TUBO)) != std::string::npos);
+    assert(salida.find("Entradas no válidas: 1\n") != std::string::npos);
+    std::cout << "Prueba 2 superada: Primer movimiento rechazado informado y código 2" << std::endl;
+
+    // Prueba 3: Guion sin terminar el nivel
+    escribirGuion(archivo, primero + "q\n" + solucion);
+    assert(ejecutarJuego({"--tutorial", "1", "--script", archivo}, salida) == 2);
+    assert(salida.find("Movimientos leídos: 1\n") != std::string::npos);
+    assert(salida.find("Resuelto: no") != std::string::npos);
+    std::cout << "Prueba 3 superada: 'q' termina el guion y el nivel queda sin resolver" << std::endl;
+
+    // Prueba 4: Guiones que no se pueden leer
+    std::string texto;
+    assert(!leerGuion("no_existe.tmp", texto));
+    assert(ejecutarJuego({"--tutorial", "1", "--script", "no_existe.tmp"}, salida) == 1);
+    assert(salida.find("Error: No se pudo leer el guion") != std::string::npos);
+    assert(!leerGuion(".", texto)); // Un directorio se abre pero no se puede leer (o ni se abre)
+    std::cout << "Prueba 4 superada: Guiones inexistentes o ilegibles" << std::endl;
+
+    // Prueba 5: Guion por la entrada estándar redirigida
+    escribirGuion(archivo, solucion);
+    assert(std::freopen(archivo.c_str(), "rb", stdin) != nullptr);
+    assert(ejecutarJuego({"--tutorial", "1", "--script"}, salida) == 0);
+    assert(salida.find("Resuelto: sí") != std::string::npos);
+    std::remove(archivo.c_str());
+    std::cout << "Prueba 5 superada: Guion leído de la entrada estándar" << std::endl;
+
+    std::cout << "¡Todas las pruebas del modo guion de BallSortPuzzle han sido superadas!" << std::endl;
+    return 0;
+}
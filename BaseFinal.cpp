@@ -0,0 +1,234 @@
+/**
+ * @file BaseFinal.cpp
+ * @brief Implementación del TAD BaseFinal para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD BaseFinal
+ * (BaseFinal.h). El predecesor de una posición se obtiene deshaciendo un
+ * movimiento: la bola x de la cima de b pudo llegar desde otra pila a si b
+ * tenía solo esa bola o si debajo de ella hay otra bola x, y a no está llena.
+ *
+ * Metadatos de la tabla: [0] número de pilas, [1] y [2] tubos por color
+ * (parte baja y alta), [3] profundidad K.
+ */
+
+#include "BaseFinal.h"
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+BaseFinal::BaseFinal()
+{
+    numPilas = 0;
+    tubosPorColor = 0;
+    profundidad = -1;
+}
+
+/**
+ * Calcula la forma de un estado
+ * @param estado - Estado a analizar
+ * @param tubosPorColor - Tubos completos que suma cada color (4 bits por color)
+ * @return bool - false si algún color no completa un número entero de tubos
+ * @complexity O(n) donde n es el número de bolas
+ */
+bool BaseFinal::calcularForma(const EstadoCompacto &estado, uint64_t &tubosPorColor)
+{
+    int bolasPorColor[EstadoCompacto::MAX_COLORES + 1] = {0};
+    for (int pila = 0; pila < estado.getNumPilas(); pila++)
+    {
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            bolasPorColor[estado.getBola(pila, posicion)]++;
+        }
+    }
+
+    tubosPorColor = 0;
+    for (int color = 1; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        int tubos = bolasPorColor[color] / Pila::CAPACIDAD_MAXIMA;
+        if (bolasPorColor[color] % Pila::CAPACIDAD_MAXIMA != 0 || tubos > 15)
+        {
+            return false;
+        }
+        tubosPorColor |= (uint64_t)tubos << (4 * (color - 1));
+    }
+    return true;
+}
+
+/**
+ * Construye la base por análisis retrógrado
+ * @param numPilas - Número de tubos del tablero
+ * @param colores - Una letra por tubo completo en la posición resuelta
+ * @param profundidad - Distancia máxima K
+ * @param progreso - Salida opcional de progreso
+ * @return bool - true si la construcción fue correcta
+ * @complexity O(S) donde S es el número de posiciones a distancia <= K
+ */
+bool BaseFinal::construir(int numPilas, const std::string &colores, int profundidad, std::ostream *progreso)
+{
+    if (numPilas < 2 || numPilas > Tablero::MAX_PILAS || (int)colores.length() > numPilas ||
+        profundidad < 0 || profundidad > 254)
+    {
+        return false;
+    }
+
+    // Posición resuelta: un tubo completo por cada letra
+    Tablero resuelto;
+    resuelto.inicializar(numPilas);
+    for (size_t i = 0; i < colores.length(); i++)
+    {
+        for (int j = 0; j < Pila::CAPACIDAD_MAXIMA; j++)
+        {
+            resuelto.colocarBola((int)i, colores[i]);
+        }
+    }
+    EstadoCompacto meta;
+    if (!meta.desdeTablero(resuelto) || !calcularForma(meta, tubosPorColor))
+    {
+        return false;
+    }
+    meta = meta.canonico();
+
+    // Búsqueda en anchura hacia atrás sobre posiciones canónicas
+    std::unordered_map<EstadoCompacto, uint8_t, HashEstadoCompacto> distancias;
+    distancias[meta] = 0;
+    std::vector<EstadoCompacto> frontera(1, meta);
+    for (int d = 1; d <= profundidad && !frontera.empty(); d++)
+    {
+        std::vector<EstadoCompacto> siguiente;
+        for (const EstadoCompacto &estado : frontera)
+        {
+            for (int b = 0; b < numPilas; b++)
+            {
+                int alturaB = estado.getAltura(b);
+                if (alturaB == 0)
+                {
+                    continue;
+                }
+                int bola = estado.getBola(b, alturaB - 1);
+                if (alturaB >= 2 && estado.getBola(b, alturaB - 2) != bola)
+                {
+                    continue;
+                }
+
+                bool vaciaProbada = false;
+                for (int a = 0; a < numPilas; a++)
+                {
+                    int alturaA = estado.getAltura(a);
+                    if (a == b || alturaA == Pila::CAPACIDAD_MAXIMA || (alturaA == 0 && vaciaProbada))
+                    {
+                        continue;
+                    }
+                    vaciaProbada = vaciaProbada || alturaA == 0;
+
+                    EstadoCompacto predecesor = estado;
+                    predecesor.trasladarBola(b, a);
+                    predecesor = predecesor.canonico();
+                    if (distancias.emplace(predecesor, (uint8_t)d).second)
+                    {
+                        siguiente.push_back(predecesor);
+                    }
+                }
+            }
+        }
+        frontera.swap(siguiente);
+        if (progreso != nullptr)
+        {
+            *progreso << "Distancia " << d << ": " << frontera.size() << " posiciones" << std::endl;
+        }
+    }
+
+    std::vector<std::pair<EstadoCompacto, uint8_t>> entradas(distancias.begin(), distancias.end());
+    distancias.clear();
+
+    uint32_t metadatos[TablaPerfecta::NUM_METADATOS] = {
+        (uint32_t)numPilas, (uint32_t)tubosPorColor, (uint32_t)(tubosPorColor >> 32), (uint32_t)profundidad};
+    if (!tabla.construir(entradas, metadatos))
+    {
+        return false;
+    }
+
+    this->numPilas = numPilas;
+    this->profundidad = profundidad;
+    return true;
+}
+
+/**
+ * Guarda la base en un archivo
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si se pudo escribir
+ * @complexity O(S)
+ */
+bool BaseFinal::guardar(const std::string &nombreArchivo) const
+{
+    return tabla.guardar(nombreArchivo);
+}
+
+/**
+ * Carga una base de un archivo proyectándolo en memoria
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si el archivo es una base válida
+ * @complexity O(1)
+ */
+bool BaseFinal::cargar(const std::string &nombreArchivo)
+{
+    if (!tabla.cargar(nombreArchivo) || tabla.getMetadato(3) > 254)
+    {
+        numPilas = 0;
+        profundidad = -1;
+        return false;
+    }
+
+    numPilas = (int)tabla.getMetadato(0);
+    tubosPorColor = (uint64_t)tabla.getMetadato(1) | ((uint64_t)tabla.getMetadato(2) << 32);
+    profundidad = (int)tabla.getMetadato(3);
+    return true;
+}
+
+/**
+ * Comprueba si la base corresponde a la forma de un estado
+ * @param estado - Estado a comprobar
+ * @return bool - true si las distancias de la base son válidas para el estado
+ * @complexity O(n) donde n es el número de bolas
+ */
+bool BaseFinal::esAplicable(const EstadoCompacto &estado) const
+{
+    uint64_t forma;
+    return tabla.estaLista() && estado.getNumPilas() == numPilas && calcularForma(estado, forma) &&
+           forma == tubosPorColor;
+}
+
+/**
+ * Obtiene la distancia exacta de un estado a la solución
+ * @param estado - Estado a consultar
+ * @return int - Distancia a la solución o -1 si es mayor que K
+ * @complexity O(n^2) donde n es el número de pilas
+ */
+int BaseFinal::distancia(const EstadoCompacto &estado) const
+{
+    return tabla.buscar(estado.canonico());
+}
+
+/**
+ * Obtiene la profundidad K de la base
+ * @return int - Distancia máxima almacenada
+ * @complexity O(1)
+ */
+int BaseFinal::getProfundidad() const
+{
+    return profundidad;
+}
+
+/**
+ * Obtiene el número de posiciones almacenadas
+ * @return uint64_t - Número de posiciones canónicas
+ * @complexity O(1)
+ */
+uint64_t BaseFinal::getNumPosiciones() const
+{
+    return tabla.getNumClaves();
+}
@@ -0,0 +1,122 @@
+/**
+ * @file BaseFinal.h
+ * @brief TAD BaseFinal para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) BaseFinal, una base de
+ * datos de finales: para una forma de tablero (número de tubos y colores) guarda
+ * la distancia exacta a la solución de todas las posiciones que están a K
+ * movimientos o menos de estar resueltas.
+ *
+ * La base se construye por análisis retrógrado: una búsqueda en anchura hacia
+ * atrás (movimientos inversos) desde la configuración resuelta. Como el orden de
+ * los tubos no afecta a la distancia, todas las posiciones se guardan en forma
+ * canónica y la configuración resuelta es una sola. El resultado se almacena en
+ * una TablaPerfecta, que se puede guardar en disco y proyectar en memoria.
+ */
+
+#ifndef BASE_FINAL_H
+#define BASE_FINAL_H
+
+#include "TablaPerfecta.h"
+#include <ostream>
+#include <string>
+
+/**
+ * @brief TAD BaseFinal con las distancias exactas de las posiciones cercanas a la solución
+ */
+class BaseFinal
+{
+private:
+    TablaPerfecta tabla;
+    int numPilas;          // Número de tubos de la forma
+    uint64_t tubosPorColor; // 4 bits por color: número de tubos completos de ese color
+    int profundidad;       // Distancia máxima almacenada (K)
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea una base vacía que no es aplicable a ningún tablero
+     * @complexity O(1)
+     */
+    BaseFinal();
+
+    /**
+     * @brief Construye la base por análisis retrógrado
+     * @pre 2 <= numPilas <= Tablero::MAX_PILAS, cada letra de colores es un tubo
+     *      completo de ese color y hay al menos tantos tubos como letras
+     * @post La base contiene la distancia de todas las posiciones a K movimientos o menos
+     * @param numPilas - Número de tubos del tablero
+     * @param colores - Una letra por tubo completo en la posición resuelta
+     * @param profundidad - Distancia máxima K
+     * @param progreso - Salida opcional de progreso (nullptr = sin salida)
+     * @return bool - true si la construcción fue correcta
+     * @complexity O(S) donde S es el número de posiciones a distancia <= K
+     */
+    bool construir(int numPilas, const std::string &colores, int profundidad, std::ostream *progreso = nullptr);
+
+    /**
+     * @brief Guarda la base en un archivo
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si se pudo escribir
+     * @complexity O(S)
+     */
+    bool guardar(const std::string &nombreArchivo) const;
+
+    /**
+     * @brief Carga una base de un archivo proyectándolo en memoria
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si el archivo es una base válida
+     * @complexity O(1)
+     */
+    bool cargar(const std::string &nombreArchivo);
+
+    /**
+     * @brief Comprueba si la base corresponde a la forma de un estado
+     * @pre No hay precondiciones
+     * @post Devuelve true si el estado tiene el mismo número de tubos y colores
+     * @param estado - Estado a comprobar
+     * @return bool - true si las distancias de la base son válidas para el estado
+     * @complexity O(n) donde n es el número de bolas
+     */
+    bool esAplicable(const EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene la distancia exacta de un estado a la solución
+     * @pre La base es aplicable al estado
+     * @post Devuelve la distancia, o -1 si es mayor que la profundidad de la base
+     * @param estado - Estado a consultar (no es necesario que sea canónico)
+     * @return int - Distancia a la solución o -1
+     * @complexity O(n^2) donde n es el número de pilas (por la forma canónica)
+     */
+    int distancia(const EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene la profundidad K de la base
+     * @return int - Distancia máxima almacenada (-1 si la base está vacía)
+     * @complexity O(1)
+     */
+    int getProfundidad() const;
+
+    /**
+     * @brief Obtiene el número de posiciones almacenadas
+     * @return uint64_t - Número de posiciones canónicas
+     * @complexity O(1)
+     */
+    uint64_t getNumPosiciones() const;
+
+    /**
+     * @brief Calcula la forma de un estado
+     * @pre No hay precondiciones
+     * @post tubosPorColor guarda, en 4 bits por color, cuántos tubos completos suma ese color
+     * @param estado - Estado a analizar
+     * @param tubosPorColor - Resultado
+     * @return bool - false si algún color no tiene un número de bolas múltiplo de la capacidad
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static bool calcularForma(const EstadoCompacto &estado, uint64_t &tubosPorColor);
+};
+
+#endif // BASE_FINAL_H
@@ -0,0 +1,325 @@
+/**
+ * @file BasePatrones.cpp
+ * @brief Implementación del TAD BasePatrones para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD BasePatrones
+ * (BasePatrones.h). El comodín es el primer índice de color que no pertenece
+ * al patrón. La construcción procesa las distancias por niveles: cada nivel se
+ * cierra con los movimientos inversos de comodines (coste 0) y el siguiente se
+ * siembra con los movimientos inversos de bolas del patrón (coste 1).
+ *
+ * Metadatos de la tabla: [0] número de pilas | tubos comodín << 8 |
+ * completa << 16, [1] máscara del patrón, [2] distancia máxima, [3] marca.
+ */
+
+#include "BasePatrones.h"
+#include <unordered_map>
+#include <vector>
+
+static const uint32_t MARCA_PATRONES = 0x50444231; // Distingue estas tablas de las de BaseFinal
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+BasePatrones::BasePatrones()
+{
+    numPilas = 0;
+    tubosComodin = 0;
+    mascara = 0;
+    distanciaMaxima = -1;
+    completa = false;
+    prepararMapa();
+}
+
+/**
+ * Calcula la abstracción de cada color: los del patrón se conservan y el resto
+ * pasan a ser el comodín
+ */
+void BasePatrones::prepararMapa()
+{
+    comodin = 1;
+    while (comodin < EstadoCompacto::MAX_COLORES && (mascara & (1u << comodin)) != 0)
+    {
+        comodin++;
+    }
+
+    mapa[0] = 0;
+    for (int color = 1; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        mapa[color] = (mascara & (1u << color)) != 0 ? color : comodin;
+    }
+}
+
+/**
+ * Construye la base con una búsqueda hacia atrás 0-1
+ * @param numPilas - Número de tubos del tablero
+ * @param patron - Colores del patrón
+ * @param tubosComodin - Tubos completos del resto de colores
+ * @param maxPosiciones - Posiciones máximas a calcular
+ * @param progreso - Salida opcional de progreso
+ * @return bool - true si la construcción fue correcta
+ * @complexity O(S) donde S es el número de posiciones abstractas calculadas
+ */
+bool BasePatrones::construir(int numPilas, const std::string &patron, int tubosComodin, long long maxPosiciones,
+                             std::ostream *progreso)
+{
+    if (numPilas < 2 || numPilas > Tablero::MAX_PILAS || tubosComodin < 0 || patron.empty() ||
+        (int)patron.length() + tubosComodin > numPilas || (int)patron.length() >= EstadoCompacto::MAX_COLORES)
+    {
+        return false;
+    }
+
+    mascara = 0;
+    for (char letra : patron)
+    {
+        int indice = EstadoCompacto::indiceColor(letra);
+        if (indice == 0 || (mascara & (1u << indice)) != 0)
+        {
+            return false;
+        }
+        mascara |= 1u << indice;
+    }
+    prepararMapa();
+
+    // Posición abstracta resuelta: un tubo por color del patrón y los tubos comodín
+    Tablero resuelto;
+    resuelto.inicializar(numPilas);
+    for (int i = 0; i < (int)patron.length() + tubosComodin; i++)
+    {
+        char color = i < (int)patron.length() ? patron[i] : EstadoCompacto::colorIndice(comodin);
+        for (int j = 0; j < Pila::CAPACIDAD_MAXIMA; j++)
+        {
+            resuelto.colocarBola(i, color);
+        }
+    }
+    EstadoCompacto meta;
+    meta.desdeTablero(resuelto);
+    meta = meta.canonico();
+
+    std::unordered_map<EstadoCompacto, uint8_t, HashEstadoCompacto> distancias;
+    distancias[meta] = 0;
+    std::vector<EstadoCompacto> nivel(1, meta);
+    int d = 0;
+    completa = false;
+
+    // Añade los predecesores de un estado cuya bola movida es (o no es) un comodín
+    auto expandir = [&](const EstadoCompacto &estado, bool movimientoComodin, uint8_t distancia,
+                        std::vector<EstadoCompacto> &destinos)
+    {
+        for (int b = 0; b < numPilas; b++)
+        {
+            int alturaB = estado.getAltura(b);
+            if (alturaB == 0)
+            {
+                continue;
+            }
+            int bola = estado.getBola(b, alturaB - 1);
+            if ((bola == comodin) != movimientoComodin || (alturaB >= 2 && estado.getBola(b, alturaB - 2) != bola))
+            {
+                continue;
+            }
+
+            bool vaciaProbada = false;
+            for (int a = 0; a < numPilas; a++)
+            {
+                int alturaA = estado.getAltura(a);
+                if (a == b || alturaA == Pila::CAPACIDAD_MAXIMA || (alturaA == 0 && vaciaProbada))
+                {
+                    continue;
+                }
+                vaciaProbada = vaciaProbada || alturaA == 0;
+
+                EstadoCompacto predecesor = estado;
+                predecesor.trasladarBola(b, a);
+                predecesor = predecesor.canonico();
+                if (distancias.emplace(predecesor, distancia).second)
+                {
+                    destinos.push_back(predecesor);
+                }
+            }
+        }
+    };
+
+    while (true)
+    {
+        // Cerrar el nivel con movimientos de comodines (coste 0)
+        for (size_t i = 0; i < nivel.size(); i++)
+        {
+            EstadoCompacto estado = nivel[i];
+            expandir(estado, true, (uint8_t)d, nivel);
+        }
+
+        // Sembrar el siguiente nivel con movimientos de bolas del patrón (coste 1)
+        std::vector<EstadoCompacto> siguiente;
+        for (const EstadoCompacto &estado : nivel)
+        {
+            expandir(estado, false, (uint8_t)(d + 1), siguiente);
+        }
+
+        if (progreso != nullptr)
+        {
+            *progreso << "Distancia " << d << ": " << nivel.size() << " posiciones" << std::endl;
+        }
+
+        if (siguiente.empty())
+        {
+            distanciaMaxima = d;
+            completa = true;
+            break;
+        }
+        if ((long long)distancias.size() >= maxPosiciones || d + 1 >= 254)
+        {
+            // El nivel d + 1 queda a medias: sus posiciones guardadas son exactas,
+            // pero de las que faltan solo se sabe que están a más de d
+            distanciaMaxima = d;
+            break;
+        }
+
+        nivel.swap(siguiente);
+        d++;
+    }
+
+    std::vector<std::pair<EstadoCompacto, uint8_t>> entradas(distancias.begin(), distancias.end());
+    distancias.clear();
+
+    uint32_t metadatos[TablaPerfecta::NUM_METADATOS] = {
+        (uint32_t)numPilas | ((uint32_t)tubosComodin << 8) | ((completa ? 1u : 0u) << 16), mascara,
+        (uint32_t)distanciaMaxima, MARCA_PATRONES};
+    if (!tabla.construir(entradas, metadatos))
+    {
+        return false;
+    }
+
+    this->numPilas = numPilas;
+    this->tubosComodin = tubosComodin;
+    return true;
+}
+
+/**
+ * Guarda la base en un archivo
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si se pudo escribir
+ * @complexity O(S)
+ */
+bool BasePatrones::guardar(const std::string &nombreArchivo) const
+{
+    return tabla.guardar(nombreArchivo);
+}
+
+/**
+ * Carga una base de un archivo proyectándolo en memoria
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si el archivo es una base de patrones válida
+ * @complexity O(1)
+ */
+bool BasePatrones::cargar(const std::string &nombreArchivo)
+{
+    if (!tabla.cargar(nombreArchivo) || tabla.getMetadato(3) != MARCA_PATRONES)
+    {
+        numPilas = 0;
+        mascara = 0;
+        distanciaMaxima = -1;
+        completa = false;
+        prepararMapa();
+        return false;
+    }
+
+    uint32_t forma = tabla.getMetadato(0);
+    numPilas = (int)(forma & 0xFF);
+    tubosComodin = (int)((forma >> 8) & 0xFF);
+    completa = ((forma >> 16) & 1) != 0;
+    mascara = tabla.getMetadato(1);
+    distanciaMaxima = (int)tabla.getMetadato(2);
+    prepararMapa();
+    return true;
+}
+
+/**
+ * Comprueba si la base corresponde a la forma de un estado
+ * @param estado - Estado a comprobar
+ * @return bool - true si las cotas de la base son válidas para el estado
+ * @complexity O(n) donde n es el número de bolas
+ */
+bool BasePatrones::esAplicable(const EstadoCompacto &estado) const
+{
+    if (!tabla.estaLista() || estado.getNumPilas() != numPilas)
+    {
+        return false;
+    }
+
+    int bolasPorColor[EstadoCompacto::MAX_COLORES + 1] = {0};
+    int bolasComodin = 0;
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            int color = estado.getBola(pila, posicion);
+            if ((mascara & (1u << color)) != 0)
+            {
+                bolasPorColor[color]++;
+            }
+            else
+            {
+                bolasComodin++;
+            }
+        }
+    }
+
+    for (int color = 1; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        if ((mascara & (1u << color)) != 0 && bolasPorColor[color] != Pila::CAPACIDAD_MAXIMA)
+        {
+            return false;
+        }
+    }
+    return bolasComodin == tubosComodin * Pila::CAPACIDAD_MAXIMA;
+}
+
+/**
+ * Obtiene la cota inferior de un estado
+ * @param estado - Estado a consultar
+ * @return int - Cota inferior de los movimientos de bolas del patrón
+ * @complexity O(n^2) donde n es el número de pilas
+ */
+int BasePatrones::cota(const EstadoCompacto &estado) const
+{
+    int distancia = tabla.buscar(estado.recolorear(mapa).canonico());
+    if (distancia >= 0)
+    {
+        return distancia;
+    }
+    return completa ? INALCANZABLE : distanciaMaxima + 1;
+}
+
+/**
+ * Obtiene la máscara de colores del patrón
+ * @return uint32_t - Bit i activo si el color de índice i está en el patrón
+ * @complexity O(1)
+ */
+uint32_t BasePatrones::getMascara() const
+{
+    return mascara;
+}
+
+/**
+ * Obtiene el número de posiciones abstractas almacenadas
+ * @return uint64_t - Número de posiciones
+ * @complexity O(1)
+ */
+uint64_t BasePatrones::getNumPosiciones() const
+{
+    return tabla.getNumClaves();
+}
+
+/**
+ * Indica si se calcularon todas las posiciones abstractas
+ * @return bool - true si la base es completa
+ * @complexity O(1)
+ */
+bool BasePatrones::esCompleta() const
+{
+    return completa;
+}
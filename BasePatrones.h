@@ -0,0 +1,133 @@
+/**
+ * @file BasePatrones.h
+ * @brief TAD BasePatrones para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) BasePatrones, una base
+ * de datos de patrones para acotar por debajo la distancia a la solución. Un
+ * patrón es un subconjunto de colores; el resto de colores se sustituyen por un
+ * único color comodín indistinguible. En el problema abstracto mover una bola
+ * del patrón cuesta 1 y mover un comodín cuesta 0, de modo que las cotas de
+ * patrones con colores disjuntos se pueden sumar sin dejar de ser admisibles.
+ *
+ * La base guarda, para cada posición abstracta canónica, su distancia exacta a
+ * la solución abstracta, calculada offline con una búsqueda hacia atrás 0-1.
+ * Se almacena en una TablaPerfecta que se guarda en disco y se proyecta en
+ * memoria al cargar. Si la búsqueda fue completa, una posición abstracta que no
+ * está en la base no tiene solución, y tampoco la posición real.
+ */
+
+#ifndef BASE_PATRONES_H
+#define BASE_PATRONES_H
+
+#include "TablaPerfecta.h"
+#include <ostream>
+#include <string>
+
+/**
+ * @brief TAD BasePatrones con cotas inferiores de un subconjunto de colores
+ */
+class BasePatrones
+{
+public:
+    static const int INALCANZABLE = 1000000; // Cota de las posiciones sin solución
+
+private:
+    TablaPerfecta tabla;
+    int numPilas;        // Número de tubos de la forma
+    int tubosComodin;    // Tubos completos de colores fuera del patrón
+    uint32_t mascara;    // Bit i activo si el color de índice i está en el patrón
+    int distanciaMaxima; // Mayor distancia calculada
+    bool completa;       // true si se calcularon todas las posiciones abstractas
+    int comodin;         // Índice de color que representa al resto de colores
+    int mapa[EstadoCompacto::MAX_COLORES + 1]; // Abstracción de cada índice de color
+
+    void prepararMapa();
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea una base vacía que no es aplicable a ningún tablero
+     * @complexity O(1)
+     */
+    BasePatrones();
+
+    /**
+     * @brief Construye la base con una búsqueda hacia atrás 0-1
+     * @pre Cada letra del patrón es un color distinto de la paleta y
+     *      patron.length() + tubosComodin <= numPilas <= Tablero::MAX_PILAS
+     * @post La base contiene la distancia abstracta de las posiciones calculadas
+     * @param numPilas - Número de tubos del tablero
+     * @param patron - Colores del patrón (uno por tubo completo)
+     * @param tubosComodin - Tubos completos del resto de colores
+     * @param maxPosiciones - Posiciones máximas a calcular (se completa la última distancia)
+     * @param progreso - Salida opcional de progreso (nullptr = sin salida)
+     * @return bool - true si la construcción fue correcta
+     * @complexity O(S) donde S es el número de posiciones abstractas calculadas
+     */
+    bool construir(int numPilas, const std::string &patron, int tubosComodin, long long maxPosiciones,
+                   std::ostream *progreso = nullptr);
+
+    /**
+     * @brief Guarda la base en un archivo
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si se pudo escribir
+     * @complexity O(S)
+     */
+    bool guardar(const std::string &nombreArchivo) const;
+
+    /**
+     * @brief Carga una base de un archivo proyectándolo en memoria
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si el archivo es una base de patrones válida
+     * @complexity O(1)
+     */
+    bool cargar(const std::string &nombreArchivo);
+
+    /**
+     * @brief Comprueba si la base corresponde a la forma de un estado
+     * @pre No hay precondiciones
+     * @post Devuelve true si el estado tiene los mismos tubos, cada color del
+     *       patrón llena un tubo y el resto llena tubosComodin tubos
+     * @param estado - Estado a comprobar
+     * @return bool - true si las cotas de la base son válidas para el estado
+     * @complexity O(n) donde n es el número de bolas
+     */
+    bool esAplicable(const EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene la cota inferior de un estado
+     * @pre La base es aplicable al estado
+     * @post Devuelve la distancia abstracta, distanciaMaxima + 1 si no se calculó,
+     *       o INALCANZABLE si la base es completa y el estado no tiene solución
+     * @param estado - Estado a consultar
+     * @return int - Cota inferior de los movimientos de bolas del patrón
+     * @complexity O(n^2) donde n es el número de pilas
+     */
+    int cota(const EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene la máscara de colores del patrón
+     * @return uint32_t - Bit i activo si el color de índice i está en el patrón
+     * @complexity O(1)
+     */
+    uint32_t getMascara() const;
+
+    /**
+     * @brief Obtiene el número de posiciones abstractas almacenadas
+     * @return uint64_t - Número de posiciones
+     * @complexity O(1)
+     */
+    uint64_t getNumPosiciones() const;
+
+    /**
+     * @brief Indica si se calcularon todas las posiciones abstractas
+     * @return bool - true si la base es completa
+     * @complexity O(1)
+     */
+    bool esCompleta() const;
+};
+
+#endif // BASE_PATRONES_H
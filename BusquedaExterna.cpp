@@ -0,0 +1,540 @@
+/**
+ * @file BusquedaExterna.cpp
+ * @brief Implementación del TAD BusquedaExterna para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD BusquedaExterna
+ * (BusquedaExterna.h). Para cada capa d se leen sus estados del archivo
+ * capa_d.bin, se generan los sucesores en un búfer acotado que se ordena con
+ * varios hilos y se vuelca como tramo ordenado, y al final se fusionan todos
+ * los tramos en un solo recorrido secuencial, avanzando a la vez por las capas
+ * 0..d (también ordenadas), para escribir en capa_(d+1).bin solo los estados
+ * nuevos.
+ */
+
+#include "BusquedaExterna.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <queue>
+#include <thread>
+
+/**
+ * Abre un archivo de estados para lectura
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si el archivo se pudo abrir
+ * @complexity O(1)
+ */
+bool LectorEstados::abrir(const std::string &nombreArchivo)
+{
+    archivo.open(nombreArchivo, std::ios::binary);
+    bufer.resize(TAM_BUFER);
+    posicion = 0;
+    validos = 0;
+    fallo = false;
+    return archivo.is_open();
+}
+
+/**
+ * Lee el siguiente estado del archivo
+ * @param estado - Estado leído
+ * @return bool - false si se llegó al final del archivo o no se pudo leer
+ * @complexity O(1) amortizado
+ */
+bool LectorEstados::leer(EstadoCompacto &estado)
+{
+    if (posicion == validos)
+    {
+        if (fallo)
+        {
+            return false;
+        }
+        archivo.read(reinterpret_cast<char *>(bufer.data()), TAM_BUFER * sizeof(EstadoCompacto));
+        size_t bytes = (size_t)archivo.gcount();
+        validos = bytes / sizeof(EstadoCompacto);
+        posicion = 0;
+        if (archivo.bad() || bytes % sizeof(EstadoCompacto) != 0)
+        {
+            // Un registro a medias no es el final del archivo: la capa está dañada
+            fallo = true;
+            validos = 0;
+            return false;
+        }
+        if (validos == 0)
+        {
+            return false;
+        }
+    }
+    estado = bufer[posicion++];
+    return true;
+}
+
+/**
+ * Indica si todas las lecturas han sido correctas
+ * @return bool - false si hubo un error de lectura o un registro incompleto
+ * @complexity O(1)
+ */
+bool LectorEstados::correcto() const
+{
+    return !fallo;
+}
+
+EscritorEstados::EscritorEstados()
+{
+    numEscritos = 0;
+}
+
+EscritorEstados::~EscritorEstados()
+{
+    cerrar();
+}
+
+/**
+ * Crea (o trunca) un archivo de estados para escritura
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si el archivo se pudo crear
+ * @complexity O(1)
+ */
+bool EscritorEstados::abrir(const std::string &nombreArchivo)
+{
+    archivo.open(nombreArchivo, std::ios::binary | std::ios::trunc);
+    bufer.clear();
+    bufer.reserve(TAM_BUFER);
+    numEscritos = 0;
+    return archivo.is_open();
+}
+
+/**
+ * Añade un estado al final del archivo
+ * @param estado - Estado a escribir
+ * @complexity O(1) amortizado
+ */
+void EscritorEstados::escribir(const EstadoCompacto &estado)
+{
+    bufer.push_back(estado);
+    numEscritos++;
+    if (bufer.size() == (size_t)TAM_BUFER)
+    {
+        archivo.write(reinterpret_cast<const char *>(bufer.data()), bufer.size() * sizeof(EstadoCompacto));
+        bufer.clear();
+    }
+}
+
+/**
+ * Vacía el búfer y cierra el archivo
+ * @return bool - true si no hubo errores de escritura
+ * @complexity O(b) donde b es el tamaño del búfer
+ */
+bool EscritorEstados::cerrar()
+{
+    if (!archivo.is_open())
+    {
+        return true;
+    }
+    if (!bufer.empty())
+    {
+        archivo.write(reinterpret_cast<const char *>(bufer.data()), bufer.size() * sizeof(EstadoCompacto));
+        bufer.clear();
+    }
+    bool correcto = archivo.good();
+    archivo.close();
+    return correcto;
+}
+
+/**
+ * Obtiene el número de estados escritos
+ * @return long long - Estados escritos desde la apertura
+ * @complexity O(1)
+ */
+long long EscritorEstados::getNumEscritos() const
+{
+    return numEscritos;
+}
+
+ConfiguracionBusquedaExterna::ConfiguracionBusquedaExterna()
+{
+    directorioTrabajo = "bfs_tmp";
+    memoriaMaxima = (size_t)256 * 1024 * 1024;
+    numHilos = 0;
+    conservarCapas = false;
+    progreso = nullptr;
+}
+
+/**
+ * Constructor
+ * @param configuracion - Parámetros de la búsqueda
+ * @complexity O(1)
+ */
+BusquedaExterna::BusquedaExterna(const ConfiguracionBusquedaExterna &configuracion)
+    : configuracion(configuracion)
+{
+    if (this->configuracion.numHilos <= 0)
+    {
+        this->configuracion.numHilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+std::string BusquedaExterna::nombreCapa(int profundidad) const
+{
+    return configuracion.directorioTrabajo + "/capa_" + std::to_string(profundidad) + ".bin";
+}
+
+std::string BusquedaExterna::nombreTramo(int profundidad, int tramo) const
+{
+    return configuracion.directorioTrabajo + "/tramo_" + std::to_string(profundidad) + "_" +
+           std::to_string(tramo) + ".bin";
+}
+
+/**
+ * Ordena un vector de estados con varios hilos: cada hilo ordena un bloque y
+ * después los bloques se fusionan por parejas, también en paralelo
+ * @param estados - Estados a ordenar
+ * @complexity O(n log n / h + n log h) donde h es el número de hilos
+ */
+void BusquedaExterna::ordenarParalelo(std::vector<EstadoCompacto> &estados) const
+{
+    size_t n = estados.size();
+    size_t numBloques = std::min((size_t)configuracion.numHilos, std::max((size_t)1, n / 4096));
+
+    // Límites de los bloques: el bloque b ocupa [limites[b], limites[b + 1])
+    std::vector<size_t> limites;
+    for (size_t b = 0; b <= numBloques; b++)
+    {
+        limites.push_back(n * b / numBloques);
+    }
+
+    std::vector<std::thread> hilos;
+    for (size_t b = 0; b < numBloques; b++)
+    {
+        hilos.emplace_back([&estados, &limites, b]()
+                           { std::sort(estados.begin() + limites[b], estados.begin() + limites[b + 1]); });
+    }
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+
+    // Fusionar bloques adyacentes por parejas hasta que quede uno solo
+    while (limites.size() > 2)
+    {
+        std::vector<size_t> nuevosLimites;
+        hilos.clear();
+        for (size_t b = 0; b + 1 < limites.size(); b += 2)
+        {
+            nuevosLimites.push_back(limites[b]);
+            if (b + 2 < limites.size())
+            {
+                size_t inicio = limites[b], medio = limites[b + 1], fin = limites[b + 2];
+                hilos.emplace_back([&estados, inicio, medio, fin]()
+                                   { std::inplace_merge(estados.begin() + inicio, estados.begin() + medio,
+                                                        estados.begin() + fin); });
+            }
+        }
+        nuevosLimites.push_back(n);
+        for (std::thread &hilo : hilos)
+        {
+            hilo.join();
+        }
+        limites.swap(nuevosLimites);
+    }
+}
+
+/**
+ * Ordena el búfer, elimina repetidos y lo vuelca como tramo en disco
+ * @param estados - Búfer de sucesores (queda vacío)
+ * @param profundidad - Capa que se está generando
+ * @param numTramo - Número del tramo
+ * @return bool - true si se escribió correctamente
+ * @complexity O(n log n)
+ */
+bool BusquedaExterna::volcarTramo(std::vector<EstadoCompacto> &estados, int profundidad, int numTramo) const
+{
+    ordenarParalelo(estados);
+    estados.erase(std::unique(estados.begin(), estados.end()), estados.end());
+
+    EscritorEstados escritor;
+    if (!escritor.abrir(nombreTramo(profundidad, numTramo)))
+    {
+        return false;
+    }
+    for (const EstadoCompacto &estado : estados)
+    {
+        escritor.escribir(estado);
+    }
+    estados.clear();
+    return escritor.cerrar();
+}
+
+/**
+ * Fusiona los tramos de una capa y escribe solo los estados no vistos antes
+ * @param profundidad - Capa que se está generando
+ * @param numTramos - Número de tramos volcados
+ * @param numNuevos - Número de estados de la nueva capa
+ * @return bool - true si no hubo errores de E/S
+ * @complexity O(T log k) donde T es el total de registros y k el número de tramos
+ */
+bool BusquedaExterna::fusionarTramos(int profundidad, int numTramos, long long &numNuevos) const
+{
+    // Cola de prioridad con el siguiente estado de cada tramo
+    typedef std::pair<EstadoCompacto, int> Entrada;
+    auto mayor = [](const Entrada &a, const Entrada &b)
+    { return b.first < a.first; };
+    std::priority_queue<Entrada, std::vector<Entrada>, decltype(mayor)> cola(mayor);
+
+    std::vector<std::unique_ptr<LectorEstados>> tramos;
+    for (int t = 0; t < numTramos; t++)
+    {
+        tramos.emplace_back(new LectorEstados());
+        if (!tramos[t]->abrir(nombreTramo(profundidad, t)))
+        {
+            return false;
+        }
+        EstadoCompacto estado;
+        if (tramos[t]->leer(estado))
+        {
+            cola.push(Entrada(estado, t));
+        }
+    }
+
+    // Capas anteriores: cualquier estado que aparezca en ellas ya fue visitado
+    std::vector<std::unique_ptr<LectorEstados>> capas;
+    std::vector<EstadoCompacto> actualCapa;
+    std::vector<bool> quedaCapa;
+    for (int d = 0; d < profundidad; d++)
+    {
+        capas.emplace_back(new LectorEstados());
+        if (!capas[d]->abrir(nombreCapa(d)))
+        {
+            return false;
+        }
+        actualCapa.push_back(EstadoCompacto());
+        quedaCapa.push_back(capas[d]->leer(actualCapa[d]));
+    }
+
+    EscritorEstados salida;
+    if (!salida.abrir(nombreCapa(profundidad)))
+    {
+        return false;
+    }
+
+    bool hayAnterior = false;
+    EstadoCompacto anterior;
+    while (!cola.empty())
+    {
+        Entrada entrada = cola.top();
+        cola.pop();
+
+        EstadoCompacto siguiente;
+        if (tramos[entrada.second]->leer(siguiente))
+        {
+            cola.push(Entrada(siguiente, entrada.second));
+        }
+
+        if (hayAnterior && entrada.first == anterior)
+        {
+            continue;
+        }
+        anterior = entrada.first;
+        hayAnterior = true;
+
+        bool visto = false;
+        for (size_t d = 0; d < capas.size(); d++)
+        {
+            while (quedaCapa[d] && actualCapa[d] < entrada.first)
+            {
+                quedaCapa[d] = capas[d]->leer(actualCapa[d]);
+            }
+            if (quedaCapa[d] && actualCapa[d] == entrada.first)
+            {
+                visto = true;
+            }
+        }
+
+        if (!visto)
+        {
+            salida.escribir(entrada.first);
+        }
+    }
+
+    numNuevos = salida.getNumEscritos();
+    bool correcto = salida.cerrar();
+    for (const std::unique_ptr<LectorEstados> &lector : tramos)
+    {
+        correcto = correcto && lector->correcto();
+    }
+    for (const std::unique_ptr<LectorEstados> &lector : capas)
+    {
+        correcto = correcto && lector->correcto();
+    }
+
+    tramos.clear();
+    for (int t = 0; t < numTramos; t++)
+    {
+        std::remove(nombreTramo(profundidad, t).c_str());
+    }
+    return correcto;
+}
+
+/**
+ * Genera la capa siguiente a partir de la capa indicada
+ * @param profundidad - Capa a expandir
+ * @param numNuevos - Número de estados de la capa profundidad + 1
+ * @return bool - true si no hubo errores de E/S
+ * @complexity O(S log S) donde S es el número de sucesores generados
+ */
+bool BusquedaExterna::expandirCapa(int profundidad, long long &numNuevos) const
+{
+    LectorEstados lector;
+    if (!lector.abrir(nombreCapa(profundidad)))
+    {
+        return false;
+    }
+
+    // La última fusión de ordenarParalelo pide un búfer temporal de hasta la
+    // mitad del tramo, así que el tramo ocupa dos tercios de la memoria máxima
+    size_t capacidad = std::max((size_t)1024, configuracion.memoriaMaxima / 3 * 2 / sizeof(EstadoCompacto));
+    std::vector<EstadoCompacto> sucesores;
+    sucesores.reserve(capacidad);
+    int numTramos = 0;
+
+    EstadoCompacto estado;
+    Tablero tablero;
+    while (lector.leer(estado))
+    {
+        estado.aTablero(tablero);
+        Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+        int numMovimientos = tablero.generarMovimientos(movimientos);
+        for (int m = 0; m < numMovimientos; m++)
+        {
+            int origen = movimientos[m].origen;
+            int destino = movimientos[m].destino;
+            Tablero hijo = tablero;
+            hijo.moverBola(origen, destino);
+            EstadoCompacto sucesor;
+            sucesor.desdeTablero(hijo);
+            sucesores.push_back(sucesor);
+
+            if (sucesores.size() == capacidad)
+            {
+                if (!volcarTramo(sucesores, profundidad + 1, numTramos++))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    if (!lector.correcto() || (!sucesores.empty() && !volcarTramo(sucesores, profundidad + 1, numTramos++)))
+    {
+        return false;
+    }
+
+    return fusionarTramos(profundidad + 1, numTramos, numNuevos);
+}
+
+/**
+ * Enumera todos los estados alcanzables desde un tablero
+ * @param inicial - Tablero de partida
+ * @return bool - true si la enumeración terminó sin errores de E/S
+ * @complexity O(E log E) operaciones de disco, donde E es el número de aristas
+ */
+bool BusquedaExterna::enumerar(const Tablero &inicial)
+{
+    estadosPorProfundidad.clear();
+
+    EstadoCompacto raiz;
+    if (!raiz.desdeTablero(inicial))
+    {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(configuracion.directorioTrabajo, error);
+    if (error)
+    {
+        return false;
+    }
+
+    EscritorEstados escritor;
+    if (!escritor.abrir(nombreCapa(0)))
+    {
+        return false;
+    }
+    escritor.escribir(raiz);
+    if (!escritor.cerrar())
+    {
+        return false;
+    }
+    estadosPorProfundidad.push_back(1);
+
+    bool correcto = true;
+    int profundidad = 0;
+    while (true)
+    {
+        long long numNuevos = 0;
+        if (!expandirCapa(profundidad, numNuevos))
+        {
+            correcto = false;
+            break;
+        }
+        if (numNuevos == 0)
+        {
+            std::remove(nombreCapa(profundidad + 1).c_str());
+            break;
+        }
+
+        profundidad++;
+        estadosPorProfundidad.push_back(numNuevos);
+        if (configuracion.progreso != nullptr)
+        {
+            *configuracion.progreso << "Profundidad " << profundidad << ": " << numNuevos << " estados" << std::endl;
+        }
+    }
+
+    if (!configuracion.conservarCapas)
+    {
+        for (int d = 0; d <= profundidad; d++)
+        {
+            std::remove(nombreCapa(d).c_str());
+        }
+        std::filesystem::remove(configuracion.directorioTrabajo, error); // Solo si quedó vacío
+    }
+    return correcto;
+}
+
+/**
+ * Obtiene el número de estados nuevos de cada profundidad
+ * @return const std::vector<long long>& - Estados por profundidad
+ * @complexity O(1)
+ */
+const std::vector<long long> &BusquedaExterna::getEstadosPorProfundidad() const
+{
+    return estadosPorProfundidad;
+}
+
+/**
+ * Obtiene el número total de estados alcanzables
+ * @return long long - Suma de los estados de todas las capas
+ * @complexity O(d) donde d es el número de capas
+ */
+long long BusquedaExterna::getTotalEstados() const
+{
+    long long total = 0;
+    for (long long numEstados : estadosPorProfundidad)
+    {
+        total += numEstados;
+    }
+    return total;
+}
+
+/**
+ * Obtiene la máxima distancia desde el estado inicial
+ * @return int - Profundidad de la última capa no vacía (-1 si no se ha enumerado)
+ * @complexity O(1)
+ */
+int BusquedaExterna::getProfundidadMaxima() const
+{
+    return (int)estadosPorProfundidad.size() - 1;
+}
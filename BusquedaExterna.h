@@ -0,0 +1,198 @@
+/**
+ * @file BusquedaExterna.h
+ * @brief TAD BusquedaExterna para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) BusquedaExterna, que
+ * enumera el grafo completo de estados alcanzables desde un Tablero mediante
+ * una búsqueda en anchura por capas apoyada en disco. Cada capa se guarda como
+ * un archivo ordenado y sin repetidos de estados compactos; los sucesores se
+ * acumulan en un búfer de memoria acotada que se ordena en paralelo y se vuelca
+ * en tramos, y los tramos se fusionan eliminando los estados ya vistos en capas
+ * anteriores (detección de duplicados diferida por ordenación externa).
+ *
+ * También se definen LectorEstados y EscritorEstados, que leen y escriben
+ * archivos binarios de registros EstadoCompacto con un búfer propio.
+ */
+
+#ifndef BUSQUEDA_EXTERNA_H
+#define BUSQUEDA_EXTERNA_H
+
+#include "EstadoCompacto.h"
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Lector secuencial de un archivo binario de estados compactos
+ */
+class LectorEstados
+{
+private:
+    static const int TAM_BUFER = 4096; // Registros leídos de una vez
+    std::ifstream archivo;
+    std::vector<EstadoCompacto> bufer;
+    size_t posicion;  // Siguiente registro del búfer
+    size_t validos;   // Registros válidos en el búfer
+    bool fallo;       // Hubo un error de lectura o el archivo acaba en un registro incompleto
+
+public:
+    /**
+     * @brief Abre un archivo de estados para lectura
+     * @pre No hay precondiciones
+     * @post El lector queda posicionado al principio del archivo
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si el archivo se pudo abrir
+     * @complexity O(1)
+     */
+    bool abrir(const std::string &nombreArchivo);
+
+    /**
+     * @brief Lee el siguiente estado del archivo
+     * @pre El lector está abierto
+     * @post Avanza una posición en el archivo
+     * @param estado - Estado leído
+     * @return bool - false si se llegó al final del archivo o no se pudo leer
+     * @complexity O(1) amortizado
+     */
+    bool leer(EstadoCompacto &estado);
+
+    /**
+     * @brief Indica si todas las lecturas han sido correctas
+     * @pre El lector está abierto
+     * @post Distingue el final del archivo de un error cuando leer() devuelve false
+     * @return bool - false si hubo un error de lectura o el archivo acaba en
+     *         un registro incompleto
+     * @complexity O(1)
+     */
+    bool correcto() const;
+};
+
+/**
+ * @brief Escritor secuencial de un archivo binario de estados compactos
+ */
+class EscritorEstados
+{
+private:
+    static const int TAM_BUFER = 4096; // Registros escritos de una vez
+    std::ofstream archivo;
+    std::vector<EstadoCompacto> bufer;
+    long long numEscritos;
+
+public:
+    EscritorEstados();
+    ~EscritorEstados();
+
+    /**
+     * @brief Crea (o trunca) un archivo de estados para escritura
+     * @pre No hay precondiciones
+     * @post El archivo queda vacío y listo para escribir
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si el archivo se pudo crear
+     * @complexity O(1)
+     */
+    bool abrir(const std::string &nombreArchivo);
+
+    /**
+     * @brief Añade un estado al final del archivo
+     * @pre El escritor está abierto
+     * @post El estado se escribe (posiblemente al vaciar el búfer)
+     * @param estado - Estado a escribir
+     * @complexity O(1) amortizado
+     */
+    void escribir(const EstadoCompacto &estado);
+
+    /**
+     * @brief Vacía el búfer y cierra el archivo
+     * @pre No hay precondiciones
+     * @post Todos los estados quedan en disco
+     * @return bool - true si no hubo errores de escritura
+     * @complexity O(b) donde b es el tamaño del búfer
+     */
+    bool cerrar();
+
+    /**
+     * @brief Obtiene el número de estados escritos
+     * @return long long - Estados escritos desde la apertura
+     * @complexity O(1)
+     */
+    long long getNumEscritos() const;
+};
+
+/**
+ * @brief Parámetros de la búsqueda externa
+ */
+struct ConfiguracionBusquedaExterna
+{
+    std::string directorioTrabajo; // Directorio para capas y tramos temporales
+    size_t memoriaMaxima;          // Bytes máximos del búfer de sucesores y de su ordenación
+    int numHilos;                  // Hilos para la ordenación (0 = todos los núcleos)
+    bool conservarCapas;           // Si es true no se borran los archivos de capa
+    std::ostream *progreso;        // Salida opcional de progreso (nullptr = sin salida)
+
+    ConfiguracionBusquedaExterna();
+};
+
+/**
+ * @brief TAD BusquedaExterna para enumerar el espacio de estados en disco
+ */
+class BusquedaExterna
+{
+private:
+    ConfiguracionBusquedaExterna configuracion;
+    std::vector<long long> estadosPorProfundidad; // Estados nuevos en cada capa
+
+    std::string nombreCapa(int profundidad) const;
+    std::string nombreTramo(int profundidad, int tramo) const;
+    void ordenarParalelo(std::vector<EstadoCompacto> &estados) const;
+    bool volcarTramo(std::vector<EstadoCompacto> &estados, int profundidad, int numTramo) const;
+    bool fusionarTramos(int profundidad, int numTramos, long long &numNuevos) const;
+    bool expandirCapa(int profundidad, long long &numNuevos) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea una búsqueda con la configuración indicada
+     * @param configuracion - Parámetros de la búsqueda
+     * @complexity O(1)
+     */
+    explicit BusquedaExterna(const ConfiguracionBusquedaExterna &configuracion);
+
+    /**
+     * @brief Enumera todos los estados alcanzables desde un tablero
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Se calculan los estados de cada profundidad
+     * @param inicial - Tablero de partida
+     * @return bool - true si la enumeración terminó sin errores de E/S
+     * @complexity O(E log E) operaciones de disco, donde E es el número de aristas
+     */
+    bool enumerar(const Tablero &inicial);
+
+    /**
+     * @brief Obtiene el número de estados nuevos de cada profundidad
+     * @return const std::vector<long long>& - Estados por profundidad
+     * @complexity O(1)
+     */
+    const std::vector<long long> &getEstadosPorProfundidad() const;
+
+    /**
+     * @brief Obtiene el número total de estados alcanzables
+     * @return long long - Suma de los estados de todas las capas
+     * @complexity O(d) donde d es el número de capas
+     */
+    long long getTotalEstados() const;
+
+    /**
+     * @brief Obtiene la máxima distancia desde el estado inicial
+     * @post Es la excentricidad del estado inicial, no el diámetro del grafo
+     *       (la mayor distancia entre dos estados cualesquiera)
+     * @return int - Profundidad de la última capa no vacía (-1 si no se ha enumerado)
+     * @complexity O(1)
+     */
+    int getProfundidadMaxima() const;
+};
+
+#endif // BUSQUEDA_EXTERNA_H
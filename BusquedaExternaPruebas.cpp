@@ -0,0 +1,132 @@
+/**
+ * @file BusquedaExternaPruebas.cpp
+ * @brief Pruebas para el TAD BusquedaExterna del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD BusquedaExterna
+ * (BusquedaExterna.h/BusquedaExterna.cpp). Se enumera un tablero pequeño con un
+ * búfer diminuto, para forzar varios tramos por capa, y se compara el número de
+ * estados de cada profundidad con una búsqueda en anchura en memoria.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "BusquedaExterna.h"
+#include <iostream>
+#include <cassert>
+#include <unordered_set>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "BusquedaExterna.cpp"
+
+/**
+ * @brief Búsqueda en anchura en memoria para contrastar los resultados
+ * @param inicial - Tablero de partida
+ * @return std::vector<long long> - Estados nuevos de cada profundidad
+ */
+std::vector<long long> anchuraEnMemoria(const Tablero &inicial)
+{
+    std::unordered_set<EstadoCompacto, HashEstadoCompacto> visitados;
+    std::vector<EstadoCompacto> frontera(1);
+    frontera[0].desdeTablero(inicial);
+    visitados.insert(frontera[0]);
+
+    std::vector<long long> capas;
+    while (!frontera.empty())
+    {
+        capas.push_back((long long)frontera.size());
+        std::vector<EstadoCompacto> siguiente;
+        for (const EstadoCompacto &estado : frontera)
+        {
+            Tablero tablero;
+            estado.aTablero(tablero);
+            for (int o = 0; o < tablero.getNumPilas(); o++)
+            {
+                for (int d = 0; d < tablero.getNumPilas(); d++)
+                {
+                    Tablero hijo = tablero;
+                    EstadoCompacto sucesor;
+                    if (hijo.moverBola(o, d) && sucesor.desdeTablero(hijo) && visitados.insert(sucesor).second)
+                    {
+                        siguiente.push_back(sucesor);
+                    }
+                }
+            }
+        }
+        frontera.swap(siguiente);
+    }
+    return capas;
+}
+
+/**
+ * @brief Ejecuta las pruebas del TAD BusquedaExterna
+ * @return int - 0 si todas las pruebas pasan correctamente
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD BusquedaExterna..." << std::endl;
+
+    // Tablero de 5 tubos y 3 colores
+    Tablero tablero;
+    tablero.inicializar(5);
+    const char *tubos[3] = {"RGBR", "GBRG", "BRGB"};
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            tablero.colocarBola(i, tubos[i][j]);
+        }
+    }
+
+    // Prueba 1: Enumeración con búfer pequeño y varios hilos
+    ConfiguracionBusquedaExterna configuracion;
+    configuracion.directorioTrabajo = "bfs_pruebas_tmp";
+    configuracion.memoriaMaxima = 1024 * sizeof(EstadoCompacto);
+    configuracion.numHilos = 4;
+    BusquedaExterna busqueda(configuracion);
+    assert(busqueda.enumerar(tablero));
+    std::cout << "Prueba 1 superada: Enumeración externa" << std::endl;
+
+    // Prueba 2: Coincidencia con la búsqueda en memoria
+    std::vector<long long> esperado = anchuraEnMemoria(tablero);
+    assert(busqueda.getEstadosPorProfundidad() == esperado);
+    assert(busqueda.getProfundidadMaxima() == (int)esperado.size() - 1);
+    long long total = 0;
+    for (long long n : esperado)
+    {
+        total += n;
+    }
+    assert(busqueda.getTotalEstados() == total);
+    std::cout << "Prueba 2 superada: Coincide con la búsqueda en memoria (" << total << " estados)" << std::endl;
+
+    // Prueba 3: Un registro incompleto es un error y no el final del archivo
+    std::filesystem::create_directories("bfs_pruebas_tmp");
+    EscritorEstados escritor;
+    assert(escritor.abrir("bfs_pruebas_tmp/capa.bin"));
+    EstadoCompacto raiz;
+    assert(raiz.desdeTablero(tablero));
+    escritor.escribir(raiz);
+    assert(escritor.cerrar());
+    LectorEstados lector;
+    EstadoCompacto leido;
+    assert(lector.abrir("bfs_pruebas_tmp/capa.bin"));
+    assert(lector.leer(leido) && leido == raiz && !lector.leer(leido) && lector.correcto());
+    {
+        std::ofstream archivo("bfs_pruebas_tmp/capa.bin", std::ios::binary | std::ios::app);
+        archivo.write("xyz", 3);
+    }
+    LectorEstados danado;
+    assert(danado.abrir("bfs_pruebas_tmp/capa.bin"));
+    assert(!danado.leer(leido) && !danado.correcto());
+    std::cout << "Prueba 3 superada: Registro incompleto detectado" << std::endl;
+
+    std::filesystem::remove_all("bfs_pruebas_tmp");
+
+    std::cout << "¡Todas las pruebas del TAD BusquedaExterna han sido superadas!" << std::endl;
+    return 0;
+}
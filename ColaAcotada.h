@@ -0,0 +1,182 @@
+/**
+ * @file ColaAcotada.h
+ * @brief TAD ColaAcotada para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) ColaAcotada, una cola
+ * de capacidad fija sin cerrojos para varios productores y varios
+ * consumidores. Cada hueco del anillo lleva un número de secuencia que indica
+ * si está libre para la vuelta actual del productor o lleno para la del
+ * consumidor; los extremos se reservan con compare_exchange, sin cerrojos.
+ * No es libre de esperas: si un productor se duerme entre reservar su hueco y
+ * publicarlo, los consumidores ven la cola vacía en ese hueco (y los
+ * productores, llena al dar la vuelta) hasta que despierte, aunque detrás
+ * haya huecos ya publicados.
+ *
+ * Las operaciones no bloquean: devuelven false si la cola está llena o vacía,
+ * y quien la usa decide cómo esperar. Así la capacidad limita el trabajo en
+ * vuelo entre dos etapas de una cadena de producción (contrapresión).
+ *
+ * Es una plantilla, por lo que su implementación está en este archivo.
+ */
+
+#ifndef COLA_ACOTADA_H
+#define COLA_ACOTADA_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief TAD ColaAcotada: cola FIFO de capacidad fija sin cerrojos
+ * @tparam T - Tipo de los elementos (se mueven al meter y al sacar)
+ */
+template <typename T>
+class ColaAcotada
+{
+private:
+    static const size_t TAM_LINEA = 64; // Bytes de una línea de caché
+
+    /**
+     * @brief Hueco del anillo
+     */
+    struct Hueco
+    {
+        std::atomic<size_t> secuencia; // Posición que puede usar el siguiente productor o consumidor
+        T valor;                       // Elemento guardado
+    };
+
+    std::unique_ptr<Hueco[]> huecos; // Anillo de huecos
+    size_t mascara;                  // Capacidad - 1 (la capacidad es potencia de 2)
+
+    alignas(TAM_LINEA) std::atomic<size_t> cabeza; // Siguiente posición a sacar
+    alignas(TAM_LINEA) std::atomic<size_t> cola;   // Siguiente posición a meter
+
+public:
+    /**
+     * @brief Constructor
+     * @pre capacidad > 0
+     * @post Crea una cola vacía con capacidad para la menor potencia de 2 que
+     *       sea mayor o igual que la pedida y que 2 (con un solo hueco, "lleno"
+     *       y "libre para la vuelta siguiente" tendrían la misma secuencia)
+     * @param capacidad - Elementos que caben como mínimo
+     * @complexity O(capacidad)
+     */
+    explicit ColaAcotada(size_t capacidad)
+    {
+        size_t potencia = 2;
+        while (potencia < capacidad)
+        {
+            potencia *= 2;
+        }
+        huecos.reset(new Hueco[potencia]);
+        for (size_t i = 0; i < potencia; i++)
+        {
+            huecos[i].secuencia.store(i, std::memory_order_relaxed);
+        }
+        mascara = potencia - 1;
+        cabeza.store(0, std::memory_order_relaxed);
+        cola.store(0, std::memory_order_relaxed);
+    }
+
+    ColaAcotada(const ColaAcotada &) = delete;
+    ColaAcotada &operator=(const ColaAcotada &) = delete;
+
+    /**
+     * @brief Intenta meter un elemento al final de la cola
+     * @pre No hay precondiciones
+     * @post Si había sitio, el elemento se ha movido a la cola
+     * @param valor - Elemento a meter
+     * @return bool - false si la cola estaba llena (el elemento no se mueve)
+     * @complexity O(1) sin contención
+     */
+    bool intentarMeter(T &valor)
+    {
+        size_t posicion = cola.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Hueco &hueco = huecos[posicion & mascara];
+            size_t secuencia = hueco.secuencia.load(std::memory_order_acquire);
+            if (secuencia == posicion)
+            {
+                if (cola.compare_exchange_weak(posicion, posicion + 1, std::memory_order_relaxed))
+                {
+                    hueco.valor = std::move(valor);
+                    hueco.secuencia.store(posicion + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (secuencia < posicion)
+            {
+                return false; // El hueco aún guarda el elemento de la vuelta anterior
+            }
+            else
+            {
+                posicion = cola.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Intenta sacar el primer elemento de la cola
+     * @pre No hay precondiciones
+     * @post Si la cola no estaba vacía, el primer elemento se ha movido a valor
+     * @param valor - Elemento sacado
+     * @return bool - false si la cola estaba vacía
+     * @complexity O(1) sin contención
+     */
+    bool intentarSacar(T &valor)
+    {
+        size_t posicion = cabeza.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Hueco &hueco = huecos[posicion & mascara];
+            size_t secuencia = hueco.secuencia.load(std::memory_order_acquire);
+            if (secuencia == posicion + 1)
+            {
+                if (cabeza.compare_exchange_weak(posicion, posicion + 1, std::memory_order_relaxed))
+                {
+                    valor = std::move(hueco.valor);
+                    hueco.secuencia.store(posicion + mascara + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (secuencia < posicion + 1)
+            {
+                return false; // Ningún productor ha llenado aún el hueco
+            }
+            else
+            {
+                posicion = cabeza.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Obtiene la capacidad de la cola
+     * @return size_t - Elementos que caben
+     * @complexity O(1)
+     */
+    size_t getCapacidad() const
+    {
+        return mascara + 1;
+    }
+
+    /**
+     * @brief Obtiene aproximadamente los elementos de la cola
+     * @pre No hay precondiciones
+     * @post Con otros hilos usando la cola, el valor puede estar desfasado
+     * @return size_t - Elementos en la cola
+     * @complexity O(1)
+     */
+    size_t getTamAproximado() const
+    {
+        size_t final = cola.load(std::memory_order_relaxed);
+        size_t inicio = cabeza.load(std::memory_order_relaxed);
+        return final > inicio ? final - inicio : 0;
+    }
+};
+
+#endif // COLA_ACOTADA_H
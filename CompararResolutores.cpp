@@ -0,0 +1,264 @@
+/**
+ * @file CompararResolutores.cpp
+ * @brief Herramienta de comparación de configuraciones de resolución
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa juega un torneo (TAD TorneoResolutores) entre varias
+ * configuraciones de resolución sobre un conjunto de niveles: archivos .cnf
+ * sueltos y paquetes de niveles (formato de FabricarNiveles). Cada partida se
+ * juega en su propio proceso, con límite de tiempo y de memoria, y varias a la
+ * vez. Muestra una tabla con los niveles resueltos, las partidas que agotaron
+ * el tiempo o la memoria, la longitud media de las soluciones en los niveles
+ * que resuelven todas las configuraciones, los nodos, el tiempo y la memoria
+ * máxima; con --csv guarda además el resultado de cada partida. Solo funciona
+ * en sistemas POSIX (Linux, macOS), porque cada partida es un proceso hijo.
+ *
+ * Uso: CompararResolutores <nivel.cnf>... [--paquete archivo]...
+ *                          [--resolutores astar,bidireccional,haz:500,...]
+ *                          [--tiempo S] [--memoria MB] [--max-nodos N]
+ *                          [--procesos N] [--semilla S] [--base archivo]
+ *                          [--patrones archivo]... [--csv archivo]
+ */
+
+#include "Juego.h"
+#include "DeduplicadorNiveles.h"
+#include "TorneoResolutores.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "Juego.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ResolutorAproximado.cpp"
+#include "MotorMonteCarlo.cpp"
+#include "DeduplicadorNiveles.cpp"
+#include "TorneoResolutores.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: CompararResolutores <nivel.cnf>... [--paquete archivo]..." << std::endl;
+    std::cerr << "                           [--resolutores astar,bidireccional,haz:500,...]" << std::endl;
+    std::cerr << "                           [--tiempo S] [--memoria MB] [--max-nodos N]" << std::endl;
+    std::cerr << "                           [--procesos N] [--semilla S] [--base archivo]" << std::endl;
+    std::cerr << "                           [--patrones archivo]... [--csv archivo]" << std::endl;
+    std::cerr << "Resolutores: astar[+bases], bidireccional[+bases], aproximado, haz[:W]," << std::endl;
+    std::cerr << "             ponderado[:P], montecarlo[:I]" << std::endl;
+}
+
+/**
+ * @brief Añade los niveles de un paquete
+ * @param archivo - Ruta del paquete
+ * @param niveles - Niveles del torneo
+ * @param nombres - Nombre de cada nivel
+ * @return bool - false si no se pudo leer el paquete
+ */
+static bool cargarPaquete(const std::string &archivo, std::vector<Tablero> &niveles, std::vector<std::string> &nombres)
+{
+    DeduplicadorNiveles deduplicador;
+    std::vector<NivelPaquete> leidos;
+    if (!deduplicador.agregarArchivo(archivo, leidos))
+    {
+        return false;
+    }
+    for (const NivelPaquete &leido : leidos)
+    {
+        Tablero tablero;
+        if (leido.grupo >= 0 && deduplicador.getRepresentante(leido.grupo).aTablero(tablero))
+        {
+            niveles.push_back(tablero);
+            nombres.push_back(archivo + ":" + std::to_string(leido.linea));
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    OpcionesTorneo opciones;
+    std::string listaResolutores = "astar,bidireccional,aproximado,montecarlo";
+    std::string archivoCsv;
+    BaseFinal base;
+    std::vector<std::unique_ptr<BasePatrones>> patrones;
+    std::vector<Tablero> niveles;
+    std::vector<std::string> nombres;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--paquete" && i + 1 < argc)
+        {
+            if (!cargarPaquete(argv[++i], niveles, nombres))
+            {
+                std::cerr << "Error: No se pudo leer el paquete " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else if (opcion == "--resolutores" && i + 1 < argc)
+        {
+            listaResolutores = argv[++i];
+        }
+        else if (opcion == "--tiempo" && i + 1 < argc)
+        {
+            opciones.segundosLimite = std::stod(argv[++i]);
+        }
+        else if (opcion == "--memoria" && i + 1 < argc)
+        {
+            opciones.memoriaMaximaMB = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--max-nodos" && i + 1 < argc)
+        {
+            opciones.maxNodos = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--procesos" && i + 1 < argc)
+        {
+            opciones.numProcesos = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--semilla" && i + 1 < argc)
+        {
+            opciones.semilla = std::stoull(argv[++i]);
+        }
+        else if (opcion == "--base" && i + 1 < argc)
+        {
+            if (!base.cargar(argv[++i]))
+            {
+                std::cerr << "Error: No se pudo cargar la base de finales " << argv[i] << std::endl;
+                return 1;
+            }
+            opciones.baseFinal = &base;
+        }
+        else if (opcion == "--patrones" && i + 1 < argc)
+        {
+            patrones.emplace_back(new BasePatrones());
+            if (!patrones.back()->cargar(argv[++i]))
+            {
+                std::cerr << "Error: No se pudo cargar la base de patrones " << argv[i] << std::endl;
+                return 1;
+            }
+            opciones.patrones.push_back(patrones.back().get());
+        }
+        else if (opcion == "--csv" && i + 1 < argc)
+        {
+            archivoCsv = argv[++i];
+        }
+        else if (opcion.compare(0, 2, "--") != 0)
+        {
+            Juego juego;
+            if (!juego.inicializar(opcion))
+            {
+                std::cerr << "Error: No se pudo cargar el nivel " << opcion << std::endl;
+                return 1;
+            }
+            niveles.push_back(juego.getTablero());
+            nombres.push_back(opcion);
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    std::vector<ConcursanteTorneo> concursantes;
+    std::stringstream lista(listaResolutores);
+    std::string texto;
+    while (std::getline(lista, texto, ','))
+    {
+        ConcursanteTorneo concursante;
+        if (!TorneoResolutores::concursanteDesdeTexto(texto, concursante))
+        {
+            std::cerr << "Error: Resolutor no válido: " << texto << std::endl;
+            mostrarUso();
+            return 1;
+        }
+        concursantes.push_back(concursante);
+    }
+    if (niveles.empty() || concursantes.empty())
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::cout << "Torneo: " << concursantes.size() << " resolutores, " << niveles.size() << " niveles, "
+              << opciones.segundosLimite << " s y " << opciones.memoriaMaximaMB << " MB por partida" << std::endl;
+    std::cout.flush();
+
+    std::vector<std::vector<ResultadoPartida>> resultados;
+    if (!TorneoResolutores(opciones).disputar(concursantes, niveles, resultados))
+    {
+#ifdef _WIN32
+        std::cerr << "Error: El torneo necesita fork y solo funciona en sistemas POSIX" << std::endl;
+#else
+        std::cerr << "Error: No se pudo crear un proceso para una partida" << std::endl;
+#endif
+        return 1;
+    }
+    std::vector<ResumenConcursante> resumenes = TorneoResolutores::resumir(resultados);
+
+    std::cout << std::left << std::setw(18) << "Resolutor" << std::right << std::setw(10) << "Resueltos"
+              << std::setw(8) << "Tiempo" << std::setw(9) << "Memoria" << std::setw(8) << "Errores"
+              << std::setw(9) << "Mejores" << std::setw(13) << "Long. común" << std::setw(14) << "Nodos medios"
+              << std::setw(10) << "Seg" << std::setw(12) << "Pico (MB)" << std::endl;
+    for (size_t c = 0; c < concursantes.size(); c++)
+    {
+        const ResumenConcursante &resumen = resumenes[c];
+        std::cout << std::left << std::setw(18) << concursantes[c].nombre << std::right << std::setw(10)
+                  << resumen.resueltos << std::setw(8) << resumen.tiemposAgotados << std::setw(9)
+                  << resumen.memoriasAgotadas << std::setw(8) << resumen.errores << std::setw(9) << resumen.mejores
+                  << std::fixed << std::setprecision(2) << std::setw(12);
+        if (resumen.longitudMediaComun >= 0.0)
+        {
+            std::cout << resumen.longitudMediaComun;
+        }
+        else
+        {
+            std::cout << "-";
+        }
+        std::cout << std::setprecision(0) << std::setw(14) << resumen.nodosMedios << std::setprecision(2)
+                  << std::setw(10) << resumen.segundosTotales << std::setprecision(1) << std::setw(12)
+                  << resumen.memoriaPicoKB / 1024.0 << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
+
+    if (!archivoCsv.empty())
+    {
+        std::ofstream csv(archivoCsv);
+        csv << "resolutor,nivel,fin,resuelto,optima,longitud,nodos,segundos,memoria_kb" << std::endl;
+        for (size_t c = 0; c < concursantes.size(); c++)
+        {
+            for (size_t n = 0; n < niveles.size(); n++)
+            {
+                const ResultadoPartida &partida = resultados[c][n];
+                csv << concursantes[c].nombre << "," << nombres[n] << "," << TorneoResolutores::nombreFin(partida.fin)
+                    << "," << partida.resuelto << "," << partida.optima << "," << partida.longitud << ","
+                    << partida.nodos << "," << partida.segundos << "," << partida.memoriaPicoKB << std::endl;
+            }
+        }
+        if (!csv)
+        {
+            std::cerr << "Error: No se pudo escribir " << archivoCsv << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,314 @@
+/**
+ * @file CompararVisitados.cpp
+ * @brief Herramienta de comparación de las representaciones del conjunto de visitados
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa carga un nivel (.cnf) y recorre en anchura todos los estados
+ * alcanzables desde él (salvo orden de tubos) una vez por cada representación
+ * del TAD ConjuntoVisitados pedida. Para cada una muestra la memoria del
+ * conjunto, los bytes por estado, los estados encontrados (y su porcentaje
+ * sobre el recorrido exacto), la profundidad alcanzada y la velocidad.
+ *
+ * Si se pide la representación exacta, se usa además para medir la tasa de
+ * falsos positivos de los filtros: se generan tableros aleatorios con las
+ * mismas bolas que no son alcanzables y se cuenta cuántos da cada filtro por
+ * visitados.
+ *
+ * Uso: CompararVisitados <nivel.cnf> [--tipos exacto,cuckoo,bloom]
+ *                        [--capacidad N] [--fp P] [--muestras N] [--semilla S]
+ */
+
+#include "Juego.h"
+#include "ConjuntoVisitados.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "Juego.cpp"
+#include "ConjuntoVisitados.cpp"
+
+/**
+ * @brief Resultado de un recorrido en anchura
+ */
+struct RecorridoAnchura
+{
+    long long estados;    // Estados que el conjunto dio por nuevos
+    int profundidad;      // Mayor profundidad con estados nuevos
+    double segundos;      // Duración del recorrido
+    size_t bytesFrontera; // Mayor memoria de dos capas consecutivas
+    bool completo;        // false si el filtro cuckoo se llenó
+};
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: CompararVisitados <nivel.cnf> [--tipos exacto,cuckoo,bloom]" << std::endl;
+    std::cerr << "                         [--capacidad N] [--fp P] [--muestras N] [--semilla S]" << std::endl;
+}
+
+/**
+ * @brief Recorre en anchura los estados canónicos alcanzables desde un tablero
+ * @param inicial - Tablero de partida
+ * @param visitados - Conjunto de visitados ya configurado y vacío
+ * @return RecorridoAnchura - Medidas del recorrido
+ */
+static RecorridoAnchura recorrer(const Tablero &inicial, ConjuntoVisitados &visitados)
+{
+    RecorridoAnchura recorrido;
+    recorrido.profundidad = 0;
+    recorrido.bytesFrontera = 0;
+    recorrido.completo = true;
+    auto inicio = std::chrono::steady_clock::now();
+
+    EstadoCompacto raiz;
+    raiz.desdeTablero(inicial);
+    std::vector<EstadoCompacto> frontera(1, raiz.canonico());
+    visitados.insertar(frontera[0]);
+
+    std::vector<EstadoCompacto> siguiente;
+    while (!frontera.empty())
+    {
+        siguiente.clear();
+        for (const EstadoCompacto &estado : frontera)
+        {
+            Tablero tablero;
+            estado.aTablero(tablero);
+            Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+            int numMovimientos = tablero.generarMovimientos(movimientos);
+            for (int m = 0; m < numMovimientos; m++)
+            {
+                Tablero hijo = tablero;
+                hijo.moverBola(movimientos[m].origen, movimientos[m].destino);
+                EstadoCompacto sucesor;
+                sucesor.desdeTablero(hijo);
+                sucesor = sucesor.canonico();
+                if (visitados.insertar(sucesor))
+                {
+                    siguiente.push_back(sucesor);
+                }
+            }
+        }
+        recorrido.bytesFrontera = std::max(recorrido.bytesFrontera,
+                                           (frontera.capacity() + siguiente.capacity()) * sizeof(EstadoCompacto));
+        if (visitados.estaLleno())
+        {
+            recorrido.completo = false;
+            break;
+        }
+        if (!siguiente.empty())
+        {
+            recorrido.profundidad++;
+        }
+        frontera.swap(siguiente);
+    }
+
+    recorrido.estados = visitados.getNumElementos();
+    recorrido.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return recorrido;
+}
+
+/**
+ * @brief Genera tableros aleatorios con las bolas de otro que no son alcanzables
+ * @param inicial - Tablero con las bolas
+ * @param alcanzables - Conjunto exacto de los estados alcanzables
+ * @param cantidad - Tableros a generar
+ * @param semilla - Semilla del generador
+ * @return std::vector<EstadoCompacto> - Estados canónicos que no están en alcanzables
+ */
+static std::vector<EstadoCompacto> generarNoAlcanzables(const Tablero &inicial, const ConjuntoVisitados &alcanzables,
+                                                        long long cantidad, unsigned long long semilla)
+{
+    std::vector<char> bolas;
+    for (int i = 0; i < inicial.getNumPilas(); i++)
+    {
+        const Pila &pila = inicial.getPila(i);
+        for (int j = 0; j < pila.numElementos(); j++)
+        {
+            bolas.push_back(pila.getElemento(j));
+        }
+    }
+
+    std::mt19937_64 generador(semilla);
+    std::uniform_int_distribution<int> tubo(0, inicial.getNumPilas() - 1);
+    std::vector<EstadoCompacto> muestras;
+    // Con pocas bolas casi todos los tableros son alcanzables: se limita el número de intentos
+    for (long long intento = 0; intento < cantidad * 100 && (long long)muestras.size() < cantidad; intento++)
+    {
+        std::shuffle(bolas.begin(), bolas.end(), generador);
+        Tablero tablero;
+        tablero.inicializar(inicial.getNumPilas());
+        for (char bola : bolas)
+        {
+            while (!tablero.colocarBola(tubo(generador), bola))
+            {
+            }
+        }
+        EstadoCompacto estado;
+        estado.desdeTablero(tablero);
+        estado = estado.canonico();
+        if (!alcanzables.contiene(estado))
+        {
+            muestras.push_back(estado);
+        }
+    }
+    return muestras;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string nivel = argv[1];
+    std::vector<TipoVisitados> tipos = {VISITADOS_EXACTO, VISITADOS_CUCKOO, VISITADOS_BLOOM};
+    long long capacidad = 1000000;
+    double tasaFalsosPositivos = 0.001;
+    long long numMuestras = 100000;
+    unsigned long long semilla = 1;
+
+    for (int i = 2; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--tipos" && i + 1 < argc)
+        {
+            tipos.clear();
+            std::stringstream lista(argv[++i]);
+            std::string nombre;
+            while (std::getline(lista, nombre, ','))
+            {
+                TipoVisitados tipo;
+                if (!ConjuntoVisitados::tipoDesdeNombre(nombre, tipo))
+                {
+                    mostrarUso();
+                    return 1;
+                }
+                tipos.push_back(tipo);
+            }
+        }
+        else if (opcion == "--capacidad" && i + 1 < argc)
+        {
+            capacidad = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--fp" && i + 1 < argc)
+        {
+            tasaFalsosPositivos = std::stod(argv[++i]);
+        }
+        else if (opcion == "--muestras" && i + 1 < argc)
+        {
+            numMuestras = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--semilla" && i + 1 < argc)
+        {
+            semilla = std::stoull(argv[++i]);
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    Juego juego;
+    if (!juego.inicializar(nivel))
+    {
+        std::cerr << "Error: No se pudo cargar el nivel " << nivel << std::endl;
+        return 1;
+    }
+    const Tablero &inicial = juego.getTablero();
+    EstadoCompacto prueba;
+    if (!prueba.desdeTablero(inicial))
+    {
+        std::cerr << "Error: El nivel usa colores fuera de la paleta" << std::endl;
+        return 1;
+    }
+
+    // El recorrido exacto va primero: da la referencia de estados y los negativos para los filtros
+    std::stable_sort(tipos.begin(), tipos.end(), [](TipoVisitados a, TipoVisitados b)
+                     { return a == VISITADOS_EXACTO && b != VISITADOS_EXACTO; });
+    ConjuntoVisitados exacto;
+    long long estadosExactos = -1;
+    std::vector<EstadoCompacto> negativos;
+
+    std::cout << std::left << std::setw(8) << "Tipo" << std::right << std::setw(14) << "Bytes"
+              << std::setw(11) << "Bytes/est" << std::setw(14) << "Estados" << std::setw(9) << "% exacto"
+              << std::setw(6) << "Prof" << std::setw(10) << "Seg" << std::setw(13) << "Estados/s"
+              << std::setw(14) << "Frontera" << std::setw(12) << "Falsos pos" << std::endl;
+
+    for (TipoVisitados tipo : tipos)
+    {
+        ConjuntoVisitados otro;
+        ConjuntoVisitados &visitados = tipo == VISITADOS_EXACTO ? exacto : otro;
+        if (!visitados.configurar(tipo, capacidad, tasaFalsosPositivos))
+        {
+            std::cerr << "Error: Capacidad o tasa de falsos positivos no válidas" << std::endl;
+            return 1;
+        }
+        RecorridoAnchura recorrido = recorrer(inicial, visitados);
+
+        std::string porcentaje = "-";
+        std::string falsosPositivos = "-";
+        if (tipo == VISITADOS_EXACTO)
+        {
+            estadosExactos = recorrido.estados;
+            negativos = generarNoAlcanzables(inicial, exacto, numMuestras, semilla);
+            porcentaje = "100";
+        }
+        else if (estadosExactos > 0)
+        {
+            std::ostringstream texto;
+            texto << std::fixed << std::setprecision(2) << 100.0 * recorrido.estados / estadosExactos;
+            porcentaje = texto.str();
+            if (!negativos.empty())
+            {
+                long long positivos = 0;
+                for (const EstadoCompacto &estado : negativos)
+                {
+                    positivos += visitados.contiene(estado);
+                }
+                std::ostringstream tasa;
+                tasa << std::scientific << std::setprecision(2) << (double)positivos / negativos.size();
+                falsosPositivos = tasa.str();
+            }
+        }
+
+        std::cout << std::left << std::setw(8) << ConjuntoVisitados::nombreTipo(tipo) << std::right
+                  << std::setw(14) << visitados.getBytes() << std::fixed << std::setprecision(2)
+                  << std::setw(11) << (double)visitados.getBytes() / std::max(1LL, recorrido.estados)
+                  << std::setw(14) << recorrido.estados << std::setw(9) << porcentaje
+                  << std::setw(6) << recorrido.profundidad << std::setprecision(3) << std::setw(10) << recorrido.segundos
+                  << std::setprecision(0) << std::setw(13) << recorrido.estados / std::max(1e-9, recorrido.segundos)
+                  << std::setw(14) << recorrido.bytesFrontera << std::setw(12) << falsosPositivos << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+        if (!recorrido.completo)
+        {
+            std::cout << "  El filtro cuckoo se llenó: recorrido interrumpido, aumente --capacidad" << std::endl;
+        }
+    }
+
+    if (estadosExactos >= 0)
+    {
+        std::cout << "Tableros no alcanzables para medir falsos positivos: " << negativos.size() << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,414 @@
+/**
+ * @file ConjuntoVisitados.cpp
+ * @brief Implementación del TAD ConjuntoVisitados para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD ConjuntoVisitados
+ * (ConjuntoVisitados.h). Las tres representaciones parten del hash de 64 bits
+ * de EstadoCompacto: la tabla exacta lo usa para el hueco inicial, el filtro
+ * cuckoo toma la cubeta de los bits bajos y la huella de los altos, y el
+ * filtro de Bloom obtiene la posición de cada zona combinando dos hashes
+ * (h1 + z · h2), que equivale a usar k funciones independientes.
+ *
+ * Si el filtro cuckoo no encuentra sitio tras MAX_DESALOJOS desalojos, la
+ * última huella desalojada se guarda aparte para no perderla y el filtro pasa
+ * a estar lleno: los estados que ya no caben se cuentan pero no se guardan.
+ */
+
+#include "ConjuntoVisitados.h"
+#include <cmath>
+
+static const size_t TAM_INICIAL_EXACTO = 1024; // Huecos iniciales de la tabla exacta
+static const double CARGA_CUCKOO = 0.95;       // Ocupación prevista del filtro cuckoo
+
+/**
+ * @brief Mezcla los bits de un número (finalizador de splitmix64)
+ */
+static uint64_t mezclar(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * @brief Menor potencia de 2 mayor o igual que n
+ */
+static size_t potenciaDos(size_t n)
+{
+    size_t potencia = 1;
+    while (potencia < n)
+    {
+        potencia *= 2;
+    }
+    return potencia;
+}
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+ConjuntoVisitados::ConjuntoVisitados()
+{
+    configurar(VISITADOS_EXACTO);
+}
+
+/**
+ * Elige la representación y vacía el conjunto
+ * @param tipo - Representación
+ * @param capacidad - Estados previstos (solo filtros)
+ * @param tasaFalsosPositivos - Tasa de falsos positivos con la capacidad llena (solo Bloom)
+ * @return bool - false si los parámetros no son válidos
+ * @complexity O(m) donde m es la memoria reservada
+ */
+bool ConjuntoVisitados::configurar(TipoVisitados tipo, long long capacidad, double tasaFalsosPositivos)
+{
+    if (capacidad < 1 || !(tasaFalsosPositivos > 0.0 && tasaFalsosPositivos < 1.0))
+    {
+        return false;
+    }
+    this->tipo = tipo;
+    numElementos = 0;
+    lleno = false;
+    hayVictima = false;
+    std::vector<EstadoCompacto>().swap(tabla);
+    std::vector<uint16_t>().swap(huellas);
+    std::vector<uint64_t>().swap(bits);
+    mascaraCubetas = 0;
+    numZonas = 0;
+    bitsZona = 0;
+
+    switch (tipo)
+    {
+    case VISITADOS_EXACTO:
+        tabla.assign(TAM_INICIAL_EXACTO, EstadoCompacto());
+        break;
+
+    case VISITADOS_CUCKOO:
+    {
+        size_t cubetas = potenciaDos((size_t)std::ceil(capacidad / (HUECOS_CUBETA * CARGA_CUCKOO)));
+        huellas.assign(cubetas * HUECOS_CUBETA, 0);
+        mascaraCubetas = cubetas - 1;
+        break;
+    }
+
+    case VISITADOS_BLOOM:
+    {
+        // m = -n ln p / (ln 2)^2 bits repartidos en k = log2(1/p) zonas
+        double ln2 = std::log(2.0);
+        double totalBits = -(double)capacidad * std::log(tasaFalsosPositivos) / (ln2 * ln2);
+        numZonas = std::max(1, (int)std::lround(-std::log2(tasaFalsosPositivos)));
+        bitsZona = ((uint64_t)std::ceil(totalBits / numZonas) + 63) / 64 * 64;
+        bits.assign((size_t)(bitsZona / 64 * numZonas), 0);
+        break;
+    }
+    }
+    return true;
+}
+
+/**
+ * Añade un estado
+ * @param estado - Estado a añadir
+ * @return bool - true si el estado no estaba (o el filtro lo cree nuevo)
+ * @complexity O(1) esperado
+ */
+bool ConjuntoVisitados::insertar(const EstadoCompacto &estado)
+{
+    uint64_t h = (uint64_t)estado.hash();
+    bool nuevo = false;
+    switch (tipo)
+    {
+    case VISITADOS_EXACTO:
+        nuevo = insertarExacto(estado, h);
+        break;
+    case VISITADOS_CUCKOO:
+        nuevo = insertarCuckoo(h);
+        break;
+    case VISITADOS_BLOOM:
+        nuevo = insertarBloom(h);
+        break;
+    }
+    if (nuevo)
+    {
+        numElementos++;
+    }
+    return nuevo;
+}
+
+/**
+ * Comprueba si un estado está en el conjunto
+ * @param estado - Estado a buscar
+ * @return bool - true si está (o el filtro lo cree visto)
+ * @complexity O(1) esperado
+ */
+bool ConjuntoVisitados::contiene(const EstadoCompacto &estado) const
+{
+    uint64_t h = (uint64_t)estado.hash();
+    switch (tipo)
+    {
+    case VISITADOS_EXACTO:
+    {
+        size_t mascara = tabla.size() - 1;
+        for (size_t i = (size_t)h & mascara; tabla[i].getNumPilas() != 0; i = (i + 1) & mascara)
+        {
+            if (tabla[i] == estado)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    case VISITADOS_CUCKOO:
+    {
+        uint16_t huella = huellaDe(h);
+        size_t cubeta = (size_t)h & mascaraCubetas;
+        size_t alternativa = cubetaAlternativa(cubeta, huella);
+        return cubetaTiene(cubeta, huella) || cubetaTiene(alternativa, huella) ||
+               (hayVictima && victima == huella && (victimaCubeta == cubeta || victimaCubeta == alternativa));
+    }
+
+    case VISITADOS_BLOOM:
+    {
+        uint64_t h2 = mezclar(h) | 1;
+        for (int zona = 0; zona < numZonas; zona++)
+        {
+            uint64_t bit = zona * bitsZona + (h + zona * h2) % bitsZona;
+            if ((bits[bit / 64] & (1ULL << (bit % 64))) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    }
+    return false;
+}
+
+/**
+ * Inserción en la tabla exacta por sondeo lineal; la tabla se duplica al pasar del 75 %
+ */
+bool ConjuntoVisitados::insertarExacto(const EstadoCompacto &estado, uint64_t h)
+{
+    if ((size_t)(numElementos + 1) * 4 > tabla.size() * 3)
+    {
+        std::vector<EstadoCompacto> anterior(tabla.size() * 2, EstadoCompacto());
+        anterior.swap(tabla);
+        size_t mascara = tabla.size() - 1;
+        for (const EstadoCompacto &guardado : anterior)
+        {
+            if (guardado.getNumPilas() != 0)
+            {
+                size_t i = (size_t)guardado.hash() & mascara;
+                while (tabla[i].getNumPilas() != 0)
+                {
+                    i = (i + 1) & mascara;
+                }
+                tabla[i] = guardado;
+            }
+        }
+    }
+
+    size_t mascara = tabla.size() - 1;
+    size_t i = (size_t)h & mascara;
+    while (tabla[i].getNumPilas() != 0)
+    {
+        if (tabla[i] == estado)
+        {
+            return false;
+        }
+        i = (i + 1) & mascara;
+    }
+    tabla[i] = estado;
+    return true;
+}
+
+/**
+ * Huella de 16 bits de un hash (nunca 0, que marca los huecos libres)
+ */
+uint16_t ConjuntoVisitados::huellaDe(uint64_t h)
+{
+    uint16_t huella = (uint16_t)(h >> 48);
+    return huella == 0 ? 1 : huella;
+}
+
+/**
+ * Comprueba si una cubeta tiene una huella
+ */
+bool ConjuntoVisitados::cubetaTiene(size_t cubeta, uint16_t huella) const
+{
+    const uint16_t *huecos = &huellas[cubeta * HUECOS_CUBETA];
+    return huecos[0] == huella || huecos[1] == huella || huecos[2] == huella || huecos[3] == huella;
+}
+
+/**
+ * Guarda una huella en un hueco libre de una cubeta
+ * @return bool - false si la cubeta está llena
+ */
+bool ConjuntoVisitados::cubetaAnadir(size_t cubeta, uint16_t huella)
+{
+    uint16_t *huecos = &huellas[cubeta * HUECOS_CUBETA];
+    for (int j = 0; j < HUECOS_CUBETA; j++)
+    {
+        if (huecos[j] == 0)
+        {
+            huecos[j] = huella;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Otra cubeta posible de una huella: se puede calcular desde cualquiera de las dos
+ */
+size_t ConjuntoVisitados::cubetaAlternativa(size_t cubeta, uint16_t huella) const
+{
+    return (cubeta ^ (size_t)mezclar(huella)) & mascaraCubetas;
+}
+
+/**
+ * Inserción en el filtro cuckoo: cubeta propia, alternativa o desalojos
+ */
+bool ConjuntoVisitados::insertarCuckoo(uint64_t h)
+{
+    uint16_t huella = huellaDe(h);
+    size_t cubeta = (size_t)h & mascaraCubetas;
+    size_t alternativa = cubetaAlternativa(cubeta, huella);
+    if (cubetaTiene(cubeta, huella) || cubetaTiene(alternativa, huella) ||
+        (hayVictima && victima == huella && (victimaCubeta == cubeta || victimaCubeta == alternativa)))
+    {
+        return false;
+    }
+    if (cubetaAnadir(cubeta, huella) || cubetaAnadir(alternativa, huella))
+    {
+        return true;
+    }
+    if (lleno)
+    {
+        return true; // Sin sitio: se cuenta pero no se guarda
+    }
+
+    // Desalojos: la huella ocupa un hueco y la que había busca sitio en su otra cubeta
+    size_t actual = (h >> 32) & 1 ? alternativa : cubeta;
+    for (int desalojo = 0; desalojo < MAX_DESALOJOS; desalojo++)
+    {
+        uint16_t &hueco = huellas[actual * HUECOS_CUBETA + (size_t)(mezclar(h + desalojo) % HUECOS_CUBETA)];
+        std::swap(huella, hueco);
+        actual = cubetaAlternativa(actual, huella);
+        if (cubetaAnadir(actual, huella))
+        {
+            return true;
+        }
+    }
+    hayVictima = true;
+    victima = huella;
+    victimaCubeta = actual;
+    lleno = true;
+    return true;
+}
+
+/**
+ * Inserción en el filtro de Bloom: el estado es nuevo si algún bit estaba a 0
+ */
+bool ConjuntoVisitados::insertarBloom(uint64_t h)
+{
+    uint64_t h2 = mezclar(h) | 1;
+    bool nuevo = false;
+    for (int zona = 0; zona < numZonas; zona++)
+    {
+        uint64_t bit = zona * bitsZona + (h + zona * h2) % bitsZona;
+        uint64_t &palabra = bits[bit / 64];
+        uint64_t mascara = 1ULL << (bit % 64);
+        if ((palabra & mascara) == 0)
+        {
+            palabra |= mascara;
+            nuevo = true;
+        }
+    }
+    return nuevo;
+}
+
+/**
+ * Obtiene el número de inserciones de estados nuevos
+ * @return long long - Inserciones que devolvieron true
+ * @complexity O(1)
+ */
+long long ConjuntoVisitados::getNumElementos() const
+{
+    return numElementos;
+}
+
+/**
+ * Obtiene la memoria usada por el conjunto
+ * @return size_t - Bytes de la tabla o del filtro
+ * @complexity O(1)
+ */
+size_t ConjuntoVisitados::getBytes() const
+{
+    return tabla.size() * sizeof(EstadoCompacto) + huellas.size() * sizeof(uint16_t) + bits.size() * sizeof(uint64_t);
+}
+
+/**
+ * Comprueba si el filtro cuckoo ha dejado de aceptar estados
+ * @return bool - true si algún estado no se pudo guardar
+ * @complexity O(1)
+ */
+bool ConjuntoVisitados::estaLleno() const
+{
+    return lleno;
+}
+
+/**
+ * Obtiene la representación elegida
+ * @return TipoVisitados - Representación
+ * @complexity O(1)
+ */
+TipoVisitados ConjuntoVisitados::getTipo() const
+{
+    return tipo;
+}
+
+/**
+ * Obtiene el nombre de una representación
+ * @param tipo - Representación
+ * @return std::string - Nombre
+ * @complexity O(1)
+ */
+std::string ConjuntoVisitados::nombreTipo(TipoVisitados tipo)
+{
+    switch (tipo)
+    {
+    case VISITADOS_EXACTO:
+        return "exacto";
+    case VISITADOS_CUCKOO:
+        return "cuckoo";
+    case VISITADOS_BLOOM:
+        return "bloom";
+    }
+    return "?";
+}
+
+/**
+ * Obtiene la representación con un nombre
+ * @param nombre - Nombre de la representación
+ * @param tipo - Representación
+ * @return bool - false si el nombre no es válido
+ * @complexity O(1)
+ */
+bool ConjuntoVisitados::tipoDesdeNombre(const std::string &nombre, TipoVisitados &tipo)
+{
+    for (TipoVisitados candidato : {VISITADOS_EXACTO, VISITADOS_CUCKOO, VISITADOS_BLOOM})
+    {
+        if (nombre == nombreTipo(candidato))
+        {
+            tipo = candidato;
+            return true;
+        }
+    }
+    return false;
+}
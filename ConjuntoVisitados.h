@@ -0,0 +1,175 @@
+/**
+ * @file ConjuntoVisitados.h
+ * @brief TAD ConjuntoVisitados para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) ConjuntoVisitados, el
+ * conjunto de estados ya vistos de una búsqueda en anchura, con tres
+ * representaciones que cambian exactitud por memoria:
+ *
+ * - Exacta: tabla hash de direccionamiento abierto que guarda los estados
+ *   compactos de 24 bytes, sin punteros; crece cuando se llena.
+ * - Filtro cuckoo: guarda una huella de 16 bits de cada estado en cubetas de
+ *   4 huecos, con dos cubetas posibles por estado. Ocupa unos 2,1 bytes por
+ *   estado y da un falso positivo con probabilidad de unos 8 / 2^16 (1,2 · 10^-4).
+ * - Filtro de Bloom particionado: k zonas de bits, una posición por zona y
+ *   estado, dimensionado para una tasa de falsos positivos pedida p con la
+ *   capacidad prevista: 1,44 · log2(1/p) bits por estado (14,4 bits para 10^-3).
+ *
+ * Los filtros nunca dan falsos negativos mientras no se supere su capacidad,
+ * pero un falso positivo hace que la búsqueda tome un estado nuevo por visto
+ * y no lo expanda, así que puede perder estados y todo lo que solo se alcanza
+ * a través de ellos. Con la capacidad superada, el filtro de Bloom empeora su
+ * tasa de falsos positivos y el cuckoo deja de aceptar estados (estaLleno()).
+ */
+
+#ifndef CONJUNTO_VISITADOS_H
+#define CONJUNTO_VISITADOS_H
+
+#include "EstadoCompacto.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Representación del conjunto de visitados
+ */
+enum TipoVisitados
+{
+    VISITADOS_EXACTO,
+    VISITADOS_CUCKOO,
+    VISITADOS_BLOOM
+};
+
+/**
+ * @brief TAD ConjuntoVisitados con representación exacta o aproximada
+ */
+class ConjuntoVisitados
+{
+public:
+    static const int HUECOS_CUBETA = 4;   // Huecos de cada cubeta del filtro cuckoo
+    static const int MAX_DESALOJOS = 500; // Desalojos antes de dar el filtro cuckoo por lleno
+
+private:
+    TipoVisitados tipo;     // Representación elegida
+    long long numElementos; // Inserciones que devolvieron true
+    bool lleno;             // El filtro cuckoo no pudo guardar un estado
+
+    // Exacta
+    std::vector<EstadoCompacto> tabla; // Estados (EstadoCompacto() = hueco libre)
+
+    // Filtro cuckoo
+    std::vector<uint16_t> huellas; // HUECOS_CUBETA huellas por cubeta (0 = hueco libre)
+    size_t mascaraCubetas;         // Número de cubetas - 1
+    bool hayVictima;               // Hay una huella desalojada sin cubeta
+    uint16_t victima;              // Huella desalojada sin cubeta
+    size_t victimaCubeta;          // Una de las dos cubetas de la víctima
+
+    // Filtro de Bloom particionado
+    std::vector<uint64_t> bits; // numZonas zonas de bitsZona bits seguidas
+    int numZonas;               // Zonas (una posición por zona y estado)
+    uint64_t bitsZona;          // Bits de cada zona
+
+    bool insertarExacto(const EstadoCompacto &estado, uint64_t h);
+    bool insertarCuckoo(uint64_t h);
+    bool insertarBloom(uint64_t h);
+    static uint16_t huellaDe(uint64_t h);
+    bool cubetaTiene(size_t cubeta, uint16_t huella) const;
+    bool cubetaAnadir(size_t cubeta, uint16_t huella);
+    size_t cubetaAlternativa(size_t cubeta, uint16_t huella) const;
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea un conjunto exacto vacío
+     * @complexity O(1)
+     */
+    ConjuntoVisitados();
+
+    /**
+     * @brief Elige la representación y vacía el conjunto
+     * @pre No hay precondiciones
+     * @post El conjunto está vacío; los filtros reservan su memoria para la
+     *       capacidad dada (la tabla exacta empieza pequeña y crece)
+     * @param tipo - Representación
+     * @param capacidad - Estados previstos (solo filtros)
+     * @param tasaFalsosPositivos - Tasa de falsos positivos con la capacidad llena (solo Bloom)
+     * @return bool - false si capacidad < 1 o la tasa no está en (0, 1)
+     * @complexity O(m) donde m es la memoria reservada
+     */
+    bool configurar(TipoVisitados tipo, long long capacidad = 1000000, double tasaFalsosPositivos = 0.001);
+
+    /**
+     * @brief Añade un estado
+     * @pre No hay precondiciones
+     * @post El estado (o su huella) queda en el conjunto
+     * @param estado - Estado a añadir
+     * @return bool - true si el estado no estaba; un filtro puede devolver
+     *         false con un estado nuevo (falso positivo)
+     * @complexity O(1) esperado
+     */
+    bool insertar(const EstadoCompacto &estado);
+
+    /**
+     * @brief Comprueba si un estado está en el conjunto
+     * @pre No hay precondiciones
+     * @post No modifica el conjunto
+     * @param estado - Estado a buscar
+     * @return bool - true si está; un filtro puede devolver true con un estado
+     *         que no se añadió (falso positivo)
+     * @complexity O(1) esperado
+     */
+    bool contiene(const EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene el número de inserciones de estados nuevos
+     * @return long long - Inserciones que devolvieron true
+     * @complexity O(1)
+     */
+    long long getNumElementos() const;
+
+    /**
+     * @brief Obtiene la memoria usada por el conjunto
+     * @return size_t - Bytes de la tabla o del filtro
+     * @complexity O(1)
+     */
+    size_t getBytes() const;
+
+    /**
+     * @brief Comprueba si el filtro cuckoo ha dejado de aceptar estados
+     * @return bool - true si algún estado no se pudo guardar por falta de sitio
+     * @complexity O(1)
+     */
+    bool estaLleno() const;
+
+    /**
+     * @brief Obtiene la representación elegida
+     * @return TipoVisitados - Representación
+     * @complexity O(1)
+     */
+    TipoVisitados getTipo() const;
+
+    /**
+     * @brief Obtiene el nombre de una representación
+     * @param tipo - Representación
+     * @return std::string - "exacto", "cuckoo" o "bloom"
+     * @complexity O(1)
+     */
+    static std::string nombreTipo(TipoVisitados tipo);
+
+    /**
+     * @brief Obtiene la representación con un nombre
+     * @pre No hay precondiciones
+     * @post Si el nombre es "exacto", "cuckoo" o "bloom", tipo es su representación
+     * @param nombre - Nombre de la representación
+     * @param tipo - Representación
+     * @return bool - false si el nombre no es válido
+     * @complexity O(1)
+     */
+    static bool tipoDesdeNombre(const std::string &nombre, TipoVisitados &tipo);
+};
+
+#endif // CONJUNTO_VISITADOS_H
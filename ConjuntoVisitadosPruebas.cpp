@@ -0,0 +1,184 @@
+/**
+ * @file ConjuntoVisitadosPruebas.cpp
+ * @brief Pruebas para el TAD ConjuntoVisitados del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD ConjuntoVisitados
+ * (ConjuntoVisitados.h/ConjuntoVisitados.cpp). Se insertan estados sintéticos
+ * para comprobar que los filtros no dan falsos negativos y que su tasa de
+ * falsos positivos se ajusta a la prevista, y se recorre en anchura un
+ * tablero pequeño con las tres representaciones.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "ConjuntoVisitados.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "ConjuntoVisitados.cpp"
+
+/**
+ * @brief Estado sintético distinto para cada número
+ * @param n - Número del estado (n < 4^20)
+ * @return EstadoCompacto - 10 tubos con las cifras de n en base 4 como colores
+ */
+EstadoCompacto estadoNumero(long long n)
+{
+    Tablero tablero;
+    tablero.inicializar(10);
+    for (int cifra = 0; cifra < 20; cifra++)
+    {
+        tablero.colocarBola(cifra / 2, "RGBY"[n % 4]);
+        n /= 4;
+    }
+    EstadoCompacto estado;
+    assert(estado.desdeTablero(tablero));
+    return estado;
+}
+
+/**
+ * @brief Cuenta los estados alcanzables en anchura con un conjunto de visitados
+ * @param inicial - Tablero de partida
+ * @param visitados - Conjunto ya configurado y vacío
+ * @return long long - Estados que el conjunto dio por nuevos
+ */
+long long contarAlcanzables(const Tablero &inicial, ConjuntoVisitados &visitados)
+{
+    std::vector<EstadoCompacto> frontera(1);
+    frontera[0].desdeTablero(inicial);
+    frontera[0] = frontera[0].canonico();
+    visitados.insertar(frontera[0]);
+    while (!frontera.empty())
+    {
+        std::vector<EstadoCompacto> siguiente;
+        for (const EstadoCompacto &estado : frontera)
+        {
+            Tablero tablero;
+            estado.aTablero(tablero);
+            Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+            int numMovimientos = tablero.generarMovimientos(movimientos);
+            for (int m = 0; m < numMovimientos; m++)
+            {
+                Tablero hijo = tablero;
+                hijo.moverBola(movimientos[m].origen, movimientos[m].destino);
+                EstadoCompacto sucesor;
+                sucesor.desdeTablero(hijo);
+                if (visitados.insertar(sucesor.canonico()))
+                {
+                    siguiente.push_back(sucesor.canonico());
+                }
+            }
+        }
+        frontera.swap(siguiente);
+    }
+    return visitados.getNumElementos();
+}
+
+/**
+ * @brief Ejecuta las pruebas del TAD ConjuntoVisitados
+ * @return int - 0 si todas las pruebas pasan correctamente
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD ConjuntoVisitados..." << std::endl;
+
+    const long long N = 100000;
+
+    // Prueba 1: Conjunto exacto
+    ConjuntoVisitados exacto;
+    assert(exacto.getTipo() == VISITADOS_EXACTO && exacto.getNumElementos() == 0);
+    size_t bytesIniciales = exacto.getBytes();
+    for (long long i = 0; i < N; i++)
+    {
+        assert(exacto.insertar(estadoNumero(i)));
+    }
+    for (long long i = 0; i < N; i++)
+    {
+        assert(!exacto.insertar(estadoNumero(i)) && exacto.contiene(estadoNumero(i)));
+        assert(!exacto.contiene(estadoNumero(N + i)));
+    }
+    assert(exacto.getNumElementos() == N && exacto.getBytes() > bytesIniciales && !exacto.estaLleno());
+    std::cout << "Prueba 1 superada: Conjunto exacto con " << N << " estados en " << exacto.getBytes() << " bytes"
+              << std::endl;
+
+    // Prueba 2: Filtro de Bloom sin falsos negativos y con la tasa de falsos positivos prevista
+    ConjuntoVisitados bloom;
+    assert(bloom.configurar(VISITADOS_BLOOM, N, 0.01));
+    long long tomadosPorVistos = 0;
+    for (long long i = 0; i < N; i++)
+    {
+        tomadosPorVistos += !bloom.insertar(estadoNumero(i));
+    }
+    for (long long i = 0; i < N; i++)
+    {
+        assert(bloom.contiene(estadoNumero(i)));
+    }
+    long long falsosPositivos = 0;
+    for (long long i = 0; i < N; i++)
+    {
+        falsosPositivos += bloom.contiene(estadoNumero(N + i));
+    }
+    double tasaBloom = (double)falsosPositivos / N;
+    assert(tasaBloom < 0.02 && bloom.getNumElementos() == N - tomadosPorVistos);
+    assert(bloom.getBytes() < (size_t)N * 2); // 9,6 bits por estado
+    std::cout << "Prueba 2 superada: Filtro de Bloom con " << bloom.getBytes() << " bytes y tasa de falsos positivos "
+              << tasaBloom << " (prevista 0.01)" << std::endl;
+
+    // Prueba 3: Filtro cuckoo sin falsos negativos hasta su capacidad
+    ConjuntoVisitados cuckoo;
+    assert(cuckoo.configurar(VISITADOS_CUCKOO, N));
+    for (long long i = 0; i < N; i++)
+    {
+        cuckoo.insertar(estadoNumero(i));
+    }
+    assert(!cuckoo.estaLleno());
+    falsosPositivos = 0;
+    for (long long i = 0; i < N; i++)
+    {
+        assert(cuckoo.contiene(estadoNumero(i)));
+        falsosPositivos += cuckoo.contiene(estadoNumero(N + i));
+    }
+    double tasaCuckoo = (double)falsosPositivos / N;
+    assert(tasaCuckoo < 0.001 && cuckoo.getBytes() < (size_t)N * 3);
+    std::cout << "Prueba 3 superada: Filtro cuckoo con " << cuckoo.getBytes() << " bytes y tasa de falsos positivos "
+              << tasaCuckoo << std::endl;
+
+    // Prueba 4: Filtro cuckoo desbordado y parámetros no válidos
+    ConjuntoVisitados pequeno;
+    assert(pequeno.configurar(VISITADOS_CUCKOO, 1000));
+    for (long long i = 0; i < 10000; i++)
+    {
+        pequeno.insertar(estadoNumero(i));
+    }
+    assert(pequeno.estaLleno() && pequeno.getBytes() == 512 * ConjuntoVisitados::HUECOS_CUBETA * sizeof(uint16_t));
+    assert(!pequeno.configurar(VISITADOS_BLOOM, 0) && !pequeno.configurar(VISITADOS_BLOOM, 100, 1.0));
+    assert(!pequeno.configurar(VISITADOS_BLOOM, 100, 0.0) && pequeno.estaLleno());
+    assert(pequeno.configurar(VISITADOS_CUCKOO, 1000) && !pequeno.estaLleno() && pequeno.getNumElementos() == 0);
+    TipoVisitados tipo;
+    assert(ConjuntoVisitados::tipoDesdeNombre("bloom", tipo) && tipo == VISITADOS_BLOOM);
+    assert(ConjuntoVisitados::nombreTipo(VISITADOS_CUCKOO) == "cuckoo");
+    assert(!ConjuntoVisitados::tipoDesdeNombre("bits", tipo));
+    std::cout << "Prueba 4 superada: Filtro cuckoo desbordado y parámetros no válidos" << std::endl;
+
+    // Prueba 5: Recorrido en anchura con las tres representaciones
+    Tablero tablero = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    ConjuntoVisitados recorrido;
+    long long alcanzables = contarAlcanzables(tablero, recorrido);
+    assert(recorrido.configurar(VISITADOS_CUCKOO, 10000));
+    assert(contarAlcanzables(tablero, recorrido) == alcanzables);
+    assert(recorrido.configurar(VISITADOS_BLOOM, 10000, 0.0001));
+    assert(contarAlcanzables(tablero, recorrido) == alcanzables);
+    std::cout << "Prueba 5 superada: " << alcanzables << " estados alcanzables con las tres representaciones"
+              << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD ConjuntoVisitados han sido superadas!" << std::endl;
+    return 0;
+}
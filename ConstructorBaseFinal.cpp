@@ -0,0 +1,128 @@
+/**
+ * @file ConstructorBaseFinal.cpp
+ * @brief Herramienta de construcción de bases de datos de finales
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa construye por análisis retrógrado una BaseFinal con la
+ * distancia exacta a la solución de todas las posiciones a K movimientos o
+ * menos de estar resueltas, y la guarda en un archivo que el resolutor puede
+ * proyectar en memoria. La forma del tablero (tubos y colores) se toma de un
+ * nivel .cnf o se indica directamente.
+ *
+ * Uso: ConstructorBaseFinal (--nivel nivel.cnf | --forma numPilas colores)
+ *                           --profundidad K --salida archivo
+ */
+
+#include "Juego.h"
+#include "BaseFinal.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: ConstructorBaseFinal (--nivel nivel.cnf | --forma numPilas colores)" << std::endl;
+    std::cerr << "                            --profundidad K --salida archivo" << std::endl;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    std::string nivel, colores, salida;
+    int numPilas = 0;
+    int profundidad = -1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--nivel" && i + 1 < argc)
+        {
+            nivel = argv[++i];
+        }
+        else if (opcion == "--forma" && i + 2 < argc)
+        {
+            numPilas = std::stoi(argv[++i]);
+            colores = argv[++i];
+        }
+        else if (opcion == "--profundidad" && i + 1 < argc)
+        {
+            profundidad = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--salida" && i + 1 < argc)
+        {
+            salida = argv[++i];
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    if (!nivel.empty())
+    {
+        // Deducir la forma a partir del nivel: un tubo completo por cada 4 bolas de un color
+        Juego juego;
+        EstadoCompacto estado;
+        uint64_t tubosPorColor;
+        if (!juego.inicializar(nivel) || !estado.desdeTablero(juego.getTablero()) ||
+            !BaseFinal::calcularForma(estado, tubosPorColor))
+        {
+            std::cerr << "Error: No se pudo obtener la forma del nivel " << nivel << std::endl;
+            return 1;
+        }
+        numPilas = estado.getNumPilas();
+        colores.clear();
+        for (int color = 1; color <= EstadoCompacto::MAX_COLORES; color++)
+        {
+            int tubos = (int)((tubosPorColor >> (4 * (color - 1))) & 0xF);
+            colores.append(tubos, EstadoCompacto::colorIndice(color));
+        }
+    }
+
+    if (numPilas == 0 || profundidad < 0 || salida.empty())
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::cout << "Construyendo base de finales: " << numPilas << " tubos, colores " << colores
+              << ", profundidad " << profundidad << std::endl;
+
+    auto inicio = std::chrono::steady_clock::now();
+    BaseFinal base;
+    if (!base.construir(numPilas, colores, profundidad, &std::cout))
+    {
+        std::cerr << "Error: No se pudo construir la base (forma no válida)" << std::endl;
+        return 1;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    if (!base.guardar(salida))
+    {
+        std::cerr << "Error: No se pudo escribir " << salida << std::endl;
+        return 1;
+    }
+
+    std::cout << "Posiciones almacenadas: " << base.getNumPosiciones() << std::endl;
+    std::cout << "Tiempo: " << segundos << " s" << std::endl;
+    std::cout << "Base guardada en " << salida << std::endl;
+    return 0;
+}
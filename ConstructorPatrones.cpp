@@ -0,0 +1,137 @@
+/**
+ * @file ConstructorPatrones.cpp
+ * @brief Herramienta de construcción de bases de datos de patrones
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa construye offline una BasePatrones para un subconjunto de
+ * colores de la forma de un nivel y la guarda en un archivo que el resolutor
+ * carga al arrancar. Para obtener cotas aditivas se construye una base por
+ * cada grupo de una partición de los colores (por ejemplo RG, BY y MC).
+ *
+ * Uso: ConstructorPatrones (--nivel nivel.cnf | --forma numPilas tubosComodin)
+ *                          --patron colores --salida archivo [--max-posiciones N]
+ */
+
+#include "Juego.h"
+#include "BasePatrones.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BasePatrones.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: ConstructorPatrones (--nivel nivel.cnf | --forma numPilas tubosComodin)" << std::endl;
+    std::cerr << "                           --patron colores --salida archivo [--max-posiciones N]" << std::endl;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    std::string nivel, patron, salida;
+    int numPilas = 0;
+    int tubosComodin = -1;
+    long long maxPosiciones = 50000000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--nivel" && i + 1 < argc)
+        {
+            nivel = argv[++i];
+        }
+        else if (opcion == "--forma" && i + 2 < argc)
+        {
+            numPilas = std::stoi(argv[++i]);
+            tubosComodin = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--patron" && i + 1 < argc)
+        {
+            patron = argv[++i];
+        }
+        else if (opcion == "--salida" && i + 1 < argc)
+        {
+            salida = argv[++i];
+        }
+        else if (opcion == "--max-posiciones" && i + 1 < argc)
+        {
+            maxPosiciones = std::stoll(argv[++i]);
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    if (!nivel.empty())
+    {
+        // Deducir la forma: las bolas que no son del patrón llenan los tubos comodín
+        Juego juego;
+        if (!juego.inicializar(nivel))
+        {
+            std::cerr << "Error: No se pudo cargar el nivel " << nivel << std::endl;
+            return 1;
+        }
+        const Tablero &tablero = juego.getTablero();
+        int bolasComodin = 0;
+        for (int pila = 0; pila < tablero.getNumPilas(); pila++)
+        {
+            for (int posicion = 0; posicion < tablero.getPila(pila).numElementos(); posicion++)
+            {
+                if (patron.find(tablero.getPila(pila).getElemento(posicion)) == std::string::npos)
+                {
+                    bolasComodin++;
+                }
+            }
+        }
+        numPilas = tablero.getNumPilas();
+        tubosComodin = bolasComodin / Pila::CAPACIDAD_MAXIMA;
+    }
+
+    if (numPilas == 0 || tubosComodin < 0 || patron.empty() || salida.empty())
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::cout << "Construyendo base de patrones " << patron << ": " << numPilas << " tubos, " << tubosComodin
+              << " tubos comodín" << std::endl;
+
+    auto inicio = std::chrono::steady_clock::now();
+    BasePatrones base;
+    if (!base.construir(numPilas, patron, tubosComodin, maxPosiciones, &std::cout))
+    {
+        std::cerr << "Error: No se pudo construir la base (forma o patrón no válidos)" << std::endl;
+        return 1;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    if (!base.guardar(salida))
+    {
+        std::cerr << "Error: No se pudo escribir " << salida << std::endl;
+        return 1;
+    }
+
+    std::cout << "Posiciones almacenadas: " << base.getNumPosiciones()
+              << (base.esCompleta() ? " (completa)" : " (truncada)") << std::endl;
+    std::cout << "Tiempo: " << segundos << " s" << std::endl;
+    std::cout << "Base guardada en " << salida << std::endl;
+    return 0;
+}
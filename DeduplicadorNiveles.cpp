@@ -0,0 +1,534 @@
+/**
+ * @file DeduplicadorNiveles.cpp
+ * @brief Implementación del TAD DeduplicadorNiveles para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD
+ * DeduplicadorNiveles (DeduplicadorNiveles.h): la forma canónica de un nivel
+ * (refinamiento de clases de colores y prueba de los empates), la tabla hash de
+ * huellas con comparación completa y la lectura de paquetes de niveles.
+ */
+
+#include "DeduplicadorNiveles.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+// Bolas que caben en el tablero más grande
+static const int MAX_BOLAS_TABLERO = Tablero::MAX_PILAS * Pila::CAPACIDAD_MAXIMA;
+
+/**
+ * @brief Firma de un color durante el refinamiento de clases
+ *
+ * Cada bola aporta su altura y el contenido de su tubo escrito con las clases
+ * actuales, de modo que la firma no depende de la letra de ningún color.
+ */
+struct FirmaColor
+{
+    int color;                          // Índice del color en la paleta
+    int clase;                          // Clase del color en la ronda anterior
+    int numBolas;                       // Bolas del color
+    uint32_t bolas[MAX_BOLAS_TABLERO];  // (altura << 16) | tubo en clases, ordenadas
+};
+
+/**
+ * Compara dos firmas sin tener en cuenta el color
+ * @param a - Primera firma
+ * @param b - Segunda firma
+ * @return int - Negativo, cero o positivo como strcmp
+ * @complexity O(b) donde b es el número de bolas del color
+ */
+static int compararFirmas(const FirmaColor &a, const FirmaColor &b)
+{
+    if (a.clase != b.clase)
+    {
+        return a.clase < b.clase ? -1 : 1;
+    }
+    if (a.numBolas != b.numBolas)
+    {
+        return a.numBolas < b.numBolas ? -1 : 1;
+    }
+    for (int i = 0; i < a.numBolas; i++)
+    {
+        if (a.bolas[i] != b.bolas[i])
+        {
+            return a.bolas[i] < b.bolas[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Ordena los colores de un estado por clases que no dependen de sus letras
+ * @param estado - Estado a clasificar
+ * @param colores - Colores presentes, ordenados por clase
+ * @param clase - Clase de cada color (desde 1; 0 para los ausentes)
+ * @return int - Número de colores presentes
+ * @complexity O(r * c * (b + c)) donde r es el número de rondas, c el de colores y b el de bolas
+ */
+static int clasificarColores(const EstadoCompacto &estado, int colores[EstadoCompacto::MAX_COLORES],
+                             int clase[EstadoCompacto::MAX_COLORES + 1])
+{
+    int numPilas = estado.getNumPilas();
+    int numColores = 0;
+    for (int color = 0; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        clase[color] = 0;
+    }
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            int color = estado.getBola(pila, posicion);
+            if (clase[color] == 0)
+            {
+                clase[color] = 1;
+                colores[numColores++] = color;
+            }
+        }
+    }
+
+    FirmaColor firmas[EstadoCompacto::MAX_COLORES];
+    int numClases = 1;
+    while (numClases < numColores)
+    {
+        // Contenido de cada tubo escrito con las clases actuales
+        uint32_t perfiles[Tablero::MAX_PILAS];
+        for (int pila = 0; pila < numPilas; pila++)
+        {
+            perfiles[pila] = 0;
+            for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+            {
+                uint32_t claseBola = (uint32_t)clase[estado.getBola(pila, posicion)];
+                perfiles[pila] |= claseBola << (EstadoCompacto::BITS_POR_BOLA * posicion);
+            }
+        }
+
+        int indiceFirma[EstadoCompacto::MAX_COLORES + 1] = {0};
+        for (int i = 0; i < numColores; i++)
+        {
+            firmas[i].color = colores[i];
+            firmas[i].clase = clase[colores[i]];
+            firmas[i].numBolas = 0;
+            indiceFirma[colores[i]] = i;
+        }
+        for (int pila = 0; pila < numPilas; pila++)
+        {
+            for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+            {
+                FirmaColor &firma = firmas[indiceFirma[estado.getBola(pila, posicion)]];
+                firma.bolas[firma.numBolas++] = ((uint32_t)posicion << 16) | perfiles[pila];
+            }
+        }
+        for (int i = 0; i < numColores; i++)
+        {
+            std::sort(firmas[i].bolas, firmas[i].bolas + firmas[i].numBolas);
+        }
+
+        // Ordenación por inserción: hay pocos colores
+        for (int i = 1; i < numColores; i++)
+        {
+            FirmaColor firma = firmas[i];
+            int j = i;
+            while (j > 0 && compararFirmas(firmas[j - 1], firma) > 0)
+            {
+                firmas[j] = firmas[j - 1];
+                j--;
+            }
+            firmas[j] = firma;
+        }
+
+        // La firma incluye la clase anterior, así que las clases solo se dividen
+        int nuevasClases = 1;
+        for (int i = 0; i < numColores; i++)
+        {
+            if (i > 0 && compararFirmas(firmas[i - 1], firmas[i]) != 0)
+            {
+                nuevasClases++;
+            }
+            clase[firmas[i].color] = nuevasClases;
+            colores[i] = firmas[i].color;
+        }
+        if (nuevasClases == numClases)
+        {
+            break;
+        }
+        numClases = nuevasClases;
+    }
+    return numColores;
+}
+
+/**
+ * Aplica a un estado la numeración de colores dada por su orden
+ * @param estado - Estado original
+ * @param colores - Colores en el orden en que se numeran desde 1
+ * @param numColores - Número de colores
+ * @return EstadoCompacto - Estado renumerado con los tubos ordenados
+ * @complexity O(b + p^2) donde b es el número de bolas y p el de pilas
+ */
+static EstadoCompacto renumerar(const EstadoCompacto &estado, const int colores[EstadoCompacto::MAX_COLORES],
+                                int numColores)
+{
+    int mapa[EstadoCompacto::MAX_COLORES + 1] = {0};
+    for (int i = 0; i < numColores; i++)
+    {
+        mapa[colores[i]] = i + 1;
+    }
+    return estado.recolorear(mapa).canonico();
+}
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+DeduplicadorNiveles::DeduplicadorNiveles()
+{
+    numNiveles = 0;
+    numColisiones = 0;
+}
+
+/**
+ * Calcula la forma canónica de un tablero
+ * @param tablero - Tablero a reducir
+ * @param canonico - Forma canónica
+ * @return bool - false si algún color no está en la paleta
+ * @complexity O(c^2 * b) normalmente, más los órdenes de los empates que no son simetrías
+ */
+bool DeduplicadorNiveles::formaCanonica(const Tablero &tablero, EstadoCompacto &canonico)
+{
+    EstadoCompacto estado;
+    if (!estado.desdeTablero(tablero))
+    {
+        return false;
+    }
+
+    int colores[EstadoCompacto::MAX_COLORES] = {0};
+    int clase[EstadoCompacto::MAX_COLORES + 1];
+    int numColores = clasificarColores(estado, colores, clase);
+    canonico = renumerar(estado, colores, numColores);
+
+    // Grupos de colores empatados: si cambiar el primero por cualquier otro deja
+    // el mismo tablero, todos sus órdenes dan el mismo resultado y no se prueban
+    int iniciosGrupo[EstadoCompacto::MAX_COLORES];
+    int finesGrupo[EstadoCompacto::MAX_COLORES];
+    int numGrupos = 0;
+    for (int inicio = 0; inicio < numColores;)
+    {
+        int fin = inicio + 1;
+        while (fin < numColores && clase[colores[fin]] == clase[colores[inicio]])
+        {
+            fin++;
+        }
+        bool simetrico = true;
+        for (int i = inicio + 1; i < fin && simetrico; i++)
+        {
+            std::swap(colores[inicio], colores[i]);
+            simetrico = renumerar(estado, colores, numColores) == canonico;
+            std::swap(colores[inicio], colores[i]);
+        }
+        if (!simetrico)
+        {
+            iniciosGrupo[numGrupos] = inicio;
+            finesGrupo[numGrupos] = fin;
+            numGrupos++;
+        }
+        inicio = fin;
+    }
+    if (numGrupos == 0)
+    {
+        return true;
+    }
+
+    // Probar todos los órdenes de los grupos empatados (como un cuentakilómetros)
+    for (int grupo = 0; grupo < numGrupos; grupo++)
+    {
+        std::sort(colores + iniciosGrupo[grupo], colores + finesGrupo[grupo]);
+    }
+    canonico = renumerar(estado, colores, numColores);
+    while (true)
+    {
+        int grupo = numGrupos - 1;
+        while (grupo >= 0 && !std::next_permutation(colores + iniciosGrupo[grupo], colores + finesGrupo[grupo]))
+        {
+            grupo--;
+        }
+        if (grupo < 0)
+        {
+            break;
+        }
+        EstadoCompacto candidato = renumerar(estado, colores, numColores);
+        if (candidato < canonico)
+        {
+            canonico = candidato;
+        }
+    }
+    return true;
+}
+
+/**
+ * Duplica la tabla hash y vuelve a colocar los grupos
+ * @complexity O(g) donde g es el número de grupos
+ */
+void DeduplicadorNiveles::ampliarTabla()
+{
+    size_t tam = huecos.empty() ? 1024 : huecos.size() * 2;
+    huecos.assign(tam, Hueco{0, -1});
+    size_t mascara = tam - 1;
+    for (size_t grupo = 0; grupo < canonicos.size(); grupo++)
+    {
+        uint64_t huella = (uint64_t)canonicos[grupo].hash();
+        size_t i = (size_t)huella & mascara;
+        while (huecos[i].grupo >= 0)
+        {
+            i = (i + 1) & mascara;
+        }
+        huecos[i] = Hueco{huella, (int32_t)grupo};
+    }
+}
+
+/**
+ * Añade un nivel
+ * @param tablero - Nivel a añadir
+ * @param nuevo - true si el nivel ha creado un grupo
+ * @return int - Grupo del nivel, o -1 si algún color no está en la paleta
+ * @complexity O(1) esperado más el coste de formaCanonica
+ */
+int DeduplicadorNiveles::agregar(const Tablero &tablero, bool &nuevo)
+{
+    nuevo = false;
+    EstadoCompacto canonico;
+    if (!formaCanonica(tablero, canonico))
+    {
+        return -1;
+    }
+    numNiveles++;
+
+    // Mantener la ocupación por debajo de la mitad
+    if ((canonicos.size() + 1) * 2 > huecos.size())
+    {
+        ampliarTabla();
+    }
+
+    uint64_t huella = (uint64_t)canonico.hash();
+    size_t mascara = huecos.size() - 1;
+    size_t i = (size_t)huella & mascara;
+    while (huecos[i].grupo >= 0)
+    {
+        if (huecos[i].huella == huella)
+        {
+            // Comprobación completa: dos formas distintas pueden tener la misma huella
+            if (canonicos[huecos[i].grupo] == canonico)
+            {
+                tamGrupos[huecos[i].grupo]++;
+                return huecos[i].grupo;
+            }
+            numColisiones++;
+        }
+        i = (i + 1) & mascara;
+    }
+
+    int grupo = (int)canonicos.size();
+    huecos[i] = Hueco{huella, (int32_t)grupo};
+    canonicos.push_back(canonico);
+    EstadoCompacto original;
+    original.desdeTablero(tablero);
+    representantes.push_back(original);
+    tamGrupos.push_back(1);
+    nuevo = true;
+    return grupo;
+}
+
+/**
+ * Indica si una línea está vacía o es un comentario (las mismas reglas que Juego)
+ * @param inicio - Primer carácter de la línea tras los espacios iniciales
+ * @param fin - Fin de la línea
+ * @return bool - true si la línea se ignora
+ * @complexity O(1)
+ */
+static bool lineaIgnorada(const char *inicio, const char *fin)
+{
+    if (inicio == fin || *inicio == '\r')
+    {
+        return true;
+    }
+    return *inicio == '*' || (fin - inicio >= 2 && inicio[0] == '/' && (inicio[1] == '/' || inicio[1] == '*'));
+}
+
+/**
+ * Añade todos los niveles de un texto en formato de paquete
+ * @param texto - Contenido de un paquete
+ * @param niveles - Resultado de cada nivel
+ * @complexity O(T) más el coste de agregar por nivel, donde T es el tamaño del texto
+ */
+void DeduplicadorNiveles::agregarTexto(const std::string &texto, std::vector<NivelPaquete> &niveles)
+{
+    const char *p = texto.data();
+    const char *finTexto = p + texto.size();
+    long long numLinea = 0;
+
+    Tablero tablero;
+    int numPilas = 0; // 0 mientras se espera el número de tubos
+    int tubosLeidos = 0;
+    long long lineaNivel = 0;
+
+    while (p < finTexto)
+    {
+        const char *finLinea = (const char *)std::memchr(p, '\n', (size_t)(finTexto - p));
+        if (finLinea == nullptr)
+        {
+            finLinea = finTexto;
+        }
+        const char *inicio = p;
+        while (inicio < finLinea && (*inicio == ' ' || *inicio == '\t'))
+        {
+            inicio++;
+        }
+        numLinea++;
+
+        if (lineaIgnorada(inicio, finLinea))
+        {
+            p = finLinea + 1;
+            continue;
+        }
+
+        if (numPilas == 0)
+        {
+            // Número de tubos del nivel siguiente
+            int valor = 0;
+            const char *c = inicio;
+            while (c < finLinea && *c >= '0' && *c <= '9' && valor <= Tablero::MAX_PILAS)
+            {
+                valor = valor * 10 + (*c - '0');
+                c++;
+            }
+            p = finLinea + 1;
+            if (c == inicio || valor < 2 || valor > Tablero::MAX_PILAS)
+            {
+                niveles.push_back(NivelPaquete{numLinea, -1, false});
+                continue;
+            }
+            numPilas = valor;
+            tubosLeidos = 0;
+            lineaNivel = numLinea;
+            tablero = Tablero();
+            tablero.inicializar(numPilas);
+        }
+        else if (finLinea - inicio < Pila::CAPACIDAD_MAXIMA)
+        {
+            // Tubo incompleto: el nivel está mal formado y la línea puede ser el
+            // número de tubos del siguiente, así que se vuelve a leer
+            niveles.push_back(NivelPaquete{lineaNivel, -1, false});
+            numPilas = 0;
+            numLinea--;
+            continue;
+        }
+        else
+        {
+            for (int j = 0; j < Pila::CAPACIDAD_MAXIMA; j++)
+            {
+                tablero.colocarBola(tubosLeidos, inicio[j]);
+            }
+            tubosLeidos++;
+            p = finLinea + 1;
+        }
+
+        // Las dos últimas pilas siempre están vacías
+        if (tubosLeidos == numPilas - 2)
+        {
+            NivelPaquete nivel{lineaNivel, -1, false};
+            nivel.grupo = agregar(tablero, nivel.nuevo);
+            niveles.push_back(nivel);
+            numPilas = 0;
+        }
+    }
+
+    if (numPilas != 0)
+    {
+        niveles.push_back(NivelPaquete{lineaNivel, -1, false});
+    }
+}
+
+/**
+ * Añade todos los niveles de un archivo en formato de paquete
+ * @param nombreArchivo - Ruta del archivo
+ * @param niveles - Resultado de cada nivel
+ * @return bool - false si no se pudo leer el archivo
+ * @complexity O(T) más el coste de agregar por nivel, donde T es el tamaño del archivo
+ */
+bool DeduplicadorNiveles::agregarArchivo(const std::string &nombreArchivo, std::vector<NivelPaquete> &niveles)
+{
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+
+    std::string texto((std::istreambuf_iterator<char>(archivo)), std::istreambuf_iterator<char>());
+    agregarTexto(texto, niveles);
+    return true;
+}
+
+/**
+ * Obtiene el número de grupos
+ * @return int - Número de grupos
+ * @complexity O(1)
+ */
+int DeduplicadorNiveles::getNumGrupos() const
+{
+    return (int)canonicos.size();
+}
+
+/**
+ * Obtiene el número de niveles añadidos
+ * @return long long - Niveles añadidos
+ * @complexity O(1)
+ */
+long long DeduplicadorNiveles::getNumNiveles() const
+{
+    return numNiveles;
+}
+
+/**
+ * Obtiene cuántos niveles tiene un grupo
+ * @param grupo - Grupo
+ * @return int - Niveles del grupo
+ * @complexity O(1)
+ */
+int DeduplicadorNiveles::getTamGrupo(int grupo) const
+{
+    return tamGrupos[grupo];
+}
+
+/**
+ * Obtiene el primer nivel de un grupo
+ * @param grupo - Grupo
+ * @return const EstadoCompacto& - Nivel representante
+ * @complexity O(1)
+ */
+const EstadoCompacto &DeduplicadorNiveles::getRepresentante(int grupo) const
+{
+    return representantes[grupo];
+}
+
+/**
+ * Obtiene la forma canónica de un grupo
+ * @param grupo - Grupo
+ * @return const EstadoCompacto& - Forma canónica
+ * @complexity O(1)
+ */
+const EstadoCompacto &DeduplicadorNiveles::getCanonico(int grupo) const
+{
+    return canonicos[grupo];
+}
+
+/**
+ * Obtiene cuántas veces coincidieron las huellas de dos formas distintas
+ * @return long long - Colisiones
+ * @complexity O(1)
+ */
+long long DeduplicadorNiveles::getNumColisiones() const
+{
+    return numColisiones;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file DeduplicadorNiveles.h
+ * @brief TAD DeduplicadorNiveles para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) DeduplicadorNiveles,
+ * que agrupa los niveles repetidos de un paquete. Dos niveles son el mismo si
+ * solo se diferencian en el orden de los tubos o en las letras de los colores,
+ * así que cada nivel se reduce a una forma canónica:
+ *
+ * - Los colores se ordenan por su posición en el tablero, sin mirar su letra:
+ *   se refina una clase por color con las alturas de sus bolas y el contenido
+ *   de los tubos donde están, hasta que las clases no cambian.
+ * - Los colores que siguen empatados se prueban en todos sus órdenes, salvo
+ *   los grupos cuyos colores son intercambiables (cambiar dos de ellos deja el
+ *   mismo tablero), que dan siempre el mismo resultado.
+ * - Con los colores renombrados, los tubos se ordenan con EstadoCompacto::canonico.
+ *
+ * Los grupos se guardan en una tabla hash de direccionamiento abierto con la
+ * huella de 64 bits de la forma canónica; cuando dos huellas coinciden se
+ * comparan las formas completas, así que una colisión nunca junta dos niveles
+ * distintos.
+ *
+ * Los paquetes son archivos con uno o varios niveles seguidos en el formato de
+ * ballSort.cnf (número de tubos y un tubo lleno por línea; los dos últimos
+ * tubos son los vacíos y no se escriben). Un archivo .cnf es un paquete de un
+ * solo nivel.
+ */
+
+#ifndef DEDUPLICADOR_NIVELES_H
+#define DEDUPLICADOR_NIVELES_H
+
+#include "EstadoCompacto.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Resultado de añadir un nivel de un paquete
+ */
+struct NivelPaquete
+{
+    long long linea; // Línea del número de tubos en el texto (desde 1)
+    int grupo;       // Grupo del nivel, o -1 si el nivel está mal formado
+    bool nuevo;      // true si es el primer nivel de su grupo
+};
+
+/**
+ * @brief TAD DeduplicadorNiveles que agrupa niveles iguales salvo orden de tubos y colores
+ */
+class DeduplicadorNiveles
+{
+private:
+    /**
+     * @brief Hueco de la tabla hash
+     */
+    struct Hueco
+    {
+        uint64_t huella; // Hash de la forma canónica
+        int32_t grupo;   // Grupo guardado en el hueco (-1 si está libre)
+    };
+
+    std::vector<Hueco> huecos;                   // Tabla hash (tamaño potencia de dos)
+    std::vector<EstadoCompacto> canonicos;       // Forma canónica de cada grupo
+    std::vector<EstadoCompacto> representantes;  // Primer nivel de cada grupo, tal como se leyó
+    std::vector<int> tamGrupos;                  // Niveles de cada grupo
+    long long numNiveles;                        // Niveles añadidos
+    long long numColisiones;                     // Huellas iguales con formas canónicas distintas
+
+    void ampliarTabla();
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea un deduplicador sin niveles
+     * @complexity O(1)
+     */
+    DeduplicadorNiveles();
+
+    /**
+     * @brief Calcula la forma canónica de un tablero
+     * @pre No hay precondiciones
+     * @post Si el tablero se puede codificar, canonico es igual para todos los
+     *       tableros que solo se diferencian en el orden de los tubos y en las
+     *       letras de los colores, y distinto para los demás
+     * @param tablero - Tablero a reducir
+     * @param canonico - Forma canónica
+     * @return bool - false si algún color no está en la paleta de EstadoCompacto
+     * @complexity O(c^2 * b) normalmente, donde c es el número de colores y b el de
+     *             bolas; los empates que no son simetrías multiplican el coste
+     *             por el número de órdenes posibles
+     */
+    static bool formaCanonica(const Tablero &tablero, EstadoCompacto &canonico);
+
+    /**
+     * @brief Añade un nivel
+     * @pre No hay precondiciones
+     * @post El nivel queda en el grupo de los niveles iguales a él (uno nuevo si no hay)
+     * @param tablero - Nivel a añadir
+     * @param nuevo - true si el nivel ha creado un grupo
+     * @return int - Grupo del nivel, o -1 si algún color no está en la paleta
+     * @complexity O(1) esperado más el coste de formaCanonica
+     */
+    int agregar(const Tablero &tablero, bool &nuevo);
+
+    /**
+     * @brief Añade todos los niveles de un texto en formato de paquete
+     * @pre No hay precondiciones
+     * @post niveles contiene una entrada por nivel del texto, en orden; los
+     *       niveles mal formados tienen grupo -1 y no se añaden
+     * @param texto - Contenido de un paquete
+     * @param niveles - Resultado de cada nivel
+     * @complexity O(T) más el coste de agregar por nivel, donde T es el tamaño del texto
+     */
+    void agregarTexto(const std::string &texto, std::vector<NivelPaquete> &niveles);
+
+    /**
+     * @brief Añade todos los niveles de un archivo en formato de paquete
+     * @pre No hay precondiciones
+     * @post Como agregarTexto con el contenido del archivo
+     * @param nombreArchivo - Ruta del archivo
+     * @param niveles - Resultado de cada nivel
+     * @return bool - false si no se pudo leer el archivo
+     * @complexity O(T) más el coste de agregar por nivel, donde T es el tamaño del archivo
+     */
+    bool agregarArchivo(const std::string &nombreArchivo, std::vector<NivelPaquete> &niveles);
+
+    /**
+     * @brief Obtiene el número de grupos (niveles distintos)
+     * @return int - Número de grupos
+     * @complexity O(1)
+     */
+    int getNumGrupos() const;
+
+    /**
+     * @brief Obtiene el número de niveles añadidos
+     * @return long long - Niveles añadidos (sin contar los mal formados)
+     * @complexity O(1)
+     */
+    long long getNumNiveles() const;
+
+    /**
+     * @brief Obtiene cuántos niveles tiene un grupo
+     * @pre 0 <= grupo < getNumGrupos()
+     * @param grupo - Grupo
+     * @return int - Niveles del grupo
+     * @complexity O(1)
+     */
+    int getTamGrupo(int grupo) const;
+
+    /**
+     * @brief Obtiene el primer nivel de un grupo, con sus tubos y colores originales
+     * @pre 0 <= grupo < getNumGrupos()
+     * @param grupo - Grupo
+     * @return const EstadoCompacto& - Nivel representante
+     * @complexity O(1)
+     */
+    const EstadoCompacto &getRepresentante(int grupo) const;
+
+    /**
+     * @brief Obtiene la forma canónica de un grupo
+     * @pre 0 <= grupo < getNumGrupos()
+     * @param grupo - Grupo
+     * @return const EstadoCompacto& - Forma canónica
+     * @complexity O(1)
+     */
+    const EstadoCompacto &getCanonico(int grupo) const;
+
+    /**
+     * @brief Obtiene cuántas veces coincidieron las huellas de dos formas distintas
+     * @return long long - Colisiones resueltas con la comparación completa
+     * @complexity O(1)
+     */
+    long long getNumColisiones() const;
+};
+
+#endif // DEDUPLICADOR_NIVELES_H
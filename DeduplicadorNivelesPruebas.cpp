@@ -0,0 +1,212 @@
+/**
+ * @file DeduplicadorNivelesPruebas.cpp
+ * @brief Pruebas para el TAD DeduplicadorNiveles del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD DeduplicadorNiveles
+ * (DeduplicadorNiveles.h/DeduplicadorNiveles.cpp). La forma canónica se
+ * contrasta con la fuerza bruta (mínimo sobre todas las numeraciones de los
+ * colores) en niveles aleatorios pequeños: las dos tienen que agrupar los
+ * niveles de la misma forma.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "DeduplicadorNiveles.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <map>
+#include <random>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "DeduplicadorNiveles.cpp"
+
+/**
+ * @brief Forma canónica por fuerza bruta: mínimo sobre todas las numeraciones de colores
+ * @param tablero - Tablero a reducir
+ * @return EstadoCompacto - Forma canónica
+ */
+EstadoCompacto canonicoFuerzaBruta(const Tablero &tablero)
+{
+    EstadoCompacto estado;
+    assert(estado.desdeTablero(tablero));
+    std::vector<int> colores;
+    for (int pila = 0; pila < estado.getNumPilas(); pila++)
+    {
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            colores.push_back(estado.getBola(pila, posicion));
+        }
+    }
+    std::sort(colores.begin(), colores.end());
+    colores.erase(std::unique(colores.begin(), colores.end()), colores.end());
+
+    std::vector<int> etiquetas(colores.size());
+    for (size_t i = 0; i < etiquetas.size(); i++)
+    {
+        etiquetas[i] = (int)i + 1;
+    }
+    EstadoCompacto mejor;
+    bool primero = true;
+    do
+    {
+        int mapa[EstadoCompacto::MAX_COLORES + 1] = {0};
+        for (size_t i = 0; i < colores.size(); i++)
+        {
+            mapa[colores[i]] = etiquetas[i];
+        }
+        EstadoCompacto candidato = estado.recolorear(mapa).canonico();
+        if (primero || candidato < mejor)
+        {
+            mejor = candidato;
+            primero = false;
+        }
+    } while (std::next_permutation(etiquetas.begin(), etiquetas.end()));
+    return mejor;
+}
+
+/**
+ * @brief Crea un nivel aleatorio con los tubos llenos
+ * @param numColores - Número de colores (y de tubos llenos)
+ * @param generador - Generador de números aleatorios
+ * @return std::vector<std::string> - Tubos del nivel
+ */
+std::vector<std::string> nivelAleatorio(int numColores, std::mt19937 &generador)
+{
+    const std::string PALETA = "RGBYMC";
+    std::string bolas;
+    for (int color = 0; color < numColores; color++)
+    {
+        bolas += std::string(Pila::CAPACIDAD_MAXIMA, PALETA[color]);
+    }
+    std::shuffle(bolas.begin(), bolas.end(), generador);
+    std::vector<std::string> tubos;
+    for (int i = 0; i < numColores; i++)
+    {
+        tubos.push_back(bolas.substr(i * Pila::CAPACIDAD_MAXIMA, Pila::CAPACIDAD_MAXIMA));
+    }
+    return tubos;
+}
+
+/**
+ * @brief Cambia de orden los tubos y de letra los colores de un nivel
+ * @param tubos - Tubos del nivel
+ * @param generador - Generador de números aleatorios
+ * @return std::vector<std::string> - El mismo nivel con otro aspecto
+ */
+std::vector<std::string> variante(std::vector<std::string> tubos, std::mt19937 &generador)
+{
+    std::string letras = "RGBYMCOPWK";
+    std::string nuevas = letras;
+    std::shuffle(nuevas.begin(), nuevas.end(), generador);
+    for (std::string &tubo : tubos)
+    {
+        for (char &color : tubo)
+        {
+            color = nuevas[letras.find(color)];
+        }
+    }
+    std::shuffle(tubos.begin(), tubos.end(), generador);
+    return tubos;
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD DeduplicadorNiveles..." << std::endl;
+
+    // Prueba 1: Orden de los tubos y letras de los colores
+    EstadoCompacto a, b, c;
+    assert(DeduplicadorNiveles::formaCanonica(crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"}), a));
+    assert(DeduplicadorNiveles::formaCanonica(crearTablero(6, {"", "ORMC", "MCOR", "MOCR", "CROM"}), b));
+    assert(a == b);
+    assert(DeduplicadorNiveles::formaCanonica(crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGYB"}), c));
+    assert(a != c);
+    assert(!DeduplicadorNiveles::formaCanonica(crearTablero(4, {"RRRX", "XXXR"}), c));
+    std::cout << "Prueba 1 superada: Orden de los tubos y letras de los colores" << std::endl;
+
+    // Prueba 2: Agrupa igual que la fuerza bruta, también en niveles simétricos
+    std::mt19937 generador(12345);
+    std::vector<std::vector<std::string>> simetricos = {
+        {"RRGG", "GGRR", "BBYY", "YYBB"}, {"RGRG", "BYBY", "GRGR", "YBYB"}, {"RGBY", "GRYB", "BYRG", "YBGR"},
+        {"RRRR", "GGGG", "BBBB", "YYYY"}, {"RGBY", "RGBY", "RGBY", "RGBY"}, {"RGRG", "GRGR", "BYBY", "YBYB"}};
+    for (const std::vector<std::string> &tubos : simetricos)
+    {
+        assert(DeduplicadorNiveles::formaCanonica(crearTablero(6, tubos), a));
+        for (int i = 0; i < 20; i++)
+        {
+            assert(DeduplicadorNiveles::formaCanonica(crearTablero(6, variante(tubos, generador)), b));
+            assert(a == b);
+        }
+    }
+    std::map<EstadoCompacto, EstadoCompacto> porFuerzaBruta, porForma;
+    for (int prueba = 0; prueba < 4000; prueba++)
+    {
+        std::vector<std::string> tubos = nivelAleatorio(2 + prueba % 4, generador);
+        if (prueba % 2 == 1)
+        {
+            tubos = variante(tubos, generador);
+        }
+        Tablero tablero = crearTablero((int)tubos.size() + 2, tubos);
+        EstadoCompacto bruta = canonicoFuerzaBruta(tablero);
+        assert(DeduplicadorNiveles::formaCanonica(tablero, c));
+        assert(porFuerzaBruta.emplace(bruta, c).first->second == c);
+        assert(porForma.emplace(c, bruta).first->second == bruta);
+    }
+    std::cout << "Prueba 2 superada: Agrupa igual que la fuerza bruta (" << porForma.size() << " niveles distintos)"
+              << std::endl;
+
+    // Prueba 3: Grupos y crecimiento de la tabla
+    DeduplicadorNiveles deduplicador;
+    bool nuevo = false;
+    assert(deduplicador.agregar(crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"}), nuevo) == 0 && nuevo);
+    assert(deduplicador.agregar(crearTablero(6, {"", "ORMC", "MCOR", "MOCR", "CROM"}), nuevo) == 0 && !nuevo);
+    assert(deduplicador.agregar(crearTablero(4, {"RRRX", "XXXR"}), nuevo) == -1 && !nuevo);
+    std::map<EstadoCompacto, int> grupos;
+    for (int i = 0; i < 3000; i++)
+    {
+        std::vector<std::string> tubos = nivelAleatorio(6, generador);
+        Tablero tablero = crearTablero(8, i % 3 == 2 ? variante(tubos, generador) : tubos);
+        int grupo = deduplicador.agregar(tablero, nuevo);
+        assert(grupo > 0);
+        auto insertado = grupos.emplace(canonicoFuerzaBruta(tablero), grupo);
+        assert(insertado.first->second == grupo && insertado.second == nuevo);
+    }
+    assert(deduplicador.getNumGrupos() == (int)grupos.size() + 1 && grupos.size() > 1024);
+    assert(deduplicador.getNumNiveles() == 3002);
+    assert(deduplicador.getTamGrupo(0) == 2);
+    EstadoCompacto original;
+    assert(original.desdeTablero(crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"})));
+    assert(deduplicador.getRepresentante(0) == original);
+    std::cout << "Prueba 3 superada: Grupos y crecimiento de la tabla" << std::endl;
+
+    // Prueba 4: Lectura de paquetes
+    DeduplicadorNiveles paquete;
+    std::vector<NivelPaquete> niveles;
+    paquete.agregarTexto("/**\n * Paquete\n */\n4\nRRRG\nGGGR\n\n// copia\n  4\r\nGGGR\r\nRRRG\r\n"
+                         "6\nRGB\n5\nRRRR\nGGGG\nBBBB\n4\nRRRG\n",
+                         niveles);
+    assert(niveles.size() == 6);
+    assert(niveles[0].linea == 4 && niveles[0].grupo == 0 && niveles[0].nuevo);
+    assert(niveles[1].linea == 9 && niveles[1].grupo == 0 && !niveles[1].nuevo);
+    assert(niveles[2].linea == 12 && niveles[2].grupo == -1);
+    assert(niveles[3].linea == 13 && niveles[3].grupo == -1);
+    assert(niveles[4].linea == 14 && niveles[4].grupo == 1 && niveles[4].nuevo);
+    assert(niveles[5].linea == 18 && niveles[5].grupo == -1);
+    assert(paquete.getNumGrupos() == 2 && paquete.getNumNiveles() == 3);
+    assert(!paquete.agregarArchivo("no_existe.cnf", niveles));
+    std::cout << "Prueba 4 superada: Lectura de paquetes" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD DeduplicadorNiveles han sido superadas!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,239 @@
+/**
+ * @file DeduplicarNiveles.cpp
+ * @brief Herramienta que elimina los niveles repetidos de paquetes de niveles
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa lee uno o varios paquetes de niveles (archivos con uno o más
+ * niveles en el formato de ballSort.cnf; "-" es la entrada estándar) y agrupa
+ * con el TAD DeduplicadorNiveles los niveles que solo se diferencian en el
+ * orden de los tubos o en las letras de los colores. Puede escribir un paquete
+ * con el primer nivel de cada grupo y la lista de grupos con repetidos, una
+ * línea por grupo:
+ *
+ *     grupo niveles archivo:linea archivo:linea ...
+ *
+ * En la consola se muestra el resumen y los niveles procesados por segundo.
+ *
+ * Uso: DeduplicarNiveles <paquete.cnf>... [--unicos archivo] [--grupos archivo]
+ */
+
+#include "DeduplicadorNiveles.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "DeduplicadorNiveles.cpp"
+
+/**
+ * @brief Procedencia de un nivel leído
+ */
+struct OrigenNivel
+{
+    int archivo;     // Índice del paquete en la línea de órdenes
+    long long linea; // Línea del número de tubos
+    int grupo;       // Grupo del nivel
+};
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: DeduplicarNiveles <paquete.cnf>... [--unicos archivo] [--grupos archivo]" << std::endl;
+}
+
+/**
+ * @brief Escribe el primer nivel de cada grupo en formato de paquete
+ * @param nombreArchivo - Ruta del paquete de salida
+ * @param deduplicador - Deduplicador con los grupos
+ * @param archivos - Paquetes leídos
+ * @param primeros - Primer nivel leído de cada grupo
+ * @return bool - true si se pudo escribir
+ */
+bool escribirUnicos(const std::string &nombreArchivo, const DeduplicadorNiveles &deduplicador,
+                    const std::vector<std::string> &archivos, const std::vector<OrigenNivel> &primeros)
+{
+    FILE *archivo = std::fopen(nombreArchivo.c_str(), "w");
+    if (archivo == nullptr)
+    {
+        return false;
+    }
+    for (int grupo = 0; grupo < deduplicador.getNumGrupos(); grupo++)
+    {
+        const EstadoCompacto &nivel = deduplicador.getRepresentante(grupo);
+        const OrigenNivel &origen = primeros[grupo];
+        std::fprintf(archivo, "// %s:%lld (%d niveles iguales)\n%d\n", archivos[origen.archivo].c_str(),
+                     origen.linea, deduplicador.getTamGrupo(grupo), nivel.getNumPilas());
+
+        // Las dos últimas pilas son las vacías y no se escriben
+        for (int pila = 0; pila < nivel.getNumPilas() - 2; pila++)
+        {
+            for (int posicion = 0; posicion < nivel.getAltura(pila); posicion++)
+            {
+                std::fputc(EstadoCompacto::colorIndice(nivel.getBola(pila, posicion)), archivo);
+            }
+            std::fputc('\n', archivo);
+        }
+        std::fputc('\n', archivo);
+    }
+    return std::fclose(archivo) == 0;
+}
+
+/**
+ * @brief Escribe los grupos con más de un nivel
+ * @param nombreArchivo - Ruta del archivo de salida
+ * @param deduplicador - Deduplicador con los grupos
+ * @param archivos - Paquetes leídos
+ * @param origenes - Procedencia de todos los niveles, en orden de lectura
+ * @return bool - true si se pudo escribir
+ */
+bool escribirGrupos(const std::string &nombreArchivo, const DeduplicadorNiveles &deduplicador,
+                    const std::vector<std::string> &archivos, const std::vector<OrigenNivel> &origenes)
+{
+    // Ordenar los niveles por grupo manteniendo el orden de lectura (ordenación por cuentas)
+    std::vector<size_t> inicioGrupo(deduplicador.getNumGrupos() + 1, 0);
+    for (int grupo = 0; grupo < deduplicador.getNumGrupos(); grupo++)
+    {
+        inicioGrupo[grupo + 1] = inicioGrupo[grupo] + deduplicador.getTamGrupo(grupo);
+    }
+    std::vector<size_t> siguiente(inicioGrupo.begin(), inicioGrupo.end() - 1);
+    std::vector<size_t> porGrupo(origenes.size());
+    for (size_t i = 0; i < origenes.size(); i++)
+    {
+        porGrupo[siguiente[origenes[i].grupo]++] = i;
+    }
+
+    FILE *archivo = std::fopen(nombreArchivo.c_str(), "w");
+    if (archivo == nullptr)
+    {
+        return false;
+    }
+    for (int grupo = 0; grupo < deduplicador.getNumGrupos(); grupo++)
+    {
+        if (deduplicador.getTamGrupo(grupo) < 2)
+        {
+            continue;
+        }
+        std::fprintf(archivo, "%d %d", grupo + 1, deduplicador.getTamGrupo(grupo));
+        for (size_t i = inicioGrupo[grupo]; i < inicioGrupo[grupo + 1]; i++)
+        {
+            const OrigenNivel &origen = origenes[porGrupo[i]];
+            std::fprintf(archivo, " %s:%lld", archivos[origen.archivo].c_str(), origen.linea);
+        }
+        std::fputc('\n', archivo);
+    }
+    return std::fclose(archivo) == 0;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - 0 si no hay niveles mal formados, 2 si los hay
+ */
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> archivos;
+    std::string archivoUnicos;
+    std::string archivoGrupos;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--unicos" && i + 1 < argc)
+        {
+            archivoUnicos = argv[++i];
+        }
+        else if (opcion == "--grupos" && i + 1 < argc)
+        {
+            archivoGrupos = argv[++i];
+        }
+        else if (opcion.compare(0, 2, "--") == 0)
+        {
+            mostrarUso();
+            return 1;
+        }
+        else
+        {
+            archivos.push_back(opcion);
+        }
+    }
+    if (archivos.empty())
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    DeduplicadorNiveles deduplicador;
+    std::vector<OrigenNivel> origenes;
+    std::vector<OrigenNivel> primeros;
+    std::vector<NivelPaquete> niveles;
+    long long malFormados = 0;
+    auto inicio = std::chrono::steady_clock::now();
+    for (size_t a = 0; a < archivos.size(); a++)
+    {
+        niveles.clear();
+        if (archivos[a] == "-")
+        {
+            std::string texto((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
+            deduplicador.agregarTexto(texto, niveles);
+        }
+        else if (!deduplicador.agregarArchivo(archivos[a], niveles))
+        {
+            std::cerr << "Error: No se pudo leer " << archivos[a] << std::endl;
+            return 1;
+        }
+
+        for (const NivelPaquete &nivel : niveles)
+        {
+            if (nivel.grupo < 0)
+            {
+                std::cerr << "Aviso: Nivel mal formado en " << archivos[a] << ":" << nivel.linea << std::endl;
+                malFormados++;
+                continue;
+            }
+            OrigenNivel origen{(int)a, nivel.linea, nivel.grupo};
+            origenes.push_back(origen);
+            if (nivel.nuevo)
+            {
+                primeros.push_back(origen);
+            }
+        }
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    if (!archivoUnicos.empty() && !escribirUnicos(archivoUnicos, deduplicador, archivos, primeros))
+    {
+        std::cerr << "Error: No se pudo escribir " << archivoUnicos << std::endl;
+        return 1;
+    }
+    if (!archivoGrupos.empty() && !escribirGrupos(archivoGrupos, deduplicador, archivos, origenes))
+    {
+        std::cerr << "Error: No se pudo escribir " << archivoGrupos << std::endl;
+        return 1;
+    }
+
+    int gruposRepetidos = 0;
+    for (int grupo = 0; grupo < deduplicador.getNumGrupos(); grupo++)
+    {
+        gruposRepetidos += deduplicador.getTamGrupo(grupo) > 1 ? 1 : 0;
+    }
+
+    segundos = std::max(segundos, 1e-9);
+    std::cout << "Niveles: " << deduplicador.getNumNiveles() << " (" << segundos << " s)" << std::endl;
+    std::cout << "  Distintos: " << deduplicador.getNumGrupos() << std::endl;
+    std::cout << "  Repetidos: " << deduplicador.getNumNiveles() - deduplicador.getNumGrupos() << " en "
+              << gruposRepetidos << " grupos" << std::endl;
+    std::cout << "  Mal formados: " << malFormados << std::endl;
+    std::cout << "Colisiones de huella: " << deduplicador.getNumColisiones() << std::endl;
+    std::cout << "Niveles por segundo: " << (long long)(deduplicador.getNumNiveles() / segundos) << std::endl;
+    return malFormados == 0 ? 0 : 2;
+}
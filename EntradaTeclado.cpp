@@ -0,0 +1,387 @@
+/**
+ * @file EntradaTeclado.cpp
+ * @brief Implementación del TAD EntradaTeclado para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD EntradaTeclado
+ * (EntradaTeclado.h). En POSIX la espera se hace con poll() y el modo crudo con
+ * termios; en Windows las pulsaciones se leen con _getch(), que ya las entrega
+ * de una en una y sin eco.
+ */
+
+#include "EntradaTeclado.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <chrono>
+#include <conio.h>
+#include <io.h>
+#include <thread>
+#else
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+// Código de la tecla Esc
+static const char TECLA_ESCAPE = 27;
+
+// Milisegundos que se espera el resto de una secuencia de escape (flechas, teclas de función)
+static const int ESPERA_SECUENCIA_MS = 30;
+
+// Cifras máximas de un número de tubo en la entrada redirigida
+static const int MAX_CIFRAS_TUBO = 9;
+
+/**
+ * Indica si un carácter separa palabras
+ * @param caracter - Carácter a comprobar
+ * @return bool - true si es un espacio, tabulador o salto de línea
+ * @complexity O(1)
+ */
+static bool esSeparador(char caracter)
+{
+    return caracter == ' ' || caracter == '\t' || caracter == '\n' || caracter == '\r' || caracter == '\f' ||
+           caracter == '\v';
+}
+
+/**
+ * Constructor
+ * @param descriptor - Descriptor de lectura
+ * @complexity O(1)
+ */
+EntradaTeclado::EntradaTeclado(int descriptor)
+{
+    this->descriptor = descriptor;
+#ifdef _WIN32
+    interactiva = _isatty(descriptor) != 0;
+#else
+    interactiva = isatty(descriptor) != 0;
+#endif
+    modoCrudo = false;
+    finEntrada = false;
+    inicio = 0;
+    fin = 0;
+}
+
+/**
+ * Destructor
+ */
+EntradaTeclado::~EntradaTeclado()
+{
+    restaurar();
+}
+
+/**
+ * Pone el terminal en modo crudo
+ * @return bool - false si la entrada no es un terminal o no se pudo cambiar
+ * @complexity O(1)
+ */
+bool EntradaTeclado::activarModoCrudo()
+{
+    if (!interactiva)
+    {
+        return false;
+    }
+    if (modoCrudo)
+    {
+        return true;
+    }
+
+#ifdef _WIN32
+    // _getch() ya lee cada pulsación sin eco ni espera del salto de línea
+    modoCrudo = true;
+#else
+    if (tcgetattr(descriptor, &original) != 0)
+    {
+        return false;
+    }
+    struct termios crudo = original;
+    crudo.c_lflag &= ~(tcflag_t)(ICANON | ECHO | ISIG);
+    crudo.c_cc[VMIN] = 1;
+    crudo.c_cc[VTIME] = 0;
+    if (tcsetattr(descriptor, TCSANOW, &crudo) != 0)
+    {
+        return false;
+    }
+    modoCrudo = true;
+#endif
+    return true;
+}
+
+/**
+ * Recupera la configuración original del terminal
+ * @complexity O(1)
+ */
+void EntradaTeclado::restaurar()
+{
+    if (!modoCrudo)
+    {
+        return;
+    }
+#ifndef _WIN32
+    tcsetattr(descriptor, TCSANOW, &original);
+#endif
+    modoCrudo = false;
+}
+
+/**
+ * Indica si la entrada es un terminal
+ * @return bool - true si se leen pulsaciones
+ * @complexity O(1)
+ */
+bool EntradaTeclado::esInteractiva() const
+{
+    return interactiva;
+}
+
+/**
+ * Indica si quedan bytes leídos sin procesar
+ * @return bool - true si el siguiente evento no necesita esperar
+ * @complexity O(1)
+ */
+bool EntradaTeclado::hayPendiente() const
+{
+    return inicio < fin;
+}
+
+/**
+ * Lee más bytes al final del búfer, esperando como mucho esperaMs
+ * @param esperaMs - Espera máxima en milisegundos (negativa = sin límite)
+ * @return bool - true si se ha leído algo
+ * @complexity O(n) donde n es el número de bytes leídos
+ */
+bool EntradaTeclado::rellenar(int esperaMs)
+{
+    if (finEntrada)
+    {
+        return false;
+    }
+
+    // Llevar los bytes pendientes al principio para dejar sitio detrás
+    if (inicio > 0)
+    {
+        std::memmove(bufer, bufer + inicio, (size_t)(fin - inicio));
+        fin -= inicio;
+        inicio = 0;
+    }
+    if (fin == TAM_BUFER)
+    {
+        return false;
+    }
+
+#ifdef _WIN32
+    if (interactiva)
+    {
+        auto limite = std::chrono::steady_clock::now() + std::chrono::milliseconds(esperaMs);
+        while (!_kbhit())
+        {
+            if (esperaMs >= 0 && std::chrono::steady_clock::now() >= limite)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        bufer[fin++] = (char)_getch();
+        return true;
+    }
+    int leidos = _read(descriptor, bufer + fin, (unsigned)(TAM_BUFER - fin));
+#else
+    struct pollfd espera;
+    espera.fd = descriptor;
+    espera.events = POLLIN;
+    espera.revents = 0;
+    int listos = poll(&espera, 1, esperaMs < 0 ? -1 : esperaMs);
+    if (listos <= 0)
+    {
+        return false;
+    }
+    ssize_t leidos = read(descriptor, bufer + fin, (size_t)(TAM_BUFER - fin));
+    if (leidos < 0 && (errno == EINTR || errno == EAGAIN))
+    {
+        return false;
+    }
+#endif
+    if (leidos <= 0)
+    {
+        finEntrada = true;
+        return false;
+    }
+    fin += (int)leidos;
+    return true;
+}
+
+/**
+ * Interpreta la siguiente pulsación del búfer
+ * @return EventoEntrada - Evento de la pulsación (EVENTO_NINGUNO si se descarta)
+ * @complexity O(1) amortizado
+ */
+EventoEntrada EntradaTeclado::leerPulsacion()
+{
+    char tecla = bufer[inicio++];
+    if (tecla != TECLA_ESCAPE)
+    {
+        return interpretarTecla(tecla);
+    }
+
+    // Esc sola sale; si le sigue '[' u 'O' es una secuencia de escape y se descarta entera
+    if (inicio == fin)
+    {
+        rellenar(ESPERA_SECUENCIA_MS);
+    }
+    if (inicio == fin || (bufer[inicio] != '[' && bufer[inicio] != 'O'))
+    {
+        return EventoEntrada{EVENTO_SALIR, -1};
+    }
+    inicio++;
+    while (inicio < fin || rellenar(ESPERA_SECUENCIA_MS))
+    {
+        char caracter = bufer[inicio++];
+        if (caracter >= 0x40 && caracter <= 0x7E)
+        {
+            break;
+        }
+    }
+    return EventoEntrada{EVENTO_NINGUNO, -1};
+}
+
+/**
+ * Interpreta la siguiente palabra del búfer, leyendo más si está a medias
+ * @param esperaMs - Espera máxima en milisegundos (negativa = sin límite)
+ * @return EventoEntrada - Evento de la palabra, EVENTO_FIN o EVENTO_NINGUNO
+ * @complexity O(n) donde n es la longitud de la palabra
+ */
+EventoEntrada EntradaTeclado::leerPalabra(int esperaMs)
+{
+    while (true)
+    {
+        while (inicio < fin && esSeparador(bufer[inicio]))
+        {
+            inicio++;
+        }
+        if (inicio < fin)
+        {
+            int final = inicio;
+            while (final < fin && !esSeparador(bufer[final]))
+            {
+                final++;
+            }
+            // La palabra está completa si le sigue un separador, si la entrada ha terminado o si llena el búfer
+            if (final < fin || finEntrada || final - inicio == TAM_BUFER)
+            {
+                EventoEntrada evento = interpretarPalabra(bufer + inicio, final - inicio);
+                // Consumir también los separadores que siguen para que hayPendiente() sea exacto
+                inicio = final;
+                while (inicio < fin && esSeparador(bufer[inicio]))
+                {
+                    inicio++;
+                }
+                return evento;
+            }
+        }
+        if (finEntrada)
+        {
+            return EventoEntrada{EVENTO_FIN, -1};
+        }
+        if (!rellenar(esperaMs) && !finEntrada)
+        {
+            return EventoEntrada{EVENTO_NINGUNO, -1};
+        }
+    }
+}
+
+/**
+ * Lee el siguiente evento
+ * @param esperaMs - Espera máxima en milisegundos (negativa = sin límite)
+ * @return EventoEntrada - Evento leído o EVENTO_NINGUNO si se agota la espera
+ * @complexity O(1) amortizado por byte
+ */
+EventoEntrada EntradaTeclado::leerEvento(int esperaMs)
+{
+    if (!interactiva)
+    {
+        return leerPalabra(esperaMs);
+    }
+
+    while (true)
+    {
+        if (inicio == fin && !rellenar(esperaMs))
+        {
+            return EventoEntrada{finEntrada ? EVENTO_FIN : EVENTO_NINGUNO, -1};
+        }
+        EventoEntrada evento = leerPulsacion();
+        if (evento.tipo != EVENTO_NINGUNO)
+        {
+            return evento;
+        }
+    }
+}
+
+/**
+ * Interpreta una pulsación del modo interactivo
+ * @param tecla - Carácter pulsado
+ * @return EventoEntrada - Evento de la tecla
+ * @complexity O(1)
+ */
+EventoEntrada EntradaTeclado::interpretarTecla(char tecla)
+{
+    if (tecla >= '1' && tecla <= '9')
+    {
+        return EventoEntrada{EVENTO_TUBO, tecla - '1'};
+    }
+    if (tecla == '0')
+    {
+        return EventoEntrada{EVENTO_TUBO, 9};
+    }
+    if (tecla == 'q' || tecla == 'Q' || tecla == 3 || tecla == 4) // Ctrl+C y Ctrl+D
+    {
+        return EventoEntrada{EVENTO_SALIR, -1};
+    }
+    if (tecla == 'p' || tecla == 'P')
+    {
+        return EventoEntrada{EVENTO_PISTA, -1};
+    }
+    if (esSeparador(tecla))
+    {
+        return EventoEntrada{EVENTO_NINGUNO, -1};
+    }
+    return EventoEntrada{EVENTO_NO_VALIDO, -1};
+}
+
+/**
+ * Interpreta una palabra de la entrada redirigida
+ * @param texto - Primer carácter de la palabra
+ * @param longitud - Número de caracteres
+ * @return EventoEntrada - Evento de la palabra
+ * @complexity O(longitud)
+ */
+EventoEntrada EntradaTeclado::interpretarPalabra(const char *texto, int longitud)
+{
+    if (longitud == 1 && (texto[0] == 'q' || texto[0] == 'Q'))
+    {
+        return EventoEntrada{EVENTO_SALIR, -1};
+    }
+    if (longitud == 1 && (texto[0] == 'p' || texto[0] == 'P'))
+    {
+        return EventoEntrada{EVENTO_PISTA, -1};
+    }
+    if (longitud == 0 || longitud > MAX_CIFRAS_TUBO)
+    {
+        return EventoEntrada{EVENTO_NO_VALIDO, -1};
+    }
+
+    int numero = 0;
+    for (int i = 0; i < longitud; i++)
+    {
+        if (texto[i] < '0' || texto[i] > '9')
+        {
+            return EventoEntrada{EVENTO_NO_VALIDO, -1};
+        }
+        numero = numero * 10 + (texto[i] - '0');
+    }
+    if (numero == 0)
+    {
+        return EventoEntrada{EVENTO_NO_VALIDO, -1};
+    }
+    return EventoEntrada{EVENTO_TUBO, numero - 1};
+}
@@ -0,0 +1,158 @@
+/**
+ * @file EntradaTeclado.h
+ * @brief TAD EntradaTeclado para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) EntradaTeclado, la capa
+ * de entrada del cliente de consola. Convierte lo que escribe el usuario en
+ * eventos (tubo elegido, salir, entrada no válida, fin de la entrada) sin
+ * excepciones ni std::cin:
+ *
+ * - Si la entrada es un terminal, lo pone en modo crudo (sin eco ni espera del
+ *   salto de línea) y cada pulsación es un evento: las cifras 1-9 eligen los
+ *   tubos 1 a 9 y el 0 el tubo 10; p pide una pista; q, Esc o Ctrl+C salen.
+ * - Si la entrada está redirigida (un archivo o una tubería), lee por bloques y
+ *   cada palabra separada por espacios es un evento: un número de tubo, p o q.
+ *
+ * La lectura admite una espera máxima, de modo que el bucle principal no se
+ * queda bloqueado, y hayPendiente() permite no dibujar el tablero mientras
+ * quedan eventos por procesar.
+ */
+
+#ifndef ENTRADA_TECLADO_H
+#define ENTRADA_TECLADO_H
+
+#ifndef _WIN32
+#include <termios.h>
+#endif
+
+/**
+ * @brief Tipos de evento de la entrada
+ */
+enum TipoEvento
+{
+    EVENTO_NINGUNO,   // No hay eventos antes de agotar la espera
+    EVENTO_TUBO,      // Se ha elegido un tubo
+    EVENTO_SALIR,     // El usuario quiere salir
+    EVENTO_PISTA,     // El usuario pide una pista
+    EVENTO_NO_VALIDO, // Tecla o palabra que no es una orden
+    EVENTO_FIN        // La entrada se ha terminado
+};
+
+/**
+ * @brief Evento de la entrada
+ */
+struct EventoEntrada
+{
+    TipoEvento tipo; // Tipo de evento
+    int tubo;        // Índice del tubo (desde 0) si tipo es EVENTO_TUBO
+};
+
+/**
+ * @brief TAD EntradaTeclado que lee pulsaciones o palabras sin bloquear
+ */
+class EntradaTeclado
+{
+public:
+    static const int TAM_BUFER = 4096; // Bytes que se leen de una vez
+
+private:
+    int descriptor;          // Descriptor de lectura
+    bool interactiva;        // La entrada es un terminal
+    bool modoCrudo;          // El terminal está en modo crudo
+    bool finEntrada;         // No quedan más bytes por leer
+    char bufer[TAM_BUFER];   // Bytes leídos y aún no procesados
+    int inicio;              // Primer byte pendiente del búfer
+    int fin;                 // Fin de los bytes leídos del búfer
+#ifndef _WIN32
+    struct termios original; // Configuración del terminal antes del modo crudo
+#endif
+
+    bool rellenar(int esperaMs);
+    EventoEntrada leerPulsacion();
+    EventoEntrada leerPalabra(int esperaMs);
+
+public:
+    /**
+     * @brief Constructor
+     * @pre descriptor es un descriptor abierto para lectura
+     * @post Crea una entrada sobre el descriptor (0 = entrada estándar)
+     * @param descriptor - Descriptor de lectura
+     * @complexity O(1)
+     */
+    explicit EntradaTeclado(int descriptor = 0);
+
+    /**
+     * @brief Destructor
+     * @post Si el terminal estaba en modo crudo, recupera su configuración
+     */
+    ~EntradaTeclado();
+
+    EntradaTeclado(const EntradaTeclado &) = delete;
+    EntradaTeclado &operator=(const EntradaTeclado &) = delete;
+
+    /**
+     * @brief Pone el terminal en modo crudo
+     * @pre No hay precondiciones
+     * @post Si la entrada es un terminal, cada pulsación se lee al momento y sin eco
+     * @return bool - false si la entrada no es un terminal o no se pudo cambiar
+     * @complexity O(1)
+     */
+    bool activarModoCrudo();
+
+    /**
+     * @brief Recupera la configuración original del terminal
+     * @pre No hay precondiciones
+     * @post El terminal vuelve al modo en que estaba antes de activarModoCrudo()
+     * @complexity O(1)
+     */
+    void restaurar();
+
+    /**
+     * @brief Indica si la entrada es un terminal
+     * @return bool - true si se leen pulsaciones, false si se leen palabras
+     * @complexity O(1)
+     */
+    bool esInteractiva() const;
+
+    /**
+     * @brief Indica si quedan bytes leídos sin procesar
+     * @return bool - true si el siguiente evento no necesita esperar
+     * @complexity O(1)
+     */
+    bool hayPendiente() const;
+
+    /**
+     * @brief Lee el siguiente evento
+     * @pre No hay precondiciones
+     * @post Consume los bytes del evento devuelto
+     * @param esperaMs - Espera máxima en milisegundos (negativa = sin límite)
+     * @return EventoEntrada - Evento leído o EVENTO_NINGUNO si se agota la espera
+     * @complexity O(1) amortizado por byte
+     */
+    EventoEntrada leerEvento(int esperaMs = -1);
+
+    /**
+     * @brief Interpreta una pulsación del modo interactivo
+     * @pre No hay precondiciones
+     * @post Devuelve el evento de la tecla (EVENTO_NINGUNO para espacios y saltos)
+     * @param tecla - Carácter pulsado
+     * @return EventoEntrada - Evento de la tecla
+     * @complexity O(1)
+     */
+    static EventoEntrada interpretarTecla(char tecla);
+
+    /**
+     * @brief Interpreta una palabra de la entrada redirigida
+     * @pre texto apunta a longitud caracteres sin espacios
+     * @post Devuelve un tubo (número positivo), salir (q o Q), pista (p o P) o no válido
+     * @param texto - Primer carácter de la palabra
+     * @param longitud - Número de caracteres
+     * @return EventoEntrada - Evento de la palabra
+     * @complexity O(longitud)
+     */
+    static EventoEntrada interpretarPalabra(const char *texto, int longitud);
+};
+
+#endif // ENTRADA_TECLADO_H
@@ -0,0 +1,155 @@
+/**
+ * @file EntradaTecladoPruebas.cpp
+ * @brief Pruebas para el TAD EntradaTeclado del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD EntradaTeclado
+ * (EntradaTeclado.h/EntradaTeclado.cpp). Se comprueba la interpretación de
+ * teclas y palabras y, en POSIX, la lectura de una entrada redirigida a través
+ * de una tubería: palabras partidas entre lecturas, espera con límite y fin de
+ * la entrada.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "EntradaTeclado.h"
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "EntradaTeclado.cpp"
+
+/**
+ * @brief Comprueba el tipo y el tubo de un evento
+ * @param evento - Evento a comprobar
+ * @param tipo - Tipo esperado
+ * @param tubo - Tubo esperado (-1 si no es EVENTO_TUBO)
+ * @return bool - true si coinciden
+ */
+bool esEvento(const EventoEntrada &evento, TipoEvento tipo, int tubo)
+{
+    return evento.tipo == tipo && evento.tubo == tubo;
+}
+
+/**
+ * @brief Interpreta una palabra escrita como cadena
+ * @param palabra - Palabra sin espacios
+ * @return EventoEntrada - Evento de la palabra
+ */
+EventoEntrada palabra(const char *palabra)
+{
+    return EntradaTeclado::interpretarPalabra(palabra, (int)std::strlen(palabra));
+}
+
+#ifndef _WIN32
+
+/**
+ * @brief Escribe una cadena en un descriptor
+ * @param descriptor - Extremo de escritura de la tubería
+ * @param texto - Texto a escribir
+ */
+void escribir(int descriptor, const char *texto)
+{
+    size_t longitud = std::strlen(texto);
+    assert(write(descriptor, texto, longitud) == (ssize_t)longitud);
+}
+
+#endif
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD EntradaTeclado..." << std::endl;
+
+    // Prueba 1: Teclas del modo interactivo
+    assert(esEvento(EntradaTeclado::interpretarTecla('1'), EVENTO_TUBO, 0));
+    assert(esEvento(EntradaTeclado::interpretarTecla('9'), EVENTO_TUBO, 8));
+    assert(esEvento(EntradaTeclado::interpretarTecla('0'), EVENTO_TUBO, 9));
+    assert(esEvento(EntradaTeclado::interpretarTecla('q'), EVENTO_SALIR, -1));
+    assert(esEvento(EntradaTeclado::interpretarTecla('Q'), EVENTO_SALIR, -1));
+    assert(esEvento(EntradaTeclado::interpretarTecla(3), EVENTO_SALIR, -1));
+    assert(esEvento(EntradaTeclado::interpretarTecla('p'), EVENTO_PISTA, -1));
+    assert(esEvento(EntradaTeclado::interpretarTecla('P'), EVENTO_PISTA, -1));
+    assert(esEvento(EntradaTeclado::interpretarTecla(' '), EVENTO_NINGUNO, -1));
+    assert(esEvento(EntradaTeclado::interpretarTecla('\n'), EVENTO_NINGUNO, -1));
+    assert(esEvento(EntradaTeclado::interpretarTecla('x'), EVENTO_NO_VALIDO, -1));
+    std::cout << "Prueba 1 superada: Teclas del modo interactivo" << std::endl;
+
+    // Prueba 2: Palabras de la entrada redirigida
+    assert(esEvento(palabra("1"), EVENTO_TUBO, 0));
+    assert(esEvento(palabra("10"), EVENTO_TUBO, 9));
+    assert(esEvento(palabra("007"), EVENTO_TUBO, 6));
+    assert(esEvento(palabra("q"), EVENTO_SALIR, -1));
+    assert(esEvento(palabra("p"), EVENTO_PISTA, -1));
+    assert(esEvento(palabra("pp"), EVENTO_NO_VALIDO, -1));
+    assert(esEvento(palabra("0"), EVENTO_NO_VALIDO, -1));
+    assert(esEvento(palabra("-1"), EVENTO_NO_VALIDO, -1));
+    assert(esEvento(palabra("3a"), EVENTO_NO_VALIDO, -1));
+    assert(esEvento(palabra("qq"), EVENTO_NO_VALIDO, -1));
+    assert(esEvento(palabra("99999999999999999999"), EVENTO_NO_VALIDO, -1));
+    std::cout << "Prueba 2 superada: Palabras de la entrada redirigida" << std::endl;
+
+#ifndef _WIN32
+    // Prueba 3: Lectura por una tubería con palabras partidas y espera con límite
+    int extremos[2];
+    assert(pipe(extremos) == 0);
+    {
+        EntradaTeclado entrada(extremos[0]);
+        assert(!entrada.esInteractiva());
+        assert(!entrada.activarModoCrudo());
+        assert(esEvento(entrada.leerEvento(10), EVENTO_NINGUNO, -1));
+
+        escribir(extremos[1], "1 5\n 2 x");
+        assert(esEvento(entrada.leerEvento(10), EVENTO_TUBO, 0));
+        assert(esEvento(entrada.leerEvento(10), EVENTO_TUBO, 4));
+        assert(entrada.hayPendiente());
+        assert(esEvento(entrada.leerEvento(10), EVENTO_TUBO, 1));
+        // "x" podría continuar en la siguiente lectura, así que aún no es un evento
+        assert(esEvento(entrada.leerEvento(10), EVENTO_NINGUNO, -1));
+        escribir(extremos[1], "y\n1");
+        assert(esEvento(entrada.leerEvento(10), EVENTO_NO_VALIDO, -1));
+        escribir(extremos[1], "0\n");
+        assert(esEvento(entrada.leerEvento(10), EVENTO_TUBO, 9));
+        assert(!entrada.hayPendiente());
+        std::cout << "Prueba 3 superada: Lectura por una tubería y espera con límite" << std::endl;
+
+        // Prueba 4: Fin de la entrada y entrada más larga que el búfer
+        std::string larga;
+        for (int i = 0; i < 3000; i++)
+        {
+            larga += "3 4 ";
+        }
+        larga += "q";
+        escribir(extremos[1], larga.c_str());
+        close(extremos[1]);
+        int tubos = 0;
+        EventoEntrada evento = entrada.leerEvento(-1);
+        while (evento.tipo == EVENTO_TUBO)
+        {
+            assert(evento.tubo == (tubos % 2 == 0 ? 2 : 3));
+            tubos++;
+            evento = entrada.leerEvento(-1);
+        }
+        assert(tubos == 6000);
+        assert(evento.tipo == EVENTO_SALIR);
+        assert(esEvento(entrada.leerEvento(-1), EVENTO_FIN, -1));
+        assert(esEvento(entrada.leerEvento(-1), EVENTO_FIN, -1));
+        std::cout << "Prueba 4 superada: Fin de la entrada tras " << tubos << " tubos" << std::endl;
+    }
+    close(extremos[0]);
+#endif
+
+    std::cout << "¡Todas las pruebas del TAD EntradaTeclado han sido superadas!" << std::endl;
+    return 0;
+}
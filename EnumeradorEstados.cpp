@@ -0,0 +1,140 @@
+/**
+ * @file EnumeradorEstados.cpp
+ * @brief Herramienta de enumeración exhaustiva del espacio de estados
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa carga un nivel (.cnf) y enumera todos los estados alcanzables
+ * desde él con la búsqueda en anchura externa (TAD BusquedaExterna), mostrando
+ * el número de estados de cada profundidad, el total y la máxima distancia
+ * desde el estado inicial. Está pensado para configuraciones grandes cuyo
+ * grafo de estados no cabe en memoria.
+ *
+ * Uso: EnumeradorEstados <nivel.cnf> [--dir directorio] [--memoria MB]
+ *                        [--hilos N] [--conservar]
+ */
+
+#include "Juego.h"
+#include "BusquedaExterna.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "BusquedaExterna.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: EnumeradorEstados <nivel.cnf> [--dir directorio] [--memoria MB]" << std::endl;
+    std::cerr << "                         [--hilos N] [--conservar]" << std::endl;
+}
+
+/**
+ * @brief Lee un número entero de un argumento sin lanzar excepciones
+ * @param texto - Argumento
+ * @param minimo - Menor valor admitido
+ * @param maximo - Mayor valor admitido
+ * @param valor - Número leído
+ * @return bool - false si el argumento no es un número o está fuera de rango
+ */
+static bool leerNumero(const char *texto, long long minimo, long long maximo, long long &valor)
+{
+    char *fin = nullptr;
+    errno = 0;
+    valor = std::strtoll(texto, &fin, 10);
+    return fin != texto && *fin == '\0' && errno == 0 && valor >= minimo && valor <= maximo;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string nivel = argv[1];
+    ConfiguracionBusquedaExterna configuracion;
+    configuracion.progreso = &std::cout;
+
+    for (int i = 2; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--dir" && i + 1 < argc)
+        {
+            configuracion.directorioTrabajo = argv[++i];
+        }
+        else if (opcion == "--memoria" && i + 1 < argc)
+        {
+            long long megas = 0;
+            if (!leerNumero(argv[++i], 1, 1LL << 30, megas))
+            {
+                std::cerr << "Error: Memoria no válida: " << argv[i] << std::endl;
+                return 1;
+            }
+            configuracion.memoriaMaxima = (size_t)megas * 1024 * 1024;
+        }
+        else if (opcion == "--hilos" && i + 1 < argc)
+        {
+            long long hilos = 0;
+            if (!leerNumero(argv[++i], 0, 1024, hilos))
+            {
+                std::cerr << "Error: Número de hilos no válido: " << argv[i] << std::endl;
+                return 1;
+            }
+            configuracion.numHilos = (int)hilos;
+        }
+        else if (opcion == "--conservar")
+        {
+            configuracion.conservarCapas = true;
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    Juego juego;
+    if (!juego.inicializar(nivel))
+    {
+        std::cerr << "Error: No se pudo cargar el nivel " << nivel << std::endl;
+        return 1;
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    BusquedaExterna busqueda(configuracion);
+    if (!busqueda.enumerar(juego.getTablero()))
+    {
+        std::cerr << "Error: La enumeración falló (colores fuera de la paleta o error de disco)" << std::endl;
+        return 1;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << "\nProfundidad  Estados" << std::endl;
+    const std::vector<long long> &capas = busqueda.getEstadosPorProfundidad();
+    for (size_t d = 0; d < capas.size(); d++)
+    {
+        std::cout << d << "  " << capas[d] << std::endl;
+    }
+    std::cout << "Total de estados: " << busqueda.getTotalEstados() << std::endl;
+    std::cout << "Profundidad máxima (distancia al estado más lejano): " << busqueda.getProfundidadMaxima()
+              << std::endl;
+    std::cout << "Tiempo: " << segundos << " s" << std::endl;
+    return 0;
+}
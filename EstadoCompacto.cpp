@@ -0,0 +1,301 @@
+/**
+ * @file EstadoCompacto.cpp
+ * @brief Implementación del TAD EstadoCompacto para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD EstadoCompacto
+ * (EstadoCompacto.h). La bola de la posición p de la pila i ocupa la casilla
+ * s = i * CAPACIDAD_MAXIMA + p, que se guarda en los 4 bits de la palabra
+ * s / 16 con desplazamiento 4 * (s % 16). El byte alto de la última palabra
+ * almacena el número de pilas.
+ */
+
+#include "EstadoCompacto.h"
+
+// Paleta de colores: el índice de cada letra más uno es su código en el estado
+static const char PALETA_COLORES[EstadoCompacto::MAX_COLORES + 1] = "RGBYMCOPWKVLNAS";
+
+static_assert(Tablero::MAX_PILAS * Pila::CAPACIDAD_MAXIMA * EstadoCompacto::BITS_POR_BOLA <=
+                  EstadoCompacto::NUM_PALABRAS * 64 - 8,
+              "El tablero máximo no cabe en un EstadoCompacto");
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+EstadoCompacto::EstadoCompacto()
+{
+    for (int i = 0; i < NUM_PALABRAS; i++)
+    {
+        palabras[i] = 0;
+    }
+}
+
+/**
+ * Codifica un tablero
+ * @param tablero - Tablero a codificar
+ * @return bool - true si la codificación fue posible
+ * @complexity O(n) donde n es el número de bolas del tablero
+ */
+bool EstadoCompacto::desdeTablero(const Tablero &tablero)
+{
+    for (int i = 0; i < NUM_PALABRAS; i++)
+    {
+        palabras[i] = 0;
+    }
+
+    int numPilas = tablero.getNumPilas();
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        const Pila &p = tablero.getPila(pila);
+        for (int posicion = 0; posicion < p.numElementos(); posicion++)
+        {
+            int indice = indiceColor(p.getElemento(posicion));
+            if (indice == 0)
+            {
+                return false;
+            }
+
+            int casilla = pila * Pila::CAPACIDAD_MAXIMA + posicion;
+            palabras[casilla / 16] |= (uint64_t)indice << (BITS_POR_BOLA * (casilla % 16));
+        }
+    }
+
+    palabras[NUM_PALABRAS - 1] |= (uint64_t)numPilas << 56;
+    return true;
+}
+
+/**
+ * Reconstruye el tablero representado por el estado
+ * @param tablero - Tablero donde reconstruir el estado
+ * @return bool - true si el estado es válido
+ * @complexity O(n) donde n es el número de bolas del estado
+ */
+bool EstadoCompacto::aTablero(Tablero &tablero) const
+{
+    int numPilas = getNumPilas();
+    if (numPilas < 2 || numPilas > Tablero::MAX_PILAS)
+    {
+        return false;
+    }
+
+    tablero = Tablero();
+    tablero.inicializar(numPilas);
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        for (int posicion = 0; posicion < Pila::CAPACIDAD_MAXIMA; posicion++)
+        {
+            int indice = getBola(pila, posicion);
+            if (indice == 0)
+            {
+                break;
+            }
+            tablero.colocarBola(pila, colorIndice(indice));
+        }
+    }
+    return true;
+}
+
+/**
+ * Obtiene el número de pilas del estado
+ * @return int - El número de pilas
+ * @complexity O(1)
+ */
+int EstadoCompacto::getNumPilas() const
+{
+    return (int)(palabras[NUM_PALABRAS - 1] >> 56);
+}
+
+/**
+ * Obtiene el índice de color de una posición de una pila
+ * @param pila - Índice de la pila
+ * @param posicion - Posición dentro de la pila (0 es el fondo)
+ * @return int - Índice de color en la paleta
+ * @complexity O(1)
+ */
+int EstadoCompacto::getBola(int pila, int posicion) const
+{
+    int casilla = pila * Pila::CAPACIDAD_MAXIMA + posicion;
+    return (int)((palabras[casilla / 16] >> (BITS_POR_BOLA * (casilla % 16))) & 0xF);
+}
+
+uint16_t EstadoCompacto::getCodigoPila(int pila) const
+{
+    return (uint16_t)(palabras[pila / 4] >> (16 * (pila % 4)));
+}
+
+void EstadoCompacto::setCodigoPila(int pila, uint16_t codigo)
+{
+    int desplazamiento = 16 * (pila % 4);
+    palabras[pila / 4] &= ~((uint64_t)0xFFFF << desplazamiento);
+    palabras[pila / 4] |= (uint64_t)codigo << desplazamiento;
+}
+
+/**
+ * Obtiene el número de bolas de una pila
+ * @param pila - Índice de la pila
+ * @return int - Número de bolas de la pila
+ * @complexity O(1)
+ */
+int EstadoCompacto::getAltura(int pila) const
+{
+    uint16_t codigo = getCodigoPila(pila);
+    int altura = 0;
+    while (altura < Pila::CAPACIDAD_MAXIMA && (codigo & 0xF) != 0)
+    {
+        codigo >>= BITS_POR_BOLA;
+        altura++;
+    }
+    return altura;
+}
+
+/**
+ * Mueve la bola de la cima de una pila a otra sin comprobar las reglas
+ * @param origen - Índice de la pila origen
+ * @param destino - Índice de la pila destino
+ * @complexity O(1)
+ */
+void EstadoCompacto::trasladarBola(int origen, int destino)
+{
+    int alturaOrigen = getAltura(origen);
+    int alturaDestino = getAltura(destino);
+    int desplazamientoOrigen = BITS_POR_BOLA * (alturaOrigen - 1);
+
+    uint16_t codigoOrigen = getCodigoPila(origen);
+    uint16_t bola = (uint16_t)((codigoOrigen >> desplazamientoOrigen) & 0xF);
+    setCodigoPila(origen, (uint16_t)(codigoOrigen & ~(0xF << desplazamientoOrigen)));
+    setCodigoPila(destino, (uint16_t)(getCodigoPila(destino) | (bola << (BITS_POR_BOLA * alturaDestino))));
+}
+
+/**
+ * Sustituye los colores de todas las bolas
+ * @param mapa - Nuevo índice de cada índice de color
+ * @return EstadoCompacto - Estado con los colores sustituidos
+ * @complexity O(n) donde n es el número de bolas
+ */
+EstadoCompacto EstadoCompacto::recolorear(const int mapa[MAX_COLORES + 1]) const
+{
+    EstadoCompacto resultado = *this;
+    int numCasillas = getNumPilas() * Pila::CAPACIDAD_MAXIMA;
+    for (int casilla = 0; casilla < numCasillas; casilla++)
+    {
+        int desplazamiento = BITS_POR_BOLA * (casilla % 16);
+        uint64_t indice = (palabras[casilla / 16] >> desplazamiento) & 0xF;
+        resultado.palabras[casilla / 16] &= ~((uint64_t)0xF << desplazamiento);
+        resultado.palabras[casilla / 16] |= (uint64_t)mapa[indice] << desplazamiento;
+    }
+    return resultado;
+}
+
+/**
+ * Obtiene la forma canónica del estado (pilas ordenadas de mayor a menor código)
+ * @return EstadoCompacto - Estado canónico
+ * @complexity O(n^2) donde n es el número de pilas
+ */
+EstadoCompacto EstadoCompacto::canonico() const
+{
+    int numPilas = getNumPilas();
+    uint16_t codigos[Tablero::MAX_PILAS];
+    for (int i = 0; i < numPilas; i++)
+    {
+        // Ordenación por inserción: hay pocas pilas
+        uint16_t codigo = getCodigoPila(i);
+        int j = i;
+        while (j > 0 && codigos[j - 1] < codigo)
+        {
+            codigos[j] = codigos[j - 1];
+            j--;
+        }
+        codigos[j] = codigo;
+    }
+
+    EstadoCompacto resultado = *this;
+    for (int i = 0; i < numPilas; i++)
+    {
+        resultado.setCodigoPila(i, codigos[i]);
+    }
+    return resultado;
+}
+
+/**
+ * Calcula un valor hash del estado (mezcla tipo splitmix64 de las palabras)
+ * @return size_t - El valor hash
+ * @complexity O(1)
+ */
+size_t EstadoCompacto::hash() const
+{
+    uint64_t h = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < NUM_PALABRAS; i++)
+    {
+        h ^= palabras[i] + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBULL;
+        h ^= h >> 31;
+    }
+    return (size_t)h;
+}
+
+bool EstadoCompacto::operator==(const EstadoCompacto &otro) const
+{
+    for (int i = 0; i < NUM_PALABRAS; i++)
+    {
+        if (palabras[i] != otro.palabras[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EstadoCompacto::operator!=(const EstadoCompacto &otro) const
+{
+    return !(*this == otro);
+}
+
+bool EstadoCompacto::operator<(const EstadoCompacto &otro) const
+{
+    for (int i = 0; i < NUM_PALABRAS; i++)
+    {
+        if (palabras[i] != otro.palabras[i])
+        {
+            return palabras[i] < otro.palabras[i];
+        }
+    }
+    return false;
+}
+
+/**
+ * Convierte un color en su índice de la paleta
+ * @param color - Carácter del color
+ * @return int - Índice del color (0 si no está en la paleta)
+ * @complexity O(1)
+ */
+int EstadoCompacto::indiceColor(char color)
+{
+    for (int i = 0; i < MAX_COLORES; i++)
+    {
+        if (PALETA_COLORES[i] == color)
+        {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Convierte un índice de la paleta en su color
+ * @param indice - Índice del color
+ * @return char - Carácter del color (' ' para el índice 0)
+ * @complexity O(1)
+ */
+char EstadoCompacto::colorIndice(int indice)
+{
+    if (indice >= 1 && indice <= MAX_COLORES)
+    {
+        return PALETA_COLORES[indice - 1];
+    }
+    return ' ';
+}
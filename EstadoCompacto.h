@@ -0,0 +1,187 @@
+/**
+ * @file EstadoCompacto.h
+ * @brief TAD EstadoCompacto para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) EstadoCompacto, una
+ * codificación empaquetada de tamaño fijo de un Tablero. Cada bola ocupa 4 bits
+ * (índice de color en la paleta, 0 para hueco vacío) y el número de pilas se
+ * guarda en el último byte, de modo que un estado completo cabe en 24 bytes.
+ *
+ * Como cada pila ocupa exactamente 16 bits, el estado admite operaciones
+ * directas sobre pilas completas, como mover bolas sin descodificar el tablero
+ * u obtener una forma canónica independiente del orden de los tubos.
+ *
+ * La codificación es trivialmente copiable, se puede comparar, ordenar y
+ * aplicar una función hash, por lo que sirve como clave en conjuntos de
+ * estados visitados y como registro de longitud fija en archivos binarios.
+ */
+
+#ifndef ESTADO_COMPACTO_H
+#define ESTADO_COMPACTO_H
+
+#include "Tablero.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief TAD EstadoCompacto que representa un Tablero empaquetado
+ *
+ * Las bolas se guardan por pilas, desde el fondo hacia la cima. Los huecos
+ * vacíos valen 0, por lo que la altura de cada pila queda implícita.
+ */
+class EstadoCompacto
+{
+public:
+    static const int NUM_PALABRAS = 3;  // Palabras de 64 bits del estado
+    static const int BITS_POR_BOLA = 4; // Bits para el índice de color
+    static const int MAX_COLORES = 15;  // Colores distintos representables
+
+private:
+    uint64_t palabras[NUM_PALABRAS]; // Bolas empaquetadas y número de pilas
+
+    // Cada pila ocupa 16 bits: la pila i está en la palabra i / 4
+    uint16_t getCodigoPila(int pila) const;
+    void setCodigoPila(int pila, uint16_t codigo);
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea un estado sin pilas
+     * @complexity O(1)
+     */
+    EstadoCompacto();
+
+    /**
+     * @brief Codifica un tablero
+     * @pre No hay precondiciones
+     * @post Si todos los colores del tablero están en la paleta, el estado
+     *       representa el tablero
+     * @param tablero - Tablero a codificar
+     * @return bool - true si la codificación fue posible
+     * @complexity O(n) donde n es el número de bolas del tablero
+     */
+    bool desdeTablero(const Tablero &tablero);
+
+    /**
+     * @brief Reconstruye el tablero representado por el estado
+     * @pre No hay precondiciones
+     * @post El tablero pasa a contener las mismas pilas y bolas que el estado
+     * @param tablero - Tablero donde reconstruir el estado
+     * @return bool - true si el estado es válido
+     * @complexity O(n) donde n es el número de bolas del estado
+     */
+    bool aTablero(Tablero &tablero) const;
+
+    /**
+     * @brief Obtiene el número de pilas del estado
+     * @pre No hay precondiciones
+     * @post Devuelve el número de pilas codificado
+     * @return int - El número de pilas
+     * @complexity O(1)
+     */
+    int getNumPilas() const;
+
+    /**
+     * @brief Obtiene el índice de color de una posición de una pila
+     * @pre 0 <= pila < getNumPilas() y 0 <= posicion < Pila::CAPACIDAD_MAXIMA
+     * @post Devuelve el índice de color (0 si la posición está vacía)
+     * @param pila - Índice de la pila
+     * @param posicion - Posición dentro de la pila (0 es el fondo)
+     * @return int - Índice de color en la paleta
+     * @complexity O(1)
+     */
+    int getBola(int pila, int posicion) const;
+
+    /**
+     * @brief Obtiene el número de bolas de una pila
+     * @pre 0 <= pila < getNumPilas()
+     * @post Devuelve la altura de la pila
+     * @param pila - Índice de la pila
+     * @return int - Número de bolas de la pila
+     * @complexity O(1)
+     */
+    int getAltura(int pila) const;
+
+    /**
+     * @brief Mueve la bola de la cima de una pila a otra sin comprobar las reglas
+     * @pre La pila origen no está vacía y la pila destino no está llena
+     * @post La bola de la cima de origen pasa a la cima de destino
+     * @param origen - Índice de la pila origen
+     * @param destino - Índice de la pila destino
+     * @complexity O(1)
+     */
+    void trasladarBola(int origen, int destino);
+
+    /**
+     * @brief Sustituye los colores de todas las bolas
+     * @pre mapa[0] == 0 y 0 <= mapa[i] <= MAX_COLORES
+     * @post Devuelve el estado en el que cada bola de color i pasa a tener color mapa[i]
+     * @param mapa - Nuevo índice de cada índice de color
+     * @return EstadoCompacto - Estado con los colores sustituidos
+     * @complexity O(n) donde n es el número de bolas
+     */
+    EstadoCompacto recolorear(const int mapa[MAX_COLORES + 1]) const;
+
+    /**
+     * @brief Obtiene la forma canónica del estado
+     * @pre No hay precondiciones
+     * @post Devuelve el estado con las pilas ordenadas por su contenido, igual
+     *       para todos los estados que solo difieren en el orden de los tubos
+     * @return EstadoCompacto - Estado canónico
+     * @complexity O(n^2) donde n es el número de pilas
+     */
+    EstadoCompacto canonico() const;
+
+    /**
+     * @brief Calcula un valor hash del estado
+     * @pre No hay precondiciones
+     * @post Devuelve un hash bien distribuido del estado
+     * @return size_t - El valor hash
+     * @complexity O(1)
+     */
+    size_t hash() const;
+
+    /**
+     * @brief Operadores de comparación (orden lexicográfico de las palabras)
+     * @complexity O(1)
+     */
+    bool operator==(const EstadoCompacto &otro) const;
+    bool operator!=(const EstadoCompacto &otro) const;
+    bool operator<(const EstadoCompacto &otro) const;
+
+    /**
+     * @brief Convierte un color en su índice de la paleta
+     * @pre No hay precondiciones
+     * @post Devuelve el índice (1..MAX_COLORES) o 0 si el color no está en la paleta
+     * @param color - Carácter del color
+     * @return int - Índice del color
+     * @complexity O(1)
+     */
+    static int indiceColor(char color);
+
+    /**
+     * @brief Convierte un índice de la paleta en su color
+     * @pre 0 <= indice <= MAX_COLORES
+     * @post Devuelve el carácter del color o ' ' para el índice 0
+     * @param indice - Índice del color
+     * @return char - Carácter del color
+     * @complexity O(1)
+     */
+    static char colorIndice(int indice);
+};
+
+/**
+ * @brief Functor hash para usar EstadoCompacto en contenedores no ordenados
+ */
+struct HashEstadoCompacto
+{
+    size_t operator()(const EstadoCompacto &estado) const
+    {
+        return estado.hash();
+    }
+};
+
+#endif // ESTADO_COMPACTO_H
@@ -0,0 +1,93 @@
+/**
+ * @file EstadoCompactoPruebas.cpp
+ * @brief Pruebas para el TAD EstadoCompacto del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas unitarias del TAD EstadoCompacto
+ * (EstadoCompacto.h/EstadoCompacto.cpp). Comprueban que la codificación de un
+ * tablero se puede deshacer sin pérdidas, que la comparación y el hash
+ * distinguen estados distintos y que se rechazan colores fuera de la paleta.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "EstadoCompacto.h"
+#include <iostream>
+#include <cassert>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+
+/**
+ * @brief Ejecuta las pruebas del TAD EstadoCompacto
+ * @return int - 0 si todas las pruebas pasan correctamente
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD EstadoCompacto..." << std::endl;
+
+    // Prueba 1: Estado vacío
+    EstadoCompacto vacio;
+    assert(vacio.getNumPilas() == 0);
+    std::cout << "Prueba 1 superada: Constructor y estado inicial" << std::endl;
+
+    // Prueba 2: Codificar y decodificar un tablero
+    Tablero tablero;
+    tablero.inicializar(Tablero::MAX_PILAS);
+    const char *colores = "RGBYMCOP";
+    for (int i = 0; i < 8; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            assert(tablero.colocarBola(i, colores[(i + j) % 8]));
+        }
+    }
+    EstadoCompacto estado;
+    assert(estado.desdeTablero(tablero));
+    assert(estado.getNumPilas() == Tablero::MAX_PILAS);
+    assert(estado.getBola(0, 0) == EstadoCompacto::indiceColor('R'));
+    assert(estado.getBola(8, 0) == 0);
+
+    Tablero reconstruido;
+    assert(estado.aTablero(reconstruido));
+    assert(reconstruido.getNumPilas() == Tablero::MAX_PILAS);
+    for (int i = 0; i < Tablero::MAX_PILAS; i++)
+    {
+        assert(reconstruido.getPila(i).numElementos() == tablero.getPila(i).numElementos());
+        for (int j = 0; j < tablero.getPila(i).numElementos(); j++)
+        {
+            assert(reconstruido.getPila(i).getElemento(j) == tablero.getPila(i).getElemento(j));
+        }
+    }
+    std::cout << "Prueba 2 superada: Codificar y decodificar" << std::endl;
+
+    // Prueba 3: Comparación y hash tras un movimiento
+    Tablero movido = tablero;
+    assert(movido.moverBola(0, 8));
+    EstadoCompacto otro;
+    assert(otro.desdeTablero(movido));
+    assert(otro != estado);
+    assert((otro < estado) != (estado < otro));
+    assert(otro.hash() != estado.hash());
+
+    EstadoCompacto copia;
+    assert(copia.desdeTablero(tablero));
+    assert(copia == estado);
+    assert(copia.hash() == estado.hash());
+    std::cout << "Prueba 3 superada: Comparación y hash" << std::endl;
+
+    // Prueba 4: Colores fuera de la paleta
+    Tablero invalido;
+    invalido.inicializar(3);
+    invalido.colocarBola(0, '?');
+    assert(!otro.desdeTablero(invalido));
+    assert(EstadoCompacto::colorIndice(EstadoCompacto::indiceColor('M')) == 'M');
+    std::cout << "Prueba 4 superada: Paleta de colores" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD EstadoCompacto han sido superadas!" << std::endl;
+    return 0;
+}
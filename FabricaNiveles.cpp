@@ -0,0 +1,541 @@
+/**
+ * @file FabricaNiveles.cpp
+ * @brief Implementación del TAD FabricaNiveles para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD FabricaNiveles
+ * (FabricaNiveles.h). Los niveles descartados siguen la cadena marcados, sin
+ * más trabajo, para que la etapa de escritura pueda reordenarlos por número.
+ * Cada etapa sabe que no recibirá más niveles cuando todos los hilos de la
+ * anterior han terminado y su cola está vacía. Las esperas empiezan girando y
+ * pasan a ceder el procesador y a dormir, para no gastar núcleos cuando una
+ * etapa está parada. La generación no se adelanta a la escritura más que lo
+ * que cabe en las colas y en los hilos, así que los niveles que la escritura
+ * guarda para reordenarlos también están acotados.
+ */
+
+#include "FabricaNiveles.h"
+#include "AnalizadorDificultad.h"
+#include "ColaAcotada.h"
+#include "DeduplicadorNiveles.h"
+#include "Resolutor.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+typedef std::chrono::steady_clock::time_point InstanteFabrica;
+
+/**
+ * @brief Motivo por el que un nivel no llega al paquete
+ */
+enum DescarteFabrica
+{
+    DESCARTE_NINGUNO,
+    DESCARTE_SIN_SOLUCION,
+    DESCARTE_CORTO,
+    DESCARTE_DIFICULTAD,
+    DESCARTE_SOBRANTE // Generado después de completar el paquete
+};
+
+/**
+ * @brief Nivel en la cadena de producción
+ */
+struct TrabajoFabrica
+{
+    long long indice;       // Número de generación
+    EstadoCompacto nivel;   // Tablero generado
+    DescarteFabrica motivo; // Descarte decidido por alguna etapa
+    int longitudOptima;     // Movimientos de la solución óptima
+    double puntuacion;      // Dificultad
+    InstanteFabrica creado; // Momento de la generación
+};
+
+/**
+ * @brief Estado compartido por los hilos de una producción
+ */
+struct CadenaFabrica
+{
+    // Cola de entrada de cada etapa salvo la primera (colas[e - 1] es la de la etapa e)
+    std::unique_ptr<ColaAcotada<TrabajoFabrica>> colas[NUM_ETAPAS_FABRICA - 1];
+    std::atomic<int> activos[NUM_ETAPAS_FABRICA]; // Hilos de cada etapa que no han terminado
+    std::atomic<bool> completo;                   // El paquete ya tiene todos sus niveles
+    std::atomic<long long> siguienteIndice;       // Siguiente número de generación
+    std::atomic<long long> siguienteEscrito;      // Siguiente número que espera la escritura
+    long long ventana;                            // Adelanto máximo de la generación sobre la escritura
+    std::mutex cerrojo;                           // Protege las estadísticas
+};
+
+/**
+ * @brief Espera que empieza girando y acaba durmiendo
+ */
+struct EsperaFabrica
+{
+    int intentos = 0;
+
+    void esperar()
+    {
+        intentos++;
+        if (intentos > 64)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        else if (intentos > 16)
+        {
+            std::this_thread::yield();
+        }
+    }
+};
+
+/**
+ * @brief Segundos transcurridos desde un instante
+ */
+static double segundosDesde(InstanteFabrica inicio)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+/**
+ * @brief Mete un nivel en la cola de la etapa siguiente, esperando si está llena
+ */
+static void meterTrabajo(ColaAcotada<TrabajoFabrica> &cola, TrabajoFabrica &trabajo, EstadisticasEtapa &estadisticas)
+{
+    if (cola.intentarMeter(trabajo))
+    {
+        return;
+    }
+    InstanteFabrica inicio = std::chrono::steady_clock::now();
+    EsperaFabrica espera;
+    while (!cola.intentarMeter(trabajo))
+    {
+        espera.esperar();
+    }
+    estadisticas.segundosSalidaLlena += segundosDesde(inicio);
+}
+
+/**
+ * @brief Saca un nivel de la cola de una etapa, esperando si está vacía
+ * @return bool - false si la etapa anterior ha terminado y no quedan niveles
+ */
+static bool sacarTrabajo(ColaAcotada<TrabajoFabrica> &cola, const std::atomic<int> &activosAnterior,
+                         TrabajoFabrica &trabajo, EstadisticasEtapa &estadisticas)
+{
+    if (cola.intentarSacar(trabajo))
+    {
+        return true;
+    }
+    InstanteFabrica inicio = std::chrono::steady_clock::now();
+    EsperaFabrica espera;
+    bool sacado = false;
+    while (!sacado)
+    {
+        // Se mira si la etapa anterior ha terminado antes de volver a intentarlo,
+        // para no perder lo que metió justo antes de terminar
+        bool terminada = activosAnterior.load() == 0;
+        sacado = cola.intentarSacar(trabajo);
+        if (!sacado && terminada)
+        {
+            break;
+        }
+        if (!sacado)
+        {
+            espera.esperar();
+        }
+    }
+    estadisticas.segundosSinEntrada += segundosDesde(inicio);
+    return sacado;
+}
+
+/**
+ * @brief Suma las medidas de un hilo a las de su etapa
+ */
+static void acumular(CadenaFabrica &cadena, const EstadisticasEtapa &hilo, EstadisticasEtapa &etapa)
+{
+    std::lock_guard<std::mutex> bloqueo(cadena.cerrojo);
+    etapa.procesados += hilo.procesados;
+    etapa.segundosOcupado += hilo.segundosOcupado;
+    etapa.segundosSinEntrada += hilo.segundosSinEntrada;
+    etapa.segundosSalidaLlena += hilo.segundosSalidaLlena;
+    etapa.servicioMaximoMs = std::max(etapa.servicioMaximoMs, hilo.servicioMaximoMs);
+}
+
+OpcionesFabrica::OpcionesFabrica()
+{
+    numPilas = 6;
+    numNiveles = 100;
+    semilla = 1;
+    maxGenerados = 1000000;
+    longitudMinima = 0;
+    dificultadMinima = 0.0;
+    dificultadMaxima = -1.0;
+    maxNodosResolutor = 2000000;
+    maxEstadosAnalisis = 200000;
+    hilosGenerar = 1;
+    hilosResolver = 0;
+    hilosPuntuar = 0;
+    capacidadCola = 64;
+    binario = false;
+}
+
+EstadisticasEtapa::EstadisticasEtapa()
+{
+    numHilos = 0;
+    procesados = 0;
+    segundosOcupado = 0.0;
+    segundosSinEntrada = 0.0;
+    segundosSalidaLlena = 0.0;
+    servicioMaximoMs = 0.0;
+}
+
+EstadisticasFabrica::EstadisticasFabrica()
+{
+    generados = 0;
+    escritos = 0;
+    sinSolucion = 0;
+    cortos = 0;
+    fueraDeRango = 0;
+    repetidos = 0;
+    segundos = 0.0;
+    latenciaMediaMs = 0.0;
+    latenciaMaximaMs = 0.0;
+}
+
+/**
+ * Constructor
+ * @param opciones - Opciones de la producción
+ * @complexity O(1)
+ */
+FabricaNiveles::FabricaNiveles(const OpcionesFabrica &opciones)
+    : opciones(opciones)
+{
+}
+
+/**
+ * Genera un tablero aleatorio
+ * @param numPilas - Tubos del tablero
+ * @param semilla - Semilla de la generación
+ * @param indice - Número del nivel
+ * @return EstadoCompacto - Tablero generado
+ * @complexity O(n) donde n es el número de bolas
+ */
+EstadoCompacto FabricaNiveles::generarNivel(int numPilas, unsigned long long semilla, long long indice)
+{
+    std::seed_seq semillas{(uint32_t)semilla, (uint32_t)(semilla >> 32), (uint32_t)indice,
+                           (uint32_t)((unsigned long long)indice >> 32)};
+    std::mt19937_64 generador(semillas);
+
+    int numColores = numPilas - 2;
+    char bolas[Tablero::MAX_PILAS * Pila::CAPACIDAD_MAXIMA];
+    int numBolas = 0;
+    for (int color = 1; color <= numColores; color++)
+    {
+        for (int i = 0; i < Pila::CAPACIDAD_MAXIMA; i++)
+        {
+            bolas[numBolas++] = EstadoCompacto::colorIndice(color);
+        }
+    }
+    // Fisher-Yates con el generador, para no depender de std::shuffle
+    for (int i = numBolas - 1; i > 0; i--)
+    {
+        std::swap(bolas[i], bolas[generador() % (uint64_t)(i + 1)]);
+    }
+
+    Tablero tablero;
+    tablero.inicializar(numPilas);
+    for (int i = 0; i < numBolas; i++)
+    {
+        tablero.colocarBola(i / Pila::CAPACIDAD_MAXIMA, bolas[i]);
+    }
+    EstadoCompacto estado;
+    estado.desdeTablero(tablero);
+    return estado;
+}
+
+/**
+ * Produce un paquete de niveles
+ * @param salida - Flujo del paquete
+ * @param estadisticas - Medidas de la producción y de cada etapa
+ * @return bool - false si las opciones no son válidas o no se pudo escribir
+ * @complexity O(G * (R + A) / hilos)
+ */
+bool FabricaNiveles::producir(std::ostream &salida, EstadisticasFabrica &estadisticas) const
+{
+    estadisticas = EstadisticasFabrica();
+    if (opciones.numPilas < 3 || opciones.numPilas > Tablero::MAX_PILAS ||
+        opciones.numPilas - 2 > EstadoCompacto::MAX_COLORES || opciones.numNiveles < 0 ||
+        opciones.maxGenerados < 0 || opciones.capacidadCola < 1)
+    {
+        return false;
+    }
+
+    int nucleos = (int)std::max(1u, std::thread::hardware_concurrency());
+    int hilos[NUM_ETAPAS_FABRICA];
+    hilos[ETAPA_GENERAR] = std::max(1, opciones.hilosGenerar);
+    hilos[ETAPA_RESOLVER] = opciones.hilosResolver > 0 ? opciones.hilosResolver : nucleos;
+    hilos[ETAPA_PUNTUAR] = opciones.hilosPuntuar > 0 ? opciones.hilosPuntuar : nucleos;
+    hilos[ETAPA_ESCRIBIR] = 1; // La salida es secuencial
+
+    CadenaFabrica cadena;
+    for (int etapa = 0; etapa < NUM_ETAPAS_FABRICA; etapa++)
+    {
+        if (etapa > 0)
+        {
+            cadena.colas[etapa - 1].reset(new ColaAcotada<TrabajoFabrica>((size_t)opciones.capacidadCola));
+        }
+        cadena.activos[etapa] = hilos[etapa];
+        estadisticas.etapas[etapa].numHilos = hilos[etapa];
+    }
+    cadena.completo = opciones.numNiveles == 0;
+    cadena.siguienteIndice = 0;
+    cadena.siguienteEscrito = 0;
+    // Lo que cabe en las colas más lo que tienen entre manos los hilos
+    cadena.ventana = (long long)opciones.capacidadCola * (NUM_ETAPAS_FABRICA - 1);
+    for (int etapa = 0; etapa < NUM_ETAPAS_FABRICA; etapa++)
+    {
+        cadena.ventana += hilos[etapa];
+    }
+
+    OpcionesResolutor opcionesResolutor;
+    opcionesResolutor.maxNodos = opciones.maxNodosResolutor;
+    AnalizadorDificultad analizador(opciones.maxEstadosAnalisis);
+    InstanteFabrica inicio = std::chrono::steady_clock::now();
+
+    // Generación: cada hilo toma el siguiente número hasta completar el paquete,
+    // sin adelantarse a la escritura más que la ventana
+    auto generar = [this, &cadena, &estadisticas]()
+    {
+        EstadisticasEtapa propias;
+        auto adelantada = [&cadena]()
+        { return cadena.siguienteIndice.load() - cadena.siguienteEscrito.load() >= cadena.ventana; };
+        while (!cadena.completo)
+        {
+            if (adelantada())
+            {
+                InstanteFabrica inicio = std::chrono::steady_clock::now();
+                EsperaFabrica espera;
+                while (!cadena.completo && adelantada())
+                {
+                    espera.esperar();
+                }
+                propias.segundosSalidaLlena += segundosDesde(inicio);
+                continue;
+            }
+            long long indice = cadena.siguienteIndice++;
+            if (indice >= opciones.maxGenerados)
+            {
+                break;
+            }
+            InstanteFabrica comienzo = std::chrono::steady_clock::now();
+            TrabajoFabrica trabajo;
+            trabajo.indice = indice;
+            trabajo.nivel = generarNivel(opciones.numPilas, opciones.semilla, indice);
+            trabajo.motivo = DESCARTE_NINGUNO;
+            trabajo.longitudOptima = -1;
+            trabajo.puntuacion = -1.0;
+            trabajo.creado = comienzo;
+            double servicio = segundosDesde(comienzo);
+            propias.procesados++;
+            propias.segundosOcupado += servicio;
+            propias.servicioMaximoMs = std::max(propias.servicioMaximoMs, servicio * 1000.0);
+            meterTrabajo(*cadena.colas[ETAPA_GENERAR], trabajo, propias);
+        }
+        acumular(cadena, propias, estadisticas.etapas[ETAPA_GENERAR]);
+        cadena.activos[ETAPA_GENERAR]--;
+    };
+
+    // Resolución y puntuación: mismas colas y medidas, distinto trabajo
+    auto procesar = [&cadena, &estadisticas](EtapaFabrica etapa, auto trabajar)
+    {
+        EstadisticasEtapa propias;
+        TrabajoFabrica trabajo;
+        while (sacarTrabajo(*cadena.colas[etapa - 1], cadena.activos[etapa - 1], trabajo, propias))
+        {
+            if (cadena.completo)
+            {
+                trabajo.motivo = DESCARTE_SOBRANTE;
+            }
+            if (trabajo.motivo == DESCARTE_NINGUNO)
+            {
+                InstanteFabrica comienzo = std::chrono::steady_clock::now();
+                Tablero tablero;
+                trabajo.nivel.aTablero(tablero);
+                trabajar(tablero, trabajo);
+                double servicio = segundosDesde(comienzo);
+                propias.procesados++;
+                propias.segundosOcupado += servicio;
+                propias.servicioMaximoMs = std::max(propias.servicioMaximoMs, servicio * 1000.0);
+            }
+            meterTrabajo(*cadena.colas[etapa], trabajo, propias);
+        }
+        acumular(cadena, propias, estadisticas.etapas[etapa]);
+        cadena.activos[etapa]--;
+    };
+    auto resolver = [this, &opcionesResolutor](const Tablero &tablero, TrabajoFabrica &trabajo)
+    {
+        ResultadoResolucion resultado = Resolutor(opcionesResolutor).resolver(tablero);
+        if (!resultado.resuelto)
+        {
+            trabajo.motivo = DESCARTE_SIN_SOLUCION;
+            return;
+        }
+        trabajo.longitudOptima = (int)resultado.movimientos.size();
+        if (trabajo.longitudOptima < opciones.longitudMinima)
+        {
+            trabajo.motivo = DESCARTE_CORTO;
+        }
+    };
+    auto puntuar = [this, &analizador](const Tablero &tablero, TrabajoFabrica &trabajo)
+    {
+        InformeDificultad informe = analizador.analizar(tablero);
+        trabajo.puntuacion = informe.puntuacion;
+        // Sin decidir, la puntuación no existe y no se puede comprobar el rango pedido
+        if (!informe.decidido || trabajo.puntuacion < opciones.dificultadMinima ||
+            (opciones.dificultadMaxima >= 0 && trabajo.puntuacion > opciones.dificultadMaxima))
+        {
+            trabajo.motivo = DESCARTE_DIFICULTAD;
+        }
+    };
+
+    // Escritura: reordena por número, quita repetidos y escribe hasta completar el paquete
+    auto escribir = [this, &cadena, &estadisticas, &salida]()
+    {
+        EstadisticasEtapa propias;
+        DeduplicadorNiveles deduplicador;
+        std::map<long long, TrabajoFabrica> pendientes;
+        long long siguiente = 0;
+        double sumaLatencias = 0.0;
+        TrabajoFabrica trabajo;
+        while (sacarTrabajo(*cadena.colas[ETAPA_ESCRIBIR - 1], cadena.activos[ETAPA_ESCRIBIR - 1], trabajo, propias))
+        {
+            pendientes[trabajo.indice] = trabajo;
+            for (auto it = pendientes.begin(); it != pendientes.end() && it->first == siguiente;
+                 it = pendientes.erase(it), cadena.siguienteEscrito = ++siguiente)
+            {
+                const TrabajoFabrica &listo = it->second;
+                if (cadena.completo)
+                {
+                    continue;
+                }
+                switch (listo.motivo)
+                {
+                case DESCARTE_SIN_SOLUCION:
+                    estadisticas.sinSolucion++;
+                    continue;
+                case DESCARTE_CORTO:
+                    estadisticas.cortos++;
+                    continue;
+                case DESCARTE_DIFICULTAD:
+                    estadisticas.fueraDeRango++;
+                    continue;
+                default:
+                    break;
+                }
+
+                InstanteFabrica comienzo = std::chrono::steady_clock::now();
+                Tablero tablero;
+                listo.nivel.aTablero(tablero);
+                bool nuevo = false;
+                deduplicador.agregar(tablero, nuevo);
+                if (!nuevo)
+                {
+                    estadisticas.repetidos++;
+                    continue;
+                }
+                if (opciones.binario)
+                {
+                    salida.write(reinterpret_cast<const char *>(&listo.nivel), sizeof(EstadoCompacto));
+                }
+                else
+                {
+                    char cabecera[128];
+                    std::snprintf(cabecera, sizeof(cabecera), "// Nivel %lld: %d movimientos, dificultad %.2f\n%d\n",
+                                  estadisticas.escritos + 1, listo.longitudOptima, listo.puntuacion,
+                                  listo.nivel.getNumPilas());
+                    std::string texto = cabecera;
+                    // Las dos últimas pilas son las vacías y no se escriben
+                    for (int pila = 0; pila < listo.nivel.getNumPilas() - 2; pila++)
+                    {
+                        for (int posicion = 0; posicion < listo.nivel.getAltura(pila); posicion++)
+                        {
+                            texto += EstadoCompacto::colorIndice(listo.nivel.getBola(pila, posicion));
+                        }
+                        texto += '\n';
+                    }
+                    texto += '\n';
+                    salida << texto;
+                }
+                estadisticas.escritos++;
+                double latencia = segundosDesde(listo.creado) * 1000.0;
+                sumaLatencias += latencia;
+                estadisticas.latenciaMaximaMs = std::max(estadisticas.latenciaMaximaMs, latencia);
+                double servicio = segundosDesde(comienzo);
+                propias.procesados++;
+                propias.segundosOcupado += servicio;
+                propias.servicioMaximoMs = std::max(propias.servicioMaximoMs, servicio * 1000.0);
+                if (estadisticas.escritos == opciones.numNiveles)
+                {
+                    cadena.completo = true; // Lo que quede en la cadena se descarta sin trabajar
+                }
+            }
+        }
+        if (estadisticas.escritos > 0)
+        {
+            estadisticas.latenciaMediaMs = sumaLatencias / (double)estadisticas.escritos;
+        }
+        acumular(cadena, propias, estadisticas.etapas[ETAPA_ESCRIBIR]);
+        cadena.activos[ETAPA_ESCRIBIR]--;
+    };
+
+    std::vector<std::thread> trabajadores;
+    for (int h = 0; h < hilos[ETAPA_GENERAR]; h++)
+    {
+        trabajadores.emplace_back(generar);
+    }
+    for (int h = 0; h < hilos[ETAPA_RESOLVER]; h++)
+    {
+        trabajadores.emplace_back(procesar, ETAPA_RESOLVER, resolver);
+    }
+    for (int h = 0; h < hilos[ETAPA_PUNTUAR]; h++)
+    {
+        trabajadores.emplace_back(procesar, ETAPA_PUNTUAR, puntuar);
+    }
+    trabajadores.emplace_back(escribir);
+    for (std::thread &trabajador : trabajadores)
+    {
+        trabajador.join();
+    }
+
+    estadisticas.generados = estadisticas.etapas[ETAPA_GENERAR].procesados;
+    estadisticas.segundos = segundosDesde(inicio);
+    salida.flush();
+    return !salida.fail();
+}
+
+/**
+ * Obtiene el nombre de una etapa
+ * @param etapa - Etapa
+ * @return std::string - Nombre para mostrar
+ * @complexity O(1)
+ */
+std::string FabricaNiveles::nombreEtapa(EtapaFabrica etapa)
+{
+    switch (etapa)
+    {
+    case ETAPA_GENERAR:
+        return "generar";
+    case ETAPA_RESOLVER:
+        return "resolver";
+    case ETAPA_PUNTUAR:
+        return "puntuar";
+    case ETAPA_ESCRIBIR:
+        return "escribir";
+    default:
+        return "?";
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * @file FabricaNiveles.h
+ * @brief TAD FabricaNiveles para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) FabricaNiveles, que
+ * produce paquetes de niveles en una cadena de cuatro etapas: generar tableros
+ * aleatorios, resolverlos con el TAD Resolutor, puntuarlos con el TAD
+ * AnalizadorDificultad y escribirlos. Cada etapa tiene sus propios hilos y se
+ * comunica con la siguiente por una ColaAcotada, de modo que todas trabajan a
+ * la vez y una etapa lenta frena a las anteriores en lugar de acumular
+ * niveles en memoria.
+ *
+ * Los niveles se numeran al generarlos y cada uno sale de una semilla y de su
+ * número, así que el paquete no depende del número de hilos: la etapa de
+ * escritura los vuelve a ordenar y escribe los primeros que superan los
+ * filtros, sin repetidos (mismo nivel salvo orden de tubos o letras de los
+ * colores, según el TAD DeduplicadorNiveles).
+ *
+ * El paquete se escribe en el formato de ballSort.cnf, un nivel tras otro con
+ * un comentario con su longitud óptima y su dificultad, o en binario, como una
+ * sucesión de registros EstadoCompacto de 24 bytes.
+ */
+
+#ifndef FABRICA_NIVELES_H
+#define FABRICA_NIVELES_H
+
+#include "EstadoCompacto.h"
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Opciones de la fábrica de niveles
+ */
+struct OpcionesFabrica
+{
+    int numPilas;                 // Tubos de cada nivel (los dos últimos vacíos)
+    long long numNiveles;         // Niveles del paquete
+    unsigned long long semilla;   // Semilla de la generación
+    long long maxGenerados;       // Tableros generados como máximo
+    int longitudMinima;           // Movimientos mínimos de la solución óptima
+    double dificultadMinima;      // Puntuación mínima de AnalizadorDificultad
+    double dificultadMaxima;      // Puntuación máxima (negativa = sin máximo)
+    long long maxNodosResolutor;  // Límite de nodos del resolutor
+    long long maxEstadosAnalisis; // Límite de la exploración completa del analizador
+    int hilosGenerar;             // Hilos de la etapa de generación
+    int hilosResolver;            // Hilos de la etapa de resolución (0 = todos los núcleos)
+    int hilosPuntuar;             // Hilos de la etapa de puntuación (0 = todos los núcleos)
+    int capacidadCola;            // Niveles en vuelo entre dos etapas como máximo
+    bool binario;                 // Escribir registros EstadoCompacto en lugar de texto
+
+    OpcionesFabrica();
+};
+
+/**
+ * @brief Etapas de la cadena de producción
+ */
+enum EtapaFabrica
+{
+    ETAPA_GENERAR,
+    ETAPA_RESOLVER,
+    ETAPA_PUNTUAR,
+    ETAPA_ESCRIBIR,
+    NUM_ETAPAS_FABRICA
+};
+
+/**
+ * @brief Medidas de una etapa
+ */
+struct EstadisticasEtapa
+{
+    int numHilos;               // Hilos de la etapa
+    long long procesados;       // Niveles atendidos (sin contar los ya descartados)
+    double segundosOcupado;     // Tiempo de trabajo, sumado entre hilos
+    double segundosSinEntrada;  // Tiempo esperando a la etapa anterior, sumado entre hilos
+    double segundosSalidaLlena; // Tiempo esperando a la etapa siguiente, sumado entre hilos
+    double servicioMaximoMs;    // Mayor tiempo de trabajo con un nivel
+
+    EstadisticasEtapa();
+};
+
+/**
+ * @brief Resultado de una producción
+ */
+struct EstadisticasFabrica
+{
+    EstadisticasEtapa etapas[NUM_ETAPAS_FABRICA]; // Medidas de cada etapa
+    long long generados;                          // Tableros generados
+    long long escritos;                           // Niveles escritos
+    long long sinSolucion;                        // Descartados sin solución (o sobre el límite de nodos)
+    long long cortos;                             // Descartados por longitud óptima
+    long long fueraDeRango;                       // Descartados por dificultad
+    long long repetidos;                          // Descartados por repetidos
+    double segundos;                              // Duración total
+    double latenciaMediaMs;                       // Desde que se genera un nivel escrito hasta que se escribe
+    double latenciaMaximaMs;                      // Mayor latencia de un nivel escrito
+
+    EstadisticasFabrica();
+};
+
+/**
+ * @brief TAD FabricaNiveles que produce paquetes de niveles en una cadena de etapas
+ */
+class FabricaNiveles
+{
+private:
+    OpcionesFabrica opciones; // Opciones de la producción
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea una fábrica con las opciones dadas
+     * @param opciones - Opciones de la producción
+     * @complexity O(1)
+     */
+    explicit FabricaNiveles(const OpcionesFabrica &opciones = OpcionesFabrica());
+
+    /**
+     * @brief Genera un tablero aleatorio
+     * @pre 3 <= numPilas <= Tablero::MAX_PILAS
+     * @post Los numPilas - 2 primeros tubos contienen, barajadas, cuatro bolas de
+     *       cada uno de los numPilas - 2 primeros colores de la paleta; el mismo
+     *       par (semilla, indice) da siempre el mismo tablero
+     * @param numPilas - Tubos del tablero
+     * @param semilla - Semilla de la generación
+     * @param indice - Número del nivel
+     * @return EstadoCompacto - Tablero generado
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static EstadoCompacto generarNivel(int numPilas, unsigned long long semilla, long long indice);
+
+    /**
+     * @brief Produce un paquete de niveles
+     * @pre No hay precondiciones
+     * @post Escribe en salida los primeros opciones.numNiveles niveles (en orden
+     *       de generación) que superan los filtros, o menos si antes se llega a
+     *       opciones.maxGenerados tableros
+     * @param salida - Flujo del paquete (abierto en binario si opciones.binario)
+     * @param estadisticas - Medidas de la producción y de cada etapa
+     * @return bool - false si las opciones no son válidas o no se pudo escribir
+     * @complexity O(G * (R + A) / hilos) donde G es el número de tableros
+     *             generados, R el coste de resolver uno y A el de analizarlo
+     */
+    bool producir(std::ostream &salida, EstadisticasFabrica &estadisticas) const;
+
+    /**
+     * @brief Obtiene el nombre de una etapa
+     * @param etapa - Etapa
+     * @return std::string - Nombre para mostrar
+     * @complexity O(1)
+     */
+    static std::string nombreEtapa(EtapaFabrica etapa);
+};
+
+#endif // FABRICA_NIVELES_H
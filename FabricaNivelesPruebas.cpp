@@ -0,0 +1,189 @@
+/**
+ * @file FabricaNivelesPruebas.cpp
+ * @brief Pruebas para los TADs ColaAcotada y FabricaNiveles del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD ColaAcotada (ColaAcotada.h) y del
+ * TAD FabricaNiveles (FabricaNiveles.h/FabricaNiveles.cpp). La cola se prueba
+ * con varios productores y consumidores a la vez; los paquetes producidos se
+ * vuelven a leer con el TAD DeduplicadorNiveles y se resuelven con el TAD
+ * Resolutor, y se comprueba que no dependen del número de hilos.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "ColaAcotada.h"
+#include "FabricaNiveles.h"
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "AnalizadorDificultad.cpp"
+#include "DeduplicadorNiveles.cpp"
+#include "FabricaNiveles.cpp"
+
+/**
+ * @brief Produce un paquete en memoria
+ */
+std::string producir(const OpcionesFabrica &opciones, EstadisticasFabrica &estadisticas)
+{
+    std::ostringstream salida;
+    assert(FabricaNiveles(opciones).producir(salida, estadisticas));
+    return salida.str();
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas de los TADs ColaAcotada y FabricaNiveles..." << std::endl;
+
+    // Prueba 1: Cola llena, vacía y en orden
+    ColaAcotada<int> cola(3);
+    assert(cola.getCapacidad() == 4 && ColaAcotada<int>(1).getCapacidad() == 2);
+    int valor = 0;
+    assert(!cola.intentarSacar(valor));
+    for (int i = 0; i < 10; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            int metido = i * 4 + j;
+            assert(cola.intentarMeter(metido));
+        }
+        int sobrante = -1;
+        assert(!cola.intentarMeter(sobrante) && cola.getTamAproximado() == 4);
+        for (int j = 0; j < 4; j++)
+        {
+            assert(cola.intentarSacar(valor) && valor == i * 4 + j);
+        }
+        assert(!cola.intentarSacar(valor));
+    }
+    std::cout << "Prueba 1 superada: Cola llena, vacía y en orden" << std::endl;
+
+    // Prueba 2: Varios productores y consumidores
+    const int PRODUCTORES = 3, CONSUMIDORES = 3, POR_PRODUCTOR = 100000;
+    ColaAcotada<long long> compartida(16);
+    std::atomic<long long> suma(0), sacados(0);
+    std::vector<std::thread> hilos;
+    for (int p = 0; p < PRODUCTORES; p++)
+    {
+        hilos.emplace_back([&compartida, p]()
+                           {
+                               for (long long i = 1; i <= POR_PRODUCTOR; i++)
+                               {
+                                   long long elemento = p * (long long)POR_PRODUCTOR + i;
+                                   while (!compartida.intentarMeter(elemento))
+                                   {
+                                       std::this_thread::yield();
+                                   }
+                               }
+                           });
+    }
+    for (int c = 0; c < CONSUMIDORES; c++)
+    {
+        hilos.emplace_back([&compartida, &suma, &sacados]()
+                           {
+                               long long elemento;
+                               while (sacados < PRODUCTORES * (long long)POR_PRODUCTOR)
+                               {
+                                   if (compartida.intentarSacar(elemento))
+                                   {
+                                       suma += elemento;
+                                       sacados++;
+                                   }
+                                   else
+                                   {
+                                       std::this_thread::yield();
+                                   }
+                               }
+                           });
+    }
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+    long long total = PRODUCTORES * (long long)POR_PRODUCTOR;
+    assert(sacados == total && suma == total * (total + 1) / 2);
+    std::cout << "Prueba 2 superada: " << total << " elementos entre " << PRODUCTORES << " productores y "
+              << CONSUMIDORES << " consumidores" << std::endl;
+
+    // Prueba 3: Paquete de texto con filtros, legible y resoluble
+    OpcionesFabrica opciones;
+    opciones.numPilas = 5;
+    opciones.numNiveles = 20;
+    opciones.semilla = 7;
+    opciones.longitudMinima = 10;
+    opciones.hilosResolver = 1;
+    opciones.hilosPuntuar = 1;
+    EstadisticasFabrica estadisticas;
+    std::string paquete = producir(opciones, estadisticas);
+    assert(estadisticas.escritos == 20);
+    assert(estadisticas.generados >= 20 + estadisticas.sinSolucion + estadisticas.cortos + estadisticas.repetidos);
+    assert(estadisticas.etapas[ETAPA_ESCRIBIR].procesados == 20);
+    assert(estadisticas.latenciaMaximaMs >= estadisticas.latenciaMediaMs);
+    DeduplicadorNiveles deduplicador;
+    std::vector<NivelPaquete> niveles;
+    deduplicador.agregarTexto(paquete, niveles);
+    assert(niveles.size() == 20 && deduplicador.getNumGrupos() == 20);
+    for (int grupo = 0; grupo < deduplicador.getNumGrupos(); grupo++)
+    {
+        Tablero tablero;
+        assert(deduplicador.getRepresentante(grupo).aTablero(tablero));
+        ResultadoResolucion resultado = Resolutor().resolver(tablero);
+        assert(resultado.resuelto && (int)resultado.movimientos.size() >= opciones.longitudMinima);
+    }
+    std::cout << "Prueba 3 superada: Paquete de 20 niveles (" << estadisticas.generados << " generados, "
+              << estadisticas.cortos << " cortos, " << estadisticas.repetidos << " repetidos)" << std::endl;
+
+    // Prueba 4: El paquete no depende de los hilos ni de la capacidad de las colas
+    OpcionesFabrica paralelo = opciones;
+    paralelo.hilosGenerar = 2;
+    paralelo.hilosResolver = 3;
+    paralelo.hilosPuntuar = 3;
+    paralelo.capacidadCola = 1;
+    EstadisticasFabrica estadisticasParalelo;
+    assert(producir(paralelo, estadisticasParalelo) == paquete);
+    assert(estadisticasParalelo.etapas[ETAPA_RESOLVER].numHilos == 3);
+    assert(estadisticasParalelo.cortos == estadisticas.cortos);
+    std::cout << "Prueba 4 superada: Mismo paquete con 2/3/3 hilos y colas de 2 niveles" << std::endl;
+
+    // Prueba 5: Paquete binario y límites
+    OpcionesFabrica binario = opciones;
+    binario.binario = true;
+    std::string registros = producir(binario, estadisticas);
+    assert(registros.size() == 20 * sizeof(EstadoCompacto));
+    for (int i = 0; i < 20; i++)
+    {
+        EstadoCompacto nivel;
+        std::memcpy(&nivel, registros.data() + i * sizeof(EstadoCompacto), sizeof(EstadoCompacto));
+        assert(nivel == deduplicador.getRepresentante(i));
+    }
+    OpcionesFabrica imposible = opciones;
+    imposible.longitudMinima = 1000;
+    imposible.maxGenerados = 30;
+    assert(producir(imposible, estadisticas).empty());
+    assert(estadisticas.escritos == 0 && estadisticas.generados == 30 && estadisticas.cortos == 30);
+    OpcionesFabrica noValidas = opciones;
+    noValidas.numPilas = Tablero::MAX_PILAS + 1;
+    std::ostringstream salida;
+    assert(!FabricaNiveles(noValidas).producir(salida, estadisticas));
+    std::cout << "Prueba 5 superada: Paquete binario y límites" << std::endl;
+
+    std::cout << "¡Todas las pruebas de los TADs ColaAcotada y FabricaNiveles han sido superadas!" << std::endl;
+    return 0;
+}
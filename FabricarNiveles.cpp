@@ -0,0 +1,181 @@
+/**
+ * @file FabricarNiveles.cpp
+ * @brief Herramienta que produce paquetes de niveles
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa produce un paquete de niveles con el TAD FabricaNiveles:
+ * genera tableros aleatorios, los resuelve, los puntúa y escribe los que
+ * superan los filtros, con las cuatro etapas trabajando a la vez. Al terminar
+ * muestra, por etapa, los niveles atendidos por segundo, el tiempo medio y
+ * máximo con cada nivel, la ocupación de sus hilos y cuánto tiempo pasaron
+ * esperando a la etapa anterior (sin entrada) o a la siguiente (salida llena).
+ *
+ * Uso: FabricarNiveles --salida paquete [--niveles N] [--tubos T] [--semilla S]
+ *                      [--min-movimientos L] [--dificultad-min D] [--dificultad-max D]
+ *                      [--max-nodos N] [--max-estados N] [--max-generados N]
+ *                      [--hilos-resolver N] [--hilos-puntuar N] [--hilos-generar N]
+ *                      [--cola N] [--binario]
+ */
+
+#include "FabricaNiveles.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "AnalizadorDificultad.cpp"
+#include "DeduplicadorNiveles.cpp"
+#include "FabricaNiveles.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: FabricarNiveles --salida paquete [--niveles N] [--tubos T] [--semilla S]" << std::endl;
+    std::cerr << "                       [--min-movimientos L] [--dificultad-min D] [--dificultad-max D]" << std::endl;
+    std::cerr << "                       [--max-nodos N] [--max-estados N] [--max-generados N]" << std::endl;
+    std::cerr << "                       [--hilos-resolver N] [--hilos-puntuar N] [--hilos-generar N]" << std::endl;
+    std::cerr << "                       [--cola N] [--binario]" << std::endl;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    OpcionesFabrica opciones;
+    std::string archivoSalida;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--salida" && i + 1 < argc)
+        {
+            archivoSalida = argv[++i];
+        }
+        else if (opcion == "--niveles" && i + 1 < argc)
+        {
+            opciones.numNiveles = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--tubos" && i + 1 < argc)
+        {
+            opciones.numPilas = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--semilla" && i + 1 < argc)
+        {
+            opciones.semilla = std::stoull(argv[++i]);
+        }
+        else if (opcion == "--min-movimientos" && i + 1 < argc)
+        {
+            opciones.longitudMinima = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--dificultad-min" && i + 1 < argc)
+        {
+            opciones.dificultadMinima = std::stod(argv[++i]);
+        }
+        else if (opcion == "--dificultad-max" && i + 1 < argc)
+        {
+            opciones.dificultadMaxima = std::stod(argv[++i]);
+        }
+        else if (opcion == "--max-nodos" && i + 1 < argc)
+        {
+            opciones.maxNodosResolutor = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--max-estados" && i + 1 < argc)
+        {
+            opciones.maxEstadosAnalisis = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--max-generados" && i + 1 < argc)
+        {
+            opciones.maxGenerados = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--hilos-generar" && i + 1 < argc)
+        {
+            opciones.hilosGenerar = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--hilos-resolver" && i + 1 < argc)
+        {
+            opciones.hilosResolver = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--hilos-puntuar" && i + 1 < argc)
+        {
+            opciones.hilosPuntuar = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--cola" && i + 1 < argc)
+        {
+            opciones.capacidadCola = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--binario")
+        {
+            opciones.binario = true;
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    if (archivoSalida.empty())
+    {
+        mostrarUso();
+        return 1;
+    }
+    std::ofstream salida(archivoSalida, opciones.binario ? std::ios::binary : std::ios::out);
+    if (!salida.is_open())
+    {
+        std::cerr << "Error: No se pudo crear " << archivoSalida << std::endl;
+        return 1;
+    }
+
+    EstadisticasFabrica estadisticas;
+    if (!FabricaNiveles(opciones).producir(salida, estadisticas))
+    {
+        std::cerr << "Error: Opciones no válidas o no se pudo escribir " << archivoSalida << std::endl;
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(10) << "Etapa" << std::right << std::setw(6) << "Hilos" << std::setw(9)
+              << "Niveles" << std::setw(11) << "Niveles/s" << std::setw(11) << "Medio ms" << std::setw(10)
+              << "Máx. ms" << std::setw(11) << "Ocupación" << std::setw(13) << "Sin entrada" << std::setw(14)
+              << "Salida llena" << std::endl;
+    std::cout << std::fixed;
+    for (int etapa = 0; etapa < NUM_ETAPAS_FABRICA; etapa++)
+    {
+        const EstadisticasEtapa &medidas = estadisticas.etapas[etapa];
+        double medioMs = medidas.procesados > 0 ? medidas.segundosOcupado * 1000.0 / medidas.procesados : 0.0;
+        double ocupacion = estadisticas.segundos > 0
+                               ? 100.0 * medidas.segundosOcupado / (estadisticas.segundos * medidas.numHilos)
+                               : 0.0;
+        std::cout << std::left << std::setw(10) << FabricaNiveles::nombreEtapa((EtapaFabrica)etapa) << std::right
+                  << std::setw(6) << medidas.numHilos << std::setw(9) << medidas.procesados << std::setw(11)
+                  << std::setprecision(1) << medidas.procesados / std::max(estadisticas.segundos, 1e-9)
+                  << std::setw(11) << std::setprecision(3) << medioMs << std::setw(10) << medidas.servicioMaximoMs
+                  << std::setw(10) << std::setprecision(1) << ocupacion << "%" << std::setw(12)
+                  << std::setprecision(2) << medidas.segundosSinEntrada << "s" << std::setw(13)
+                  << medidas.segundosSalidaLlena << "s" << std::endl;
+    }
+
+    std::cout << "Generados: " << estadisticas.generados << ", escritos: " << estadisticas.escritos
+              << ", sin solución: " << estadisticas.sinSolucion << ", cortos: " << estadisticas.cortos
+              << ", fuera de rango: " << estadisticas.fueraDeRango << ", repetidos: " << estadisticas.repetidos
+              << std::endl;
+    std::cout << std::setprecision(2) << "Niveles escritos por segundo: "
+              << estadisticas.escritos / std::max(estadisticas.segundos, 1e-9) << " (" << estadisticas.segundos
+              << " s); latencia media " << estadisticas.latenciaMediaMs << " ms, máxima "
+              << estadisticas.latenciaMaximaMs << " ms" << std::endl;
+    return estadisticas.escritos == opciones.numNiveles ? 0 : 2;
+}
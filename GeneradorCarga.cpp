@@ -0,0 +1,380 @@
+/**
+ * @file GeneradorCarga.cpp
+ * @brief Generador de carga para el servidor de partidas del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa abre muchas conexiones simultáneas con ServidorPartidas y en
+ * cada una juega sin parar la solución óptima de un nivel ("L id", los
+ * movimientos y vuelta a empezar). Cada conexión espera la respuesta de una
+ * orden antes de enviar la siguiente; las conexiones se reparten entre varios
+ * hilos, cada uno con su propio bucle epoll. Al terminar muestra las órdenes
+ * por segundo, las respuestas de error y los percentiles de latencia.
+ *
+ * Uso: GeneradorCarga <puerto | ruta.sock> <nivel.cnf> [--id nivel] [--conexiones N]
+ *                     [--hilos N] [--segundos S]
+ */
+
+#include "Juego.h"
+#include "Resolutor.h"
+#include "ServidorJuego.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ServidorJuego.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: GeneradorCarga <puerto | ruta.sock> <nivel.cnf> [--id nivel] [--conexiones N]" << std::endl;
+    std::cerr << "                    [--hilos N] [--segundos S]" << std::endl;
+}
+
+/**
+ * @brief Lee un número entero de un argumento sin lanzar excepciones
+ * @param texto - Argumento
+ * @param minimo - Menor valor admitido
+ * @param maximo - Mayor valor admitido
+ * @param valor - Número leído
+ * @return bool - false si el argumento no es un número o está fuera de rango
+ */
+static bool leerNumero(const char *texto, long long minimo, long long maximo, long long &valor)
+{
+    char *fin = nullptr;
+    errno = 0;
+    valor = std::strtoll(texto, &fin, 10);
+    return fin != texto && *fin == '\0' && errno == 0 && valor >= minimo && valor <= maximo;
+}
+
+/**
+ * @brief Lee una duración en segundos de un argumento sin lanzar excepciones
+ * @param texto - Argumento
+ * @param valor - Segundos leídos
+ * @return bool - false si el argumento no es un número finito mayor que 0
+ */
+static bool leerSegundos(const char *texto, double &valor)
+{
+    char *fin = nullptr;
+    errno = 0;
+    valor = std::strtod(texto, &fin);
+    return fin != texto && *fin == '\0' && errno == 0 && std::isfinite(valor) && valor > 0.0;
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Estado de una conexión del generador
+ */
+struct ConexionCarga
+{
+    int descriptor;                              // Socket de la conexión
+    size_t paso;                                 // Orden de la secuencia que espera respuesta
+    std::chrono::steady_clock::time_point envio; // Instante en que se envió la orden
+    std::string recibido;                        // Respuesta recibida en parte
+};
+
+/**
+ * @brief Resultados de un hilo del generador
+ */
+struct ResultadoCarga
+{
+    long long respuestas;            // Respuestas recibidas
+    long long errores;               // Respuestas "ERR" o conexiones perdidas
+    std::vector<uint32_t> latencias; // Microsegundos entre cada orden y su respuesta
+};
+
+/**
+ * @brief Abre una conexión bloqueante con el servidor
+ * @param direccion - Puerto TCP o ruta del socket Unix
+ * @return int - Descriptor del socket o -1 si no se pudo conectar
+ */
+int conectar(const std::string &direccion)
+{
+    int puerto = 0;
+    int descriptor;
+    int resultado;
+    if (ServidorJuego::leerPuerto(direccion, puerto))
+    {
+        if (puerto == 0)
+        {
+            return -1;
+        }
+        descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in destino;
+        std::memset(&destino, 0, sizeof(destino));
+        destino.sin_family = AF_INET;
+        destino.sin_port = htons((uint16_t)puerto);
+        destino.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        resultado = connect(descriptor, (sockaddr *)&destino, sizeof(destino));
+        int activo = 1;
+        setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &activo, sizeof(activo));
+    }
+    else
+    {
+        descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un destino;
+        std::memset(&destino, 0, sizeof(destino));
+        destino.sun_family = AF_UNIX;
+        std::strncpy(destino.sun_path, direccion.c_str(), sizeof(destino.sun_path) - 1);
+        resultado = connect(descriptor, (sockaddr *)&destino, sizeof(destino));
+    }
+    if (resultado != 0)
+    {
+        close(descriptor);
+        return -1;
+    }
+    return descriptor;
+}
+
+/**
+ * @brief Envía la orden actual de una conexión
+ * @param conexion - Conexión
+ * @param ordenes - Secuencia de órdenes (con salto de línea)
+ * @return bool - false si no se pudo enviar
+ */
+bool enviarOrden(ConexionCarga &conexion, const std::vector<std::string> &ordenes)
+{
+    const std::string &orden = ordenes[conexion.paso];
+    conexion.envio = std::chrono::steady_clock::now();
+    return send(conexion.descriptor, orden.data(), orden.size(), MSG_NOSIGNAL) == (ssize_t)orden.size();
+}
+
+/**
+ * @brief Juega con un grupo de conexiones hasta que se agota el tiempo
+ * @param direccion - Puerto TCP o ruta del socket Unix
+ * @param numConexiones - Conexiones del hilo
+ * @param ordenes - Secuencia de órdenes que repite cada conexión
+ * @param parar - Indica que se ha agotado el tiempo
+ * @param resultado - Resultados del hilo
+ */
+void generarCarga(const std::string &direccion, int numConexiones, const std::vector<std::string> &ordenes,
+                  const std::atomic<bool> &parar, ResultadoCarga &resultado)
+{
+    resultado.respuestas = 0;
+    resultado.errores = 0;
+
+    int epoll = epoll_create1(0);
+    std::vector<ConexionCarga> conexiones;
+    conexiones.reserve(numConexiones);
+    for (int i = 0; i < numConexiones; i++)
+    {
+        int descriptor = conectar(direccion);
+        if (descriptor < 0)
+        {
+            resultado.errores++;
+            continue;
+        }
+        conexiones.push_back(ConexionCarga{descriptor, 0, std::chrono::steady_clock::now(), std::string()});
+    }
+    for (size_t i = 0; i < conexiones.size(); i++)
+    {
+        epoll_event evento;
+        evento.events = EPOLLIN;
+        evento.data.u64 = i;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, conexiones[i].descriptor, &evento);
+        enviarOrden(conexiones[i], ordenes);
+    }
+
+    epoll_event eventos[256];
+    char bufer[4096];
+    while (!parar)
+    {
+        int numEventos = epoll_wait(epoll, eventos, 256, 100);
+        for (int e = 0; e < numEventos; e++)
+        {
+            ConexionCarga &conexion = conexiones[eventos[e].data.u64];
+            ssize_t leidos = recv(conexion.descriptor, bufer, sizeof(bufer), 0);
+            if (leidos <= 0)
+            {
+                resultado.errores++;
+                epoll_ctl(epoll, EPOLL_CTL_DEL, conexion.descriptor, nullptr);
+                continue;
+            }
+            conexion.recibido.append(bufer, (size_t)leidos);
+
+            size_t salto;
+            while ((salto = conexion.recibido.find('\n')) != std::string::npos)
+            {
+                auto ahora = std::chrono::steady_clock::now();
+                resultado.latencias.push_back(
+                    (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(ahora - conexion.envio).count());
+                resultado.respuestas++;
+                if (conexion.recibido.compare(0, 3, "ERR") == 0)
+                {
+                    resultado.errores++;
+                }
+                conexion.recibido.erase(0, salto + 1);
+                conexion.paso = (conexion.paso + 1) % ordenes.size();
+                enviarOrden(conexion, ordenes);
+            }
+        }
+    }
+
+    for (ConexionCarga &conexion : conexiones)
+    {
+        close(conexion.descriptor);
+    }
+    close(epoll);
+}
+
+#endif
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string direccion = argv[1];
+    std::string archivoNivel = argv[2];
+    std::string id = "nivel";
+    int numConexiones = 1000;
+    int numHilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    double segundos = 5.0;
+    for (int i = 3; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--id" && i + 1 < argc)
+        {
+            id = argv[++i];
+        }
+        else if (opcion == "--conexiones" && i + 1 < argc)
+        {
+            long long conexiones = 0;
+            if (!leerNumero(argv[++i], 1, 1000000, conexiones))
+            {
+                std::cerr << "Error: Número de conexiones no válido: " << argv[i] << std::endl;
+                return 1;
+            }
+            numConexiones = (int)conexiones;
+        }
+        else if (opcion == "--hilos" && i + 1 < argc)
+        {
+            long long hilos = 0;
+            if (!leerNumero(argv[++i], 1, 1024, hilos))
+            {
+                std::cerr << "Error: Número de hilos no válido: " << argv[i] << std::endl;
+                return 1;
+            }
+            numHilos = (int)hilos;
+        }
+        else if (opcion == "--segundos" && i + 1 < argc)
+        {
+            if (!leerSegundos(argv[++i], segundos))
+            {
+                std::cerr << "Error: Duración no válida: " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+#ifdef __linux__
+    Juego juego;
+    if (!juego.inicializar(archivoNivel))
+    {
+        std::cerr << "Error: No se pudo cargar el nivel " << archivoNivel << std::endl;
+        return 1;
+    }
+    ResultadoResolucion solucion = Resolutor().resolver(juego.getTablero());
+    if (!solucion.resuelto)
+    {
+        std::cerr << "Error: El nivel no tiene solución" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> ordenes;
+    ordenes.push_back("L " + id + "\n");
+    for (const Movimiento &movimiento : solucion.movimientos)
+    {
+        ordenes.push_back("M " + std::to_string(movimiento.origen + 1) + " " + std::to_string(movimiento.destino + 1) +
+                          "\n");
+    }
+
+    numHilos = std::min(numHilos, numConexiones);
+    std::atomic<bool> parar(false);
+    std::vector<ResultadoCarga> resultados(numHilos);
+    std::vector<std::thread> hilos;
+    for (int h = 0; h < numHilos; h++)
+    {
+        int conexionesHilo = numConexiones / numHilos + (h < numConexiones % numHilos ? 1 : 0);
+        hilos.emplace_back(generarCarga, direccion, conexionesHilo, std::cref(ordenes), std::cref(parar),
+                           std::ref(resultados[h]));
+    }
+    auto inicio = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::duration<double>(segundos));
+    parar = true;
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+    double transcurrido = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    long long respuestas = 0;
+    long long errores = 0;
+    std::vector<uint32_t> latencias;
+    for (const ResultadoCarga &resultado : resultados)
+    {
+        respuestas += resultado.respuestas;
+        errores += resultado.errores;
+        latencias.insert(latencias.end(), resultado.latencias.begin(), resultado.latencias.end());
+    }
+    std::sort(latencias.begin(), latencias.end());
+
+    std::cout << "Conexiones: " << numConexiones << " en " << numHilos << " hilos" << std::endl;
+    std::cout << "Órdenes respondidas: " << respuestas << " en " << transcurrido << " s" << std::endl;
+    std::cout << "Órdenes por segundo: " << (long long)(respuestas / transcurrido) << std::endl;
+    std::cout << "Errores: " << errores << std::endl;
+    if (!latencias.empty())
+    {
+        std::cout << "Latencia (µs): p50 " << latencias[latencias.size() / 2] << ", p99 "
+                  << latencias[latencias.size() * 99 / 100] << ", máx " << latencias.back() << std::endl;
+    }
+    return errores > 0 ? 2 : 0;
+#else
+    std::cerr << "Error: El generador de carga solo está disponible en Linux" << std::endl;
+    return 1;
+#endif
+}
@@ -0,0 +1,272 @@
+/**
+ * @file Instrumentacion.cpp
+ * @brief Implementación del TAD Instrumentacion para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa la exportación de las métricas definidas en el TAD
+ * Instrumentacion (Instrumentacion.h): el formato de texto de Prometheus (apto
+ * para el colector de archivos de texto de node_exporter), un resumen legible y
+ * el volcado periódico desde un hilo. Los contadores se leen sin detener a
+ * quien los actualiza, así que cada exportación es una instantánea aproximada.
+ */
+
+#include "Instrumentacion.h"
+#include <cstdio>
+#include <fstream>
+
+/**
+ * @brief Nombre y descripción de una métrica exportada
+ */
+struct DescripcionMetrica
+{
+    const char *nombre;      // Nombre en Prometheus (sin el prefijo ballsort_)
+    const char *etiqueta;    // Etiquetas entre llaves, o "" si no tiene
+    const char *descripcion; // Texto de ayuda
+};
+
+// Métricas de los contadores, en el orden de ContadorInstrumentacion
+static const DescripcionMetrica METRICAS_CONTADORES[NUM_CONTADORES] = {
+    {"cargas_fallidas_total", "", "Configuraciones que no se pudieron cargar"},
+    {"movimientos_total", "", "Movimientos realizados"},
+    {"movimientos_rechazados_total", "{motivo=\"indice\"}", "Movimientos rechazados por motivo"},
+    {"movimientos_rechazados_total", "{motivo=\"mismo_tubo\"}", ""},
+    {"movimientos_rechazados_total", "{motivo=\"origen_vacio\"}", ""},
+    {"movimientos_rechazados_total", "{motivo=\"destino_lleno\"}", ""},
+    {"movimientos_rechazados_total", "{motivo=\"color\"}", ""},
+    {"movimientos_rechazados_total", "{motivo=\"juego_terminado\"}", ""},
+    {"comprobaciones_fin_total", "", "Comprobaciones de fin de juego"},
+};
+
+// Métricas de las operaciones medidas, en el orden de MedidaInstrumentacion
+static const DescripcionMetrica METRICAS_MEDIDAS[NUM_MEDIDAS] = {
+    {"carga_configuracion_segundos", "", "Duración de la carga de configuración"},
+    {"realizar_movimiento_segundos", "", "Duración de Juego::realizarMovimiento"},
+    {"dibujo_tablero_segundos", "", "Duración del dibujo del tablero"},
+};
+
+// Límites superiores de las cubetas del histograma en el formato de Prometheus
+static const char *LIMITES_CUBETAS[Instrumentacion::NUM_CUBETAS] = {"1e-07", "1e-06", "1e-05", "0.0001",
+                                                                     "0.001", "0.01",  "0.1",   "+Inf"};
+
+/**
+ * Añade una línea "nombre valor" a un texto
+ * @param texto - Cadena donde se añade
+ * @param nombre - Nombre con etiquetas
+ * @param valor - Valor de la métrica
+ * @complexity O(1)
+ */
+static void escribirMuestra(std::string &texto, const std::string &nombre, const std::string &valor)
+{
+    texto += nombre;
+    texto += ' ';
+    texto += valor;
+    texto += '\n';
+}
+
+/**
+ * Escribe un número real con precisión suficiente para Prometheus
+ * @param valor - Número
+ * @return std::string - Texto del número
+ * @complexity O(1)
+ */
+static std::string textoReal(double valor)
+{
+    char bufer[32];
+    std::snprintf(bufer, sizeof(bufer), "%.9g", valor);
+    return bufer;
+}
+
+/**
+ * Pone a cero todos los contadores y medidas
+ * @complexity O(1)
+ */
+void Instrumentacion::reiniciar()
+{
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        contadores[c].store(0, std::memory_order_relaxed);
+    }
+    for (int m = 0; m < NUM_MEDIDAS; m++)
+    {
+        numMedidas[m].store(0, std::memory_order_relaxed);
+        sumaNs[m].store(0, std::memory_order_relaxed);
+        maxNs[m].store(0, std::memory_order_relaxed);
+        for (int i = 0; i < NUM_CUBETAS; i++)
+        {
+            cubetas[m][i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Escribe los contadores y los histogramas en el formato de texto de Prometheus
+ * @param texto - Cadena donde se añade la exportación
+ * @complexity O(1)
+ */
+void Instrumentacion::exportarPrometheus(std::string &texto)
+{
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        const DescripcionMetrica &metrica = METRICAS_CONTADORES[c];
+        std::string nombre = std::string("ballsort_") + metrica.nombre;
+        if (metrica.descripcion[0] != '\0')
+        {
+            texto += "# HELP " + nombre + " " + metrica.descripcion + "\n";
+            texto += "# TYPE " + nombre + " counter\n";
+        }
+        escribirMuestra(texto, nombre + metrica.etiqueta,
+                        std::to_string(getContador((ContadorInstrumentacion)c)));
+    }
+
+    for (int m = 0; m < NUM_MEDIDAS; m++)
+    {
+        MedidaInstrumentacion medida = (MedidaInstrumentacion)m;
+        std::string nombre = std::string("ballsort_") + METRICAS_MEDIDAS[m].nombre;
+        texto += "# HELP " + nombre + " " + METRICAS_MEDIDAS[m].descripcion + "\n";
+        texto += "# TYPE " + nombre + " histogram\n";
+
+        // Las cubetas de Prometheus son acumuladas
+        uint64_t acumulado = 0;
+        for (int i = 0; i < NUM_CUBETAS; i++)
+        {
+            acumulado += getCubeta(medida, i);
+            escribirMuestra(texto, nombre + "_bucket{le=\"" + LIMITES_CUBETAS[i] + "\"}", std::to_string(acumulado));
+        }
+        escribirMuestra(texto, nombre + "_sum", textoReal(getSumaNs(medida) / 1e9));
+        escribirMuestra(texto, nombre + "_count", std::to_string(acumulado));
+    }
+}
+
+/**
+ * Escribe un resumen legible de las métricas
+ * @param texto - Cadena donde se añade el resumen
+ * @complexity O(1)
+ */
+void Instrumentacion::exportarResumen(std::string &texto)
+{
+    if (!ACTIVA)
+    {
+        texto += "Instrumentación desactivada (compila con -DBALLSORT_INSTRUMENTACION)\n";
+        return;
+    }
+
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        texto += std::string(METRICAS_CONTADORES[c].nombre) + METRICAS_CONTADORES[c].etiqueta + ": " +
+                 std::to_string(getContador((ContadorInstrumentacion)c)) + "\n";
+    }
+    for (int m = 0; m < NUM_MEDIDAS; m++)
+    {
+        MedidaInstrumentacion medida = (MedidaInstrumentacion)m;
+        uint64_t cuenta = getNumMedidas(medida);
+        double mediaNs = cuenta == 0 ? 0.0 : (double)getSumaNs(medida) / (double)cuenta;
+        texto += std::string(METRICAS_MEDIDAS[m].nombre) + ": " + std::to_string(cuenta) + " veces, media " +
+                 textoReal(mediaNs / 1000.0) + " µs, máx " + textoReal(getMaxNs(medida) / 1000.0) + " µs\n";
+    }
+}
+
+/**
+ * Guarda la exportación de Prometheus en un archivo
+ * @param archivo - Ruta del archivo
+ * @return bool - true si se pudo escribir
+ * @complexity O(1)
+ */
+bool Instrumentacion::guardarPrometheus(const std::string &archivo)
+{
+    std::string texto;
+    exportarPrometheus(texto);
+
+    // Escribir en un temporal y renombrar, para que el lector nunca vea un archivo a medias
+    std::string temporal = archivo + ".tmp";
+    {
+        std::ofstream salida(temporal, std::ios::binary | std::ios::trunc);
+        if (!salida)
+        {
+            return false;
+        }
+        salida.write(texto.data(), (std::streamsize)texto.size());
+        if (!salida)
+        {
+            return false;
+        }
+    }
+#ifdef _WIN32
+    // En Windows rename no sustituye un archivo existente
+    std::remove(archivo.c_str());
+#endif
+    return std::rename(temporal.c_str(), archivo.c_str()) == 0;
+}
+
+/**
+ * Constructor
+ * @complexity O(1)
+ */
+VolcadoInstrumentacion::VolcadoInstrumentacion()
+{
+    intervaloMs = 0;
+    parar = false;
+}
+
+/**
+ * Destructor
+ */
+VolcadoInstrumentacion::~VolcadoInstrumentacion()
+{
+    detener();
+}
+
+/**
+ * Empieza a guardar las métricas cada cierto tiempo
+ * @param archivo - Ruta del archivo de Prometheus
+ * @param intervaloMs - Milisegundos entre volcados
+ * @return bool - false si ya estaba en marcha o el intervalo no es válido
+ * @complexity O(1)
+ */
+bool VolcadoInstrumentacion::iniciar(const std::string &archivo, int intervaloMs)
+{
+    if (hilo.joinable() || intervaloMs <= 0)
+    {
+        return false;
+    }
+    this->archivo = archivo;
+    this->intervaloMs = intervaloMs;
+    parar = false;
+    hilo = std::thread(&VolcadoInstrumentacion::volcar, this);
+    return true;
+}
+
+/**
+ * Detiene el volcado
+ * @complexity O(1)
+ */
+void VolcadoInstrumentacion::detener()
+{
+    if (!hilo.joinable())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojo);
+        parar = true;
+    }
+    aviso.notify_all();
+    hilo.join();
+}
+
+/**
+ * Bucle del hilo: guarda las métricas cada intervalo y una última vez al detenerse
+ * @complexity O(1) por volcado
+ */
+void VolcadoInstrumentacion::volcar()
+{
+    std::unique_lock<std::mutex> bloqueo(cerrojo);
+    while (!aviso.wait_for(bloqueo, std::chrono::milliseconds(intervaloMs), [this] { return parar; }))
+    {
+        Instrumentacion::guardarPrometheus(archivo);
+    }
+    bloqueo.unlock();
+
+    // El último volcado se hace siempre, aunque se detenga antes del primer intervalo
+    Instrumentacion::guardarPrometheus(archivo);
+}
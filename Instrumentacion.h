@@ -0,0 +1,306 @@
+/**
+ * @file Instrumentacion.h
+ * @brief TAD Instrumentacion para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) Instrumentacion, que
+ * cuenta y mide las operaciones más frecuentes de Juego: cargas de
+ * configuración, movimientos realizados, movimientos rechazados por motivo
+ * (el ResultadoMovimiento de Juego::realizarMovimiento), comprobaciones de fin
+ * de juego y tiempo de dibujo del tablero.
+ *
+ * La instrumentación se activa al compilar con -DBALLSORT_INSTRUMENTACION. Sin
+ * esa macro, INSTRUMENTAR_CONTAR e INSTRUMENTAR_MEDIR no generan código y las
+ * operaciones no tienen ningún coste añadido. Los contadores son atómicos y
+ * están en este archivo como variables inline para que Juego.cpp los use sin
+ * que cada programa tenga que incluir otra implementación; la exportación
+ * (texto de Prometheus, resumen legible y volcado periódico a un archivo) está
+ * en Instrumentacion.cpp.
+ */
+
+#ifndef INSTRUMENTACION_H
+#define INSTRUMENTACION_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Sucesos que se cuentan
+ *
+ * Desde CONTADOR_MOVIMIENTOS hasta CONTADOR_RECHAZO_JUEGO_TERMINADO siguen el
+ * orden de ResultadoMovimiento, así que cada resultado se cuenta con un solo
+ * incremento en CONTADOR_MOVIMIENTOS + resultado, sin comparaciones.
+ */
+enum ContadorInstrumentacion
+{
+    CONTADOR_CARGAS_FALLIDAS,         // Configuraciones que no se pudieron cargar
+    CONTADOR_MOVIMIENTOS,             // Movimientos realizados por Juego (MOVIMIENTO_VALIDO)
+    CONTADOR_RECHAZO_INDICE,          // Rechazos: tubo fuera del tablero
+    CONTADOR_RECHAZO_MISMO_TUBO,      // Rechazos: origen y destino iguales
+    CONTADOR_RECHAZO_ORIGEN_VACIO,    // Rechazos: tubo origen vacío
+    CONTADOR_RECHAZO_DESTINO_LLENO,   // Rechazos: tubo destino lleno
+    CONTADOR_RECHAZO_COLOR,           // Rechazos: color distinto en la cima del destino
+    CONTADOR_RECHAZO_JUEGO_TERMINADO, // Rechazos: la partida ya no está en curso
+    CONTADOR_COMPROBACIONES_FIN,      // Comprobaciones de fin de juego hechas por Juego
+    NUM_CONTADORES
+};
+
+/**
+ * @brief Operaciones cuya duración se mide
+ */
+enum MedidaInstrumentacion
+{
+    MEDIDA_CARGA,      // Juego::cargarConfiguracion
+    MEDIDA_MOVIMIENTO, // Juego::realizarMovimiento
+    MEDIDA_DIBUJO,     // Dibujo del tablero en la consola
+    NUM_MEDIDAS
+};
+
+/**
+ * @brief TAD Instrumentacion con contadores e histogramas de latencia globales
+ */
+class Instrumentacion
+{
+public:
+    static const int NUM_CUBETAS = 8; // Cubetas del histograma: hasta 100 ns, 1 µs, ... 100 ms y el resto
+
+#ifdef BALLSORT_INSTRUMENTACION
+    static constexpr bool ACTIVA = true;
+#else
+    static constexpr bool ACTIVA = false;
+#endif
+
+private:
+    static inline std::atomic<uint64_t> contadores[NUM_CONTADORES];
+    static inline std::atomic<uint64_t> numMedidas[NUM_MEDIDAS];
+    static inline std::atomic<uint64_t> sumaNs[NUM_MEDIDAS];
+    static inline std::atomic<uint64_t> maxNs[NUM_MEDIDAS];
+    static inline std::atomic<uint64_t> cubetas[NUM_MEDIDAS][NUM_CUBETAS];
+
+public:
+    /**
+     * @brief Suma uno a un contador
+     * @pre contador < NUM_CONTADORES
+     * @post El contador ha aumentado en uno
+     * @param contador - Contador a aumentar
+     * @complexity O(1)
+     */
+    static void contar(ContadorInstrumentacion contador)
+    {
+        contadores[contador].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Registra la duración de una operación
+     * @pre medida < NUM_MEDIDAS
+     * @post La duración queda sumada, comparada con el máximo y contada en su cubeta
+     * @param medida - Operación medida
+     * @param nanosegundos - Duración de la operación
+     * @complexity O(1)
+     */
+    static void registrarDuracion(MedidaInstrumentacion medida, uint64_t nanosegundos)
+    {
+        numMedidas[medida].fetch_add(1, std::memory_order_relaxed);
+        sumaNs[medida].fetch_add(nanosegundos, std::memory_order_relaxed);
+        uint64_t maximo = maxNs[medida].load(std::memory_order_relaxed);
+        while (nanosegundos > maximo &&
+               !maxNs[medida].compare_exchange_weak(maximo, nanosegundos, std::memory_order_relaxed))
+        {
+        }
+        int cubeta = 0;
+        uint64_t limite = 100;
+        while (cubeta < NUM_CUBETAS - 1 && nanosegundos > limite)
+        {
+            cubeta++;
+            limite *= 10;
+        }
+        cubetas[medida][cubeta].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtiene el valor de un contador
+     * @param contador - Contador
+     * @return uint64_t - Veces que se ha contado
+     * @complexity O(1)
+     */
+    static uint64_t getContador(ContadorInstrumentacion contador)
+    {
+        return contadores[contador].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtiene cuántas veces se ha medido una operación
+     * @param medida - Operación
+     * @return uint64_t - Número de medidas
+     * @complexity O(1)
+     */
+    static uint64_t getNumMedidas(MedidaInstrumentacion medida)
+    {
+        return numMedidas[medida].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtiene la suma de las duraciones de una operación
+     * @param medida - Operación
+     * @return uint64_t - Nanosegundos acumulados
+     * @complexity O(1)
+     */
+    static uint64_t getSumaNs(MedidaInstrumentacion medida)
+    {
+        return sumaNs[medida].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtiene la mayor duración de una operación
+     * @param medida - Operación
+     * @return uint64_t - Nanosegundos de la medida más lenta
+     * @complexity O(1)
+     */
+    static uint64_t getMaxNs(MedidaInstrumentacion medida)
+    {
+        return maxNs[medida].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtiene las medidas de una cubeta del histograma
+     * @pre 0 <= cubeta < NUM_CUBETAS
+     * @param medida - Operación
+     * @param cubeta - Cubeta (la i-ésima cuenta duraciones hasta 100·10^i ns; la última, el resto)
+     * @return uint64_t - Medidas de la cubeta (no acumuladas)
+     * @complexity O(1)
+     */
+    static uint64_t getCubeta(MedidaInstrumentacion medida, int cubeta)
+    {
+        return cubetas[medida][cubeta].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Pone a cero todos los contadores y medidas
+     * @pre No hay precondiciones
+     * @post Todos los valores son cero
+     * @complexity O(1)
+     */
+    static void reiniciar();
+
+    /**
+     * @brief Escribe los contadores y los histogramas en el formato de texto de Prometheus
+     * @pre No hay precondiciones
+     * @post Añade a texto una métrica por contador y un histograma por operación
+     * @param texto - Cadena donde se añade la exportación
+     * @complexity O(1)
+     */
+    static void exportarPrometheus(std::string &texto);
+
+    /**
+     * @brief Escribe un resumen legible (cuentas, media y máximo por operación)
+     * @pre No hay precondiciones
+     * @post Añade el resumen a texto
+     * @param texto - Cadena donde se añade el resumen
+     * @complexity O(1)
+     */
+    static void exportarResumen(std::string &texto);
+
+    /**
+     * @brief Guarda la exportación de Prometheus en un archivo
+     * @pre No hay precondiciones
+     * @post El archivo se sustituye de una vez (se escribe uno temporal y se renombra)
+     * @param archivo - Ruta del archivo
+     * @return bool - true si se pudo escribir
+     * @complexity O(1)
+     */
+    static bool guardarPrometheus(const std::string &archivo);
+};
+
+/**
+ * @brief Mide la duración de un bloque y la registra al salir de él
+ */
+class CronometroInstrumentacion
+{
+private:
+    MedidaInstrumentacion medida;
+    std::chrono::steady_clock::time_point inicio;
+
+public:
+    explicit CronometroInstrumentacion(MedidaInstrumentacion medida)
+        : medida(medida), inicio(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~CronometroInstrumentacion()
+    {
+        auto duracion = std::chrono::steady_clock::now() - inicio;
+        Instrumentacion::registrarDuracion(
+            medida, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duracion).count());
+    }
+};
+
+/**
+ * @brief TAD VolcadoInstrumentacion que guarda las métricas periódicamente desde un hilo
+ */
+class VolcadoInstrumentacion
+{
+private:
+    std::string archivo;             // Archivo de Prometheus que se sustituye en cada volcado
+    int intervaloMs;                 // Milisegundos entre volcados
+    bool parar;                      // Indica al hilo que debe terminar
+    std::mutex cerrojo;              // Protege parar
+    std::condition_variable aviso;   // Despierta al hilo al detener
+    std::thread hilo;                // Hilo que hace los volcados
+
+    void volcar();
+
+public:
+    /**
+     * @brief Constructor
+     * @post Crea un volcado detenido
+     * @complexity O(1)
+     */
+    VolcadoInstrumentacion();
+
+    /**
+     * @brief Destructor
+     * @post Detiene el volcado si está en marcha (con un último volcado)
+     */
+    ~VolcadoInstrumentacion();
+
+    VolcadoInstrumentacion(const VolcadoInstrumentacion &) = delete;
+    VolcadoInstrumentacion &operator=(const VolcadoInstrumentacion &) = delete;
+
+    /**
+     * @brief Empieza a guardar las métricas cada cierto tiempo
+     * @pre El volcado está detenido y intervaloMs > 0
+     * @post Un hilo guarda las métricas en archivo cada intervaloMs milisegundos
+     * @param archivo - Ruta del archivo de Prometheus
+     * @param intervaloMs - Milisegundos entre volcados
+     * @return bool - false si ya estaba en marcha o el intervalo no es válido
+     * @complexity O(1)
+     */
+    bool iniciar(const std::string &archivo, int intervaloMs);
+
+    /**
+     * @brief Detiene el volcado
+     * @pre No hay precondiciones
+     * @post El hilo ha terminado tras un último volcado
+     * @complexity O(1)
+     */
+    void detener();
+};
+
+#ifdef BALLSORT_INSTRUMENTACION
+#define INSTRUMENTAR_CONTAR(contador) Instrumentacion::contar(contador)
+#define INSTRUMENTAR_RESULTADO(resultado) \
+    Instrumentacion::contar((ContadorInstrumentacion)(CONTADOR_MOVIMIENTOS + (int)(resultado)))
+#define INSTRUMENTAR_MEDIR(medida) CronometroInstrumentacion cronometroInstrumentacion(medida)
+#else
+#define INSTRUMENTAR_CONTAR(contador) ((void)0)
+#define INSTRUMENTAR_RESULTADO(resultado) ((void)0)
+#define INSTRUMENTAR_MEDIR(medida) ((void)0)
+#endif
+
+#endif // INSTRUMENTACION_H
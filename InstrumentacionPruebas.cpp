@@ -0,0 +1,168 @@
+/**
+ * @file InstrumentacionPruebas.cpp
+ * @brief Pruebas para el TAD Instrumentacion del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD Instrumentacion
+ * (Instrumentacion.h/Instrumentacion.cpp). Se compila con la instrumentación
+ * activada y comprueba que Juego cuenta los movimientos, los
+ * rechazos por motivo (ResultadoMovimiento) y las comprobaciones de fin, y
+ * que la exportación en formato Prometheus y el volcado periódico son correctos.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+// Activar la instrumentación en esta unidad de compilación
+#ifndef BALLSORT_INSTRUMENTACION
+#define BALLSORT_INSTRUMENTACION
+#endif
+
+#include "Juego.h"
+#include "Instrumentacion.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "Instrumentacion.cpp"
+
+/**
+ * @brief Indica si un texto contiene una línea exacta
+ * @param texto - Texto con varias líneas
+ * @param linea - Línea buscada
+ * @return bool - true si alguna línea coincide
+ */
+bool contieneLinea(const std::string &texto, const std::string &linea)
+{
+    std::istringstream lector(texto);
+    std::string actual;
+    while (std::getline(lector, actual))
+    {
+        if (actual == linea)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD Instrumentacion..." << std::endl;
+    assert(Instrumentacion::ACTIVA);
+
+    // Prueba 1: Rechazos por motivo
+    Instrumentacion::reiniciar();
+    Juego juego;
+    ResultadoMovimiento resultado;
+    assert(!juego.inicializar("no_existe.cnf"));
+    assert(juego.inicializar(crearTablero(4, {"RRRG", "GGGR"})));
+    assert(!juego.realizarMovimiento(-1, 2, resultado) && resultado == MOVIMIENTO_INDICE_NO_VALIDO);
+    assert(!juego.realizarMovimiento(0, 4, resultado) && resultado == MOVIMIENTO_INDICE_NO_VALIDO);
+    assert(!juego.realizarMovimiento(1, 1, resultado) && resultado == MOVIMIENTO_MISMO_TUBO);
+    assert(!juego.realizarMovimiento(2, 0, resultado) && resultado == MOVIMIENTO_ORIGEN_VACIO);
+    assert(!juego.realizarMovimiento(0, 1, resultado) && resultado == MOVIMIENTO_DESTINO_LLENO);
+    assert(juego.realizarMovimiento(0, 2, resultado) && resultado == MOVIMIENTO_VALIDO);
+    assert(!juego.realizarMovimiento(1, 2, resultado) && resultado == MOVIMIENTO_COLOR_DISTINTO);
+
+    // Las comprobaciones directas del tablero (las que hacen los resolutores) no se cuentan
+    assert(!juego.getTablero().movimientoValido(1, 2));
+    assert(Instrumentacion::getContador(CONTADOR_CARGAS_FALLIDAS) == 1);
+    assert(Instrumentacion::getContador(CONTADOR_RECHAZO_INDICE) == 2);
+    assert(Instrumentacion::getContador(CONTADOR_RECHAZO_MISMO_TUBO) == 1);
+    assert(Instrumentacion::getContador(CONTADOR_RECHAZO_ORIGEN_VACIO) == 1);
+    assert(Instrumentacion::getContador(CONTADOR_RECHAZO_DESTINO_LLENO) == 1);
+    assert(Instrumentacion::getContador(CONTADOR_RECHAZO_COLOR) == 1);
+    std::cout << "Prueba 1 superada: Rechazos por motivo" << std::endl;
+
+    // Prueba 2: Movimientos, comprobaciones de fin y latencias
+    assert(juego.realizarMovimiento(1, 3));
+    assert(juego.realizarMovimiento(2, 1));
+    assert(juego.realizarMovimiento(3, 0));
+    assert(!juego.estaEnCurso());
+    assert(!juego.realizarMovimiento(0, 2, resultado) && resultado == MOVIMIENTO_JUEGO_TERMINADO);
+    assert(Instrumentacion::getContador(CONTADOR_MOVIMIENTOS) == 4);
+    assert(Instrumentacion::getContador(CONTADOR_RECHAZO_JUEGO_TERMINADO) == 1);
+    assert(Instrumentacion::getContador(CONTADOR_COMPROBACIONES_FIN) == 4);
+    assert(Instrumentacion::getNumMedidas(MEDIDA_MOVIMIENTO) == 11);
+    assert(Instrumentacion::getNumMedidas(MEDIDA_CARGA) == 1);
+    uint64_t enCubetas = 0;
+    for (int i = 0; i < Instrumentacion::NUM_CUBETAS; i++)
+    {
+        enCubetas += Instrumentacion::getCubeta(MEDIDA_MOVIMIENTO, i);
+    }
+    assert(enCubetas == 11);
+    assert(Instrumentacion::getMaxNs(MEDIDA_MOVIMIENTO) * 11 >= Instrumentacion::getSumaNs(MEDIDA_MOVIMIENTO));
+    std::cout << "Prueba 2 superada: Movimientos, comprobaciones de fin y latencias" << std::endl;
+
+    // Prueba 3: Exportación en formato Prometheus y cubetas de latencia
+    Instrumentacion::registrarDuracion(MEDIDA_DIBUJO, 50);
+    Instrumentacion::registrarDuracion(MEDIDA_DIBUJO, 5000);
+    Instrumentacion::registrarDuracion(MEDIDA_DIBUJO, 2000000000);
+    std::string texto;
+    Instrumentacion::exportarPrometheus(texto);
+    assert(contieneLinea(texto, "# TYPE ballsort_movimientos_total counter"));
+    assert(contieneLinea(texto, "ballsort_movimientos_total 4"));
+    assert(contieneLinea(texto, "ballsort_movimientos_rechazados_total{motivo=\"indice\"} 2"));
+    assert(contieneLinea(texto, "ballsort_movimientos_rechazados_total{motivo=\"juego_terminado\"} 1"));
+    assert(contieneLinea(texto, "# TYPE ballsort_dibujo_tablero_segundos histogram"));
+    assert(contieneLinea(texto, "ballsort_dibujo_tablero_segundos_bucket{le=\"1e-07\"} 1"));
+    assert(contieneLinea(texto, "ballsort_dibujo_tablero_segundos_bucket{le=\"1e-06\"} 1"));
+    assert(contieneLinea(texto, "ballsort_dibujo_tablero_segundos_bucket{le=\"1e-05\"} 2"));
+    assert(contieneLinea(texto, "ballsort_dibujo_tablero_segundos_bucket{le=\"0.1\"} 2"));
+    assert(contieneLinea(texto, "ballsort_dibujo_tablero_segundos_bucket{le=\"+Inf\"} 3"));
+    assert(contieneLinea(texto, "ballsort_dibujo_tablero_segundos_count 3"));
+    assert(contieneLinea(texto, "ballsort_dibujo_tablero_segundos_sum 2.00000505"));
+    std::string resumen;
+    Instrumentacion::exportarResumen(resumen);
+    assert(resumen.find("dibujo_tablero_segundos: 3 veces") != std::string::npos);
+    std::cout << "Prueba 3 superada: Exportación en formato Prometheus" << std::endl;
+
+    // Prueba 4: Volcado periódico a un archivo
+    const std::string archivo = "instrumentacion_pruebas.prom";
+    {
+        VolcadoInstrumentacion volcado;
+        assert(!volcado.iniciar(archivo, 0));
+        assert(volcado.iniciar(archivo, 5));
+        assert(!volcado.iniciar(archivo, 5));
+        assert(juego.inicializar(crearTablero(4, {"RRRG", "GGGR"})));
+        assert(juego.realizarMovimiento(0, 2));
+        volcado.detener();
+    }
+    std::ifstream lector(archivo);
+    std::stringstream contenido;
+    contenido << lector.rdbuf();
+    assert(contieneLinea(contenido.str(), "ballsort_movimientos_total 5"));
+    lector.close();
+    std::remove(archivo.c_str());
+    {
+        // Detenido antes de cumplirse el primer intervalo, el volcado final se hace igualmente
+        VolcadoInstrumentacion volcado;
+        assert(volcado.iniciar(archivo, 60000));
+        volcado.detener();
+    }
+    lector.open(archivo);
+    assert(lector.is_open());
+    lector.close();
+    std::remove(archivo.c_str());
+    Instrumentacion::reiniciar();
+    assert(Instrumentacion::getContador(CONTADOR_MOVIMIENTOS) == 0);
+    assert(Instrumentacion::getNumMedidas(MEDIDA_DIBUJO) == 0);
+    std::cout << "Prueba 4 superada: Volcado periódico a un archivo" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD Instrumentacion han sido superadas!" << std::endl;
+    return 0;
+}
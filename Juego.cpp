@@ -11,9 +11,27 @@
  *
  * Es el componente principal que coordina todos los elementos del juego y sirve
  * como interfaz entre la lógica del juego y la interfaz de usuario.
+ *
+ * Cada prefijo de una grabación recibe una marca única en todo el programa, así
+ * que una instantánea reconoce si la grabación actual (de esta partida o de una
+ * copia) sigue pasando por ella sin comparar los movimientos.
  */
 
 #include "Juego.h"
+#include "EstadoCompacto.h"
+#include "Instrumentacion.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+// Siguiente marca de grabación libre (0 se reserva para "sin grabación")
+static std::atomic<uint64_t> siguienteMarcaGrabacion(1);
+
+// Las instantáneas guardan las palabras de un EstadoCompacto tal cual
+static_assert(sizeof(InstantaneaJuego::tablero) == sizeof(EstadoCompacto) &&
+                  std::is_trivially_copyable<EstadoCompacto>::value,
+              "InstantaneaJuego::tablero debe tener el tamaño de un EstadoCompacto");
 
 /**
  * Constructor por defecto
@@ -23,6 +41,7 @@ Juego::Juego()
 {
     numMovimientos = 0;
     juegoEnCurso = false;
+    grabando = false;
 }
 
 /**
@@ -37,12 +56,38 @@ bool Juego::inicializar(const std::string &nombreArchivo)
     if (cargarConfiguracion(nombreArchivo))
     {
         juegoEnCurso = true;
+        activarGrabacion(grabando);
         return true;
     }
+    INSTRUMENTAR_CONTAR(CONTADOR_CARGAS_FALLIDAS);
     juegoEnCurso = false;
     return false;
 }
 
+/**
+ * Inicializa el juego con un tablero dado
+ * @param tableroInicial - Tablero de partida
+ * @return bool - true si la inicialización fue exitosa
+ * @complexity O(n) donde n es el número de pilas
+ */
+bool Juego::inicializar(const Tablero &tableroInicial)
+{
+    tablero = tableroInicial;
+    numMovimientos = 0;
+    juegoEnCurso = true;
+    activarGrabacion(grabando);
+    return true;
+}
+
+// Los contadores de resultados de la instrumentación siguen el orden de ResultadoMovimiento
+static_assert(CONTADOR_MOVIMIENTOS + MOVIMIENTO_INDICE_NO_VALIDO == CONTADOR_RECHAZO_INDICE &&
+                  CONTADOR_MOVIMIENTOS + MOVIMIENTO_MISMO_TUBO == CONTADOR_RECHAZO_MISMO_TUBO &&
+                  CONTADOR_MOVIMIENTOS + MOVIMIENTO_ORIGEN_VACIO == CONTADOR_RECHAZO_ORIGEN_VACIO &&
+                  CONTADOR_MOVIMIENTOS + MOVIMIENTO_DESTINO_LLENO == CONTADOR_RECHAZO_DESTINO_LLENO &&
+                  CONTADOR_MOVIMIENTOS + MOVIMIENTO_COLOR_DISTINTO == CONTADOR_RECHAZO_COLOR &&
+                  CONTADOR_MOVIMIENTOS + MOVIMIENTO_JUEGO_TERMINADO == CONTADOR_RECHAZO_JUEGO_TERMINADO,
+              "Los contadores de rechazo no siguen el orden de ResultadoMovimiento");
+
 /**
  * Realiza un movimiento en el juego
  * @param origen - Índice de la pila origen
@@ -52,25 +97,55 @@ bool Juego::inicializar(const std::string &nombreArchivo)
  */
 bool Juego::realizarMovimiento(int origen, int destino)
 {
+    ResultadoMovimiento resultado;
+    return realizarMovimiento(origen, destino, resultado);
+}
+
+/**
+ * Realiza un movimiento en el juego e indica por qué no se pudo hacer
+ * @param origen - Índice de la pila origen
+ * @param destino - Índice de la pila destino
+ * @param resultado - MOVIMIENTO_VALIDO o el motivo del rechazo
+ * @return bool - true si el movimiento fue exitoso
+ * @complexity O(1)
+ */
+bool Juego::realizarMovimiento(int origen, int destino, ResultadoMovimiento &resultado)
+{
+    INSTRUMENTAR_MEDIR(MEDIDA_MOVIMIENTO);
     if (!juegoEnCurso)
     {
+        resultado = MOVIMIENTO_JUEGO_TERMINADO;
+        INSTRUMENTAR_RESULTADO(resultado);
         return false;
     }
 
-    if (tablero.moverBola(origen, destino))
+    bool realizado = tablero.moverBola(origen, destino, resultado);
+    INSTRUMENTAR_RESULTADO(resultado);
+    if (realizado)
     {
         numMovimientos++;
 
+        if (grabando)
+        {
+            std::chrono::steady_clock::time_point ahora = std::chrono::steady_clock::now();
+            long long milisegundos =
+                std::chrono::duration_cast<std::chrono::milliseconds>(ahora - instanteAnterior).count();
+            Grabacion &propia = grabacionPropia();
+            propia.movimientos.push_back(Movimiento{origen, destino});
+            propia.tiempos.push_back((uint32_t)std::min(milisegundos, (long long)UINT32_MAX));
+            propia.marcas.push_back(siguienteMarcaGrabacion++);
+            instanteAnterior = ahora;
+        }
+
         // Verificar si el juego ha terminado después del movimiento
+        INSTRUMENTAR_CONTAR(CONTADOR_COMPROBACIONES_FIN);
         if (tablero.juegoTerminado())
         {
             juegoEnCurso = false;
         }
-
-        return true;
     }
 
-    return false;
+    return realizado;
 }
 
 /**
@@ -80,6 +155,7 @@ bool Juego::realizarMovimiento(int origen, int destino)
  */
 bool Juego::juegoTerminado() const
 {
+    INSTRUMENTAR_CONTAR(CONTADOR_COMPROBACIONES_FIN);
     return !juegoEnCurso || tablero.juegoTerminado();
 }
 
@@ -130,6 +206,7 @@ const Tablero &Juego::getTablero() const
  */
 bool Juego::cargarConfiguracion(const std::string &nombreArchivo)
 {
+    INSTRUMENTAR_MEDIR(MEDIDA_CARGA);
     std::ifstream archivo(nombreArchivo);
     if (!archivo.is_open())
     {
@@ -219,4 +296,150 @@ bool Juego::cargarConfiguracion(const std::string &nombreArchivo)
 
     archivo.close();
     return true;
-}
\ No newline at end of file
+}
+
+/**
+ * Activa o desactiva la grabación de la partida
+ * @param activa - true para grabar
+ * @complexity O(n) donde n es el número de pilas
+ */
+void Juego::activarGrabacion(bool activa)
+{
+    grabando = activa;
+    grabacion.reset(); // Las copias conservan la grabación anterior
+    if (activa)
+    {
+        grabacion = std::make_shared<Grabacion>();
+        grabacion->tablero = tablero;
+        grabacion->marcas.push_back(siguienteMarcaGrabacion++);
+        instanteAnterior = std::chrono::steady_clock::now();
+    }
+}
+
+/**
+ * Obtiene la grabación para modificarla, duplicándola si está compartida
+ * @return Grabacion& - Grabación propia de este juego
+ * @complexity O(1), u O(m) la primera vez tras copiar el juego
+ */
+Juego::Grabacion &Juego::grabacionPropia()
+{
+    if (grabacion.use_count() > 1)
+    {
+        grabacion = std::make_shared<Grabacion>(*grabacion);
+    }
+    return *grabacion;
+}
+
+/**
+ * Obtiene la grabación para leerla
+ * @return const Grabacion& - Grabación actual, o una vacía si no se graba
+ * @complexity O(1)
+ */
+const Juego::Grabacion &Juego::grabacionActual() const
+{
+    static const Grabacion vacia = Grabacion();
+    return grabacion ? *grabacion : vacia;
+}
+
+/**
+ * Comprueba si se está grabando la partida
+ * @return bool - true si la grabación está activa
+ * @complexity O(1)
+ */
+bool Juego::estaGrabando() const
+{
+    return grabando;
+}
+
+/**
+ * Obtiene el tablero con el que empezó la grabación
+ * @return const Tablero& - Tablero de partida de la grabación
+ * @complexity O(1)
+ */
+const Tablero &Juego::getTableroGrabado() const
+{
+    return grabacionActual().tablero;
+}
+
+/**
+ * Obtiene los movimientos grabados
+ * @return const std::vector<Movimiento>& - Movimientos válidos en orden
+ * @complexity O(1)
+ */
+const std::vector<Movimiento> &Juego::getMovimientosGrabados() const
+{
+    return grabacionActual().movimientos;
+}
+
+/**
+ * Obtiene los tiempos grabados
+ * @return const std::vector<uint32_t>& - Milisegundos transcurridos antes de cada movimiento
+ * @complexity O(1)
+ */
+const std::vector<uint32_t> &Juego::getTiemposGrabados() const
+{
+    return grabacionActual().tiempos;
+}
+
+/**
+ * Guarda una instantánea de la partida
+ * @param instantanea - Instantánea donde guardar la partida
+ * @return bool - true si se pudo guardar
+ * @complexity O(n) donde n es el número de bolas del tablero
+ */
+bool Juego::guardarInstantanea(InstantaneaJuego &instantanea) const
+{
+    EstadoCompacto estado;
+    if (!estado.desdeTablero(tablero))
+    {
+        return false;
+    }
+    std::memcpy(instantanea.tablero, &estado, sizeof(estado));
+    instantanea.numMovimientos = numMovimientos;
+    instantanea.posicionGrabacion = (int32_t)grabacionActual().movimientos.size();
+    instantanea.marcaGrabacion = grabando ? grabacion->marcas.back() : 0;
+    instantanea.enCurso = juegoEnCurso;
+    return true;
+}
+
+/**
+ * Vuelve a una instantánea de la partida
+ * @param instantanea - Instantánea guardada con guardarInstantanea
+ * @return bool - true si se restauró
+ * @complexity O(n) donde n es el número de bolas del tablero
+ */
+bool Juego::restaurarInstantanea(const InstantaneaJuego &instantanea)
+{
+    EstadoCompacto estado;
+    std::memcpy(&estado, instantanea.tablero, sizeof(estado));
+    Tablero restaurado;
+    if (instantanea.numMovimientos < 0 || !estado.aTablero(restaurado))
+    {
+        return false;
+    }
+    tablero = restaurado;
+    numMovimientos = instantanea.numMovimientos;
+    juegoEnCurso = instantanea.enCurso;
+
+    if (grabando)
+    {
+        size_t posicion = (size_t)std::max(instantanea.posicionGrabacion, 0);
+        if (posicion < grabacion->marcas.size() && grabacion->marcas[posicion] == instantanea.marcaGrabacion)
+        {
+            // La grabación pasa por la instantánea: se descarta lo posterior
+            if (posicion + 1 < grabacion->marcas.size())
+            {
+                Grabacion &propia = grabacionPropia();
+                propia.movimientos.resize(posicion);
+                propia.tiempos.resize(posicion);
+                propia.marcas.resize(posicion + 1);
+            }
+            instanteAnterior = std::chrono::steady_clock::now();
+        }
+        else
+        {
+            activarGrabacion(true); // Otra línea de juego: se graba desde aquí
+        }
+    }
+    return true;
+}
@@ -12,14 +12,43 @@
  *
  * Es el componente de nivel más alto en la arquitectura del juego y sirve
  * como punto de entrada para la interfaz de usuario.
+ *
+ * Opcionalmente graba la partida: el tablero de partida, los movimientos
+ * válidos y los milisegundos transcurridos antes de cada uno. El TAD
+ * Repeticion guarda esa grabación en un archivo y la vuelve a ejecutar.
+ *
+ * Una instantánea guarda el tablero empaquetado, el contador de movimientos y
+ * la posición en la grabación en unas decenas de bytes, y se restaura sin
+ * repetir movimientos. Copiar un Juego es barato: las copias comparten la
+ * grabación hasta que una de ellas mueve, y solo entonces la duplica, de modo
+ * que se pueden abrir muchas variantes de una partida para explorarlas.
  */
 
 #ifndef JUEGO_H
 #define JUEGO_H
 
 #include "Tablero.h"
+#include <chrono>
+#include <cstdint>
 #include <fstream>
+#include <memory>
 #include <string>
+#include <vector>
+
+/**
+ * @brief Instantánea de una partida para volver a ella más tarde
+ *
+ * La marca identifica la grabación hasta la posición guardada: si al restaurar
+ * la grabación ya no pasa por ahí, se vuelve a empezar desde el tablero restaurado.
+ */
+struct InstantaneaJuego
+{
+    uint64_t tablero[3];       // Tablero empaquetado (las palabras de un EstadoCompacto)
+    int32_t numMovimientos;    // Contador de movimientos
+    int32_t posicionGrabacion; // Movimientos grabados al guardarla
+    uint64_t marcaGrabacion;   // Marca de la grabación en esa posición (0 si no se grababa)
+    bool enCurso;              // Si la partida estaba en curso
+};
 
 /**
  * @brief TAD Juego para gestionar la lógica del juego Ball Sort Puzzle
@@ -34,6 +63,37 @@ private:
     int numMovimientos; // Contador de movimientos realizados
     bool juegoEnCurso;  // Indica si el juego está en curso
 
+    // Grabación de la partida, compartida entre copias hasta que una la modifica
+    struct Grabacion
+    {
+        Tablero tablero;                     // Tablero al empezar la grabación
+        std::vector<Movimiento> movimientos; // Movimientos válidos realizados
+        std::vector<uint32_t> tiempos;       // Milisegundos antes de cada movimiento
+        std::vector<uint64_t> marcas;        // Marca única tras cada prefijo (marcas[0] = inicio)
+    };
+    bool grabando;                                          // Indica si se graban los movimientos
+    std::shared_ptr<Grabacion> grabacion;                   // Grabación (nula si no se graba)
+    std::chrono::steady_clock::time_point instanteAnterior; // Último movimiento o inicio
+
+    /**
+     * @brief Obtiene la grabación para modificarla
+     * @pre No hay precondiciones
+     * @post Si otra copia del juego comparte la grabación, la duplica antes
+     * @return Grabacion& - Grabación propia de este juego
+     * @complexity O(1), u O(m) la primera vez tras copiar el juego, donde m es
+     *             el número de movimientos grabados
+     */
+    Grabacion &grabacionPropia();
+
+    /**
+     * @brief Obtiene la grabación para leerla
+     * @pre No hay precondiciones
+     * @post Devuelve una grabación vacía si no se está grabando
+     * @return const Grabacion& - Grabación actual
+     * @complexity O(1)
+     */
+    const Grabacion &grabacionActual() const;
+
     /**
      * @brief Carga la configuración desde un archivo
      * @pre No hay precondiciones
@@ -63,6 +123,16 @@ public:
      */
     bool inicializar(const std::string &nombreArchivo);
 
+    /**
+     * @brief Inicializa el juego con un tablero dado
+     * @pre No hay precondiciones
+     * @post El juego está en curso con una copia del tablero y sin movimientos
+     * @param tableroInicial - Tablero de partida
+     * @return bool - true si la inicialización fue exitosa
+     * @complexity O(n) donde n es el número de pilas
+     */
+    bool inicializar(const Tablero &tableroInicial);
+
     /**
      * @brief Realiza un movimiento en el juego
      * @pre El juego está en curso
@@ -74,6 +144,19 @@ public:
      */
     bool realizarMovimiento(int origen, int destino);
 
+    /**
+     * @brief Realiza un movimiento en el juego e indica por qué no se pudo hacer
+     * @pre No hay precondiciones
+     * @post Realiza el movimiento si es válido y el juego está en curso
+     * @param origen - Índice de la pila origen
+     * @param destino - Índice de la pila destino
+     * @param resultado - MOVIMIENTO_VALIDO, el motivo del rechazo del tablero o
+     *                    MOVIMIENTO_JUEGO_TERMINADO si la partida no está en curso
+     * @return bool - true si el movimiento fue exitoso
+     * @complexity O(1)
+     */
+    bool realizarMovimiento(int origen, int destino, ResultadoMovimiento &resultado);
+
     /**
      * @brief Comprueba si el juego ha terminado
      * @pre No hay precondiciones
@@ -117,6 +200,69 @@ public:
      * @complexity O(1)
      */
     const Tablero &getTablero() const;
+
+    /**
+     * @brief Activa o desactiva la grabación de la partida
+     * @pre No hay precondiciones
+     * @post Al activarla se descarta la grabación anterior y se empieza a grabar
+     *       desde el tablero actual; al inicializar el juego se vuelve a empezar
+     * @param activa - true para grabar
+     * @complexity O(n) donde n es el número de pilas
+     */
+    void activarGrabacion(bool activa);
+
+    /**
+     * @brief Comprueba si se está grabando la partida
+     * @return bool - true si la grabación está activa
+     * @complexity O(1)
+     */
+    bool estaGrabando() const;
+
+    /**
+     * @brief Obtiene el tablero con el que empezó la grabación
+     * @return const Tablero& - Tablero de partida de la grabación
+     * @complexity O(1)
+     */
+    const Tablero &getTableroGrabado() const;
+
+    /**
+     * @brief Obtiene los movimientos grabados
+     * @return const std::vector<Movimiento>& - Movimientos válidos en orden
+     * @complexity O(1)
+     */
+    const std::vector<Movimiento> &getMovimientosGrabados() const;
+
+    /**
+     * @brief Obtiene los tiempos grabados
+     * @return const std::vector<uint32_t>& - Milisegundos transcurridos antes de cada movimiento
+     * @complexity O(1)
+     */
+    const std::vector<uint32_t> &getTiemposGrabados() const;
+
+    /**
+     * @brief Guarda una instantánea de la partida
+     * @pre No hay precondiciones
+     * @post Si el tablero se puede empaquetar (colores de la paleta de
+     *       EstadoCompacto), la instantánea lo representa junto con el contador,
+     *       el estado y la posición en la grabación
+     * @param instantanea - Instantánea donde guardar la partida
+     * @return bool - true si se pudo guardar
+     * @complexity O(n) donde n es el número de bolas del tablero
+     */
+    bool guardarInstantanea(InstantaneaJuego &instantanea) const;
+
+    /**
+     * @brief Vuelve a una instantánea de la partida
+     * @pre No hay precondiciones
+     * @post Si la instantánea es válida, el tablero, el contador y el estado son
+     *       los guardados. Si la grabación sigue pasando por la posición de la
+     *       instantánea, se recorta hasta ella; si no, vuelve a empezar desde el
+     *       tablero restaurado
+     * @param instantanea - Instantánea guardada con guardarInstantanea
+     * @return bool - true si se restauró
+     * @complexity O(n) donde n es el número de bolas del tablero
+     */
+    bool restaurarInstantanea(const InstantaneaJuego &instantanea);
 };
 
 #endif // JUEGO_H
\ No newline at end of file
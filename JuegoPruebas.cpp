@@ -0,0 +1,175 @@
+/**
+ * @file JuegoPruebas.cpp
+ * @brief Pruebas de las instantáneas y las copias del TAD Juego del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas de las instantáneas del TAD Juego
+ * (Juego.h/Juego.cpp) y de las copias que comparten la grabación. La grabación
+ * se comprueba repitiendo sus movimientos desde el tablero grabado: tras
+ * restaurar o copiar, debe seguir llevando al tablero actual.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "Juego.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+
+/**
+ * @brief Comprueba que dos tableros tienen las mismas pilas y bolas
+ */
+bool igualesTableros(const Tablero &a, const Tablero &b)
+{
+    EstadoCompacto estadoA, estadoB;
+    return estadoA.desdeTablero(a) && estadoB.desdeTablero(b) && estadoA == estadoB;
+}
+
+/**
+ * @brief Realiza el movimiento válido número k (módulo los disponibles)
+ * @return bool - true si había algún movimiento
+ */
+bool mover(Juego &juego, int k)
+{
+    Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+    int numMovimientos = juego.getTablero().generarMovimientos(movimientos);
+    if (numMovimientos == 0)
+    {
+        return false;
+    }
+    const Movimiento &m = movimientos[k % numMovimientos];
+    return juego.realizarMovimiento(m.origen, m.destino);
+}
+
+/**
+ * @brief Comprueba que la grabación lleva del tablero grabado al actual
+ */
+bool grabacionCoherente(const Juego &juego)
+{
+    Tablero tablero = juego.getTableroGrabado();
+    for (const Movimiento &m : juego.getMovimientosGrabados())
+    {
+        if (!tablero.moverBola(m.origen, m.destino))
+        {
+            return false;
+        }
+    }
+    return juego.getTiemposGrabados().size() == juego.getMovimientosGrabados().size() &&
+           igualesTableros(tablero, juego.getTablero());
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas de las instantáneas del TAD Juego..." << std::endl;
+
+    Tablero ejemplo = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+
+    // Prueba 1: Guardar y restaurar sin grabación
+    Juego juego;
+    assert(juego.inicializar(ejemplo));
+    assert(mover(juego, 0) && mover(juego, 1));
+    InstantaneaJuego instantanea;
+    assert(juego.guardarInstantanea(instantanea));
+    Tablero guardado = juego.getTablero();
+    for (int i = 0; i < 5; i++)
+    {
+        assert(mover(juego, i + 2));
+    }
+    assert(juego.restaurarInstantanea(instantanea));
+    assert(igualesTableros(juego.getTablero(), guardado));
+    assert(juego.getNumMovimientos() == 2 && juego.estaEnCurso());
+    assert(juego.getTablero().getNumPilas() == 6);
+    std::cout << "Prueba 1 superada: Instantánea de " << sizeof(InstantaneaJuego) << " bytes restaurada" << std::endl;
+
+    // Prueba 2: Restaurar tras ganar, y tableros que no se pueden empaquetar
+    Juego corto;
+    assert(corto.inicializar(crearTablero(4, {"RRRG", "GGGR"})));
+    InstantaneaJuego inicio;
+    assert(corto.guardarInstantanea(inicio));
+    assert(corto.realizarMovimiento(0, 2) && corto.realizarMovimiento(1, 0) && corto.realizarMovimiento(2, 1));
+    assert(corto.juegoTerminado() && !corto.estaEnCurso());
+    assert(corto.restaurarInstantanea(inicio));
+    assert(corto.estaEnCurso() && corto.getNumMovimientos() == 0 && !corto.juegoTerminado());
+    assert(!corto.restaurarInstantanea(InstantaneaJuego()));
+    Juego extrano;
+    assert(extrano.inicializar(crearTablero(3, {"ZZZZ"})));
+    InstantaneaJuego noValida;
+    assert(!extrano.guardarInstantanea(noValida));
+    std::cout << "Prueba 2 superada: Restaurar tras ganar y tableros no empaquetables" << std::endl;
+
+    // Prueba 3: La grabación se recorta hasta la instantánea
+    Juego grabado;
+    grabado.activarGrabacion(true);
+    assert(grabado.inicializar(ejemplo));
+    assert(mover(grabado, 0) && mover(grabado, 3) && mover(grabado, 1));
+    InstantaneaJuego punto;
+    assert(grabado.guardarInstantanea(punto));
+    assert(mover(grabado, 2) && mover(grabado, 0));
+    assert(grabado.getMovimientosGrabados().size() == 5);
+    assert(grabado.restaurarInstantanea(punto));
+    assert(grabado.getMovimientosGrabados().size() == 3 && grabacionCoherente(grabado));
+    assert(mover(grabado, 4));
+    assert(grabado.getMovimientosGrabados().size() == 4 && grabacionCoherente(grabado));
+    assert(grabado.restaurarInstantanea(punto)); // Sigue en la misma línea
+    assert(grabado.getMovimientosGrabados().size() == 3 && grabacionCoherente(grabado));
+    std::cout << "Prueba 3 superada: La grabación vuelve a la instantánea" << std::endl;
+
+    // Prueba 4: Una instantánea de otra línea vuelve a empezar la grabación
+    InstantaneaJuego abandonada;
+    assert(mover(grabado, 0) && mover(grabado, 1));
+    assert(grabado.guardarInstantanea(abandonada));
+    assert(grabado.restaurarInstantanea(punto));
+    assert(mover(grabado, 2));
+    assert(grabado.restaurarInstantanea(abandonada));
+    assert(grabado.getNumMovimientos() == 5);
+    assert(grabado.getMovimientosGrabados().empty() && grabacionCoherente(grabado));
+    assert(igualesTableros(grabado.getTableroGrabado(), grabado.getTablero()));
+    std::cout << "Prueba 4 superada: Instantánea de una línea abandonada" << std::endl;
+
+    // Prueba 5: Las copias comparten la grabación hasta que una mueve
+    Juego original;
+    original.activarGrabacion(true);
+    assert(original.inicializar(ejemplo));
+    for (int i = 0; i < 6; i++)
+    {
+        assert(mover(original, i));
+    }
+    InstantaneaJuego comun;
+    assert(original.guardarInstantanea(comun));
+    Juego rama = original;
+    assert(&rama.getMovimientosGrabados() == &original.getMovimientosGrabados());
+    assert(mover(rama, 1) && mover(rama, 2));
+    assert(&rama.getMovimientosGrabados() != &original.getMovimientosGrabados());
+    assert(original.getMovimientosGrabados().size() == 6 && grabacionCoherente(original));
+    assert(rama.getMovimientosGrabados().size() == 8 && grabacionCoherente(rama));
+    InstantaneaJuego deRama;
+    assert(rama.guardarInstantanea(deRama));
+    assert(mover(original, 0));
+    assert(original.restaurarInstantanea(deRama)); // La rama no pasa por la grabación original
+    assert(original.getMovimientosGrabados().empty() && grabacionCoherente(original));
+    assert(rama.restaurarInstantanea(comun)); // Prefijo común a las dos
+    assert(rama.getMovimientosGrabados().size() == 6 && grabacionCoherente(rama));
+    std::vector<Juego> variantes(100, rama);
+    for (size_t i = 0; i < variantes.size(); i++)
+    {
+        assert(mover(variantes[i], (int)i) && grabacionCoherente(variantes[i]));
+    }
+    assert(rama.getMovimientosGrabados().size() == 6 && grabacionCoherente(rama));
+    std::cout << "Prueba 5 superada: Copias que comparten la grabación hasta que mueven" << std::endl;
+
+    std::cout << "¡Todas las pruebas de las instantáneas del TAD Juego han sido superadas!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,364 @@
+/**
+ * @file MinimizadorSoluciones.cpp
+ * @brief Implementación del TAD MinimizadorSoluciones para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD
+ * MinimizadorSoluciones (MinimizadorSoluciones.h). Cuando una transformación
+ * llega a una posición que solo coincide con la original salvo el orden de los
+ * tubos, los movimientos restantes se renumeran emparejando cada tubo con otro
+ * de igual contenido (los tubos iguales son intercambiables).
+ */
+
+#include "MinimizadorSoluciones.h"
+#include "Resolutor.h"
+#include <algorithm>
+#include <unordered_map>
+
+OpcionesMinimizador::OpcionesMinimizador()
+{
+    tamVentana = 8;
+    maxNodosVentana = 200000;
+}
+
+EstadisticasMinimizacion::EstadisticasMinimizacion()
+{
+    longitudInicial = 0;
+    quitadosCiclos = 0;
+    quitadosPares = 0;
+    quitadosVentanas = 0;
+    longitudFinal = 0;
+}
+
+/**
+ * Aplica una secuencia de movimientos guardando todas las posiciones intermedias
+ * (tableros[k] es la posición tras k movimientos)
+ */
+static bool simular(const Tablero &inicial, const std::vector<Movimiento> &movimientos,
+                    std::vector<Tablero> &tableros)
+{
+    tableros.assign(1, inicial);
+    for (const Movimiento &movimiento : movimientos)
+    {
+        Tablero siguiente = tableros.back();
+        if (!siguiente.moverBola(movimiento.origen, movimiento.destino))
+        {
+            return false;
+        }
+        tableros.push_back(siguiente);
+    }
+    return true;
+}
+
+/**
+ * Calcula qué tubo de a tiene el contenido de cada tubo de b
+ * (a y b son iguales salvo el orden de los tubos)
+ */
+static void emparejarTubos(const Tablero &a, const Tablero &b, int permutacion[Tablero::MAX_PILAS])
+{
+    bool usado[Tablero::MAX_PILAS] = {false};
+    for (int tuboB = 0; tuboB < b.getNumPilas(); tuboB++)
+    {
+        const Pila &pilaB = b.getPila(tuboB);
+        for (int tuboA = 0; tuboA < a.getNumPilas(); tuboA++)
+        {
+            const Pila &pilaA = a.getPila(tuboA);
+            bool igual = !usado[tuboA] && pilaA.numElementos() == pilaB.numElementos();
+            for (int posicion = 0; igual && posicion < pilaA.numElementos(); posicion++)
+            {
+                igual = pilaA.getElemento(posicion) == pilaB.getElemento(posicion);
+            }
+            if (igual)
+            {
+                usado[tuboA] = true;
+                permutacion[tuboB] = tuboA;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Clave canónica de un tablero
+ */
+static EstadoCompacto claveCanonica(const Tablero &tablero)
+{
+    EstadoCompacto estado;
+    estado.desdeTablero(tablero);
+    return estado.canonico();
+}
+
+/**
+ * Constructor
+ * @param opciones - Opciones del minimizador
+ * @complexity O(1)
+ */
+MinimizadorSoluciones::MinimizadorSoluciones(const OpcionesMinimizador &opciones)
+    : opciones(opciones)
+{
+}
+
+/**
+ * Salta desde cada posición a su última repetición, renumerando los tubos
+ */
+int MinimizadorSoluciones::eliminarCiclos(const Tablero &inicial, std::vector<Movimiento> &movimientos) const
+{
+    std::vector<Tablero> tableros;
+    simular(inicial, movimientos, tableros);
+
+    std::vector<EstadoCompacto> claves;
+    std::unordered_map<EstadoCompacto, size_t, HashEstadoCompacto> ultima;
+    for (size_t k = 0; k < tableros.size(); k++)
+    {
+        claves.push_back(claveCanonica(tableros[k]));
+        ultima[claves.back()] = k;
+    }
+
+    // mapa[t] es el tubo de la nueva secuencia que corresponde al tubo t de la original
+    int mapa[Tablero::MAX_PILAS];
+    for (int tubo = 0; tubo < Tablero::MAX_PILAS; tubo++)
+    {
+        mapa[tubo] = tubo;
+    }
+
+    std::vector<Movimiento> resultado;
+    size_t k = 0;
+    while (k < movimientos.size())
+    {
+        size_t salto = ultima[claves[k]];
+        if (salto > k)
+        {
+            int permutacion[Tablero::MAX_PILAS];
+            emparejarTubos(tableros[k], tableros[salto], permutacion);
+            int nuevoMapa[Tablero::MAX_PILAS];
+            for (int tubo = 0; tubo < inicial.getNumPilas(); tubo++)
+            {
+                nuevoMapa[tubo] = mapa[permutacion[tubo]];
+            }
+            std::copy(nuevoMapa, nuevoMapa + inicial.getNumPilas(), mapa);
+            k = salto;
+            continue;
+        }
+        resultado.push_back(Movimiento{mapa[movimientos[k].origen], mapa[movimientos[k].destino]});
+        k++;
+    }
+
+    int quitados = (int)(movimientos.size() - resultado.size());
+    movimientos.swap(resultado);
+    return quitados;
+}
+
+/**
+ * Sustituye a -> b ... b -> c por a -> c (o nada si c es a) cuando ningún
+ * movimiento intermedio toca b ni c: las posiciones intermedias solo difieren
+ * en la bola que estaba de paso en b y el resultado final es el mismo
+ */
+int MinimizadorSoluciones::simplificarPares(std::vector<Movimiento> &movimientos) const
+{
+    int quitados = 0;
+    size_t k = 0;
+    while (k < movimientos.size())
+    {
+        int a = movimientos[k].origen;
+        int b = movimientos[k].destino;
+
+        size_t m = k + 1;
+        while (m < movimientos.size() && movimientos[m].origen != b && movimientos[m].destino != b)
+        {
+            m++;
+        }
+        if (m == movimientos.size() || movimientos[m].origen != b)
+        {
+            k++;
+            continue;
+        }
+
+        int c = movimientos[m].destino;
+        bool libre = true;
+        for (size_t t = k + 1; t < m && libre; t++)
+        {
+            libre = movimientos[t].origen != c && movimientos[t].destino != c;
+        }
+        if (!libre)
+        {
+            k++;
+            continue;
+        }
+
+        movimientos.erase(movimientos.begin() + m);
+        if (c == a)
+        {
+            movimientos.erase(movimientos.begin() + k);
+            quitados += 2;
+            k = k > 0 ? k - 1 : 0;
+        }
+        else
+        {
+            movimientos[k].destino = c;
+            quitados++;
+        }
+    }
+    return quitados;
+}
+
+/**
+ * Busca el camino más corto desde origen hasta la posición objetivo (salvo el
+ * orden de los tubos) o, si objetivo es nullptr, hasta una posición resuelta
+ */
+bool MinimizadorSoluciones::caminoMinimo(const Tablero &origen, const EstadoCompacto *objetivo, int maxLongitud,
+                                         std::vector<Movimiento> &camino, Tablero &final) const
+{
+    EstadoCompacto raiz = claveCanonica(origen);
+    std::unordered_map<EstadoCompacto, EstadoCompacto, HashEstadoCompacto> padres;
+    padres[raiz] = raiz;
+    std::vector<EstadoCompacto> frontera(1, raiz);
+    Tablero tablero;
+
+    for (int profundidad = 0; profundidad <= maxLongitud && !frontera.empty(); profundidad++)
+    {
+        std::vector<EstadoCompacto> siguiente;
+        for (const EstadoCompacto &estado : frontera)
+        {
+            estado.aTablero(tablero);
+            bool meta = objetivo != nullptr ? estado == *objetivo : tablero.juegoTerminado();
+            if (meta)
+            {
+                std::vector<EstadoCompacto> claves;
+                for (EstadoCompacto clave = estado; clave != raiz; clave = padres[clave])
+                {
+                    claves.push_back(clave);
+                }
+                claves.push_back(raiz);
+                std::reverse(claves.begin(), claves.end());
+
+                camino.clear();
+                final = origen;
+                return Resolutor::reconstruirCamino(final, claves, camino);
+            }
+            if (profundidad == maxLongitud || tablero.juegoTerminado())
+            {
+                continue;
+            }
+
+            Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+            int numMovimientos = tablero.generarMovimientos(movimientos);
+            for (int m = 0; m < numMovimientos; m++)
+            {
+                int o = movimientos[m].origen;
+                int d = movimientos[m].destino;
+                EstadoCompacto hijo = estado;
+                hijo.trasladarBola(o, d);
+                hijo = hijo.canonico();
+                if (padres.emplace(hijo, estado).second)
+                {
+                    siguiente.push_back(hijo);
+                }
+            }
+            if ((long long)padres.size() > opciones.maxNodosVentana)
+            {
+                return false;
+            }
+        }
+        frontera.swap(siguiente);
+    }
+    return false;
+}
+
+/**
+ * Sustituye cada tramo de tamVentana movimientos por el camino más corto entre
+ * sus extremos; los tramos avanzan media ventana para solaparse
+ */
+int MinimizadorSoluciones::optimizarVentanas(const Tablero &inicial, std::vector<Movimiento> &movimientos) const
+{
+    if (opciones.tamVentana < 2)
+    {
+        return 0;
+    }
+
+    int quitados = 0;
+    std::vector<Tablero> tableros;
+    simular(inicial, movimientos, tableros);
+
+    size_t paso = (size_t)std::max(1, opciones.tamVentana / 2);
+    for (size_t i = 0; i < movimientos.size(); i += paso)
+    {
+        size_t j = std::min(i + (size_t)opciones.tamVentana, movimientos.size());
+        bool ultimoTramo = j == movimientos.size();
+        EstadoCompacto objetivo = claveCanonica(tableros[j]);
+
+        std::vector<Movimiento> camino;
+        Tablero final;
+        if (!caminoMinimo(tableros[i], ultimoTramo ? nullptr : &objetivo, (int)(j - i) - 1, camino, final))
+        {
+            continue;
+        }
+
+        // Renumerar el resto de la secuencia según la posición a la que llega el camino
+        int permutacion[Tablero::MAX_PILAS];
+        emparejarTubos(final, tableros[j], permutacion);
+        std::vector<Movimiento> nuevos(movimientos.begin(), movimientos.begin() + i);
+        nuevos.insert(nuevos.end(), camino.begin(), camino.end());
+        for (size_t k = j; k < movimientos.size(); k++)
+        {
+            nuevos.push_back(Movimiento{permutacion[movimientos[k].origen], permutacion[movimientos[k].destino]});
+        }
+
+        quitados += (int)(movimientos.size() - nuevos.size());
+        movimientos.swap(nuevos);
+        simular(inicial, movimientos, tableros);
+    }
+    return quitados;
+}
+
+/**
+ * Acorta una solución
+ * @param inicial - Tablero de partida
+ * @param movimientos - Solución a acortar
+ * @param resultado - Solución acortada
+ * @param estadisticas - Estadísticas opcionales
+ * @return bool - false si algún movimiento no es válido o no se resuelve el tablero
+ * @complexity O(P * (m * n log n + V))
+ */
+bool MinimizadorSoluciones::minimizar(const Tablero &inicial, const std::vector<Movimiento> &movimientos,
+                                      std::vector<Movimiento> &resultado,
+                                      EstadisticasMinimizacion *estadisticas) const
+{
+    std::vector<Tablero> tableros;
+    if (!simular(inicial, movimientos, tableros) || !tableros.back().juegoTerminado())
+    {
+        return false;
+    }
+
+    EstadisticasMinimizacion propias;
+    propias.longitudInicial = (int)movimientos.size();
+    resultado = movimientos;
+
+    bool mejorado = true;
+    while (mejorado)
+    {
+        int ciclos = eliminarCiclos(inicial, resultado);
+        int pares = simplificarPares(resultado);
+        int ventanas = optimizarVentanas(inicial, resultado);
+        propias.quitadosCiclos += ciclos;
+        propias.quitadosPares += pares;
+        propias.quitadosVentanas += ventanas;
+        mejorado = ciclos + pares + ventanas > 0;
+    }
+
+    // Comprobación final: ante cualquier incoherencia se devuelve la solución original
+    if (!simular(inicial, resultado, tableros) || !tableros.back().juegoTerminado() ||
+        resultado.size() > movimientos.size())
+    {
+        resultado = movimientos;
+        propias = EstadisticasMinimizacion();
+        propias.longitudInicial = (int)movimientos.size();
+    }
+    propias.longitudFinal = (int)resultado.size();
+
+    if (estadisticas != nullptr)
+    {
+        *estadisticas = propias;
+    }
+    return true;
+}
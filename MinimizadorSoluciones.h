@@ -0,0 +1,96 @@
+/**
+ * @file MinimizadorSoluciones.h
+ * @brief TAD MinimizadorSoluciones para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) MinimizadorSoluciones,
+ * que acorta una secuencia de movimientos válida sin dejar de resolver el
+ * tablero. Sirve para aprovechar resolutores rápidos pero no óptimos y obtener
+ * soluciones de referencia cercanas a la óptima. Aplica, hasta que ninguna
+ * mejora, tres transformaciones:
+ *
+ * - Eliminación de ciclos: si una posición se repite (salvo el orden de los
+ *   tubos, comparando estados canónicos) se quitan los movimientos intermedios
+ *   y los siguientes se renumeran con la permutación de tubos.
+ * - Cancelación y fusión de pares: un movimiento a -> b seguido, sin tocar b ni
+ *   c entre medias, de b -> c se sustituye por a -> c, o desaparece si c es a.
+ * - Ventanas óptimas: cada tramo de la secuencia se sustituye por el camino más
+ *   corto entre sus extremos, calculado con una búsqueda en anchura acotada; el
+ *   último tramo se busca hasta cualquier posición resuelta.
+ */
+
+#ifndef MINIMIZADOR_SOLUCIONES_H
+#define MINIMIZADOR_SOLUCIONES_H
+
+#include "EstadoCompacto.h"
+#include <vector>
+
+/**
+ * @brief Opciones del minimizador
+ */
+struct OpcionesMinimizador
+{
+    int tamVentana;            // Movimientos de cada tramo que se vuelve a resolver (0 = sin ventanas)
+    long long maxNodosVentana; // Estados máximos de la búsqueda de cada tramo
+
+    OpcionesMinimizador();
+};
+
+/**
+ * @brief Estadísticas de una minimización
+ */
+struct EstadisticasMinimizacion
+{
+    int longitudInicial;   // Movimientos de la secuencia recibida
+    int quitadosCiclos;    // Movimientos eliminados por posiciones repetidas
+    int quitadosPares;     // Movimientos eliminados por cancelación o fusión de pares
+    int quitadosVentanas;  // Movimientos ahorrados al resolver tramos de forma óptima
+    int longitudFinal;     // Movimientos de la secuencia resultante
+
+    EstadisticasMinimizacion();
+};
+
+/**
+ * @brief TAD MinimizadorSoluciones que acorta secuencias de movimientos
+ */
+class MinimizadorSoluciones
+{
+private:
+    OpcionesMinimizador opciones;
+
+    // Cada transformación devuelve el número de movimientos que ha quitado
+    int eliminarCiclos(const Tablero &inicial, std::vector<Movimiento> &movimientos) const;
+    int simplificarPares(std::vector<Movimiento> &movimientos) const;
+    int optimizarVentanas(const Tablero &inicial, std::vector<Movimiento> &movimientos) const;
+    bool caminoMinimo(const Tablero &origen, const EstadoCompacto *objetivo, int maxLongitud,
+                      std::vector<Movimiento> &camino, Tablero &final) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea un minimizador con las opciones indicadas
+     * @param opciones - Opciones del minimizador
+     * @complexity O(1)
+     */
+    explicit MinimizadorSoluciones(const OpcionesMinimizador &opciones = OpcionesMinimizador());
+
+    /**
+     * @brief Acorta una solución
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Si la secuencia es válida y resuelve el tablero, resultado es una
+     *       secuencia que también lo resuelve y no es más larga
+     * @param inicial - Tablero de partida
+     * @param movimientos - Solución a acortar (índices base 0)
+     * @param resultado - Solución acortada
+     * @param estadisticas - Estadísticas opcionales (nullptr = sin estadísticas)
+     * @return bool - false si algún movimiento no es válido o no se resuelve el tablero
+     * @complexity O(P * (m * n log n + V)) donde P es el número de pasadas,
+     *             m la longitud de la secuencia y V el coste de las ventanas
+     */
+    bool minimizar(const Tablero &inicial, const std::vector<Movimiento> &movimientos,
+                   std::vector<Movimiento> &resultado, EstadisticasMinimizacion *estadisticas = nullptr) const;
+};
+
+#endif // MINIMIZADOR_SOLUCIONES_H
@@ -0,0 +1,127 @@
+/**
+ * @file MinimizadorSolucionesPruebas.cpp
+ * @brief Pruebas para el TAD MinimizadorSoluciones del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD MinimizadorSoluciones
+ * (MinimizadorSoluciones.h/MinimizadorSoluciones.cpp). Cada transformación se
+ * prueba por separado y después se acortan soluciones largas obtenidas con un
+ * paseo aleatorio seguido de la solución óptima desde donde termina.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "MinimizadorSoluciones.h"
+#include "Resolutor.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <random>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "MinimizadorSoluciones.cpp"
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD MinimizadorSoluciones..." << std::endl;
+
+    Tablero ejemplo = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    ResultadoResolucion optima = Resolutor().resolver(ejemplo);
+    assert(optima.resuelto && optima.movimientos.size() == 15);
+
+    OpcionesMinimizador sinVentanas;
+    sinVentanas.tamVentana = 0;
+    MinimizadorSoluciones minimizador(sinVentanas);
+    std::vector<Movimiento> resultado;
+    EstadisticasMinimizacion estadisticas;
+
+    // Prueba 1: Secuencias que no son soluciones
+    std::vector<Movimiento> invalida = optima.movimientos;
+    invalida.insert(invalida.begin(), Movimiento{4, 5});
+    assert(!minimizador.minimizar(ejemplo, invalida, resultado));
+    std::vector<Movimiento> incompleta(optima.movimientos.begin(), optima.movimientos.end() - 1);
+    assert(!minimizador.minimizar(ejemplo, incompleta, resultado));
+    std::cout << "Prueba 1 superada: Rechazo de secuencias no válidas" << std::endl;
+
+    // Prueba 2: Ida y vuelta de una bola
+    Tablero trasPrimero = ejemplo;
+    trasPrimero.moverBola(0, 4);
+    ResultadoResolucion desdePrimero = Resolutor().resolver(trasPrimero);
+    assert(desdePrimero.resuelto);
+    std::vector<Movimiento> idaVuelta = {Movimiento{0, 4}, Movimiento{4, 5}, Movimiento{5, 4}};
+    idaVuelta.insert(idaVuelta.end(), desdePrimero.movimientos.begin(), desdePrimero.movimientos.end());
+    assert(minimizador.minimizar(ejemplo, idaVuelta, resultado, &estadisticas));
+    assert(resultado.size() == idaVuelta.size() - 2 && resuelve(ejemplo, resultado));
+    assert(estadisticas.longitudInicial == (int)idaVuelta.size());
+    assert(estadisticas.longitudFinal == (int)resultado.size());
+    std::cout << "Prueba 2 superada: Cancelación de ida y vuelta" << std::endl;
+
+    // Prueba 3: Posición repetida salvo el orden de los tubos
+    Tablero intermedio = ejemplo;
+    intermedio.moverBola(0, 4);
+    intermedio.moverBola(4, 5);
+    ResultadoResolucion resto = Resolutor().resolver(intermedio);
+    assert(resto.resuelto);
+    std::vector<Movimiento> permutada = {Movimiento{0, 4}, Movimiento{4, 5}};
+    permutada.insert(permutada.end(), resto.movimientos.begin(), resto.movimientos.end());
+    assert(minimizador.minimizar(ejemplo, permutada, resultado, &estadisticas));
+    assert(resuelve(ejemplo, resultado));
+    assert(estadisticas.quitadosCiclos == 1 && resultado.size() == permutada.size() - 1);
+    std::cout << "Prueba 3 superada: Ciclo con tubos permutados" << std::endl;
+
+    // Prueba 4: Fusión de a -> b ... b -> c en a -> c
+    Tablero dosColores = crearTablero(4, {"RRRG", "GGGR"});
+    std::vector<Movimiento> fusionable = {Movimiento{0, 2}, Movimiento{1, 3}, Movimiento{2, 1}, Movimiento{3, 0}};
+    assert(minimizador.minimizar(dosColores, fusionable, resultado, &estadisticas));
+    assert(resultado.size() == 3 && resuelve(dosColores, resultado));
+    assert(estadisticas.quitadosPares == 1 && estadisticas.quitadosCiclos == 0);
+    std::cout << "Prueba 4 superada: Fusión de movimientos encadenados" << std::endl;
+
+    // Prueba 5: Soluciones largas de paseos aleatorios
+    MinimizadorSoluciones completo;
+    std::mt19937 generador(2025);
+    for (int intento = 0; intento < 5; intento++)
+    {
+        std::vector<Movimiento> larga;
+        Tablero tablero = ejemplo;
+        while (larga.size() < 40 && !tablero.juegoTerminado())
+        {
+            int origen = (int)(generador() % 6);
+            int destino = (int)(generador() % 6);
+            if (tablero.movimientoValido(origen, destino))
+            {
+                tablero.moverBola(origen, destino);
+                larga.push_back(Movimiento{origen, destino});
+            }
+        }
+        ResultadoResolucion final = Resolutor().resolver(tablero);
+        assert(final.resuelto);
+        larga.insert(larga.end(), final.movimientos.begin(), final.movimientos.end());
+
+        assert(completo.minimizar(ejemplo, larga, resultado, &estadisticas));
+        assert(resuelve(ejemplo, resultado));
+        assert(resultado.size() >= 15 && resultado.size() < larga.size());
+        assert(estadisticas.longitudInicial - estadisticas.quitadosCiclos - estadisticas.quitadosPares -
+                   estadisticas.quitadosVentanas ==
+               estadisticas.longitudFinal);
+        std::cout << "  Paseo " << intento + 1 << ": " << larga.size() << " -> " << resultado.size()
+                  << " movimientos" << std::endl;
+    }
+    std::cout << "Prueba 5 superada: Acortamiento de soluciones largas" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD MinimizadorSoluciones han sido superadas!" << std::endl;
+    return 0;
+}
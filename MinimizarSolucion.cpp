@@ -0,0 +1,146 @@
+/**
+ * @file MinimizarSolucion.cpp
+ * @brief Herramienta de acortamiento de soluciones del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa lee una solución de un nivel (un movimiento "origen destino"
+ * por línea, con tubos numerados desde 1; el resto de líneas se ignoran, así
+ * que sirve la salida de ResolverNivel) y la acorta con el TAD
+ * MinimizadorSoluciones.
+ *
+ * Uso: MinimizarSolucion <nivel.cnf> <solucion.txt> [--ventana N] [--max-nodos N]
+ */
+
+#include "Juego.h"
+#include "MinimizadorSoluciones.h"
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "MinimizadorSoluciones.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: MinimizarSolucion <nivel.cnf> <solucion.txt> [--ventana N] [--max-nodos N]" << std::endl;
+}
+
+/**
+ * @brief Lee los movimientos de un archivo de solución
+ * @param nombreArchivo - Ruta del archivo
+ * @param movimientos - Movimientos leídos (índices base 0)
+ * @return bool - true si el archivo se pudo leer
+ */
+bool leerSolucion(const std::string &nombreArchivo, std::vector<Movimiento> &movimientos)
+{
+    std::ifstream archivo(nombreArchivo);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+
+    std::string linea;
+    while (std::getline(archivo, linea))
+    {
+        size_t inicio = linea.find_first_not_of(" \t");
+        if (inicio == std::string::npos || !std::isdigit((unsigned char)linea[inicio]))
+        {
+            continue;
+        }
+        std::istringstream campos(linea);
+        int origen, destino;
+        if (!(campos >> origen >> destino))
+        {
+            return false;
+        }
+        movimientos.push_back(Movimiento{origen - 1, destino - 1});
+    }
+    return true;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string nivel = argv[1];
+    std::string solucion = argv[2];
+    OpcionesMinimizador opciones;
+    for (int i = 3; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--ventana" && i + 1 < argc)
+        {
+            opciones.tamVentana = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--max-nodos" && i + 1 < argc)
+        {
+            opciones.maxNodosVentana = std::stoll(argv[++i]);
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    Juego juego;
+    if (!juego.inicializar(nivel))
+    {
+        std::cerr << "Error: No se pudo cargar el nivel " << nivel << std::endl;
+        return 1;
+    }
+    std::vector<Movimiento> movimientos;
+    if (!leerSolucion(solucion, movimientos))
+    {
+        std::cerr << "Error: No se pudo leer la solución " << solucion << std::endl;
+        return 1;
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    MinimizadorSoluciones minimizador(opciones);
+    std::vector<Movimiento> resultado;
+    EstadisticasMinimizacion estadisticas;
+    if (!minimizador.minimizar(juego.getTablero(), movimientos, resultado, &estadisticas))
+    {
+        std::cerr << "Error: La secuencia no es una solución válida del nivel" << std::endl;
+        return 2;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << "Longitud inicial: " << estadisticas.longitudInicial << std::endl;
+    std::cout << "Quitados por ciclos: " << estadisticas.quitadosCiclos << std::endl;
+    std::cout << "Quitados por pares: " << estadisticas.quitadosPares << std::endl;
+    std::cout << "Quitados por ventanas: " << estadisticas.quitadosVentanas << std::endl;
+    std::cout << "Tiempo: " << segundos << " s" << std::endl;
+    std::cout << "Solución en " << estadisticas.longitudFinal << " movimientos:" << std::endl;
+    for (const Movimiento &movimiento : resultado)
+    {
+        std::cout << movimiento.origen + 1 << " " << movimiento.destino + 1 << std::endl;
+    }
+    return 0;
+}
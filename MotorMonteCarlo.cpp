@@ -0,0 +1,447 @@
+/**
+ * @file MotorMonteCarlo.cpp
+ * @brief Implementación del TAD MotorMonteCarlo para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD MotorMonteCarlo
+ * (MotorMonteCarlo.h). Las partidas trabajan sobre TubosRapidos
+ * (TubosRapidos.h), así que mover una bola son unas pocas operaciones de
+ * bits. Los movimientos a tubos vacíos se consideran solo hacia el primero de
+ * ellos, porque todos son equivalentes.
+ *
+ * La recompensa de una partida es 0,5 o más si resuelve el tablero (más cuanto
+ * más corta) y, si no, como mucho 0,2 según las bolas que quedan descolocadas,
+ * para que el árbol progrese aunque ninguna partida llegue a resolver.
+ */
+
+#include "MotorMonteCarlo.h"
+#include "TubosRapidos.h"
+#include <algorithm>
+#include <cmath>
+
+OpcionesMonteCarlo::OpcionesMonteCarlo()
+{
+    maxMovimientosPartida = 200;
+    probabilidadVoraz = 0.75;
+    constanteExploracion = 1.4;
+    iteracionesPorPaso = 2000;
+    maxPasos = 500;
+    semilla = 1;
+}
+
+/**
+ * Constructor
+ * @param opciones - Opciones del motor
+ * @complexity O(1)
+ */
+MotorMonteCarlo::MotorMonteCarlo(const OpcionesMonteCarlo &opciones)
+    : opciones(opciones)
+{
+    generador = (opciones.semilla + 0x9E3779B97F4A7C15ULL) * 0xBF58476D1CE4E5B9ULL;
+    if (generador == 0)
+    {
+        generador = 1;
+    }
+    partidasJugadas = 0;
+    movimientosJugados = 0;
+}
+
+/**
+ * Siguiente número del generador xorshift64*
+ */
+uint64_t MotorMonteCarlo::aleatorio()
+{
+    generador ^= generador >> 12;
+    generador ^= generador << 25;
+    generador ^= generador >> 27;
+    return generador * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * Juega una partida y devuelve su longitud (-1 si no resuelve) y el desorden final
+ */
+int MotorMonteCarlo::partida(const EstadoCompacto &estado, std::vector<Movimiento> *movimientos, int &desorden)
+{
+    TubosRapidos tubos(estado);
+    Movimiento validos[Tablero::MAX_PILAS * Tablero::MAX_PILAS];
+    Movimiento voraces[Tablero::MAX_PILAS * Tablero::MAX_PILAS];
+    uint64_t umbralVoraz = (uint64_t)(opciones.probabilidadVoraz * 4294967296.0);
+    Movimiento anterior = Movimiento{-1, -1};
+    partidasJugadas++;
+
+    for (int paso = 0; paso < opciones.maxMovimientosPartida; paso++)
+    {
+        if (tubos.resuelto())
+        {
+            desorden = 0;
+            return paso;
+        }
+
+        int numVoraces;
+        int numValidos = tubos.movimientosValidos(validos, voraces, numVoraces);
+        if (numValidos == 0)
+        {
+            break;
+        }
+
+        uint64_t azar = aleatorio();
+        Movimiento elegido;
+        if (numVoraces > 0 && (azar & 0xFFFFFFFF) < umbralVoraz)
+        {
+            elegido = voraces[(azar >> 32) % numVoraces];
+        }
+        else
+        {
+            elegido = validos[(azar >> 32) % numValidos];
+        }
+        // Deshacer el movimiento anterior solo si no hay alternativa
+        if (elegido.origen == anterior.destino && elegido.destino == anterior.origen && numValidos > 1)
+        {
+            elegido = validos[((azar >> 32) + 1) % numValidos];
+            if (elegido.origen == anterior.destino && elegido.destino == anterior.origen)
+            {
+                elegido = validos[((azar >> 32) + 2) % numValidos];
+            }
+        }
+
+        tubos.mover(elegido.origen, elegido.destino);
+        anterior = elegido;
+        movimientosJugados++;
+        if (movimientos != nullptr)
+        {
+            movimientos->push_back(elegido);
+        }
+    }
+
+    desorden = tubos.desorden();
+    return tubos.resuelto() ? opciones.maxMovimientosPartida : -1;
+}
+
+/**
+ * Recompensa de una partida: en [0,5; 1] si resolvió el tablero, en [0; 0,2] si no
+ */
+double MotorMonteCarlo::recompensa(int longitud, int desorden) const
+{
+    if (longitud >= 0)
+    {
+        return 1.0 - 0.5 * longitud / (opciones.maxPasos + opciones.maxMovimientosPartida);
+    }
+    return 0.2 / (1.0 + desorden);
+}
+
+/**
+ * Juega una partida simulada
+ * @param estado - Posición de partida
+ * @param movimientos - Movimientos jugados (nullptr = no se guardan)
+ * @return int - Movimientos hasta resolver el tablero, o -1 si no se resolvió
+ * @complexity O(M * n^2)
+ */
+int MotorMonteCarlo::jugarPartida(const EstadoCompacto &estado, std::vector<Movimiento> *movimientos)
+{
+    int desorden;
+    return partida(estado, movimientos, desorden);
+}
+
+/**
+ * Evalúa cada movimiento válido con partidas simuladas
+ * @param tablero - Posición a evaluar
+ * @param partidasPorMovimiento - Partidas simuladas tras cada movimiento
+ * @return std::vector<EvaluacionMovimiento> - Evaluaciones ordenadas
+ * @complexity O(m * P * M * n^2)
+ */
+std::vector<EvaluacionMovimiento> MotorMonteCarlo::evaluarMovimientos(const Tablero &tablero,
+                                                                      int partidasPorMovimiento)
+{
+    std::vector<EvaluacionMovimiento> evaluaciones;
+    EstadoCompacto estado;
+    if (!estado.desdeTablero(tablero))
+    {
+        return evaluaciones;
+    }
+
+    for (int origen = 0; origen < tablero.getNumPilas(); origen++)
+    {
+        for (int destino = 0; destino < tablero.getNumPilas(); destino++)
+        {
+            if (!tablero.movimientoValido(origen, destino))
+            {
+                continue;
+            }
+
+            EstadoCompacto hijo = estado;
+            hijo.trasladarBola(origen, destino);
+            EvaluacionMovimiento evaluacion;
+            evaluacion.movimiento = Movimiento{origen, destino};
+            evaluacion.partidas = partidasPorMovimiento;
+            long long exitos = 0;
+            long long sumaLongitudes = 0;
+            for (int i = 0; i < partidasPorMovimiento; i++)
+            {
+                int longitud = jugarPartida(hijo);
+                if (longitud >= 0)
+                {
+                    exitos++;
+                    sumaLongitudes += longitud + 1;
+                }
+            }
+            evaluacion.tasaExito = partidasPorMovimiento > 0 ? (double)exitos / partidasPorMovimiento : 0.0;
+            evaluacion.longitudMedia = exitos > 0 ? (double)sumaLongitudes / exitos : 0.0;
+            evaluaciones.push_back(evaluacion);
+        }
+    }
+
+    std::stable_sort(evaluaciones.begin(), evaluaciones.end(),
+                     [](const EvaluacionMovimiento &a, const EvaluacionMovimiento &b)
+                     {
+                         if (a.tasaExito != b.tasaExito)
+                         {
+                             return a.tasaExito > b.tasaExito;
+                         }
+                         return a.longitudMedia < b.longitudMedia;
+                     });
+    return evaluaciones;
+}
+
+/**
+ * Búsqueda en árbol de Monte Carlo desde una posición: devuelve el hijo más
+ * visitado y, si mejorSolucion no es nullptr, guarda en él la solución completa
+ * más corta encontrada por el camino (vacío si no hay ninguna)
+ */
+Movimiento MotorMonteCarlo::elegirMovimiento(const EstadoCompacto &raiz, std::vector<Movimiento> *mejorSolucion,
+                                             long long &iteraciones)
+{
+    struct NodoArbol
+    {
+        EstadoCompacto estado;
+        int padre;
+        Movimiento movimiento; // Movimiento que lleva desde el padre
+        int profundidad;
+        bool expandido;
+        bool resuelto;
+        std::vector<int> hijos;
+        long long visitas;
+        double suma; // Suma de recompensas
+    };
+
+    std::vector<NodoArbol> nodos(1);
+    nodos[0].estado = raiz;
+    nodos[0].padre = -1;
+    nodos[0].movimiento = Movimiento{-1, -1};
+    nodos[0].profundidad = 0;
+    nodos[0].expandido = false;
+    nodos[0].resuelto = estaResuelto(raiz);
+    nodos[0].visitas = 0;
+    nodos[0].suma = 0;
+
+    Movimiento validos[Tablero::MAX_PILAS * Tablero::MAX_PILAS];
+    Movimiento voraces[Tablero::MAX_PILAS * Tablero::MAX_PILAS];
+    std::vector<Movimiento> jugados;
+
+    for (long long iteracion = 0; iteracion < opciones.iteracionesPorPaso; iteracion++)
+    {
+        iteraciones++;
+
+        // Selección con UCT
+        int actual = 0;
+        while (nodos[actual].expandido && !nodos[actual].hijos.empty())
+        {
+            int mejor = -1;
+            double mejorValor = -1.0;
+            double logaritmo = std::log((double)nodos[actual].visitas + 1.0);
+            for (int hijo : nodos[actual].hijos)
+            {
+                if (nodos[hijo].visitas == 0)
+                {
+                    mejor = hijo;
+                    break;
+                }
+                double valor = nodos[hijo].suma / nodos[hijo].visitas +
+                               opciones.constanteExploracion * std::sqrt(logaritmo / nodos[hijo].visitas);
+                if (valor > mejorValor)
+                {
+                    mejorValor = valor;
+                    mejor = hijo;
+                }
+            }
+            actual = mejor;
+            if (nodos[actual].visitas == 0)
+            {
+                break;
+            }
+        }
+
+        // Expansión
+        if (!nodos[actual].expandido && !nodos[actual].resuelto)
+        {
+            nodos[actual].expandido = true;
+            TubosRapidos tubos(nodos[actual].estado);
+            int numVoraces;
+            int numValidos = tubos.movimientosValidos(validos, voraces, numVoraces);
+            for (int i = 0; i < numValidos; i++)
+            {
+                NodoArbol hijo;
+                hijo.estado = nodos[actual].estado;
+                hijo.estado.trasladarBola(validos[i].origen, validos[i].destino);
+                hijo.padre = actual;
+                hijo.movimiento = validos[i];
+                hijo.profundidad = nodos[actual].profundidad + 1;
+                hijo.expandido = false;
+                hijo.resuelto = estaResuelto(hijo.estado);
+                hijo.visitas = 0;
+                hijo.suma = 0;
+                nodos[actual].hijos.push_back((int)nodos.size());
+                nodos.push_back(hijo);
+            }
+            if (numValidos > 0)
+            {
+                actual = nodos[actual].hijos[aleatorio() % numValidos];
+            }
+        }
+
+        // Simulación
+        jugados.clear();
+        int desorden;
+        int longitud = partida(nodos[actual].estado, mejorSolucion != nullptr ? &jugados : nullptr, desorden);
+        if (longitud >= 0)
+        {
+            longitud += nodos[actual].profundidad;
+            if (mejorSolucion != nullptr && (mejorSolucion->empty() || longitud < (int)mejorSolucion->size()))
+            {
+                std::vector<Movimiento> solucion;
+                for (int nodo = actual; nodo != 0; nodo = nodos[nodo].padre)
+                {
+                    solucion.push_back(nodos[nodo].movimiento);
+                }
+                std::reverse(solucion.begin(), solucion.end());
+                solucion.insert(solucion.end(), jugados.begin(), jugados.end());
+                mejorSolucion->swap(solucion);
+            }
+        }
+
+        // Retropropagación
+        double valor = recompensa(longitud, desorden);
+        for (int nodo = actual; nodo >= 0; nodo = nodos[nodo].padre)
+        {
+            nodos[nodo].visitas++;
+            nodos[nodo].suma += valor;
+        }
+    }
+
+    Movimiento elegido = Movimiento{-1, -1};
+    long long masVisitas = -1;
+    for (int hijo : nodos[0].hijos)
+    {
+        if (nodos[hijo].visitas > masVisitas)
+        {
+            masVisitas = nodos[hijo].visitas;
+            elegido = nodos[hijo].movimiento;
+        }
+    }
+    return elegido;
+}
+
+/**
+ * Sugiere un movimiento con búsqueda en árbol de Monte Carlo
+ * @param tablero - Posición actual
+ * @param movimiento - Movimiento sugerido
+ * @return bool - false si no hay movimientos válidos
+ * @complexity O(I * (M * n^2 + profundidad del árbol))
+ */
+bool MotorMonteCarlo::sugerirMovimiento(const Tablero &tablero, Movimiento &movimiento)
+{
+    EstadoCompacto estado;
+    if (!estado.desdeTablero(tablero) || estaResuelto(estado))
+    {
+        return false;
+    }
+    long long iteraciones = 0;
+    movimiento = elegirMovimiento(estado, nullptr, iteraciones);
+    return movimiento.origen >= 0;
+}
+
+/**
+ * Resuelve un tablero eligiendo cada movimiento con MCTS
+ * @param tablero - Posición de partida
+ * @return ResultadoResolucion - Solución (no necesariamente óptima)
+ * @complexity O(maxPasos * coste de sugerirMovimiento)
+ */
+ResultadoResolucion MotorMonteCarlo::resolver(const Tablero &tablero)
+{
+    ResultadoResolucion resultado;
+    EstadoCompacto estado;
+    if (!estado.desdeTablero(tablero))
+    {
+        return resultado;
+    }
+
+    long long partidasIniciales = partidasJugadas;
+    std::vector<Movimiento> prefijo;
+    for (int paso = 0; paso <= opciones.maxPasos; paso++)
+    {
+        if (estaResuelto(estado))
+        {
+            if (!resultado.resuelto || prefijo.size() < resultado.movimientos.size())
+            {
+                resultado.movimientos = prefijo;
+                resultado.resuelto = true;
+            }
+            break;
+        }
+        if (resultado.resuelto && prefijo.size() + 1 >= resultado.movimientos.size())
+        {
+            break; // Ya no se puede mejorar la solución conocida
+        }
+
+        std::vector<Movimiento> desdeAqui;
+        Movimiento movimiento = elegirMovimiento(estado, &desdeAqui, resultado.nodosExpandidos);
+        if (!desdeAqui.empty() &&
+            (!resultado.resuelto || prefijo.size() + desdeAqui.size() < resultado.movimientos.size()))
+        {
+            resultado.movimientos = prefijo;
+            resultado.movimientos.insert(resultado.movimientos.end(), desdeAqui.begin(), desdeAqui.end());
+            resultado.resuelto = true;
+        }
+        if (movimiento.origen < 0)
+        {
+            break;
+        }
+
+        estado.trasladarBola(movimiento.origen, movimiento.destino);
+        prefijo.push_back(movimiento);
+    }
+
+    resultado.nodosGenerados = partidasJugadas - partidasIniciales;
+    return resultado;
+}
+
+/**
+ * Obtiene el número de partidas simuladas
+ * @return long long - Partidas jugadas desde la construcción
+ * @complexity O(1)
+ */
+long long MotorMonteCarlo::getPartidasJugadas() const
+{
+    return partidasJugadas;
+}
+
+/**
+ * Obtiene el número de movimientos de las partidas simuladas
+ * @return long long - Movimientos jugados desde la construcción
+ * @complexity O(1)
+ */
+long long MotorMonteCarlo::getMovimientosJugados() const
+{
+    return movimientosJugados;
+}
+
+/**
+ * Indica si un estado es una posición resuelta
+ * @param estado - Estado a comprobar
+ * @return bool - true si el estado está resuelto
+ * @complexity O(n) donde n es el número de bolas
+ */
+bool MotorMonteCarlo::estaResuelto(const EstadoCompacto &estado)
+{
+    return TubosRapidos(estado).resuelto();
+}
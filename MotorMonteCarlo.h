@@ -0,0 +1,151 @@
+/**
+ * @file MotorMonteCarlo.h
+ * @brief TAD MotorMonteCarlo para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) MotorMonteCarlo, que
+ * evalúa posiciones jugando partidas simuladas (playouts) hasta resolver el
+ * tablero o agotar un número de movimientos. Cada partida se juega sobre una
+ * copia local empaquetada de los tubos (16 bits por tubo) que se modifica en el
+ * sitio, sin crear objetos Tablero. La política es semivoraz: con cierta
+ * probabilidad elige un movimiento que junta bolas del mismo color y, si no, uno
+ * válido al azar.
+ *
+ * Sobre las partidas se construye una búsqueda en árbol de Monte Carlo (MCTS
+ * con UCT) que elige el movimiento con mejor tasa de éxito. Sirve como fuente
+ * de pistas y como resolutor de último recurso para tableros en los que la
+ * búsqueda exacta no es viable; sus soluciones no son necesariamente óptimas.
+ */
+
+#ifndef MOTOR_MONTE_CARLO_H
+#define MOTOR_MONTE_CARLO_H
+
+#include "Resolutor.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Opciones del motor de Monte Carlo
+ */
+struct OpcionesMonteCarlo
+{
+    int maxMovimientosPartida;    // Movimientos máximos de cada partida simulada
+    double probabilidadVoraz;     // Probabilidad de elegir un movimiento que junta colores
+    double constanteExploracion;  // Constante C de la fórmula UCT
+    long long iteracionesPorPaso; // Iteraciones del árbol antes de decidir cada movimiento
+    int maxPasos;                 // Movimientos máximos de la solución del resolutor
+    uint64_t semilla;             // Semilla del generador (misma semilla, mismo resultado)
+
+    OpcionesMonteCarlo();
+};
+
+/**
+ * @brief Evaluación de un movimiento por partidas simuladas
+ */
+struct EvaluacionMovimiento
+{
+    Movimiento movimiento; // Movimiento evaluado
+    long long partidas;    // Partidas jugadas tras el movimiento
+    double tasaExito;      // Fracción de partidas que resolvieron el tablero
+    double longitudMedia;  // Movimientos medios de las partidas con éxito
+};
+
+/**
+ * @brief TAD MotorMonteCarlo con partidas simuladas y MCTS
+ */
+class MotorMonteCarlo
+{
+private:
+    OpcionesMonteCarlo opciones;
+    uint64_t generador;          // Estado del generador xorshift
+    long long partidasJugadas;   // Partidas simuladas desde la construcción
+    long long movimientosJugados; // Movimientos de todas las partidas simuladas
+
+    uint64_t aleatorio();
+    int partida(const EstadoCompacto &estado, std::vector<Movimiento> *movimientos, int &desorden);
+    double recompensa(int longitud, int desorden) const;
+    Movimiento elegirMovimiento(const EstadoCompacto &raiz, std::vector<Movimiento> *mejorSolucion,
+                                long long &iteraciones);
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea un motor con el generador iniciado con opciones.semilla
+     * @param opciones - Opciones del motor
+     * @complexity O(1)
+     */
+    explicit MotorMonteCarlo(const OpcionesMonteCarlo &opciones = OpcionesMonteCarlo());
+
+    /**
+     * @brief Juega una partida simulada
+     * @pre El estado representa un tablero válido
+     * @post Si movimientos no es nullptr, contiene los movimientos jugados
+     * @param estado - Posición de partida (no se modifica)
+     * @param movimientos - Movimientos jugados (nullptr = no se guardan)
+     * @return int - Movimientos hasta resolver el tablero, o -1 si no se resolvió
+     * @complexity O(M * n^2) donde M es maxMovimientosPartida y n el número de pilas
+     */
+    int jugarPartida(const EstadoCompacto &estado, std::vector<Movimiento> *movimientos = nullptr);
+
+    /**
+     * @brief Evalúa cada movimiento válido con partidas simuladas
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Devuelve una evaluación por movimiento válido, de mayor a menor tasa de éxito
+     * @param tablero - Posición a evaluar
+     * @param partidasPorMovimiento - Partidas simuladas tras cada movimiento
+     * @return std::vector<EvaluacionMovimiento> - Evaluaciones ordenadas
+     * @complexity O(m * P * M * n^2) donde m es el número de movimientos válidos y P las partidas
+     */
+    std::vector<EvaluacionMovimiento> evaluarMovimientos(const Tablero &tablero, int partidasPorMovimiento);
+
+    /**
+     * @brief Sugiere un movimiento con búsqueda en árbol de Monte Carlo
+     * @pre El tablero no está resuelto y tiene algún movimiento válido
+     * @post Devuelve el hijo de la raíz más visitado tras iteracionesPorPaso iteraciones
+     * @param tablero - Posición actual
+     * @param movimiento - Movimiento sugerido
+     * @return bool - false si no hay movimientos válidos
+     * @complexity O(I * (M * n^2 + profundidad del árbol)) donde I es el número de iteraciones
+     */
+    bool sugerirMovimiento(const Tablero &tablero, Movimiento &movimiento);
+
+    /**
+     * @brief Resuelve un tablero eligiendo cada movimiento con MCTS
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Si se resuelve, devuelve la solución más corta vista (la del árbol
+     *       o la de alguna partida simulada que llegó a resolver el tablero)
+     * @param tablero - Posición de partida
+     * @return ResultadoResolucion - Solución (no necesariamente óptima); los nodos
+     *         expandidos son iteraciones del árbol y los generados, partidas
+     * @complexity O(maxPasos * coste de sugerirMovimiento)
+     */
+    ResultadoResolucion resolver(const Tablero &tablero);
+
+    /**
+     * @brief Obtiene el número de partidas simuladas
+     * @return long long - Partidas jugadas desde la construcción
+     * @complexity O(1)
+     */
+    long long getPartidasJugadas() const;
+
+    /**
+     * @brief Obtiene el número de movimientos de las partidas simuladas
+     * @return long long - Movimientos jugados desde la construcción
+     * @complexity O(1)
+     */
+    long long getMovimientosJugados() const;
+
+    /**
+     * @brief Indica si un estado es una posición resuelta
+     * @pre No hay precondiciones
+     * @post Devuelve true si cada tubo está vacío o lleno de un solo color
+     * @param estado - Estado a comprobar
+     * @return bool - true si el estado está resuelto
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static bool estaResuelto(const EstadoCompacto &estado);
+};
+
+#endif // MOTOR_MONTE_CARLO_H
@@ -0,0 +1,143 @@
+/**
+ * @file MotorMonteCarloPruebas.cpp
+ * @brief Pruebas para el TAD MotorMonteCarlo del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD MotorMonteCarlo
+ * (MotorMonteCarlo.h/MotorMonteCarlo.cpp). Los movimientos de las partidas
+ * simuladas y de las soluciones se comprueban aplicándolos a un Tablero.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "MotorMonteCarlo.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "MotorMonteCarlo.cpp"
+
+/**
+ * @brief Aplica una secuencia de movimientos a un tablero
+ * @param tablero - Tablero a modificar
+ * @param movimientos - Movimientos a aplicar
+ * @return bool - true si todos los movimientos son válidos
+ */
+bool aplicar(Tablero &tablero, const std::vector<Movimiento> &movimientos)
+{
+    for (const Movimiento &movimiento : movimientos)
+    {
+        if (!tablero.moverBola(movimiento.origen, movimiento.destino))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD MotorMonteCarlo..." << std::endl;
+
+    Tablero ejemplo = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    EstadoCompacto estadoEjemplo;
+    estadoEjemplo.desdeTablero(ejemplo);
+
+    // Prueba 1: Detección de posiciones resueltas
+    EstadoCompacto resuelto, casi;
+    resuelto.desdeTablero(crearTablero(4, {"RRRR", "GGGG"}));
+    casi.desdeTablero(crearTablero(4, {"RRRG", "GGGR"}));
+    assert(MotorMonteCarlo::estaResuelto(resuelto));
+    assert(!MotorMonteCarlo::estaResuelto(casi));
+    assert(!MotorMonteCarlo::estaResuelto(estadoEjemplo));
+    MotorMonteCarlo motor;
+    assert(motor.jugarPartida(resuelto) == 0);
+    std::cout << "Prueba 1 superada: Posiciones resueltas" << std::endl;
+
+    // Prueba 2: Las partidas solo juegan movimientos válidos
+    int exitos = 0;
+    for (int i = 0; i < 200; i++)
+    {
+        std::vector<Movimiento> movimientos;
+        int longitud = motor.jugarPartida(estadoEjemplo, &movimientos);
+        Tablero tablero = ejemplo;
+        assert(aplicar(tablero, movimientos));
+        if (longitud >= 0)
+        {
+            assert(longitud == (int)movimientos.size() && longitud >= 15);
+            assert(tablero.juegoTerminado());
+            exitos++;
+        }
+        else
+        {
+            assert(!tablero.juegoTerminado());
+        }
+    }
+    assert(exitos > 0);
+    assert(motor.getPartidasJugadas() == 201);
+    std::cout << "Prueba 2 superada: Partidas válidas (" << exitos << " de 200 con éxito)" << std::endl;
+
+    // Prueba 3: Evaluación de los movimientos de la posición inicial
+    std::vector<EvaluacionMovimiento> evaluaciones = motor.evaluarMovimientos(ejemplo, 50);
+    int numValidos = 0;
+    for (int o = 0; o < 6; o++)
+    {
+        for (int d = 0; d < 6; d++)
+        {
+            numValidos += ejemplo.movimientoValido(o, d) ? 1 : 0;
+        }
+    }
+    assert((int)evaluaciones.size() == numValidos);
+    for (size_t i = 0; i < evaluaciones.size(); i++)
+    {
+        assert(evaluaciones[i].tasaExito >= 0.0 && evaluaciones[i].tasaExito <= 1.0);
+        assert(ejemplo.movimientoValido(evaluaciones[i].movimiento.origen, evaluaciones[i].movimiento.destino));
+        assert(i == 0 || evaluaciones[i - 1].tasaExito >= evaluaciones[i].tasaExito);
+    }
+    Movimiento sugerido;
+    assert(motor.sugerirMovimiento(ejemplo, sugerido));
+    assert(ejemplo.movimientoValido(sugerido.origen, sugerido.destino));
+    std::cout << "Prueba 3 superada: Evaluación de " << numValidos << " movimientos" << std::endl;
+
+    // Prueba 4: Resolución con MCTS, determinista para una misma semilla
+    OpcionesMonteCarlo opciones;
+    opciones.iteracionesPorPaso = 300;
+    opciones.semilla = 7;
+    ResultadoResolucion primera = MotorMonteCarlo(opciones).resolver(ejemplo);
+    ResultadoResolucion segunda = MotorMonteCarlo(opciones).resolver(ejemplo);
+    assert(primera.resuelto);
+    Tablero tablero = ejemplo;
+    assert(aplicar(tablero, primera.movimientos) && tablero.juegoTerminado());
+    assert(primera.movimientos.size() >= 15);
+    assert(segunda.movimientos.size() == primera.movimientos.size());
+    for (size_t i = 0; i < primera.movimientos.size(); i++)
+    {
+        assert(primera.movimientos[i].origen == segunda.movimientos[i].origen);
+        assert(primera.movimientos[i].destino == segunda.movimientos[i].destino);
+    }
+    std::cout << "Prueba 4 superada: Solución de " << primera.movimientos.size() << " movimientos con "
+              << primera.nodosGenerados << " partidas" << std::endl;
+
+    // Prueba 5: Tablero bloqueado
+    Tablero bloqueado = crearTablero(2, {"RGRG", "GRGR"});
+    assert(!motor.sugerirMovimiento(bloqueado, sugerido));
+    assert(!motor.resolver(bloqueado).resuelto);
+    std::cout << "Prueba 5 superada: Tablero sin movimientos" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD MotorMonteCarlo han sido superadas!" << std::endl;
+    return 0;
+}
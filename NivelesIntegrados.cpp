@@ -0,0 +1,99 @@
+/**
+ * @file NivelesIntegrados.cpp
+ * @brief Implementación del TAD NivelesIntegrados para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo comprueba en tiempo de compilación los niveles definidos en el
+ * TAD NivelesIntegrados (NivelesIntegrados.h) e implementa su carga. Si se
+ * añade un nivel con un color incompleto, sin solución, con una longitud
+ * óptima equivocada o repetido, el programa no compila.
+ */
+
+#include "NivelesIntegrados.h"
+
+/**
+ * Construye el tablero de un nivel en tiempo de compilación
+ * @param indice - Índice del nivel
+ * @return Tablero - Tablero del nivel (sin tubos si el nivel no es válido)
+ */
+static constexpr Tablero tableroIntegrado(int indice)
+{
+    Tablero tablero;
+    if (!NivelesIntegrados::construirTablero(NivelesIntegrados::NIVELES[indice], tablero))
+    {
+        return Tablero();
+    }
+    return tablero;
+}
+
+/**
+ * Comprueba un nivel: tubos válidos, colores completos y longitud óptima
+ * @param indice - Índice del nivel
+ * @return bool - true si el nivel es correcto
+ */
+static constexpr bool nivelIntegradoCorrecto(int indice)
+{
+    const NivelIntegrado &nivel = NivelesIntegrados::NIVELES[indice];
+    Tablero tablero;
+    if (!NivelesIntegrados::construirTablero(nivel, tablero) || !NivelesIntegrados::coloresCompletos(tablero))
+    {
+        return false;
+    }
+    return NivelesIntegrados::distanciaOptima(tablero, nivel.movimientosOptimos) == nivel.movimientosOptimos;
+}
+
+/**
+ * Comprueba que ningún par de niveles tenga la misma clave Zobrist
+ * @return bool - true si todas las claves son distintas
+ */
+static constexpr bool nivelesIntegradosDistintos()
+{
+    for (int i = 0; i < NivelesIntegrados::NUM_NIVELES; i++)
+    {
+        for (int j = i + 1; j < NivelesIntegrados::NUM_NIVELES; j++)
+        {
+            if (NivelesIntegrados::claveZobrist(tableroIntegrado(i)) ==
+                NivelesIntegrados::claveZobrist(tableroIntegrado(j)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(NivelesIntegrados::NUM_NIVELES == 5, "Añade la comprobación de los niveles nuevos");
+static_assert(nivelIntegradoCorrecto(0), "Nivel integrado 1 incorrecto");
+static_assert(nivelIntegradoCorrecto(1), "Nivel integrado 2 incorrecto");
+static_assert(nivelIntegradoCorrecto(2), "Nivel integrado 3 incorrecto");
+static_assert(nivelIntegradoCorrecto(3), "Nivel integrado 4 incorrecto");
+static_assert(nivelIntegradoCorrecto(4), "Nivel integrado 5 incorrecto");
+static_assert(nivelesIntegradosDistintos(), "Hay niveles integrados repetidos");
+
+/**
+ * Carga un nivel integrado
+ * @param indice - Índice del nivel
+ * @param tablero - Tablero donde se carga
+ * @return bool - false si el índice no es válido
+ * @complexity O(n) donde n es el número de bolas
+ */
+bool NivelesIntegrados::cargarNivel(int indice, Tablero &tablero)
+{
+    if (indice < 0 || indice >= NUM_NIVELES)
+    {
+        return false;
+    }
+    return construirTablero(NIVELES[indice], tablero);
+}
+
+/**
+ * Obtiene la descripción de un nivel integrado
+ * @param indice - Índice del nivel
+ * @return const NivelIntegrado& - Descripción del nivel
+ * @complexity O(1)
+ */
+const NivelIntegrado &NivelesIntegrados::getNivel(int indice)
+{
+    return NIVELES[indice];
+}
@@ -0,0 +1,377 @@
+/**
+ * @file NivelesIntegrados.h
+ * @brief TAD NivelesIntegrados para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) NivelesIntegrados, los
+ * niveles de aprendizaje que vienen dentro del programa y no necesitan archivo
+ * de configuración. Como Pila y Tablero son constexpr, los niveles se validan
+ * al compilar (NivelesIntegrados.cpp): cada color tiene exactamente
+ * CAPACIDAD_MAXIMA bolas, el nivel tiene solución y su solución óptima tiene la
+ * longitud anotada. La comprobación de la longitud óptima usa una búsqueda
+ * IDA* constexpr, así que solo es viable para niveles pequeños como estos.
+ *
+ * Las claves Zobrist (un número aleatorio por casilla y color) también se
+ * generan al compilar y sirven para identificar cada nivel por su contenido.
+ */
+
+#ifndef NIVELES_INTEGRADOS_H
+#define NIVELES_INTEGRADOS_H
+
+#include "Tablero.h"
+#include <cstdint>
+
+/**
+ * @brief Descripción de un nivel integrado
+ */
+struct NivelIntegrado
+{
+    const char *nombre;     // Nombre que se muestra al jugador
+    int numPilas;           // Número total de tubos (incluidos los vacíos)
+    const char *tubos;      // Tubos llenos separados por espacios, de abajo arriba
+    int movimientosOptimos; // Longitud de la solución óptima (se comprueba al compilar)
+};
+
+/**
+ * @brief Tabla de claves Zobrist generada en tiempo de compilación
+ *
+ * Hay una clave por casilla (tubo y altura) y color; los colores se indexan con
+ * los cinco bits bajos de su letra, así que cualquier letra tiene su clave.
+ */
+struct TablaZobrist
+{
+    static const int NUM_CASILLAS = Tablero::MAX_PILAS * Pila::CAPACIDAD_MAXIMA;
+    static const int NUM_COLORES = 32;
+
+    uint64_t claves[NUM_CASILLAS][NUM_COLORES];
+
+    /**
+     * @brief Constructor
+     * @post Rellena la tabla con la secuencia splitmix64 de una semilla fija
+     * @complexity O(NUM_CASILLAS * NUM_COLORES)
+     */
+    constexpr TablaZobrist() : claves()
+    {
+        uint64_t estado = 0x42616c6c536f7274ULL; // "BallSort"
+        for (int casilla = 0; casilla < NUM_CASILLAS; casilla++)
+        {
+            for (int color = 0; color < NUM_COLORES; color++)
+            {
+                estado += 0x9e3779b97f4a7c15ULL;
+                uint64_t z = estado;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                claves[casilla][color] = z ^ (z >> 31);
+            }
+        }
+    }
+};
+
+/**
+ * @brief TAD NivelesIntegrados con los niveles de aprendizaje del juego
+ */
+class NivelesIntegrados
+{
+public:
+    static const int NUM_NIVELES = 5;      // Número de niveles integrados
+    static const int SIN_SOLUCION = -1;    // Resultado de distanciaOptima si se supera el límite
+
+    static constexpr NivelIntegrado NIVELES[NUM_NIVELES] = {
+        {"Primeros pasos", 4, "RRRG GGGR", 3},
+        {"Intercalados", 4, "RGRG GRGR", 8},
+        {"Tres colores", 5, "RRGB GBBR GGRB", 9},
+        {"Un tubo libre", 5, "RGBB BRGR GRGB", 11},
+        {"Rotación", 5, "RGBR GBRG BRGB", 12},
+    };
+
+    static constexpr TablaZobrist ZOBRIST = TablaZobrist();
+
+    /**
+     * @brief Construye el tablero de un nivel
+     * @pre No hay precondiciones
+     * @post Si el nivel es válido, tablero contiene sus tubos y el resto vacíos
+     * @param nivel - Nivel a construir
+     * @param tablero - Tablero donde se construye
+     * @return bool - false si el número de tubos o el contenido no caben en el tablero
+     * @complexity O(n) donde n es la longitud del texto de los tubos
+     */
+    static constexpr bool construirTablero(const NivelIntegrado &nivel, Tablero &tablero);
+
+    /**
+     * @brief Comprueba que cada color del tablero tenga exactamente CAPACIDAD_MAXIMA bolas
+     * @pre No hay precondiciones
+     * @post Devuelve true si el tablero se puede completar en cuanto a número de bolas
+     * @param tablero - Tablero a comprobar
+     * @return bool - true si todos los colores están completos
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static constexpr bool coloresCompletos(const Tablero &tablero);
+
+    /**
+     * @brief Cota inferior admisible de los movimientos que faltan
+     * @pre No hay precondiciones
+     * @post Devuelve las bolas que tapan una de otro color más las de las rachas
+     *       inferiores de un color que no pueden quedarse donde están
+     * @param tablero - Tablero a evaluar
+     * @return int - Cota inferior
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static constexpr int cotaInferior(const Tablero &tablero);
+
+    /**
+     * @brief Calcula la longitud de la solución óptima con IDA*
+     * @pre No hay precondiciones
+     * @post Devuelve el mínimo número de movimientos que resuelve el tablero
+     * @param tablero - Tablero de partida
+     * @param limite - Longitud máxima que se explora
+     * @return int - Longitud óptima, o SIN_SOLUCION si es mayor que limite
+     * @complexity Exponencial en la longitud de la solución
+     */
+    static constexpr int distanciaOptima(const Tablero &tablero, int limite);
+
+    /**
+     * @brief Calcula la clave Zobrist de un tablero
+     * @pre No hay precondiciones
+     * @post Devuelve el XOR de las claves de sus bolas (el número de tubos también cuenta)
+     * @param tablero - Tablero
+     * @return uint64_t - Clave del tablero
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static constexpr uint64_t claveZobrist(const Tablero &tablero);
+
+    /**
+     * @brief Carga un nivel integrado
+     * @pre No hay precondiciones
+     * @post Si el índice es válido, tablero contiene el nivel
+     * @param indice - Índice del nivel (0 .. NUM_NIVELES - 1)
+     * @param tablero - Tablero donde se carga
+     * @return bool - false si el índice no es válido
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static bool cargarNivel(int indice, Tablero &tablero);
+
+    /**
+     * @brief Obtiene la descripción de un nivel integrado
+     * @pre 0 <= indice < NUM_NIVELES
+     * @param indice - Índice del nivel
+     * @return const NivelIntegrado& - Descripción del nivel
+     * @complexity O(1)
+     */
+    static const NivelIntegrado &getNivel(int indice);
+
+private:
+    static const int ENCONTRADO = -1;         // La búsqueda ha llegado a un tablero resuelto
+    static const int COTA_INFINITA = 1 << 30; // No queda ningún movimiento por explorar
+
+    static constexpr int buscar(const Tablero &tablero, int coste, int cota, int anteriorOrigen, int anteriorDestino);
+};
+
+// Las operaciones constexpr se definen en la cabecera para poder usarlas en
+// static_assert; las de tiempo de ejecución están en NivelesIntegrados.cpp.
+
+/**
+ * Construye el tablero de un nivel
+ * @param nivel - Nivel a construir
+ * @param tablero - Tablero donde se construye
+ * @return bool - false si el nivel no cabe en el tablero
+ * @complexity O(n) donde n es la longitud del texto de los tubos
+ */
+constexpr bool NivelesIntegrados::construirTablero(const NivelIntegrado &nivel, Tablero &tablero)
+{
+    if (nivel.numPilas <= 0 || nivel.numPilas > Tablero::MAX_PILAS)
+    {
+        return false;
+    }
+    // inicializar no vacía los tubos, así que se parte de un tablero nuevo
+    tablero = Tablero();
+    tablero.inicializar(nivel.numPilas);
+
+    int pila = 0;
+    for (const char *c = nivel.tubos; *c != '\0'; c++)
+    {
+        if (*c == ' ')
+        {
+            pila++;
+        }
+        else if (!tablero.colocarBola(pila, *c))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Comprueba que cada color tenga exactamente CAPACIDAD_MAXIMA bolas
+ * @param tablero - Tablero a comprobar
+ * @return bool - true si todos los colores están completos
+ * @complexity O(n) donde n es el número de bolas
+ */
+constexpr bool NivelesIntegrados::coloresCompletos(const Tablero &tablero)
+{
+    int bolasPorColor[TablaZobrist::NUM_COLORES] = {};
+    for (int i = 0; i < tablero.getNumPilas(); i++)
+    {
+        const Pila &pila = tablero.getPila(i);
+        for (int j = 0; j < pila.numElementos(); j++)
+        {
+            bolasPorColor[pila.getElemento(j) & (TablaZobrist::NUM_COLORES - 1)]++;
+        }
+    }
+    for (int color = 0; color < TablaZobrist::NUM_COLORES; color++)
+    {
+        if (bolasPorColor[color] != 0 && bolasPorColor[color] != Pila::CAPACIDAD_MAXIMA)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Cota inferior admisible de los movimientos que faltan (la misma idea que
+ * Resolutor::heuristicaBasica)
+ * @param tablero - Tablero a evaluar
+ * @return int - Cota inferior
+ * @complexity O(n) donde n es el número de bolas
+ */
+constexpr int NivelesIntegrados::cotaInferior(const Tablero &tablero)
+{
+    int sumaRachas[TablaZobrist::NUM_COLORES] = {};
+    int mayorRacha[TablaZobrist::NUM_COLORES] = {};
+    int cota = 0;
+    for (int i = 0; i < tablero.getNumPilas(); i++)
+    {
+        const Pila &pila = tablero.getPila(i);
+        if (pila.estaVacia())
+        {
+            continue;
+        }
+        int racha = 1;
+        while (racha < pila.numElementos() && pila.getElemento(racha) == pila.getElemento(0))
+        {
+            racha++;
+        }
+
+        // Las bolas sobre la racha inferior tapan una bola de otro color
+        cota += pila.numElementos() - racha;
+        int color = pila.getElemento(0) & (TablaZobrist::NUM_COLORES - 1);
+        sumaRachas[color] += racha;
+        if (racha > mayorRacha[color])
+        {
+            mayorRacha[color] = racha;
+        }
+    }
+
+    // Cada color cabe en un solo tubo: solo una de sus rachas inferiores puede quedarse
+    for (int color = 0; color < TablaZobrist::NUM_COLORES; color++)
+    {
+        cota += sumaRachas[color] - mayorRacha[color];
+    }
+    return cota;
+}
+
+/**
+ * Paso recursivo de IDA*
+ * @param tablero - Tablero actual
+ * @param coste - Movimientos hechos hasta ahora
+ * @param cota - Cota de la iteración actual
+ * @param anteriorOrigen - Origen del último movimiento (-1 si no hay)
+ * @param anteriorDestino - Destino del último movimiento (-1 si no hay)
+ * @return int - ENCONTRADO, o la menor f que ha superado la cota
+ * @complexity Exponencial en la cota
+ */
+constexpr int NivelesIntegrados::buscar(const Tablero &tablero, int coste, int cota, int anteriorOrigen,
+                                        int anteriorDestino)
+{
+    int f = coste + cotaInferior(tablero);
+    if (f > cota)
+    {
+        return f;
+    }
+    if (tablero.juegoTerminado())
+    {
+        return ENCONTRADO;
+    }
+
+    int menor = COTA_INFINITA;
+    for (int origen = 0; origen < tablero.getNumPilas(); origen++)
+    {
+        for (int destino = 0; destino < tablero.getNumPilas(); destino++)
+        {
+            // Deshacer el último movimiento nunca acorta la solución, y mover la única
+            // bola de un tubo a otro vacío solo cambia el orden de los tubos
+            if ((origen == anteriorDestino && destino == anteriorOrigen) ||
+                (tablero.getPila(origen).numElementos() == 1 && tablero.getPila(destino).estaVacia()))
+            {
+                continue;
+            }
+            // Cada hijo es una copia: deshacer con moverBola no siempre es un movimiento válido
+            Tablero hijo = tablero;
+            if (!hijo.moverBola(origen, destino))
+            {
+                continue;
+            }
+            int t = buscar(hijo, coste + 1, cota, origen, destino);
+            if (t == ENCONTRADO)
+            {
+                return ENCONTRADO;
+            }
+            if (t < menor)
+            {
+                menor = t;
+            }
+        }
+    }
+    return menor;
+}
+
+/**
+ * Calcula la longitud de la solución óptima con IDA*
+ * @param tablero - Tablero de partida
+ * @param limite - Longitud máxima que se explora
+ * @return int - Longitud óptima, o SIN_SOLUCION si es mayor que limite
+ * @complexity Exponencial en la longitud de la solución
+ */
+constexpr int NivelesIntegrados::distanciaOptima(const Tablero &tablero, int limite)
+{
+    int cota = cotaInferior(tablero);
+    while (cota <= limite)
+    {
+        int t = buscar(tablero, 0, cota, -1, -1);
+        if (t == ENCONTRADO)
+        {
+            return cota;
+        }
+        if (t == COTA_INFINITA)
+        {
+            return SIN_SOLUCION;
+        }
+        cota = t;
+    }
+    return SIN_SOLUCION;
+}
+
+/**
+ * Calcula la clave Zobrist de un tablero
+ * @param tablero - Tablero
+ * @return uint64_t - Clave del tablero
+ * @complexity O(n) donde n es el número de bolas
+ */
+constexpr uint64_t NivelesIntegrados::claveZobrist(const Tablero &tablero)
+{
+    uint64_t clave = (uint64_t)tablero.getNumPilas();
+    for (int i = 0; i < tablero.getNumPilas(); i++)
+    {
+        const Pila &pila = tablero.getPila(i);
+        for (int j = 0; j < pila.numElementos(); j++)
+        {
+            clave ^= ZOBRIST.claves[i * Pila::CAPACIDAD_MAXIMA + j]
+                                   [pila.getElemento(j) & (TablaZobrist::NUM_COLORES - 1)];
+        }
+    }
+    return clave;
+}
+
+#endif // NIVELES_INTEGRADOS_H
@@ -0,0 +1,116 @@
+/**
+ * @file NivelesIntegradosPruebas.cpp
+ * @brief Pruebas para el TAD NivelesIntegrados del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD NivelesIntegrados
+ * (NivelesIntegrados.h/NivelesIntegrados.cpp). Comprueba que Pila y Tablero se
+ * pueden usar en tiempo de compilación, que los niveles se cargan y que la
+ * búsqueda constexpr coincide con el TAD Resolutor.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "NivelesIntegrados.h"
+#include "Resolutor.h"
+#include <iostream>
+#include <cassert>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "NivelesIntegrados.cpp"
+
+/**
+ * @brief Resuelve en tiempo de compilación el nivel pequeño {"RRRG", "GGGR"}
+ * @return bool - true si los movimientos dejan el tablero resuelto
+ */
+constexpr bool resolverEnCompilacion()
+{
+    Tablero tablero;
+    tablero.inicializar(4);
+    const char *tubos[2] = {"RRRG", "GGGR"};
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; tubos[i][j] != '\0'; j++)
+        {
+            tablero.colocarBola(i, tubos[i][j]);
+        }
+    }
+    ResultadoMovimiento resultado = MOVIMIENTO_VALIDO;
+    bool rechazado = !tablero.moverBola(0, 1, resultado) && resultado == MOVIMIENTO_DESTINO_LLENO;
+    return rechazado && !tablero.juegoTerminado() && tablero.moverBola(1, 2) && tablero.moverBola(0, 1) &&
+           tablero.moverBola(2, 0) && tablero.juegoTerminado();
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD NivelesIntegrados..." << std::endl;
+
+    // Prueba 1: Pila y Tablero en tiempo de compilación
+    static_assert(Pila().estaVacia(), "Una pila nueva está vacía");
+    static_assert(resolverEnCompilacion(), "El nivel pequeño se resuelve al compilar");
+    static_assert(NivelesIntegrados::ZOBRIST.claves[0][1] != NivelesIntegrados::ZOBRIST.claves[0][2],
+                  "Las claves Zobrist son distintas");
+    std::cout << "Prueba 1 superada: Pila y Tablero en tiempo de compilación" << std::endl;
+
+    // Prueba 2: Carga de los niveles
+    Tablero tablero;
+    assert(!NivelesIntegrados::cargarNivel(-1, tablero));
+    assert(!NivelesIntegrados::cargarNivel(NivelesIntegrados::NUM_NIVELES, tablero));
+    for (int i = 0; i < NivelesIntegrados::NUM_NIVELES; i++)
+    {
+        assert(NivelesIntegrados::cargarNivel(i, tablero));
+        assert(tablero.getNumPilas() == NivelesIntegrados::getNivel(i).numPilas);
+        assert(NivelesIntegrados::coloresCompletos(tablero));
+        assert(!tablero.juegoTerminado());
+    }
+    Tablero incompleto;
+    incompleto.inicializar(3);
+    incompleto.colocarBola(0, 'R');
+    assert(!NivelesIntegrados::coloresCompletos(incompleto));
+    std::cout << "Prueba 2 superada: Carga de los niveles" << std::endl;
+
+    // Prueba 3: La búsqueda constexpr coincide con el resolutor
+    Resolutor resolutor;
+    for (int i = 0; i < NivelesIntegrados::NUM_NIVELES; i++)
+    {
+        assert(NivelesIntegrados::cargarNivel(i, tablero));
+        int optimo = NivelesIntegrados::getNivel(i).movimientosOptimos;
+        assert(NivelesIntegrados::distanciaOptima(tablero, optimo) == optimo);
+        assert(NivelesIntegrados::distanciaOptima(tablero, optimo - 1) == NivelesIntegrados::SIN_SOLUCION);
+        ResultadoResolucion resultado = resolutor.resolver(tablero);
+        assert(resultado.resuelto && (int)resultado.movimientos.size() == optimo);
+        assert(NivelesIntegrados::cotaInferior(tablero) <= optimo);
+    }
+    std::cout << "Prueba 3 superada: La búsqueda constexpr coincide con el resolutor" << std::endl;
+
+    // Prueba 4: Claves Zobrist
+    assert(NivelesIntegrados::cargarNivel(0, tablero));
+    uint64_t inicial = NivelesIntegrados::claveZobrist(tablero);
+    assert(tablero.moverBola(0, 2));
+    uint64_t movido = NivelesIntegrados::claveZobrist(tablero);
+    assert(movido != inicial);
+    const NivelIntegrado movidoAMano = {"", 4, "RRR GGGR G", 0};
+    Tablero esperado;
+    assert(NivelesIntegrados::construirTablero(movidoAMano, esperado));
+    assert(NivelesIntegrados::claveZobrist(esperado) == movido);
+    Tablero otro;
+    assert(NivelesIntegrados::cargarNivel(1, otro));
+    assert(NivelesIntegrados::claveZobrist(otro) != inicial);
+    std::cout << "Prueba 4 superada: Claves Zobrist" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD NivelesIntegrados han sido superadas!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,303 @@
+/**
+ * @file NumeracionEstados.cpp
+ * @brief Implementación del TAD NumeracionEstados para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD NumeracionEstados
+ * (NumeracionEstados.h). Si quedan t bolas con r[c] del color c, hay P(t)
+ * ordenaciones de ellas y P(t) * r[c] / t empiezan por c (división exacta).
+ * El límite MAX_ESTADOS deja margen para que P(t) * t quepa en 64 bits.
+ */
+
+#include "NumeracionEstados.h"
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+NumeracionEstados::NumeracionEstados()
+{
+    numPilas = 0;
+    numBolas = 0;
+    for (int color = 0; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        bolasPorColor[color] = 0;
+    }
+    numPermutaciones = 0;
+    numEstados = 0;
+}
+
+/**
+ * Prepara la numeración para la forma de un estado
+ * @param estado - Estado con la forma a numerar
+ * @return bool - false si la forma tiene más de MAX_ESTADOS tableros
+ * @complexity O(n * b) donde n es el número de tubos y b el de bolas
+ */
+bool NumeracionEstados::configurar(const EstadoCompacto &estado)
+{
+    numEstados = 0;
+    numPilas = estado.getNumPilas();
+    numBolas = 0;
+    for (int color = 0; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        bolasPorColor[color] = 0;
+    }
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            bolasPorColor[estado.getBola(pila, posicion)]++;
+            numBolas++;
+        }
+    }
+
+    // Permutaciones con repetición: producto de combinaciones C(acumuladas, bolas del color)
+    numPermutaciones = 1;
+    int acumuladas = 0;
+    for (int color = 1; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        for (int i = 1; i <= bolasPorColor[color]; i++)
+        {
+            acumuladas++;
+            if (numPermutaciones > MAX_ESTADOS / acumuladas)
+            {
+                return false;
+            }
+            numPermutaciones = numPermutaciones * acumuladas / i;
+        }
+    }
+
+    for (int s = 0; s <= MAX_BOLAS; s++)
+    {
+        repartos[numPilas][s] = s == 0 ? 1 : 0;
+    }
+    for (int pila = numPilas - 1; pila >= 0; pila--)
+    {
+        for (int s = 0; s <= MAX_BOLAS; s++)
+        {
+            repartos[pila][s] = 0;
+            for (int altura = 0; altura <= Pila::CAPACIDAD_MAXIMA && altura <= s; altura++)
+            {
+                repartos[pila][s] += repartos[pila + 1][s - altura];
+            }
+        }
+    }
+
+    if (repartos[0][numBolas] > MAX_ESTADOS / numPermutaciones)
+    {
+        return false;
+    }
+    numEstados = repartos[0][numBolas] * numPermutaciones;
+    return true;
+}
+
+/**
+ * Comprueba si un estado tiene la forma de la numeración
+ * @param estado - Estado a comprobar
+ * @return bool - true si coinciden el número de tubos y las bolas de cada color
+ * @complexity O(b) donde b es el número de bolas
+ */
+bool NumeracionEstados::esDeLaForma(const EstadoCompacto &estado) const
+{
+    if (numEstados == 0 || estado.getNumPilas() != numPilas)
+    {
+        return false;
+    }
+    int restantes[EstadoCompacto::MAX_COLORES + 1];
+    for (int color = 0; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        restantes[color] = bolasPorColor[color];
+    }
+    int total = 0;
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            if (--restantes[estado.getBola(pila, posicion)] < 0)
+            {
+                return false;
+            }
+            total++;
+        }
+    }
+    return total == numBolas;
+}
+
+/**
+ * Obtiene el número del estado
+ * @param estado - Estado a numerar
+ * @return uint64_t - Número del estado
+ * @complexity O(n + b * c) donde c es el número de colores
+ */
+uint64_t NumeracionEstados::numerar(const EstadoCompacto &estado) const
+{
+    // Alturas: se cuentan los repartos con una altura menor en el primer tubo distinto
+    uint64_t numeroAlturas = 0;
+    int quedan = numBolas;
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        int altura = estado.getAltura(pila);
+        for (int menor = 0; menor < altura; menor++)
+        {
+            numeroAlturas += repartos[pila + 1][quedan - menor];
+        }
+        quedan -= altura;
+    }
+
+    // Colores: se cuentan las ordenaciones que ponen un color menor en la primera bola distinta
+    int restantes[EstadoCompacto::MAX_COLORES + 1];
+    for (int color = 0; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        restantes[color] = bolasPorColor[color];
+    }
+    uint64_t numeroColores = 0;
+    uint64_t ordenaciones = numPermutaciones;
+    int total = numBolas;
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        for (int posicion = 0; posicion < estado.getAltura(pila); posicion++)
+        {
+            int bola = estado.getBola(pila, posicion);
+            int menores = 0;
+            for (int color = 1; color < bola; color++)
+            {
+                menores += restantes[color];
+            }
+            numeroColores += ordenaciones * menores / total;
+            ordenaciones = ordenaciones * restantes[bola] / total;
+            restantes[bola]--;
+            total--;
+        }
+    }
+    return numeroAlturas * numPermutaciones + numeroColores;
+}
+
+/**
+ * Obtiene el estado de un número
+ * @param numero - Número del estado
+ * @param estado - Estado con ese número
+ * @complexity O(n + b * c) donde c es el número de colores
+ */
+void NumeracionEstados::estadoDe(uint64_t numero, EstadoCompacto &estado) const
+{
+    uint64_t numeroAlturas = numero / numPermutaciones;
+    uint64_t numeroColores = numero % numPermutaciones;
+
+    int restantes[EstadoCompacto::MAX_COLORES + 1];
+    for (int color = 0; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        restantes[color] = bolasPorColor[color];
+    }
+    uint64_t ordenaciones = numPermutaciones;
+    int total = numBolas;
+    int quedan = numBolas;
+
+    Tablero tablero;
+    tablero.inicializar(numPilas);
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        int altura = 0;
+        while (numeroAlturas >= repartos[pila + 1][quedan - altura])
+        {
+            numeroAlturas -= repartos[pila + 1][quedan - altura];
+            altura++;
+        }
+        quedan -= altura;
+
+        for (int posicion = 0; posicion < altura; posicion++)
+        {
+            int color = 1;
+            while (true)
+            {
+                uint64_t empiezan = ordenaciones * restantes[color] / total;
+                if (numeroColores < empiezan)
+                {
+                    break;
+                }
+                numeroColores -= empiezan;
+                color++;
+            }
+            ordenaciones = ordenaciones * restantes[color] / total;
+            restantes[color]--;
+            total--;
+            tablero.colocarBola(pila, EstadoCompacto::colorIndice(color));
+        }
+    }
+    estado.desdeTablero(tablero);
+}
+
+/**
+ * Obtiene el número de tableros de la forma
+ * @return uint64_t - Número de estados
+ * @complexity O(1)
+ */
+uint64_t NumeracionEstados::getNumEstados() const
+{
+    return numEstados;
+}
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+TablaNibbles::TablaNibbles()
+{
+    numEntradas = 0;
+}
+
+/**
+ * Reserva la tabla y da a todas las entradas el mismo valor
+ * @param numEntradas - Número de entradas
+ * @param valor - Valor inicial
+ * @complexity O(numEntradas)
+ */
+void TablaNibbles::inicializar(uint64_t numEntradas, int valor)
+{
+    this->numEntradas = numEntradas;
+    bytes.assign((size_t)((numEntradas + 1) / 2), (uint8_t)(valor * 17));
+}
+
+/**
+ * Obtiene el valor de una entrada
+ * @param indice - Entrada
+ * @return int - Valor de 0 a 15
+ * @complexity O(1)
+ */
+int TablaNibbles::get(uint64_t indice) const
+{
+    return (bytes[indice >> 1] >> ((indice & 1) * 4)) & 15;
+}
+
+/**
+ * Cambia el valor de una entrada
+ * @param indice - Entrada
+ * @param valor - Nuevo valor
+ * @complexity O(1)
+ */
+void TablaNibbles::set(uint64_t indice, int valor)
+{
+    int desplazamiento = (int)(indice & 1) * 4;
+    uint8_t &byte = bytes[indice >> 1];
+    byte = (uint8_t)((byte & ~(15 << desplazamiento)) | (valor << desplazamiento));
+}
+
+/**
+ * Obtiene el número de entradas
+ * @return uint64_t - Número de entradas
+ * @complexity O(1)
+ */
+uint64_t TablaNibbles::getNumEntradas() const
+{
+    return numEntradas;
+}
+
+/**
+ * Obtiene la memoria que ocupan los valores
+ * @return uint64_t - Bytes reservados
+ * @complexity O(1)
+ */
+uint64_t TablaNibbles::getBytes() const
+{
+    return (uint64_t)bytes.size();
+}
@@ -0,0 +1,173 @@
+/**
+ * @file NumeracionEstados.h
+ * @brief TAD NumeracionEstados para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) NumeracionEstados, una
+ * biyección entre los tableros de una forma (número de tubos y bolas de cada
+ * color) y los enteros 0..N-1, donde N es el número de tableros de esa forma.
+ * Con ella un conjunto de visitados es un vector de bits y una tabla de
+ * distancias un vector de 4 bits por estado, indexados por el número del
+ * estado, sin claves ni huecos libres como en una tabla hash.
+ *
+ * Un tablero se descompone en sus alturas (cuántas bolas tiene cada tubo) y
+ * la secuencia de colores de todas las bolas, tubo a tubo y de abajo arriba:
+ *
+ *     numero = numero(alturas) * P + numero(colores)
+ *
+ * donde P es el número de permutaciones con repetición de las bolas. Las
+ * alturas se numeran en orden lexicográfico contando cuántas formas hay de
+ * repartir las bolas restantes en los tubos restantes, y los colores con el
+ * orden lexicográfico de las permutaciones con repetición.
+ *
+ * También se define TablaNibbles, un vector de valores de 4 bits.
+ */
+
+#ifndef NUMERACION_ESTADOS_H
+#define NUMERACION_ESTADOS_H
+
+#include "EstadoCompacto.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief TAD NumeracionEstados que numera los tableros de una forma
+ */
+class NumeracionEstados
+{
+public:
+    static const uint64_t MAX_ESTADOS = (uint64_t)1 << 56; // Formas con más estados no se numeran
+
+private:
+    static const int MAX_BOLAS = Tablero::MAX_PILAS * Pila::CAPACIDAD_MAXIMA;
+
+    int numPilas;
+    int numBolas;
+    int bolasPorColor[EstadoCompacto::MAX_COLORES + 1];
+    uint64_t numPermutaciones; // Ordenaciones distintas de las bolas
+    uint64_t numEstados;
+    // repartos[i][s]: formas de poner s bolas en los tubos i..numPilas-1
+    uint64_t repartos[Tablero::MAX_PILAS + 1][MAX_BOLAS + 1];
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea una numeración sin forma (getNumEstados() == 0)
+     * @complexity O(1)
+     */
+    NumeracionEstados();
+
+    /**
+     * @brief Prepara la numeración para la forma de un estado
+     * @pre No hay precondiciones
+     * @post Si devuelve true, numera todos los tableros con el mismo número de
+     *       tubos y las mismas bolas de cada color que estado
+     * @param estado - Estado con la forma a numerar
+     * @return bool - false si la forma tiene más de MAX_ESTADOS tableros
+     * @complexity O(n * b) donde n es el número de tubos y b el de bolas
+     */
+    bool configurar(const EstadoCompacto &estado);
+
+    /**
+     * @brief Comprueba si un estado tiene la forma de la numeración
+     * @pre No hay precondiciones
+     * @post Devuelve true si el estado se puede numerar
+     * @param estado - Estado a comprobar
+     * @return bool - true si coinciden el número de tubos y las bolas de cada color
+     * @complexity O(b) donde b es el número de bolas
+     */
+    bool esDeLaForma(const EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene el número del estado
+     * @pre esDeLaForma(estado)
+     * @post Devuelve un número en 0..getNumEstados()-1 distinto para cada estado
+     * @param estado - Estado a numerar
+     * @return uint64_t - Número del estado
+     * @complexity O(n + b * c) donde c es el número de colores
+     */
+    uint64_t numerar(const EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene el estado de un número
+     * @pre numero < getNumEstados()
+     * @post numerar(estado) == numero
+     * @param numero - Número del estado
+     * @param estado - Estado con ese número
+     * @complexity O(n + b * c) donde c es el número de colores
+     */
+    void estadoDe(uint64_t numero, EstadoCompacto &estado) const;
+
+    /**
+     * @brief Obtiene el número de tableros de la forma
+     * @return uint64_t - Número de estados (0 si no hay forma configurada)
+     * @complexity O(1)
+     */
+    uint64_t getNumEstados() const;
+};
+
+/**
+ * @brief Vector de valores de 4 bits (0..15), dos por byte
+ */
+class TablaNibbles
+{
+private:
+    std::vector<uint8_t> bytes;
+    uint64_t numEntradas;
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea una tabla sin entradas
+     * @complexity O(1)
+     */
+    TablaNibbles();
+
+    /**
+     * @brief Reserva la tabla y da a todas las entradas el mismo valor
+     * @pre 0 <= valor <= 15
+     * @post La tabla tiene numEntradas entradas iguales a valor
+     * @param numEntradas - Número de entradas
+     * @param valor - Valor inicial
+     * @complexity O(numEntradas)
+     */
+    void inicializar(uint64_t numEntradas, int valor);
+
+    /**
+     * @brief Obtiene el valor de una entrada
+     * @pre indice < getNumEntradas()
+     * @param indice - Entrada
+     * @return int - Valor de 0 a 15
+     * @complexity O(1)
+     */
+    int get(uint64_t indice) const;
+
+    /**
+     * @brief Cambia el valor de una entrada
+     * @pre indice < getNumEntradas() y 0 <= valor <= 15
+     * @post get(indice) == valor
+     * @param indice - Entrada
+     * @param valor - Nuevo valor
+     * @complexity O(1)
+     */
+    void set(uint64_t indice, int valor);
+
+    /**
+     * @brief Obtiene el número de entradas
+     * @return uint64_t - Número de entradas
+     * @complexity O(1)
+     */
+    uint64_t getNumEntradas() const;
+
+    /**
+     * @brief Obtiene la memoria que ocupan los valores
+     * @return uint64_t - Bytes reservados
+     * @complexity O(1)
+     */
+    uint64_t getBytes() const;
+};
+
+#endif // NUMERACION_ESTADOS_H
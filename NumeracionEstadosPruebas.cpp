@@ -0,0 +1,254 @@
+/**
+ * @file NumeracionEstadosPruebas.cpp
+ * @brief Pruebas para el TAD NumeracionEstados del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD NumeracionEstados
+ * (NumeracionEstados.h/NumeracionEstados.cpp). La numeración se contrasta con
+ * una enumeración por fuerza bruta de todos los tableros de una forma pequeña,
+ * y una búsqueda hacia atrás con una TablaNibbles indexada por número de
+ * estado se contrasta con el TAD Resolutor.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "NumeracionEstados.h"
+#include "Resolutor.h"
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <string>
+#include <unordered_set>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "NumeracionEstados.cpp"
+
+/**
+ * @brief Crea un estado a partir de sus tubos
+ * @param numPilas - Número total de tubos
+ * @param tubos - Contenido de los primeros tubos, de abajo arriba
+ * @return EstadoCompacto - Estado con el resto de tubos vacíos
+ */
+EstadoCompacto crearEstado(int numPilas, const std::vector<std::string> &tubos)
+{
+    Tablero tablero;
+    tablero.inicializar(numPilas);
+    for (size_t i = 0; i < tubos.size(); i++)
+    {
+        for (char color : tubos[i])
+        {
+            tablero.colocarBola((int)i, color);
+        }
+    }
+    EstadoCompacto estado;
+    estado.desdeTablero(tablero);
+    return estado;
+}
+
+/**
+ * @brief Cuenta por fuerza bruta los tableros de 4 tubos con cuatro bolas R y cuatro G
+ * @param tubos - Contenido de los tubos ya elegidos
+ * @return long long - Tableros que completan los tubos elegidos
+ */
+long long contarFuerzaBruta(std::vector<std::string> &tubos)
+{
+    if (tubos.size() == 4)
+    {
+        int rojas = 0, verdes = 0;
+        for (const std::string &tubo : tubos)
+        {
+            for (char color : tubo)
+            {
+                (color == 'R' ? rojas : verdes)++;
+            }
+        }
+        return rojas == 4 && verdes == 4 ? 1 : 0;
+    }
+    // Todos los contenidos posibles de un tubo: cadenas de 0 a 4 bolas R o G
+    long long total = 0;
+    for (int altura = 0; altura <= Pila::CAPACIDAD_MAXIMA; altura++)
+    {
+        for (int bits = 0; bits < (1 << altura); bits++)
+        {
+            std::string tubo;
+            for (int i = 0; i < altura; i++)
+            {
+                tubo += (bits >> i) & 1 ? 'G' : 'R';
+            }
+            tubos.push_back(tubo);
+            total += contarFuerzaBruta(tubos);
+            tubos.pop_back();
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Distancias a la solución de todos los tableros de una forma, con una tabla de nibbles
+ * @param numeracion - Numeración configurada con la forma
+ * @param distancias - Distancia de cada número de estado (15 si es mayor que 14 o no hay solución)
+ */
+void distanciasHaciaAtras(const NumeracionEstados &numeracion, TablaNibbles &distancias)
+{
+    distancias.inicializar(numeracion.getNumEstados(), 15);
+    std::vector<uint64_t> frontera;
+    EstadoCompacto estado;
+    Tablero tablero;
+    for (uint64_t numero = 0; numero < numeracion.getNumEstados(); numero++)
+    {
+        numeracion.estadoDe(numero, estado);
+        estado.aTablero(tablero);
+        if (tablero.juegoTerminado())
+        {
+            distancias.set(numero, 0);
+            frontera.push_back(numero);
+        }
+    }
+    for (int d = 1; d <= 14 && !frontera.empty(); d++)
+    {
+        std::vector<uint64_t> siguiente;
+        for (uint64_t numero : frontera)
+        {
+            numeracion.estadoDe(numero, estado);
+            estado.aTablero(tablero);
+            for (int a = 0; a < tablero.getNumPilas(); a++)
+            {
+                for (int b = 0; b < tablero.getNumPilas(); b++)
+                {
+                    // Predecesor: el movimiento de a a b lleva de él al estado actual. Solo
+                    // se deshace si b tiene una bola que devolver y a tiene sitio para ella
+                    if (a == b || estado.getAltura(b) == 0 || estado.getAltura(a) == Pila::CAPACIDAD_MAXIMA)
+                    {
+                        continue;
+                    }
+                    EstadoCompacto predecesor = estado;
+                    predecesor.trasladarBola(b, a);
+                    Tablero anterior;
+                    if (!predecesor.aTablero(anterior) || !anterior.movimientoValido(a, b))
+                    {
+                        continue;
+                    }
+                    uint64_t numeroPredecesor = numeracion.numerar(predecesor);
+                    if (distancias.get(numeroPredecesor) == 15)
+                    {
+                        distancias.set(numeroPredecesor, d);
+                        siguiente.push_back(numeroPredecesor);
+                    }
+                }
+            }
+        }
+        frontera.swap(siguiente);
+    }
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD NumeracionEstados..." << std::endl;
+
+    // Prueba 1: Biyección en una forma pequeña
+    NumeracionEstados pequena;
+    assert(pequena.getNumEstados() == 0);
+    assert(pequena.configurar(crearEstado(4, {"RRRG", "GGGR"})));
+    std::vector<std::string> tubos;
+    assert((long long)pequena.getNumEstados() == contarFuerzaBruta(tubos));
+    std::unordered_set<EstadoCompacto, HashEstadoCompacto> vistos;
+    for (uint64_t numero = 0; numero < pequena.getNumEstados(); numero++)
+    {
+        EstadoCompacto estado;
+        pequena.estadoDe(numero, estado);
+        assert(pequena.esDeLaForma(estado));
+        assert(pequena.numerar(estado) == numero);
+        assert(vistos.insert(estado).second);
+    }
+    std::cout << "Prueba 1 superada: Biyección con los " << pequena.getNumEstados() << " tableros de 4 tubos"
+              << std::endl;
+
+    // Prueba 2: Números de tableros del nivel de ejemplo
+    NumeracionEstados ejemplo;
+    EstadoCompacto inicial = crearEstado(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    assert(ejemplo.configurar(inicial));
+    assert(ejemplo.getNumEstados() % 63063000 == 0); // 16! / (4!)^4 ordenaciones de las bolas
+    assert(ejemplo.esDeLaForma(crearEstado(6, {"B", "YYYY", "BBB", "RRRR", "GGGG"})));
+    assert(!ejemplo.esDeLaForma(crearEstado(6, {"RBGY", "GYRB", "BYGR", "RGBR"})));
+    assert(!ejemplo.esDeLaForma(crearEstado(7, {"RBGY", "GYRB", "BYGR", "RGBY"})));
+    assert(!ejemplo.esDeLaForma(crearEstado(6, {"RBGY", "GYRB", "BYGR", "RGB"})));
+    std::mt19937 generador(2025);
+    Tablero tablero;
+    inicial.aTablero(tablero);
+    for (int paso = 0; paso < 20000; paso++)
+    {
+        int origen = (int)(generador() % 6), destino = (int)(generador() % 6);
+        if (!tablero.moverBola(origen, destino))
+        {
+            continue;
+        }
+        EstadoCompacto estado, recuperado;
+        estado.desdeTablero(tablero);
+        uint64_t numero = ejemplo.numerar(estado);
+        assert(numero < ejemplo.getNumEstados());
+        ejemplo.estadoDe(numero, recuperado);
+        assert(recuperado == estado);
+        if (tablero.juegoTerminado())
+        {
+            inicial.aTablero(tablero);
+        }
+    }
+    std::cout << "Prueba 2 superada: Nivel de ejemplo con " << ejemplo.getNumEstados() << " tableros" << std::endl;
+
+    // Prueba 3: Formas demasiado grandes
+    NumeracionEstados grande;
+    assert(!grande.configurar(crearEstado(10, {"RGBY", "MCOP", "YBGR", "POCM", "GRYB", "COPM", "BYRG", "OPMC"})));
+    assert(grande.getNumEstados() == 0);
+    assert(!grande.esDeLaForma(crearEstado(10, {"RGBY"})));
+    std::cout << "Prueba 3 superada: Formas demasiado grandes" << std::endl;
+
+    // Prueba 4: Tabla de nibbles
+    TablaNibbles tabla;
+    tabla.inicializar(7, 9);
+    assert(tabla.getNumEntradas() == 7 && tabla.getBytes() == 4);
+    for (uint64_t i = 0; i < 7; i++)
+    {
+        assert(tabla.get(i) == 9);
+    }
+    tabla.set(3, 15);
+    tabla.set(4, 0);
+    tabla.set(6, 1);
+    assert(tabla.get(2) == 9 && tabla.get(3) == 15 && tabla.get(4) == 0 && tabla.get(5) == 9 && tabla.get(6) == 1);
+    std::cout << "Prueba 4 superada: Tabla de nibbles" << std::endl;
+
+    // Prueba 5: Distancias en una tabla de nibbles iguales a las del resolutor
+    TablaNibbles distancias;
+    distanciasHaciaAtras(pequena, distancias);
+    Resolutor resolutor;
+    int conSolucion = 0;
+    for (uint64_t numero = 0; numero < pequena.getNumEstados(); numero++)
+    {
+        EstadoCompacto estado;
+        pequena.estadoDe(numero, estado);
+        estado.aTablero(tablero);
+        ResultadoResolucion resultado = resolutor.resolver(tablero);
+        int esperada = resultado.resuelto && resultado.movimientos.size() <= 14 ? (int)resultado.movimientos.size() : 15;
+        assert(distancias.get(numero) == esperada);
+        conSolucion += resultado.resuelto ? 1 : 0;
+    }
+    assert(distancias.get(pequena.numerar(crearEstado(4, {"RRRG", "GGGR"}))) == 3);
+    assert(distancias.get(pequena.numerar(crearEstado(4, {"RGRG", "GRGR"}))) == 8);
+    std::cout << "Prueba 5 superada: Distancias de " << pequena.getNumEstados() << " tableros (" << conSolucion
+              << " resolubles) en " << distancias.getBytes() << " bytes" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD NumeracionEstados han sido superadas!" << std::endl;
+    return 0;
+}
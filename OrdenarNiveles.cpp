@@ -0,0 +1,172 @@
+/**
+ * @file OrdenarNiveles.cpp
+ * @brief Herramienta de ordenación de paquetes de niveles por dificultad
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa analiza en paralelo los niveles de un paquete con el TAD
+ * AnalizadorDificultad y los muestra ordenados de más fácil a más difícil.
+ * Los informes se pueden guardar en un archivo de caché para no volver a
+ * analizar los niveles que no han cambiado.
+ *
+ * Uso: OrdenarNiveles <nivel.cnf>... [--cache archivo] [--hilos N] [--max-estados N]
+ */
+
+#include "Juego.h"
+#include "AnalizadorDificultad.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "AnalizadorDificultad.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: OrdenarNiveles <nivel.cnf>... [--cache archivo] [--hilos N] [--max-estados N]" << std::endl;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> archivos;
+    std::string archivoCache;
+    int numHilos = 0;
+    long long maxEstados = 5000000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--cache" && i + 1 < argc)
+        {
+            archivoCache = argv[++i];
+        }
+        else if (opcion == "--hilos" && i + 1 < argc)
+        {
+            numHilos = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--max-estados" && i + 1 < argc)
+        {
+            maxEstados = std::stoll(argv[++i]);
+        }
+        else if (opcion.compare(0, 2, "--") == 0)
+        {
+            mostrarUso();
+            return 1;
+        }
+        else
+        {
+            archivos.push_back(opcion);
+        }
+    }
+
+    if (archivos.empty())
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::vector<Tablero> tableros;
+    for (const std::string &archivo : archivos)
+    {
+        Juego juego;
+        if (!juego.inicializar(archivo))
+        {
+            std::cerr << "Error: No se pudo cargar el nivel " << archivo << std::endl;
+            return 1;
+        }
+        tableros.push_back(juego.getTablero());
+    }
+
+    AnalizadorDificultad analizador(maxEstados);
+    if (!archivoCache.empty() && analizador.cargarCache(archivoCache))
+    {
+        std::cout << "Caché cargada de " << archivoCache << std::endl;
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    std::vector<InformeDificultad> informes = analizador.analizarNiveles(tableros, numHilos);
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    if (!archivoCache.empty() && !analizador.guardarCache(archivoCache))
+    {
+        std::cerr << "Aviso: No se pudo guardar la caché en " << archivoCache << std::endl;
+    }
+
+    // De más fácil a más difícil; después los niveles sin decidir y al final los que no tienen solución
+    std::vector<size_t> orden(archivos.size());
+    for (size_t i = 0; i < orden.size(); i++)
+    {
+        orden[i] = i;
+    }
+    auto grupo = [&informes](size_t i)
+    { return informes[i].resoluble ? 0 : (informes[i].decidido ? 2 : 1); };
+    std::stable_sort(orden.begin(), orden.end(), [&informes, &grupo](size_t a, size_t b)
+                     {
+                         if (grupo(a) != grupo(b))
+                         {
+                             return grupo(a) < grupo(b);
+                         }
+                         return informes[a].puntuacion < informes[b].puntuacion;
+                     });
+
+    std::cout << std::left << std::setw(5) << "#" << std::setw(28) << "Nivel" << std::right << std::setw(8)
+              << "Óptimo" << std::setw(12) << "Soluciones" << std::setw(8) << "Ramif." << std::setw(12)
+              << "Callejones" << std::setw(9) << "Trampas" << std::setw(11) << "Dificultad" << std::endl;
+    for (size_t posicion = 0; posicion < orden.size(); posicion++)
+    {
+        const InformeDificultad &informe = informes[orden[posicion]];
+        std::cout << std::left << std::setw(5) << posicion + 1 << std::setw(28) << archivos[orden[posicion]]
+                  << std::right;
+        if (!informe.resoluble)
+        {
+            std::cout << std::setw(8) << (informe.decidido ? "-" : "?")
+                      << (informe.decidido ? "  sin solución" : "  sin decidir (límite del resolutor)") << std::endl;
+            continue;
+        }
+        std::cout << std::setw(8) << informe.longitudOptima;
+        if (informe.completo)
+        {
+            std::cout << std::setw(12) << std::setprecision(4) << informe.numSolucionesOptimas;
+        }
+        else
+        {
+            std::cout << std::setw(12) << "?";
+        }
+        std::cout << std::setw(8) << std::fixed << std::setprecision(2) << informe.ramificacionMedia;
+        std::cout.unsetf(std::ios::fixed);
+        if (informe.completo)
+        {
+            std::cout << std::setw(12) << informe.numCallejones << std::setw(9) << informe.numTrampas;
+        }
+        else
+        {
+            std::cout << std::setw(12) << "?" << std::setw(9) << "?";
+        }
+        std::cout << std::setw(11) << std::fixed << std::setprecision(2) << informe.puntuacion << std::endl;
+        std::cout.unsetf(std::ios::fixed);
+    }
+
+    std::cout << "Niveles analizados: " << archivos.size() << " (" << analizador.getAciertosCache()
+              << " de la caché) en " << segundos << " s" << std::endl;
+    return 0;
+}
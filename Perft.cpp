@@ -0,0 +1,381 @@
+/**
+ * @file Perft.cpp
+ * @brief Herramienta de recuento de movimientos (perft) y de rendimiento del generador
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa recorre el árbol completo de partidas de un nivel hasta una
+ * profundidad D con las reglas de Tablero::movimientoValido y cuenta, para
+ * cada profundidad, las hojas (secuencias distintas de movimientos de esa
+ * longitud) y las posiciones distintas que se alcanzan por primera vez. Las
+ * posiciones resueltas se siguen expandiendo, como hace movimientoValido. El
+ * trabajo se reparte entre hilos por los movimientos de la raíz y al final se
+ * muestran los nodos por segundo.
+ *
+ * Con --referencia se recorren el nivel de ejemplo y los niveles de
+ * aprendizaje y se comparan los recuentos con los valores de referencia, de
+ * modo que cualquier cambio en la generación de movimientos que altere las
+ * reglas se detecta enseguida. Con --solo-hojas no se guardan las posiciones
+ * y se mide solo la generación de movimientos. Con --pares los movimientos se
+ * buscan comprobando todos los pares de tubos con movimientoValido en lugar de
+ * con Tablero::generarMovimientos, para comparar los dos generadores.
+ *
+ * Uso: Perft <nivel.cnf> [--profundidad D] [--hilos N] [--solo-hojas] [--pares]
+ *      Perft --referencia [--hilos N] [--pares]
+ */
+
+#include "Juego.h"
+#include "NivelesIntegrados.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "NivelesIntegrados.cpp"
+
+/**
+ * @brief Recuentos de un recorrido
+ */
+struct ConteoPerft
+{
+    std::vector<unsigned long long> hojas;                                 // Nodos de cada profundidad
+    std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> primeraVez; // Menor profundidad de cada posición
+};
+
+/**
+ * @brief Recuentos de referencia de un nivel
+ */
+struct ReferenciaPerft
+{
+    int nivel;                     // -1 para el nivel de ejemplo, o nivel de aprendizaje
+    int profundidad;               // Profundidad D del recorrido
+    unsigned long long hojas;      // Hojas a profundidad D
+    unsigned long long posiciones; // Posiciones distintas a D movimientos o menos
+};
+
+// Contrastados con una implementación independiente de las reglas
+static const ReferenciaPerft REFERENCIAS[] = {
+    {-1, 9, 757848, 1835}, {0, 10, 3725148, 174}, {1, 10, 2108712, 360},
+    {2, 9, 1801580, 741},  {3, 9, 929508, 1090},  {4, 9, 669816, 1209}};
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: Perft <nivel.cnf> [--profundidad D] [--hilos N] [--solo-hojas] [--pares]" << std::endl;
+    std::cerr << "       Perft --referencia [--hilos N] [--pares]" << std::endl;
+}
+
+/**
+ * @brief Enumera los movimientos válidos comprobando todos los pares de tubos
+ * @param tablero - Posición actual
+ * @param movimientos - Movimientos válidos, en el mismo orden que generarMovimientos
+ * @return int - Número de movimientos válidos
+ */
+int generarPorPares(const Tablero &tablero, Movimiento movimientos[])
+{
+    int numMovimientos = 0;
+    for (int origen = 0; origen < tablero.getNumPilas(); origen++)
+    {
+        for (int destino = 0; destino < tablero.getNumPilas(); destino++)
+        {
+            if (tablero.movimientoValido(origen, destino))
+            {
+                movimientos[numMovimientos++] = Movimiento{origen, destino};
+            }
+        }
+    }
+    return numMovimientos;
+}
+
+/**
+ * @brief Recorre en profundidad el árbol de partidas desde un tablero
+ * @param tablero - Posición actual
+ * @param profundidad - Movimientos hechos hasta la posición actual
+ * @param maxProfundidad - Profundidad D del recorrido
+ * @param posiciones - true para guardar las posiciones distintas
+ * @param pares - true para generar los movimientos con generarPorPares
+ * @param conteo - Recuentos que se acumulan
+ */
+void recorrer(const Tablero &tablero, int profundidad, int maxProfundidad, bool posiciones, bool pares,
+              ConteoPerft &conteo)
+{
+    conteo.hojas[profundidad]++;
+    if (posiciones)
+    {
+        EstadoCompacto estado;
+        estado.desdeTablero(tablero);
+        auto insertado = conteo.primeraVez.emplace(estado, profundidad);
+        if (!insertado.second)
+        {
+            // Ya vista antes: su subárbol ya guardó las posiciones, pero las hojas hay que contarlas
+            if (insertado.first->second <= profundidad)
+            {
+                posiciones = false;
+            }
+            else
+            {
+                insertado.first->second = profundidad;
+            }
+        }
+    }
+    if (profundidad == maxProfundidad)
+    {
+        return;
+    }
+
+    Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+    int numMovimientos = pares ? generarPorPares(tablero, movimientos) : tablero.generarMovimientos(movimientos);
+    for (int i = 0; i < numMovimientos; i++)
+    {
+        Tablero hijo = tablero;
+        hijo.moverBola(movimientos[i].origen, movimientos[i].destino);
+        recorrer(hijo, profundidad + 1, maxProfundidad, posiciones, pares, conteo);
+    }
+}
+
+/**
+ * @brief Recorre el árbol de partidas repartiendo los movimientos de la raíz entre hilos
+ * @param inicial - Tablero de partida
+ * @param maxProfundidad - Profundidad D del recorrido
+ * @param numHilos - Hilos de trabajo (0 = todos los núcleos)
+ * @param posiciones - true para contar las posiciones distintas
+ * @param pares - true para generar los movimientos con generarPorPares
+ * @param nuevas - Posiciones alcanzadas por primera vez a cada profundidad
+ * @return std::vector<unsigned long long> - Hojas de cada profundidad
+ */
+std::vector<unsigned long long> perft(const Tablero &inicial, int maxProfundidad, int numHilos, bool posiciones,
+                                      bool pares, std::vector<unsigned long long> &nuevas)
+{
+    EstadoCompacto raiz;
+    raiz.desdeTablero(inicial);
+    std::vector<Tablero> hijos;
+    for (int origen = 0; origen < inicial.getNumPilas(); origen++)
+    {
+        for (int destino = 0; destino < inicial.getNumPilas(); destino++)
+        {
+            Tablero hijo = inicial;
+            if (maxProfundidad > 0 && hijo.moverBola(origen, destino))
+            {
+                hijos.push_back(hijo);
+            }
+        }
+    }
+
+    if (numHilos <= 0)
+    {
+        numHilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+    numHilos = std::min(numHilos, (int)std::max((size_t)1, hijos.size()));
+
+    std::vector<ConteoPerft> conteos(numHilos);
+    std::atomic<size_t> siguiente(0);
+    std::vector<std::thread> hilos;
+    for (int h = 0; h < numHilos; h++)
+    {
+        conteos[h].hojas.assign(maxProfundidad + 1, 0);
+        if (posiciones)
+        {
+            conteos[h].primeraVez[raiz] = 0;
+        }
+        hilos.emplace_back([&hijos, &conteos, &siguiente, h, maxProfundidad, posiciones, pares]()
+                           {
+                               for (size_t i = siguiente++; i < hijos.size(); i = siguiente++)
+                               {
+                                   recorrer(hijos[i], 1, maxProfundidad, posiciones, pares, conteos[h]);
+                               }
+                           });
+    }
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+
+    // Suma de hojas y menor profundidad de cada posición entre todos los hilos
+    std::vector<unsigned long long> hojas(maxProfundidad + 1, 0);
+    hojas[0] = 1;
+    for (int h = 0; h < numHilos; h++)
+    {
+        for (int d = 1; d <= maxProfundidad; d++)
+        {
+            hojas[d] += conteos[h].hojas[d];
+        }
+    }
+    nuevas.assign(maxProfundidad + 1, 0);
+    if (posiciones)
+    {
+        std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> &todas = conteos[0].primeraVez;
+        todas[raiz] = 0;
+        for (int h = 1; h < numHilos; h++)
+        {
+            for (const auto &par : conteos[h].primeraVez)
+            {
+                auto insertado = todas.insert(par);
+                insertado.first->second = std::min(insertado.first->second, par.second);
+            }
+            conteos[h].primeraVez.clear();
+        }
+        for (const auto &par : todas)
+        {
+            nuevas[par.second]++;
+        }
+    }
+    return hojas;
+}
+
+/**
+ * @brief Recorre un nivel y muestra los recuentos de cada profundidad
+ * @param inicial - Tablero de partida
+ * @param maxProfundidad - Profundidad D del recorrido
+ * @param numHilos - Hilos de trabajo (0 = todos los núcleos)
+ * @param posiciones - true para contar las posiciones distintas
+ * @param pares - true para generar los movimientos con generarPorPares
+ * @param posicionesTotales - Posiciones distintas a D movimientos o menos
+ * @return unsigned long long - Hojas a profundidad D
+ */
+unsigned long long mostrarPerft(const Tablero &inicial, int maxProfundidad, int numHilos, bool posiciones, bool pares,
+                                unsigned long long &posicionesTotales)
+{
+    std::vector<unsigned long long> nuevas;
+    auto inicio = std::chrono::steady_clock::now();
+    std::vector<unsigned long long> hojas = perft(inicial, maxProfundidad, numHilos, posiciones, pares, nuevas);
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    unsigned long long nodos = 0;
+    posicionesTotales = 0;
+    for (int d = 0; d <= maxProfundidad; d++)
+    {
+        nodos += hojas[d];
+        posicionesTotales += nuevas[d];
+        std::cout << "  Profundidad " << d << ": " << hojas[d] << " hojas";
+        if (posiciones)
+        {
+            std::cout << ", " << nuevas[d] << " posiciones nuevas (" << posicionesTotales << " en total)";
+        }
+        std::cout << std::endl;
+    }
+    segundos = std::max(segundos, 1e-9);
+    std::cout << "  Nodos: " << nodos << " en " << segundos << " s (" << (unsigned long long)(nodos / segundos)
+              << " nodos/s)" << std::endl;
+    return hojas[maxProfundidad];
+}
+
+/**
+ * @brief Comprueba los recuentos de los niveles de referencia
+ * @param numHilos - Hilos de trabajo (0 = todos los núcleos)
+ * @param pares - true para generar los movimientos con generarPorPares
+ * @return bool - true si todos los recuentos coinciden
+ */
+bool comprobarReferencias(int numHilos, bool pares)
+{
+    bool correcto = true;
+    for (const ReferenciaPerft &referencia : REFERENCIAS)
+    {
+        Tablero tablero;
+        std::string nombre = "Nivel de ejemplo (ballSort.cnf)";
+        if (referencia.nivel < 0)
+        {
+            const NivelIntegrado ejemplo = {"", 6, "RBGY GYRB BYGR RGBY", 0};
+            NivelesIntegrados::construirTablero(ejemplo, tablero);
+        }
+        else if (NivelesIntegrados::cargarNivel(referencia.nivel, tablero))
+        {
+            nombre = std::string("Nivel de aprendizaje ") + std::to_string(referencia.nivel + 1) + ": " +
+                     NivelesIntegrados::getNivel(referencia.nivel).nombre;
+        }
+
+        std::cout << nombre << ", profundidad " << referencia.profundidad << std::endl;
+        unsigned long long posiciones = 0;
+        unsigned long long hojas = mostrarPerft(tablero, referencia.profundidad, numHilos, true, pares, posiciones);
+        if (hojas != referencia.hojas || posiciones != referencia.posiciones)
+        {
+            std::cout << "  ERROR: se esperaban " << referencia.hojas << " hojas y " << referencia.posiciones
+                      << " posiciones" << std::endl;
+            correcto = false;
+        }
+    }
+    return correcto;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - 0 si todo fue bien, 2 si algún recuento de referencia no coincide
+ */
+int main(int argc, char *argv[])
+{
+    std::string nivel;
+    int profundidad = 5;
+    int numHilos = 0;
+    bool referencia = false;
+    bool posiciones = true;
+    bool pares = false;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--profundidad" && i + 1 < argc)
+        {
+            profundidad = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--hilos" && i + 1 < argc)
+        {
+            numHilos = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--referencia")
+        {
+            referencia = true;
+        }
+        else if (opcion == "--solo-hojas")
+        {
+            posiciones = false;
+        }
+        else if (opcion == "--pares")
+        {
+            pares = true;
+        }
+        else if (opcion.compare(0, 2, "--") == 0 || !nivel.empty())
+        {
+            mostrarUso();
+            return 1;
+        }
+        else
+        {
+            nivel = opcion;
+        }
+    }
+    if (referencia == !nivel.empty() || profundidad < 0)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    if (referencia)
+    {
+        bool correcto = comprobarReferencias(numHilos, pares);
+        std::cout << (correcto ? "Todos los recuentos coinciden con la referencia" : "Hay recuentos distintos")
+                  << std::endl;
+        return correcto ? 0 : 2;
+    }
+
+    Juego juego;
+    if (!juego.inicializar(nivel))
+    {
+        std::cerr << "Error: No se pudo cargar el nivel " << nivel << std::endl;
+        return 1;
+    }
+    std::cout << nivel << ", profundidad " << profundidad << std::endl;
+    unsigned long long posicionesTotales = 0;
+    mostrarPerft(juego.getTablero(), profundidad, numHilos, posiciones, pares, posicionesTotales);
+    return 0;
+}
@@ -11,7 +11,8 @@
  * y comprobar si la pila está completa (todas las bolas del mismo color).
  *
  * La implementación utiliza un array estático para almacenar los elementos y
- * un índice para controlar la posición de la cima de la pila.
+ * un índice para controlar la posición de la cima de la pila. Todas las
+ * operaciones son constexpr y están definidas al final de este archivo.
  */
 
 #ifndef PILA_H
@@ -27,8 +28,10 @@
  */
 class Pila
 {
-private:
+public:
     static const int CAPACIDAD_MAXIMA = 4; // Capacidad máxima de cada tubo
+
+private:
     char elementos[CAPACIDAD_MAXIMA];      // Array para almacenar los colores
     int cima;                              // Índice del elemento en la cima de la pila (-1 si está vacía)
 
@@ -39,7 +42,7 @@ public:
      * @post Crea una pila vacía
      * @complexity O(1)
      */
-    Pila();
+    constexpr Pila();
 
     /**
      * @brief Comprueba si la pila está vacía
@@ -48,7 +51,7 @@ public:
      * @return bool - true si la pila está vacía
      * @complexity O(1)
      */
-    bool estaVacia() const;
+    constexpr bool estaVacia() const;
 
     /**
      * @brief Comprueba si la pila está llena
@@ -57,7 +60,7 @@ public:
      * @return bool - true si la pila está llena
      * @complexity O(1)
      */
-    bool estaLlena() const;
+    constexpr bool estaLlena() const;
 
     /**
      * @brief Añade un elemento a la cima de la pila
@@ -66,7 +69,7 @@ public:
      * @param elemento - El elemento (color) a añadir
      * @complexity O(1)
      */
-    void apilar(char elemento);
+    constexpr void apilar(char elemento);
 
     /**
      * @brief Elimina el elemento en la cima de la pila
@@ -74,7 +77,7 @@ public:
      * @post Se elimina el elemento de la cima de la pila
      * @complexity O(1)
      */
-    void desapilar();
+    constexpr void desapilar();
 
     /**
      * @brief Devuelve el elemento en la cima de la pila
@@ -83,7 +86,7 @@ public:
      * @return char - El elemento en la cima
      * @complexity O(1)
      */
-    char cimaPila() const;
+    constexpr char cimaPila() const;
 
     /**
      * @brief Devuelve el número de elementos en la pila
@@ -92,7 +95,7 @@ public:
      * @return int - Número de elementos
      * @complexity O(1)
      */
-    int numElementos() const;
+    constexpr int numElementos() const;
 
     /**
      * @brief Comprueba si la pila está completa con un solo color
@@ -101,7 +104,7 @@ public:
      * @return bool - true si la pila contiene CAPACIDAD_MAXIMA elementos del mismo color
      * @complexity O(n) donde n es la cantidad de elementos en la pila
      */
-    bool estaCompleta() const;
+    constexpr bool estaCompleta() const;
 
     /**
      * @brief Obtiene el elemento en una posición específica de la pila
@@ -111,7 +114,129 @@ public:
      * @return char - El elemento en la posición
      * @complexity O(1)
      */
-    char getElemento(int posicion) const;
+    constexpr char getElemento(int posicion) const;
 };
 
+// Las operaciones son constexpr para poder usarlas en tiempo de compilación
+// (niveles integrados y static_assert), así que se definen en la cabecera.
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+constexpr Pila::Pila() : elementos(), cima(-1) // Inicializa la pila como vacía
+{
+}
+
+/**
+ * Comprueba si la pila está vacía
+ * @return bool - true si la pila está vacía
+ * @complexity O(1)
+ */
+constexpr bool Pila::estaVacia() const
+{
+    return cima == -1;
+}
+
+/**
+ * Comprueba si la pila está llena
+ * @return bool - true si la pila está llena
+ * @complexity O(1)
+ */
+constexpr bool Pila::estaLlena() const
+{
+    return cima == CAPACIDAD_MAXIMA - 1;
+}
+
+/**
+ * Añade un elemento a la cima de la pila
+ * @param elemento - El elemento (color) a añadir
+ * @complexity O(1)
+ */
+constexpr void Pila::apilar(char elemento)
+{
+    if (!estaLlena())
+    {
+        cima++;
+        elementos[cima] = elemento;
+    }
+}
+
+/**
+ * Elimina el elemento en la cima de la pila
+ * @complexity O(1)
+ */
+constexpr void Pila::desapilar()
+{
+    if (!estaVacia())
+    {
+        cima--;
+    }
+}
+
+/**
+ * Devuelve el elemento en la cima de la pila
+ * @return char - El elemento en la cima
+ * @complexity O(1)
+ */
+constexpr char Pila::cimaPila() const
+{
+    if (!estaVacia())
+    {
+        return elementos[cima];
+    }
+    return ' '; // Devuelve espacio si la pila está vacía
+}
+
+/**
+ * Devuelve el número de elementos en la pila
+ * @return int - Número de elementos
+ * @complexity O(1)
+ */
+constexpr int Pila::numElementos() const
+{
+    return cima + 1;
+}
+
+/**
+ * Comprueba si la pila está completa con un solo color
+ * @return bool - true si la pila contiene CAPACIDAD_MAXIMA elementos del mismo color
+ * @complexity O(n) donde n es la cantidad de elementos en la pila
+ */
+constexpr bool Pila::estaCompleta() const
+{
+    // La pila debe estar llena
+    if (!estaLlena())
+    {
+        return false;
+    }
+
+    // Todos los elementos deben ser del mismo color
+    char primerColor = elementos[0];
+    for (int i = 1; i < CAPACIDAD_MAXIMA; i++)
+    {
+        if (elementos[i] != primerColor)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Obtiene el elemento en una posición específica de la pila
+ * @param posicion - La posición del elemento (0 es el fondo de la pila)
+ * @return char - El elemento en la posición
+ * @complexity O(1)
+ */
+constexpr char Pila::getElemento(int posicion) const
+{
+    if (posicion >= 0 && posicion <= cima)
+    {
+        return elementos[posicion];
+    }
+    return ' '; // Devuelve espacio si la posición es inválida
+}
+
 #endif // PILA_H
\ No newline at end of file
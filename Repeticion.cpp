@@ -0,0 +1,344 @@
+/**
+ * @file Repeticion.cpp
+ * @brief Implementación del TAD Repeticion para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD Repeticion
+ * (Repeticion.h). La descodificación comprueba cada campo antes de aceptarlo
+ * (pilas dentro de rango, bolas sin huecos y colores de la paleta), porque los
+ * archivos de repetición proceden de los jugadores y no son de confianza.
+ */
+
+#include "Repeticion.h"
+#include "EstadoCompacto.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+// Identificador al comienzo de cada registro
+static const char MARCA_REPETICION[4] = {'B', 'S', 'R', 'P'};
+
+/**
+ * Añade un entero sin signo en formato LEB128
+ * @param datos - Vector donde añadirlo
+ * @param valor - Entero a codificar
+ * @complexity O(1)
+ */
+static void escribirVarint(std::vector<uint8_t> &datos, uint64_t valor)
+{
+    while (valor >= 0x80)
+    {
+        datos.push_back((uint8_t)(valor | 0x80));
+        valor >>= 7;
+    }
+    datos.push_back((uint8_t)valor);
+}
+
+/**
+ * Lee un entero sin signo en formato LEB128
+ * @param datos - Inicio del registro
+ * @param tam - Bytes disponibles
+ * @param posicion - Posición de lectura, que avanza tras el entero
+ * @param valor - Entero leído
+ * @return bool - false si el entero está truncado o no cabe en 32 bits
+ * @complexity O(1)
+ */
+static bool leerVarint(const uint8_t *datos, size_t tam, size_t &posicion, uint32_t &valor)
+{
+    uint64_t acumulado = 0;
+    for (int desplazamiento = 0; desplazamiento < 35; desplazamiento += 7)
+    {
+        if (posicion >= tam)
+        {
+            return false;
+        }
+        uint8_t byte = datos[posicion++];
+        acumulado |= (uint64_t)(byte & 0x7F) << desplazamiento;
+        if ((byte & 0x80) == 0)
+        {
+            if (acumulado > UINT32_MAX)
+            {
+                return false;
+            }
+            valor = (uint32_t)acumulado;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+Repeticion::Repeticion()
+{
+}
+
+/**
+ * Copia la grabación de un juego
+ * @param juego - Juego con la grabación activa
+ * @return bool - false si el juego no estaba grabando
+ * @complexity O(m) donde m es el número de movimientos
+ */
+bool Repeticion::desdeJuego(const Juego &juego)
+{
+    if (!juego.estaGrabando())
+    {
+        return false;
+    }
+
+    inicial = juego.getTableroGrabado();
+    movimientos = juego.getMovimientosGrabados();
+    tiempos = juego.getTiemposGrabados();
+    return true;
+}
+
+/**
+ * Codifica la repetición en formato binario
+ * @param datos - Vector donde añadir el registro
+ * @return bool - false si algún color no es representable
+ * @complexity O(m) donde m es el número de movimientos
+ */
+bool Repeticion::codificar(std::vector<uint8_t> &datos) const
+{
+    size_t tamOriginal = datos.size();
+    datos.insert(datos.end(), MARCA_REPETICION, MARCA_REPETICION + 4);
+    datos.push_back(VERSION);
+    datos.push_back((uint8_t)inicial.getNumPilas());
+
+    for (int pila = 0; pila < inicial.getNumPilas(); pila++)
+    {
+        const Pila &p = inicial.getPila(pila);
+        uint16_t codigo = 0;
+        for (int posicion = 0; posicion < p.numElementos(); posicion++)
+        {
+            int indice = EstadoCompacto::indiceColor(p.getElemento(posicion));
+            if (indice == 0)
+            {
+                datos.resize(tamOriginal);
+                return false;
+            }
+            codigo |= (uint16_t)(indice << (EstadoCompacto::BITS_POR_BOLA * posicion));
+        }
+        datos.push_back((uint8_t)(codigo & 0xFF));
+        datos.push_back((uint8_t)(codigo >> 8));
+    }
+
+    escribirVarint(datos, movimientos.size());
+    for (size_t i = 0; i < movimientos.size(); i++)
+    {
+        datos.push_back((uint8_t)(movimientos[i].origen << 4 | movimientos[i].destino));
+        escribirVarint(datos, i < tiempos.size() ? tiempos[i] : 0);
+    }
+    return true;
+}
+
+/**
+ * Obtiene la longitud de un registro sin descodificarlo
+ * @param datos - Inicio del registro
+ * @param tam - Bytes disponibles
+ * @param longitud - Bytes ocupados por el registro
+ * @return bool - false si el registro está truncado o su cabecera no es válida
+ * @complexity O(m) donde m es el número de movimientos
+ */
+bool Repeticion::medirRegistro(const uint8_t *datos, size_t tam, size_t &longitud)
+{
+    if (tam < 6 || !std::equal(MARCA_REPETICION, MARCA_REPETICION + 4, datos) || datos[4] != VERSION)
+    {
+        return false;
+    }
+    int numPilas = datos[5];
+    if (numPilas < 2 || numPilas > Tablero::MAX_PILAS || tam < 6 + 2 * (size_t)numPilas)
+    {
+        return false;
+    }
+
+    size_t posicion = 6 + 2 * (size_t)numPilas;
+    uint32_t numMovimientos;
+    if (!leerVarint(datos, tam, posicion, numMovimientos) || numMovimientos > (tam - posicion) / 2)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < numMovimientos; i++)
+    {
+        uint32_t tiempo;
+        if (posicion >= tam)
+        {
+            return false;
+        }
+        posicion++; // Byte del movimiento
+        if (!leerVarint(datos, tam, posicion, tiempo))
+        {
+            return false;
+        }
+    }
+    longitud = posicion;
+    return true;
+}
+
+/**
+ * Descodifica un registro binario
+ * @param datos - Inicio del registro
+ * @param tam - Bytes disponibles
+ * @param leidos - Bytes ocupados por el registro
+ * @return bool - false si el registro está truncado o mal formado
+ * @complexity O(m) donde m es el número de movimientos
+ */
+bool Repeticion::descodificar(const uint8_t *datos, size_t tam, size_t &leidos)
+{
+    if (tam < 6 || !std::equal(MARCA_REPETICION, MARCA_REPETICION + 4, datos) || datos[4] != VERSION)
+    {
+        return false;
+    }
+
+    int numPilas = datos[5];
+    if (numPilas < 2 || numPilas > Tablero::MAX_PILAS || tam < 6 + 2 * (size_t)numPilas)
+    {
+        return false;
+    }
+
+    Tablero tablero;
+    tablero.inicializar(numPilas);
+    size_t posicion = 6;
+    for (int pila = 0; pila < numPilas; pila++)
+    {
+        uint16_t codigo = (uint16_t)(datos[posicion] | datos[posicion + 1] << 8);
+        posicion += 2;
+        while (codigo != 0)
+        {
+            int indice = codigo & 0xF;
+            if (indice == 0)
+            {
+                return false; // Hueco debajo de una bola
+            }
+            tablero.colocarBola(pila, EstadoCompacto::colorIndice(indice));
+            codigo >>= EstadoCompacto::BITS_POR_BOLA;
+        }
+    }
+
+    uint32_t numMovimientos;
+    if (!leerVarint(datos, tam, posicion, numMovimientos) || numMovimientos > (tam - posicion) / 2)
+    {
+        return false;
+    }
+
+    std::vector<Movimiento> nuevosMovimientos(numMovimientos);
+    std::vector<uint32_t> nuevosTiempos(numMovimientos);
+    for (uint32_t i = 0; i < numMovimientos; i++)
+    {
+        if (posicion >= tam)
+        {
+            return false;
+        }
+        uint8_t byte = datos[posicion++];
+        nuevosMovimientos[i].origen = byte >> 4;
+        nuevosMovimientos[i].destino = byte & 0xF;
+        if (nuevosMovimientos[i].origen >= numPilas || nuevosMovimientos[i].destino >= numPilas ||
+            !leerVarint(datos, tam, posicion, nuevosTiempos[i]))
+        {
+            return false;
+        }
+    }
+
+    inicial = tablero;
+    movimientos.swap(nuevosMovimientos);
+    tiempos.swap(nuevosTiempos);
+    leidos = posicion;
+    return true;
+}
+
+/**
+ * Guarda la repetición en un archivo
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si se pudo escribir
+ * @complexity O(m) donde m es el número de movimientos
+ */
+bool Repeticion::guardar(const std::string &nombreArchivo) const
+{
+    std::vector<uint8_t> datos;
+    if (!codificar(datos))
+    {
+        return false;
+    }
+
+    std::ofstream archivo(nombreArchivo, std::ios::binary | std::ios::trunc);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+    archivo.write(reinterpret_cast<const char *>(datos.data()), (std::streamsize)datos.size());
+    return archivo.good();
+}
+
+/**
+ * Carga la primera repetición de un archivo
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - false si el archivo no existe o está dañado
+ * @complexity O(m) donde m es el número de movimientos
+ */
+bool Repeticion::cargar(const std::string &nombreArchivo)
+{
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> datos((std::istreambuf_iterator<char>(archivo)), std::istreambuf_iterator<char>());
+    size_t leidos;
+    return descodificar(datos.data(), datos.size(), leidos);
+}
+
+/**
+ * Vuelve a ejecutar la partida sobre un juego
+ * @param juego - Juego donde reproducir la partida
+ * @param movimientosValidos - Movimientos aceptados por el juego
+ * @return bool - true si todos los movimientos son válidos y el juego termina resuelto
+ * @complexity O(m) donde m es el número de movimientos
+ */
+bool Repeticion::reproducir(Juego &juego, int &movimientosValidos) const
+{
+    juego.inicializar(inicial);
+    movimientosValidos = 0;
+    for (const Movimiento &movimiento : movimientos)
+    {
+        if (!juego.realizarMovimiento(movimiento.origen, movimiento.destino))
+        {
+            return false;
+        }
+        movimientosValidos++;
+    }
+    return juego.juegoTerminado();
+}
+
+/**
+ * Obtiene el tablero de partida
+ * @return const Tablero& - Tablero antes del primer movimiento
+ * @complexity O(1)
+ */
+const Tablero &Repeticion::getInicial() const
+{
+    return inicial;
+}
+
+/**
+ * Obtiene los movimientos de la partida
+ * @return const std::vector<Movimiento>& - Movimientos en orden
+ * @complexity O(1)
+ */
+const std::vector<Movimiento> &Repeticion::getMovimientos() const
+{
+    return movimientos;
+}
+
+/**
+ * Obtiene los tiempos de la partida
+ * @return const std::vector<uint32_t>& - Milisegundos antes de cada movimiento
+ * @complexity O(1)
+ */
+const std::vector<uint32_t> &Repeticion::getTiempos() const
+{
+    return tiempos;
+}
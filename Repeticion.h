@@ -0,0 +1,156 @@
+/**
+ * @file Repeticion.h
+ * @brief TAD Repeticion para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) Repeticion, que guarda
+ * una partida grabada por el TAD Juego (tablero de partida, movimientos y
+ * tiempos) en un formato binario compacto y la vuelve a ejecutar a máxima
+ * velocidad a través de Juego::realizarMovimiento para verificarla.
+ *
+ * Formato de un registro (enteros multibyte en little-endian):
+ * - Cabecera: "BSRP", versión (1 byte) y número de pilas (1 byte)
+ * - Tablero: 16 bits por pila, 4 bits por bola desde el fondo con el índice de
+ *   color de la paleta de EstadoCompacto (0 = hueco vacío)
+ * - Número de movimientos como entero de longitud variable (LEB128)
+ * - Por movimiento: un byte (origen << 4 | destino) y los milisegundos
+ *   transcurridos desde el anterior como entero de longitud variable
+ *
+ * Cada registro es autodelimitado, de modo que un archivo puede contener
+ * muchas partidas concatenadas y verificarse de una sola lectura.
+ */
+
+#ifndef REPETICION_H
+#define REPETICION_H
+
+#include "Juego.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief TAD Repeticion con una partida grabada
+ */
+class Repeticion
+{
+public:
+    static constexpr uint8_t VERSION = 1; // Versión del formato binario
+
+private:
+    Tablero inicial;                     // Tablero de partida
+    std::vector<Movimiento> movimientos; // Movimientos en orden
+    std::vector<uint32_t> tiempos;       // Milisegundos antes de cada movimiento
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea una repetición vacía
+     * @complexity O(1)
+     */
+    Repeticion();
+
+    /**
+     * @brief Copia la grabación de un juego
+     * @pre No hay precondiciones
+     * @post La repetición contiene el tablero, los movimientos y los tiempos grabados
+     * @param juego - Juego con la grabación activa
+     * @return bool - false si el juego no estaba grabando
+     * @complexity O(m) donde m es el número de movimientos
+     */
+    bool desdeJuego(const Juego &juego);
+
+    /**
+     * @brief Codifica la repetición en formato binario
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Se añade un registro completo al final de datos
+     * @param datos - Vector donde añadir el registro
+     * @return bool - false si algún color no es representable
+     * @complexity O(m) donde m es el número de movimientos
+     */
+    bool codificar(std::vector<uint8_t> &datos) const;
+
+    /**
+     * @brief Descodifica un registro binario
+     * @pre datos apunta a tam bytes legibles
+     * @post Si el registro es válido, la repetición lo representa y leidos
+     *       contiene su longitud en bytes; si no, la repetición no cambia
+     * @param datos - Inicio del registro
+     * @param tam - Bytes disponibles
+     * @param leidos - Bytes ocupados por el registro
+     * @return bool - false si el registro está truncado o mal formado
+     * @complexity O(m) donde m es el número de movimientos
+     */
+    bool descodificar(const uint8_t *datos, size_t tam, size_t &leidos);
+
+    /**
+     * @brief Obtiene la longitud de un registro sin descodificarlo
+     * @pre datos apunta a tam bytes legibles
+     * @post Recorre la cabecera y los enteros de longitud variable del registro
+     *       sin construir el tablero ni los movimientos, para poder repartir
+     *       los registros de un archivo antes de descodificarlos
+     * @param datos - Inicio del registro
+     * @param tam - Bytes disponibles
+     * @param longitud - Bytes ocupados por el registro
+     * @return bool - false si el registro está truncado o su cabecera no es válida
+     * @complexity O(m) donde m es el número de movimientos
+     */
+    static bool medirRegistro(const uint8_t *datos, size_t tam, size_t &longitud);
+
+    /**
+     * @brief Guarda la repetición en un archivo
+     * @pre No hay precondiciones
+     * @post El archivo contiene un único registro
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si se pudo escribir
+     * @complexity O(m) donde m es el número de movimientos
+     */
+    bool guardar(const std::string &nombreArchivo) const;
+
+    /**
+     * @brief Carga la primera repetición de un archivo
+     * @pre No hay precondiciones
+     * @post Si el archivo es válido, la repetición contiene su primer registro
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - false si el archivo no existe o está dañado
+     * @complexity O(m) donde m es el número de movimientos
+     */
+    bool cargar(const std::string &nombreArchivo);
+
+    /**
+     * @brief Vuelve a ejecutar la partida sobre un juego
+     * @pre No hay precondiciones
+     * @post El juego se inicializa con el tablero de partida y se realizan los
+     *       movimientos hasta el primero que no sea válido
+     * @param juego - Juego donde reproducir la partida
+     * @param movimientosValidos - Movimientos aceptados por el juego
+     * @return bool - true si todos los movimientos son válidos y el juego termina resuelto
+     * @complexity O(m) donde m es el número de movimientos
+     */
+    bool reproducir(Juego &juego, int &movimientosValidos) const;
+
+    /**
+     * @brief Obtiene el tablero de partida
+     * @return const Tablero& - Tablero antes del primer movimiento
+     * @complexity O(1)
+     */
+    const Tablero &getInicial() const;
+
+    /**
+     * @brief Obtiene los movimientos de la partida
+     * @return const std::vector<Movimiento>& - Movimientos en orden
+     * @complexity O(1)
+     */
+    const std::vector<Movimiento> &getMovimientos() const;
+
+    /**
+     * @brief Obtiene los tiempos de la partida
+     * @return const std::vector<uint32_t>& - Milisegundos antes de cada movimiento
+     * @complexity O(1)
+     */
+    const std::vector<uint32_t> &getTiempos() const;
+};
+
+#endif // REPETICION_H
@@ -0,0 +1,161 @@
+/**
+ * @file RepeticionPruebas.cpp
+ * @brief Pruebas para el TAD Repeticion del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD Repeticion (Repeticion.h/Repeticion.cpp)
+ * y de la grabación de partidas del TAD Juego. Se graba la resolución del
+ * tablero de ejemplo, se guarda, se vuelve a cargar y se reproduce, y se
+ * comprueba que las partidas manipuladas o los archivos dañados se detectan.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "Repeticion.h"
+#include "Resolutor.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "Repeticion.cpp"
+
+/**
+ * @brief Comprueba que dos tableros tienen las mismas pilas y bolas
+ * @param a - Primer tablero
+ * @param b - Segundo tablero
+ * @return bool - true si son iguales
+ */
+bool igualesTableros(const Tablero &a, const Tablero &b)
+{
+    EstadoCompacto estadoA, estadoB;
+    return estadoA.desdeTablero(a) && estadoB.desdeTablero(b) && estadoA == estadoB;
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD Repeticion..." << std::endl;
+
+    Tablero ejemplo = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    ResultadoResolucion solucion = Resolutor().resolver(ejemplo);
+    assert(solucion.resuelto);
+
+    // Prueba 1: Grabación de una partida en el juego
+    Juego juego;
+    assert(!juego.estaGrabando());
+    assert(juego.inicializar(ejemplo));
+    juego.activarGrabacion(true);
+    assert(juego.estaGrabando());
+    assert(!juego.realizarMovimiento(0, 1)); // Los movimientos no válidos no se graban
+    for (const Movimiento &movimiento : solucion.movimientos)
+    {
+        assert(juego.realizarMovimiento(movimiento.origen, movimiento.destino));
+    }
+    assert(juego.juegoTerminado() && !juego.estaEnCurso());
+    assert(juego.getMovimientosGrabados().size() == solucion.movimientos.size());
+    assert(juego.getTiemposGrabados().size() == solucion.movimientos.size());
+    assert(igualesTableros(juego.getTableroGrabado(), ejemplo));
+    std::cout << "Prueba 1 superada: Grabación de " << solucion.movimientos.size() << " movimientos" << std::endl;
+
+    // Prueba 2: Codificación y descodificación
+    Repeticion repeticion;
+    assert(repeticion.desdeJuego(juego));
+    std::vector<uint8_t> datos;
+    assert(repeticion.codificar(datos));
+    assert(datos.size() == 6 + 2 * 6 + 1 + 2 * solucion.movimientos.size()); // Tiempos de menos de 128 ms
+    Repeticion copia;
+    size_t leidos = 0;
+    assert(copia.descodificar(datos.data(), datos.size(), leidos) && leidos == datos.size());
+    assert(igualesTableros(copia.getInicial(), ejemplo));
+    assert(copia.getMovimientos().size() == solucion.movimientos.size());
+    for (size_t i = 0; i < solucion.movimientos.size(); i++)
+    {
+        assert(copia.getMovimientos()[i].origen == solucion.movimientos[i].origen);
+        assert(copia.getMovimientos()[i].destino == solucion.movimientos[i].destino);
+        assert(copia.getTiempos()[i] == repeticion.getTiempos()[i]);
+    }
+    std::cout << "Prueba 2 superada: Codificación en " << datos.size() << " bytes" << std::endl;
+
+    // Prueba 3: Guardado, carga y reproducción
+    assert(repeticion.guardar("repeticion_pruebas.tmp"));
+    Repeticion cargada;
+    assert(cargada.cargar("repeticion_pruebas.tmp"));
+    Juego reproduccion;
+    int movimientosValidos = 0;
+    assert(cargada.reproducir(reproduccion, movimientosValidos));
+    assert(movimientosValidos == (int)solucion.movimientos.size());
+    assert(reproduccion.juegoTerminado() && reproduccion.getNumMovimientos() == movimientosValidos);
+    assert(!cargada.cargar("no_existe.rep"));
+    std::remove("repeticion_pruebas.tmp");
+    std::cout << "Prueba 3 superada: Guardado, carga y reproducción" << std::endl;
+
+    // Prueba 4: Partidas manipuladas
+    std::vector<uint8_t> manipulados = datos;
+    size_t inicioMovimientos = 6 + 2 * 6 + 1;
+    manipulados[inicioMovimientos + 2 * 4] = 0x00; // Quinto movimiento: del tubo 1 al tubo 1
+    Repeticion manipulada;
+    assert(manipulada.descodificar(manipulados.data(), manipulados.size(), leidos));
+    assert(!manipulada.reproducir(reproduccion, movimientosValidos));
+    assert(movimientosValidos == 4);
+    std::vector<uint8_t> sinFinal = datos;
+    sinFinal[inicioMovimientos - 1] = (uint8_t)(solucion.movimientos.size() - 1);
+    assert(manipulada.descodificar(sinFinal.data(), sinFinal.size(), leidos) && leidos == sinFinal.size() - 2);
+    assert(!manipulada.reproducir(reproduccion, movimientosValidos));
+    assert(movimientosValidos == (int)solucion.movimientos.size() - 1);
+    std::cout << "Prueba 4 superada: Detección de partidas manipuladas" << std::endl;
+
+    // Prueba 5: Registros dañados y concatenados
+    Repeticion rota;
+    for (size_t tam = 0; tam < datos.size(); tam++)
+    {
+        assert(!rota.descodificar(datos.data(), tam, leidos)); // Registro truncado
+    }
+    std::vector<uint8_t> erroneos = datos;
+    erroneos[0] = 'X';
+    assert(!rota.descodificar(erroneos.data(), erroneos.size(), leidos));
+    erroneos = datos;
+    erroneos[5] = 11; // Demasiadas pilas
+    assert(!rota.descodificar(erroneos.data(), erroneos.size(), leidos));
+    erroneos = datos;
+    erroneos[inicioMovimientos] = 0x0F; // Tubo destino fuera de rango
+    assert(!rota.descodificar(erroneos.data(), erroneos.size(), leidos));
+
+    std::vector<uint8_t> varias = datos;
+    assert(repeticion.codificar(varias));
+    assert(rota.descodificar(varias.data(), varias.size(), leidos) && leidos == datos.size());
+    assert(rota.descodificar(varias.data() + leidos, varias.size() - leidos, leidos) && leidos == datos.size());
+    size_t longitud;
+    assert(Repeticion::medirRegistro(varias.data(), varias.size(), longitud) && longitud == datos.size());
+    for (size_t tam = 0; tam < datos.size(); tam++)
+    {
+        assert(!Repeticion::medirRegistro(datos.data(), tam, longitud));
+    }
+    std::cout << "Prueba 5 superada: Registros dañados y concatenados" << std::endl;
+
+    // Prueba 6: La grabación se reinicia al inicializar el juego
+    juego.inicializar(ejemplo);
+    assert(juego.estaGrabando() && juego.getMovimientosGrabados().empty());
+    juego.realizarMovimiento(0, 4);
+    juego.activarGrabacion(false);
+    assert(!juego.estaGrabando() && juego.getMovimientosGrabados().empty());
+    assert(!repeticion.desdeJuego(juego));
+    std::cout << "Prueba 6 superada: Reinicio de la grabación" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD Repeticion han sido superadas!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file ResolucionAsincrona.cpp
+ * @brief Implementación del TAD ResolucionAsincrona para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD ResolucionAsincrona
+ * (ResolucionAsincrona.h). El hilo de trabajo duerme en una variable de
+ * condición hasta que hay una petición. Cada petición lleva un número, y el
+ * hilo solo publica el progreso y el resultado si siguen siendo de la última
+ * petición, así que una búsqueda cancelada nunca sobrescribe a la siguiente.
+ */
+
+#include "ResolucionAsincrona.h"
+#include <chrono>
+
+/**
+ * Constructor
+ * @param opciones - Opciones del resolutor (se ignoran cancelar y progreso)
+ * @complexity O(1)
+ */
+ResolucionAsincrona::ResolucionAsincrona(const OpcionesResolutor &opciones)
+    : opciones(opciones), salir(false), hayPeticion(false), numPeticion(0), movimientosPedido(0), cancelada(false),
+      estado(RESOLUCION_INACTIVA), progreso{0, 0, 0, 0}
+{
+    trabajador = std::thread(&ResolucionAsincrona::bucleTrabajador, this);
+}
+
+/**
+ * Destructor
+ * @complexity O(1) más lo que tarde la búsqueda en ver la cancelación
+ */
+ResolucionAsincrona::~ResolucionAsincrona()
+{
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojo);
+        salir = true;
+        cancelada = true;
+    }
+    aviso.notify_all();
+    trabajador.join();
+}
+
+/**
+ * Atiende las peticiones hasta que se pide salir
+ */
+void ResolucionAsincrona::bucleTrabajador()
+{
+    std::unique_lock<std::mutex> bloqueo(cerrojo);
+    while (true)
+    {
+        aviso.wait(bloqueo, [this]() { return salir || hayPeticion; });
+        if (salir)
+        {
+            return;
+        }
+        hayPeticion = false;
+        cancelada = false;
+        unsigned long long peticion = numPeticion;
+        Tablero tablero = tableroPedido;
+        bloqueo.unlock();
+
+        OpcionesResolutor opcionesPeticion = opciones;
+        opcionesPeticion.cancelar = &cancelada;
+        opcionesPeticion.progreso = [this, peticion](const ProgresoResolucion &actual)
+        {
+            std::lock_guard<std::mutex> bloqueoProgreso(cerrojo);
+            if (peticion == numPeticion)
+            {
+                progreso = actual;
+            }
+        };
+        ResultadoResolucion resultadoPeticion = Resolutor(opcionesPeticion).resolver(tablero);
+
+        bloqueo.lock();
+        if (peticion == numPeticion && estado == RESOLUCION_EN_CURSO && !resultadoPeticion.cancelado)
+        {
+            resultado = resultadoPeticion;
+            estado = RESOLUCION_TERMINADA;
+        }
+        aviso.notify_all();
+    }
+}
+
+/**
+ * Pide resolver la posición actual de una partida
+ * @param juego - Partida cuya posición se resuelve
+ * @return bool - false si la partida no está en curso
+ * @complexity O(1)
+ */
+bool ResolucionAsincrona::iniciar(const Juego &juego)
+{
+    if (!juego.estaEnCurso())
+    {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojo);
+        numPeticion++;
+        tableroPedido = juego.getTablero();
+        movimientosPedido = juego.getNumMovimientos();
+        hayPeticion = true;
+        cancelada = true; // Detiene la búsqueda anterior, si la hay
+        estado = RESOLUCION_EN_CURSO;
+        progreso = ProgresoResolucion{0, 0, 0, 0};
+        resultado = ResultadoResolucion();
+    }
+    aviso.notify_all();
+    return true;
+}
+
+/**
+ * Cancela la petición en curso
+ * @complexity O(1)
+ */
+void ResolucionAsincrona::cancelar()
+{
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojo);
+        if (estado != RESOLUCION_EN_CURSO)
+        {
+            return;
+        }
+        hayPeticion = false;
+        cancelada = true;
+        estado = RESOLUCION_CANCELADA;
+    }
+    aviso.notify_all();
+}
+
+/**
+ * Cancela la petición si la partida ha cambiado desde que se hizo
+ * @param juego - Partida de la petición
+ * @return bool - true si la petición sigue correspondiendo a la partida
+ * @complexity O(1)
+ */
+bool ResolucionAsincrona::actualizar(const Juego &juego)
+{
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojo);
+        if (estado != RESOLUCION_EN_CURSO && estado != RESOLUCION_TERMINADA)
+        {
+            return false;
+        }
+        if (juego.estaEnCurso() && juego.getNumMovimientos() == movimientosPedido)
+        {
+            return true;
+        }
+        hayPeticion = false;
+        cancelada = true;
+        estado = RESOLUCION_CANCELADA;
+    }
+    aviso.notify_all();
+    return false;
+}
+
+/**
+ * Obtiene el estado de la última petición
+ * @return EstadoResolucionAsincrona - Estado de la última petición
+ * @complexity O(1)
+ */
+EstadoResolucionAsincrona ResolucionAsincrona::getEstado() const
+{
+    std::lock_guard<std::mutex> bloqueo(cerrojo);
+    return estado;
+}
+
+/**
+ * Obtiene el último progreso de la petición
+ * @return ProgresoResolucion - Profundidad, cota y nodos de la búsqueda
+ * @complexity O(1)
+ */
+ProgresoResolucion ResolucionAsincrona::getProgreso() const
+{
+    std::lock_guard<std::mutex> bloqueo(cerrojo);
+    return progreso;
+}
+
+/**
+ * Obtiene el resultado de la última petición
+ * @param resultadoPeticion - Resultado de la resolución
+ * @return bool - true si la petición está TERMINADA
+ * @complexity O(L) donde L es la longitud de la solución
+ */
+bool ResolucionAsincrona::obtenerResultado(ResultadoResolucion &resultadoPeticion) const
+{
+    std::lock_guard<std::mutex> bloqueo(cerrojo);
+    if (estado != RESOLUCION_TERMINADA)
+    {
+        return false;
+    }
+    resultadoPeticion = resultado;
+    return true;
+}
+
+/**
+ * Espera a que la petición deje de estar en curso
+ * @param esperaMs - Milisegundos como máximo (negativo = sin límite)
+ * @return bool - true si la petición ya no está EN_CURSO
+ * @complexity O(1) más la espera
+ */
+bool ResolucionAsincrona::esperar(int esperaMs) const
+{
+    std::unique_lock<std::mutex> bloqueo(cerrojo);
+    auto terminada = [this]() { return estado != RESOLUCION_EN_CURSO; };
+    if (esperaMs < 0)
+    {
+        aviso.wait(bloqueo, terminada);
+        return true;
+    }
+    return aviso.wait_for(bloqueo, std::chrono::milliseconds(esperaMs), terminada);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file ResolucionAsincrona.h
+ * @brief TAD ResolucionAsincrona para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) ResolucionAsincrona,
+ * que resuelve la posición de una partida con el TAD Resolutor en un hilo de
+ * trabajo, para que la interfaz pueda seguir leyendo teclas y dibujando
+ * mientras se calcula una pista. El hilo se crea con el objeto y atiende una
+ * petición cada vez: una petición nueva cancela la anterior.
+ *
+ * La interfaz consulta el estado, el último progreso (profundidad, nodos y
+ * cota) y el resultado sin bloquearse. Cada petición recuerda los movimientos
+ * que llevaba la partida, de modo que actualizar() la cancela en cuanto el
+ * jugador mueve y la solución deja de servir.
+ */
+
+#ifndef RESOLUCION_ASINCRONA_H
+#define RESOLUCION_ASINCRONA_H
+
+#include "Juego.h"
+#include "Resolutor.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Estado de la última petición de resolución
+ */
+enum EstadoResolucionAsincrona
+{
+    RESOLUCION_INACTIVA,  // No se ha pedido ninguna resolución
+    RESOLUCION_EN_CURSO,  // El hilo de trabajo está resolviendo (o va a empezar)
+    RESOLUCION_TERMINADA, // Hay resultado, con o sin solución
+    RESOLUCION_CANCELADA  // Se canceló antes de terminar
+};
+
+/**
+ * @brief TAD ResolucionAsincrona que resuelve partidas en segundo plano
+ */
+class ResolucionAsincrona
+{
+private:
+    OpcionesResolutor opciones; // Opciones de cada resolución (cancelar y progreso los pone el TAD)
+
+    mutable std::mutex cerrojo;            // Protege todo lo que sigue salvo cancelada
+    mutable std::condition_variable aviso; // Despierta al hilo de trabajo y a esperar()
+    std::thread trabajador;                // Hilo de trabajo
+    bool salir;                            // Pide al hilo de trabajo que termine
+    bool hayPeticion;                      // Hay una petición que el hilo aún no ha empezado
+    unsigned long long numPeticion;        // Número de la última petición
+    Tablero tableroPedido;                 // Posición de la petición
+    int movimientosPedido;                 // Movimientos de la partida al hacer la petición
+    std::atomic<bool> cancelada;           // Bandera de cancelación de la búsqueda en curso
+    EstadoResolucionAsincrona estado;      // Estado de la última petición
+    ProgresoResolucion progreso;           // Último progreso de la última petición
+    ResultadoResolucion resultado;         // Resultado de la última petición terminada
+
+    void bucleTrabajador();
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea el hilo de trabajo, sin ninguna petición
+     * @param opciones - Opciones del resolutor (se ignoran cancelar y progreso)
+     * @complexity O(1)
+     */
+    explicit ResolucionAsincrona(const OpcionesResolutor &opciones = OpcionesResolutor());
+
+    /**
+     * @brief Destructor
+     * @pre No hay precondiciones
+     * @post Cancela la petición en curso y espera a que termine el hilo de trabajo
+     * @complexity O(1) más lo que tarde la búsqueda en ver la cancelación
+     */
+    ~ResolucionAsincrona();
+
+    ResolucionAsincrona(const ResolucionAsincrona &) = delete;
+    ResolucionAsincrona &operator=(const ResolucionAsincrona &) = delete;
+
+    /**
+     * @brief Pide resolver la posición actual de una partida
+     * @pre No hay precondiciones
+     * @post Si la partida está en curso, cancela la petición anterior y deja la
+     *       nueva EN_CURSO; el resultado anterior se descarta
+     * @param juego - Partida cuya posición se resuelve
+     * @return bool - false si la partida no está en curso
+     * @complexity O(1)
+     */
+    bool iniciar(const Juego &juego);
+
+    /**
+     * @brief Cancela la petición en curso
+     * @pre No hay precondiciones
+     * @post Si había una petición EN_CURSO, pasa a CANCELADA sin esperar al hilo
+     * @complexity O(1)
+     */
+    void cancelar();
+
+    /**
+     * @brief Cancela la petición si la partida ha cambiado desde que se hizo
+     * @pre No hay precondiciones
+     * @post Si la partida tiene otro número de movimientos o ya no está en
+     *       curso, la petición EN_CURSO o TERMINADA pasa a CANCELADA
+     * @param juego - Partida de la petición
+     * @return bool - true si la petición sigue correspondiendo a la partida
+     * @complexity O(1)
+     */
+    bool actualizar(const Juego &juego);
+
+    /**
+     * @brief Obtiene el estado de la última petición
+     * @pre No hay precondiciones
+     * @post Devuelve el estado sin bloquearse
+     * @return EstadoResolucionAsincrona - Estado de la última petición
+     * @complexity O(1)
+     */
+    EstadoResolucionAsincrona getEstado() const;
+
+    /**
+     * @brief Obtiene el último progreso de la petición
+     * @pre No hay precondiciones
+     * @post Devuelve el último progreso comunicado por el resolutor (ceros si aún no hay)
+     * @return ProgresoResolucion - Profundidad, cota y nodos de la búsqueda
+     * @complexity O(1)
+     */
+    ProgresoResolucion getProgreso() const;
+
+    /**
+     * @brief Obtiene el resultado de la última petición
+     * @pre No hay precondiciones
+     * @post Si la petición ha terminado, copia su resultado
+     * @param resultadoPeticion - Resultado de la resolución
+     * @return bool - true si la petición está TERMINADA
+     * @complexity O(L) donde L es la longitud de la solución
+     */
+    bool obtenerResultado(ResultadoResolucion &resultadoPeticion) const;
+
+    /**
+     * @brief Espera a que la petición deje de estar en curso
+     * @pre No hay precondiciones
+     * @post Vuelve al terminar o cancelarse la petición, o al agotar la espera
+     * @param esperaMs - Milisegundos como máximo (negativo = sin límite)
+     * @return bool - true si la petición ya no está EN_CURSO
+     * @complexity O(1) más la espera
+     */
+    bool esperar(int esperaMs) const;
+};
+
+#endif // RESOLUCION_ASINCRONA_H
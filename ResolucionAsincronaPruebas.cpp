@@ -0,0 +1,137 @@
+/**
+ * @file ResolucionAsincronaPruebas.cpp
+ * @brief Pruebas para el TAD ResolucionAsincrona del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD ResolucionAsincrona
+ * (ResolucionAsincrona.h/ResolucionAsincrona.cpp). Las soluciones se comparan
+ * con las del TAD Resolutor, y la cancelación se prueba con un tablero sin
+ * solución cuya búsqueda tarda bastante más que las pruebas.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "ResolucionAsincrona.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ResolucionAsincrona.cpp"
+
+/**
+ * @brief Crea una partida a partir de sus tubos
+ * @param numPilas - Número total de tubos
+ * @param tubos - Contenido de los primeros tubos, de abajo arriba
+ * @param juego - Partida que se inicializa
+ */
+void crearJuego(int numPilas, const std::vector<std::string> &tubos, Juego &juego)
+{
+    Tablero tablero;
+    tablero.inicializar(numPilas);
+    for (size_t i = 0; i < tubos.size(); i++)
+    {
+        for (char color : tubos[i])
+        {
+            tablero.colocarBola((int)i, color);
+        }
+    }
+    assert(juego.inicializar(tablero));
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD ResolucionAsincrona..." << std::endl;
+
+    Juego ejemplo;
+    crearJuego(6, {"RBGY", "GYRB", "BYGR", "RGBY"}, ejemplo);
+    ResultadoResolucion esperado = Resolutor().resolver(ejemplo.getTablero());
+
+    // Tablero sin solución (cinco bolas R y tres O) con muchas posiciones alcanzables
+    Juego sinSolucion;
+    crearJuego(10, {"RGBY", "MCOR", "YBGR", "OCMR", "GRYB", "COMY", "BMGC"}, sinSolucion);
+    OpcionesResolutor opcionesLargas;
+    opcionesLargas.maxNodos = 100000000;
+
+    // Prueba 1: Resolución en segundo plano con progreso
+    ResolucionAsincrona resolucion;
+    assert(resolucion.getEstado() == RESOLUCION_INACTIVA);
+    ResultadoResolucion resultado;
+    assert(!resolucion.obtenerResultado(resultado));
+    assert(resolucion.iniciar(ejemplo));
+    int consultas = 0;
+    while (!resolucion.esperar(1))
+    {
+        consultas++; // La interfaz seguiría leyendo teclas y dibujando aquí
+    }
+    assert(resolucion.getEstado() == RESOLUCION_TERMINADA);
+    assert(resolucion.obtenerResultado(resultado) && resultado.resuelto);
+    assert(resultado.movimientos.size() == esperado.movimientos.size());
+    ProgresoResolucion progreso = resolucion.getProgreso();
+    assert(progreso.cota > 0 && progreso.cota <= (int)esperado.movimientos.size());
+    assert(progreso.nodosExpandidos <= resultado.nodosExpandidos);
+    assert(resolucion.actualizar(ejemplo));
+    std::cout << "Prueba 1 superada: Solución de " << resultado.movimientos.size() << " movimientos tras "
+              << consultas << " consultas sin bloqueo" << std::endl;
+
+    // Prueba 2: Cancelación y reutilización del hilo de trabajo
+    assert(resolucion.iniciar(sinSolucion));
+    assert(resolucion.getEstado() == RESOLUCION_EN_CURSO);
+    resolucion.cancelar();
+    assert(resolucion.getEstado() == RESOLUCION_CANCELADA);
+    assert(resolucion.esperar(0) && !resolucion.obtenerResultado(resultado));
+    assert(!resolucion.actualizar(sinSolucion));
+    assert(resolucion.iniciar(ejemplo));
+    assert(resolucion.esperar(-1) && resolucion.obtenerResultado(resultado));
+    assert(resultado.resuelto && resultado.movimientos.size() == esperado.movimientos.size());
+    std::cout << "Prueba 2 superada: Cancelación y nueva petición" << std::endl;
+
+    // Prueba 3: Una petición nueva sustituye a la que está en curso
+    ResolucionAsincrona larga(opcionesLargas);
+    assert(larga.iniciar(sinSolucion));
+    assert(larga.iniciar(ejemplo));
+    assert(larga.esperar(-1) && larga.obtenerResultado(resultado));
+    assert(resultado.resuelto && resultado.movimientos.size() == esperado.movimientos.size());
+    std::cout << "Prueba 3 superada: Una petición nueva sustituye a la anterior" << std::endl;
+
+    // Prueba 4: La petición se cancela cuando el jugador mueve
+    Juego partida;
+    crearJuego(6, {"RBGY", "GYRB", "BYGR", "RGBY"}, partida);
+    assert(larga.iniciar(partida));
+    assert(larga.actualizar(partida));
+    assert(partida.realizarMovimiento(esperado.movimientos[0].origen, esperado.movimientos[0].destino));
+    assert(!larga.actualizar(partida));
+    assert(larga.getEstado() == RESOLUCION_CANCELADA);
+    partida.terminarJuego();
+    assert(!larga.iniciar(partida));
+    std::cout << "Prueba 4 superada: Cancelación al mover" << std::endl;
+
+    // Prueba 5: Progreso de una búsqueda larga y destrucción con ella en curso
+    {
+        ResolucionAsincrona enCurso(opcionesLargas);
+        assert(enCurso.iniciar(sinSolucion));
+        while (enCurso.getProgreso().cota == 0)
+        {
+            assert(!enCurso.esperar(1));
+        }
+        assert(enCurso.getEstado() == RESOLUCION_EN_CURSO);
+    }
+    std::cout << "Prueba 5 superada: Progreso y destrucción con una búsqueda en curso" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD ResolucionAsincrona han sido superadas!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,550 @@
+/**
+ * @file Resolutor.cpp
+ * @brief Implementación del TAD Resolutor para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD Resolutor
+ * (Resolutor.h). La lista abierta es una cola de prioridad ordenada por
+ * f = g + h (desempate por mayor g) y la lista cerrada un mapa de estados
+ * canónicos a nodos. Como la cota con base de finales no es necesariamente
+ * consistente, un nodo se reabre si se encuentra un camino más corto hasta él.
+ *
+ * La búsqueda bidireccional guarda los nodos de los dos sentidos en el mismo
+ * mapa. Hacia atrás se deshacen movimientos como en BaseFinal::construir. Como
+ * cada sentido expande capas completas, el primer encuentro ya es óptimo: si
+ * hacia delante se han cerrado las capas hasta df y hacia atrás hasta da sin
+ * encontrarse, la solución tiene más de df + da movimientos, y el encuentro
+ * da un camino de df + da + 1 como mucho.
+ *
+ * La bandera de cancelación se consulta antes de expandir cada nodo, así que
+ * la búsqueda se detiene en cuanto termina la expansión en curso.
+ */
+
+#include "Resolutor.h"
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+
+OpcionesResolutor::OpcionesResolutor()
+{
+    baseFinal = nullptr;
+    maxNodos = 2000000;
+    cancelar = nullptr;
+    intervaloProgreso = 10000;
+}
+
+ResultadoResolucion::ResultadoResolucion()
+{
+    resuelto = false;
+    cancelado = false;
+    nodosExpandidos = 0;
+    nodosGenerados = 0;
+}
+
+/**
+ * Constructor
+ * @param opciones - Opciones del resolutor
+ * @complexity O(1)
+ */
+Resolutor::Resolutor(const OpcionesResolutor &opciones)
+    : opciones(opciones)
+{
+}
+
+/**
+ * Cota inferior básica del número de movimientos restantes
+ * @param estado - Estado a evaluar
+ * @return int - Cota inferior admisible
+ * @complexity O(n) donde n es el número de bolas
+ */
+int Resolutor::heuristicaBasica(const EstadoCompacto &estado)
+{
+    int bolasPorColor[EstadoCompacto::MAX_COLORES + 1] = {0};
+    int sumaRachas[EstadoCompacto::MAX_COLORES + 1] = {0};
+    int mayorRacha[EstadoCompacto::MAX_COLORES + 1] = {0};
+    int cota = 0;
+
+    for (int pila = 0; pila < estado.getNumPilas(); pila++)
+    {
+        int altura = estado.getAltura(pila);
+        if (altura == 0)
+        {
+            continue;
+        }
+
+        int fondo = estado.getBola(pila, 0);
+        int racha = 1;
+        while (racha < altura && estado.getBola(pila, racha) == fondo)
+        {
+            racha++;
+        }
+        for (int posicion = 0; posicion < altura; posicion++)
+        {
+            bolasPorColor[estado.getBola(pila, posicion)]++;
+        }
+
+        // Las bolas sobre la racha inferior tapan una bola de otro color
+        cota += altura - racha;
+        sumaRachas[fondo] += racha;
+        mayorRacha[fondo] = std::max(mayorRacha[fondo], racha);
+    }
+
+    // Si un color cabe en un solo tubo, solo una de sus rachas inferiores puede quedarse
+    for (int color = 1; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        if (bolasPorColor[color] <= Pila::CAPACIDAD_MAXIMA)
+        {
+            cota += sumaRachas[color] - mayorRacha[color];
+        }
+    }
+    return cota;
+}
+
+/**
+ * Selecciona las bases aplicables a la forma del tablero de partida
+ */
+Resolutor::ContextoCota Resolutor::prepararContexto(const EstadoCompacto &raiz) const
+{
+    ContextoCota contexto;
+    contexto.baseAplicable = opciones.baseFinal != nullptr && opciones.baseFinal->esAplicable(raiz);
+    contexto.patronesAditivos = true;
+
+    uint32_t coloresUsados = 0;
+    for (const BasePatrones *patron : opciones.patrones)
+    {
+        if (patron != nullptr && patron->esAplicable(raiz))
+        {
+            if ((coloresUsados & patron->getMascara()) != 0)
+            {
+                contexto.patronesAditivos = false;
+            }
+            coloresUsados |= patron->getMascara();
+            contexto.patrones.push_back(patron);
+        }
+    }
+    return contexto;
+}
+
+/**
+ * Calcula la cota inferior de un estado: exacta si está en la base de finales,
+ * COTA_INFINITA si un patrón demuestra que no tiene solución
+ */
+int Resolutor::cotaInferior(const EstadoCompacto &estado, const ContextoCota &contexto, bool &exacta) const
+{
+    exacta = false;
+    if (contexto.baseAplicable)
+    {
+        int distancia = opciones.baseFinal->distancia(estado);
+        if (distancia >= 0)
+        {
+            exacta = true;
+            return distancia;
+        }
+    }
+
+    int cota = heuristicaBasica(estado);
+    if (contexto.baseAplicable)
+    {
+        cota = std::max(cota, opciones.baseFinal->getProfundidad() + 1);
+    }
+
+    // Patrones disjuntos: suma de cotas; si se solapan, la mayor
+    int cotaPatrones = 0;
+    for (const BasePatrones *patron : contexto.patrones)
+    {
+        int cotaPatron = patron->cota(estado);
+        if (cotaPatron >= BasePatrones::INALCANZABLE)
+        {
+            return COTA_INFINITA;
+        }
+        cotaPatrones = contexto.patronesAditivos ? cotaPatrones + cotaPatron : std::max(cotaPatrones, cotaPatron);
+    }
+    return std::max(cota, cotaPatrones);
+}
+
+/**
+ * Completa una solución bajando por la base de finales: desde una posición a
+ * distancia d siempre hay un movimiento a otra de distancia d - 1
+ * @return bool - false si la base no corresponde al tablero (ningún movimiento baja)
+ */
+bool Resolutor::completarConBase(Tablero tablero, int distancia, std::vector<Movimiento> &movimientos) const
+{
+    while (distancia > 0)
+    {
+        bool avanzado = false;
+        for (int origen = 0; origen < tablero.getNumPilas() && !avanzado; origen++)
+        {
+            for (int destino = 0; destino < tablero.getNumPilas() && !avanzado; destino++)
+            {
+                Tablero hijo = tablero;
+                EstadoCompacto estado;
+                if (hijo.moverBola(origen, destino) && estado.desdeTablero(hijo) &&
+                    opciones.baseFinal->distancia(estado) == distancia - 1)
+                {
+                    movimientos.push_back(Movimiento{origen, destino});
+                    tablero = hijo;
+                    distancia--;
+                    avanzado = true;
+                }
+            }
+        }
+        if (!avanzado)
+        {
+            return false; // Base incoherente con el tablero: no debería ocurrir
+        }
+    }
+    return true;
+}
+
+/**
+ * Reconstruye los movimientos reales de un camino de claves canónicas: desde el
+ * tablero de partida se busca en cada paso el movimiento que lleva al siguiente
+ * estado canónico, así los índices de tubo son siempre los de la partida
+ * @param tablero - Tablero de partida; al terminar, tablero final del camino
+ * @param claves - Claves canónicas del camino, empezando por la del tablero
+ * @param movimientos - Vector al que se añaden los movimientos
+ * @return bool - false si algún paso no corresponde a un movimiento válido
+ * @complexity O(L * n^3 log n) donde L es la longitud del camino y n el número de pilas
+ */
+bool Resolutor::reconstruirCamino(Tablero &tablero, const std::vector<EstadoCompacto> &claves,
+                                  std::vector<Movimiento> &movimientos)
+{
+    for (size_t paso = 1; paso < claves.size(); paso++)
+    {
+        bool encontrado = false;
+        for (int origen = 0; origen < tablero.getNumPilas() && !encontrado; origen++)
+        {
+            for (int destino = 0; destino < tablero.getNumPilas() && !encontrado; destino++)
+            {
+                Tablero hijo = tablero;
+                EstadoCompacto estado;
+                if (hijo.moverBola(origen, destino) && estado.desdeTablero(hijo) &&
+                    estado.canonico() == claves[paso])
+                {
+                    movimientos.push_back(Movimiento{origen, destino});
+                    tablero = hijo;
+                    encontrado = true;
+                }
+            }
+        }
+        if (!encontrado)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Busca una solución de longitud mínima
+ * @param inicial - Tablero de partida
+ * @return ResultadoResolucion - Solución y estadísticas de la búsqueda
+ * @complexity O(N log N) donde N es el número de nodos generados
+ */
+ResultadoResolucion Resolutor::resolver(const Tablero &inicial) const
+{
+    ResultadoResolucion resultado;
+
+    EstadoCompacto raiz;
+    if (!raiz.desdeTablero(inicial))
+    {
+        return resultado;
+    }
+    ContextoCota contexto = prepararContexto(raiz);
+
+    // Los nodos se guardan por estado canónico, que es a su vez un tablero válido
+    struct Nodo
+    {
+        EstadoCompacto padre; // Clave canónica del padre (igual a la propia en la raíz)
+        int coste;            // Movimientos desde la raíz
+        int cota;             // Cota inferior de los movimientos restantes
+        bool exacta;          // true si la cota es exacta (base de finales)
+    };
+    struct Entrada
+    {
+        int f;
+        int g;
+        EstadoCompacto clave;
+        bool operator<(const Entrada &otra) const
+        {
+            return f != otra.f ? f > otra.f : g < otra.g;
+        }
+    };
+
+    std::unordered_map<EstadoCompacto, Nodo, HashEstadoCompacto> nodos;
+    std::priority_queue<Entrada> abiertos;
+
+    EstadoCompacto claveRaiz = raiz.canonico();
+    Nodo nodoRaiz;
+    nodoRaiz.padre = claveRaiz;
+    nodoRaiz.coste = 0;
+    nodoRaiz.cota = cotaInferior(claveRaiz, contexto, nodoRaiz.exacta);
+    if (nodoRaiz.cota >= COTA_INFINITA)
+    {
+        return resultado;
+    }
+    nodos[claveRaiz] = nodoRaiz;
+    abiertos.push(Entrada{nodoRaiz.cota, 0, claveRaiz});
+
+    // La menor f de la lista abierta es una cota inferior de la longitud de la solución
+    ProgresoResolucion progreso = {0, 0, 0, 0};
+    long long siguienteAviso = 0;
+
+    Tablero tablero;
+    while (!abiertos.empty() && resultado.nodosExpandidos < opciones.maxNodos)
+    {
+        if (opciones.cancelar != nullptr && opciones.cancelar->load(std::memory_order_relaxed))
+        {
+            resultado.cancelado = true;
+            return resultado;
+        }
+
+        Entrada entrada = abiertos.top();
+        abiertos.pop();
+
+        Nodo nodo = nodos[entrada.clave];
+        if (entrada.g != nodo.coste)
+        {
+            continue; // Entrada obsoleta: el nodo se alcanzó después por un camino más corto
+        }
+
+        if (opciones.progreso && (entrada.f > progreso.cota || resultado.nodosExpandidos >= siguienteAviso))
+        {
+            progreso.profundidad = nodo.coste;
+            progreso.cota = std::max(progreso.cota, entrada.f);
+            progreso.nodosExpandidos = resultado.nodosExpandidos;
+            progreso.nodosGenerados = resultado.nodosGenerados;
+            opciones.progreso(progreso);
+            siguienteAviso = resultado.nodosExpandidos + opciones.intervaloProgreso;
+        }
+
+        entrada.clave.aTablero(tablero);
+        if (nodo.exacta || tablero.juegoTerminado())
+        {
+            // Camino de claves desde la raíz, traducido a movimientos de la partida
+            std::vector<EstadoCompacto> claves;
+            EstadoCompacto clave = entrada.clave;
+            while (clave != claveRaiz)
+            {
+                claves.push_back(clave);
+                clave = nodos[clave].padre;
+            }
+            claves.push_back(claveRaiz);
+            std::reverse(claves.begin(), claves.end());
+
+            Tablero real = inicial;
+            if (!reconstruirCamino(real, claves, resultado.movimientos) ||
+                (nodo.exacta && !completarConBase(real, nodo.cota, resultado.movimientos)))
+            {
+                resultado.movimientos.clear(); // Solución incompleta: no se da por resuelto
+                return resultado;
+            }
+            resultado.resuelto = true;
+            return resultado;
+        }
+
+        resultado.nodosExpandidos++;
+        int coste = nodo.coste + 1;
+        Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+        int numMovimientos = tablero.generarMovimientos(movimientos);
+        for (int m = 0; m < numMovimientos; m++)
+        {
+            Tablero hijo = tablero;
+            hijo.moverBola(movimientos[m].origen, movimientos[m].destino);
+            EstadoCompacto estadoHijo;
+            estadoHijo.desdeTablero(hijo);
+            EstadoCompacto claveHijo = estadoHijo.canonico();
+            resultado.nodosGenerados++;
+
+            auto encontrado = nodos.find(claveHijo);
+            if (encontrado == nodos.end())
+            {
+                Nodo nuevo;
+                nuevo.padre = entrada.clave;
+                nuevo.coste = coste;
+                nuevo.cota = cotaInferior(claveHijo, contexto, nuevo.exacta);
+                nodos[claveHijo] = nuevo;
+                if (nuevo.cota < COTA_INFINITA)
+                {
+                    abiertos.push(Entrada{coste + nuevo.cota, coste, claveHijo});
+                }
+            }
+            else if (coste < encontrado->second.coste && encontrado->second.cota < COTA_INFINITA)
+            {
+                encontrado->second.padre = entrada.clave;
+                encontrado->second.coste = coste;
+                abiertos.push(Entrada{coste + encontrado->second.cota, coste, claveHijo});
+            }
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * Busca una solución de longitud mínima con búsqueda bidireccional
+ * @param inicial - Tablero de partida
+ * @return ResultadoResolucion - Solución y estadísticas de la búsqueda
+ * @complexity O(b^(L/2)) nodos, donde b es el número de movimientos por
+ *             posición y L la longitud de la solución
+ */
+ResultadoResolucion Resolutor::resolverBidireccional(const Tablero &inicial) const
+{
+    ResultadoResolucion resultado;
+
+    EstadoCompacto raiz;
+    uint64_t tubosPorColor = 0;
+    if (!raiz.desdeTablero(inicial) || !BaseFinal::calcularForma(raiz, tubosPorColor))
+    {
+        return resultado; // Algún color no llena un número entero de tubos: no hay solución
+    }
+
+    // Posición resuelta: la única forma canónica con cada color en tubos completos
+    Tablero resuelto;
+    resuelto.inicializar(inicial.getNumPilas());
+    int pilaMeta = 0;
+    for (int color = 1; color <= EstadoCompacto::MAX_COLORES; color++)
+    {
+        for (int tubo = 0; tubo < (int)((tubosPorColor >> (4 * (color - 1))) & 15); tubo++, pilaMeta++)
+        {
+            for (int j = 0; j < Pila::CAPACIDAD_MAXIMA; j++)
+            {
+                resuelto.colocarBola(pilaMeta, EstadoCompacto::colorIndice(color));
+            }
+        }
+    }
+    EstadoCompacto meta;
+    meta.desdeTablero(resuelto);
+
+    // vecino es el padre hacia la partida (hacia delante) o el hijo hacia la meta (hacia atrás)
+    struct NodoBidireccional
+    {
+        EstadoCompacto vecino;
+        bool haciaAtras;
+    };
+    std::unordered_map<EstadoCompacto, NodoBidireccional, HashEstadoCompacto> nodos;
+
+    EstadoCompacto claveRaiz = raiz.canonico();
+    EstadoCompacto claveMeta = meta.canonico();
+    nodos[claveRaiz] = NodoBidireccional{claveRaiz, false};
+    if (claveRaiz == claveMeta)
+    {
+        resultado.resuelto = true;
+        return resultado;
+    }
+    nodos[claveMeta] = NodoBidireccional{claveMeta, true};
+
+    std::vector<EstadoCompacto> fronteras[2] = {std::vector<EstadoCompacto>(1, claveRaiz),
+                                                std::vector<EstadoCompacto>(1, claveMeta)};
+    EstadoCompacto delante; // Último nodo del lado de la partida en el encuentro
+    EstadoCompacto detras;  // Primer nodo del lado de la meta en el encuentro
+    bool encontrado = false;
+    int numPilas = inicial.getNumPilas();
+    Tablero tablero;
+
+    while (!encontrado && !fronteras[0].empty() && !fronteras[1].empty() &&
+           resultado.nodosExpandidos < opciones.maxNodos)
+    {
+        // Se expande una capa completa del sentido con menos nodos en la frontera
+        bool haciaAtras = fronteras[1].size() < fronteras[0].size();
+        std::vector<EstadoCompacto> siguiente;
+        std::vector<EstadoCompacto> hijos;
+        for (size_t i = 0; i < fronteras[haciaAtras].size() && !encontrado; i++)
+        {
+            if (opciones.cancelar != nullptr && opciones.cancelar->load(std::memory_order_relaxed))
+            {
+                resultado.cancelado = true;
+                return resultado;
+            }
+            const EstadoCompacto &estado = fronteras[haciaAtras][i];
+            resultado.nodosExpandidos++;
+            hijos.clear();
+            if (!haciaAtras)
+            {
+                estado.aTablero(tablero);
+                Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+                int numMovimientos = tablero.generarMovimientos(movimientos);
+                for (int m = 0; m < numMovimientos; m++)
+                {
+                    Tablero hijo = tablero;
+                    hijo.moverBola(movimientos[m].origen, movimientos[m].destino);
+                    EstadoCompacto estadoHijo;
+                    estadoHijo.desdeTablero(hijo);
+                    hijos.push_back(estadoHijo.canonico());
+                }
+            }
+            else
+            {
+                // La bola de la cima de b pudo llegar desde a si debajo hay otra igual o b solo la tiene a ella
+                for (int b = 0; b < numPilas; b++)
+                {
+                    int alturaB = estado.getAltura(b);
+                    if (alturaB == 0 ||
+                        (alturaB >= 2 && estado.getBola(b, alturaB - 2) != estado.getBola(b, alturaB - 1)))
+                    {
+                        continue;
+                    }
+                    bool vaciaProbada = false;
+                    for (int a = 0; a < numPilas; a++)
+                    {
+                        int alturaA = estado.getAltura(a);
+                        if (a == b || alturaA == Pila::CAPACIDAD_MAXIMA || (alturaA == 0 && vaciaProbada))
+                        {
+                            continue;
+                        }
+                        vaciaProbada = vaciaProbada || alturaA == 0;
+                        EstadoCompacto predecesor = estado;
+                        predecesor.trasladarBola(b, a);
+                        hijos.push_back(predecesor.canonico());
+                    }
+                }
+            }
+
+            for (const EstadoCompacto &hijo : hijos)
+            {
+                resultado.nodosGenerados++;
+                auto insertado = nodos.emplace(hijo, NodoBidireccional{estado, haciaAtras});
+                if (insertado.second)
+                {
+                    siguiente.push_back(hijo);
+                }
+                else if (insertado.first->second.haciaAtras != haciaAtras)
+                {
+                    delante = haciaAtras ? hijo : estado;
+                    detras = haciaAtras ? estado : hijo;
+                    encontrado = true;
+                    break;
+                }
+            }
+        }
+        fronteras[haciaAtras].swap(siguiente);
+    }
+
+    if (!encontrado)
+    {
+        return resultado;
+    }
+
+    // Camino de claves: de la partida al encuentro y del encuentro a la meta
+    std::vector<EstadoCompacto> claves;
+    for (EstadoCompacto clave = delante; clave != claveRaiz; clave = nodos[clave].vecino)
+    {
+        claves.push_back(clave);
+    }
+    claves.push_back(claveRaiz);
+    std::reverse(claves.begin(), claves.end());
+    for (EstadoCompacto clave = detras; clave != claveMeta; clave = nodos[clave].vecino)
+    {
+        claves.push_back(clave);
+    }
+    claves.push_back(claveMeta);
+
+    Tablero real = inicial;
+    resultado.resuelto = reconstruirCamino(real, claves, resultado.movimientos) && real.juegoTerminado();
+    if (!resultado.resuelto)
+    {
+        resultado.movimientos.clear();
+    }
+    return resultado;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file Resolutor.h
+ * @brief TAD Resolutor para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) Resolutor, que busca una
+ * solución de longitud mínima para un Tablero con el algoritmo A*. Los estados
+ * se identifican por su forma canónica (el orden de los tubos no cambia la
+ * distancia a la solución); al encontrar la solución, el camino de estados
+ * canónicos se traduce a movimientos con los índices de tubo de la partida.
+ *
+ * La cota inferior básica cuenta las bolas que necesariamente deben moverse.
+ * Opcionalmente se puede usar una BaseFinal: las posiciones que están en la
+ * base tienen distancia exacta (y se completan siguiendo la base sin buscar) y
+ * las que no están tienen distancia mayor que la profundidad de la base.
+ * También se pueden usar bases de patrones: si sus colores son disjuntos sus
+ * cotas se suman, y si alguna indica que la posición no tiene solución el
+ * nodo se descarta.
+ *
+ * También ofrece una búsqueda bidireccional sin cota: avanza desde el tablero
+ * de partida y retrocede desde la posición resuelta deshaciendo movimientos,
+ * capa a capa por la frontera más pequeña, hasta que las dos se encuentran.
+ *
+ * Las dos búsquedas se pueden cancelar desde otro hilo con una bandera
+ * atómica, y A* informa periódicamente de su progreso con una función, de
+ * modo que se pueden ejecutar en segundo plano (TAD ResolucionAsincrona).
+ */
+
+#ifndef RESOLUTOR_H
+#define RESOLUTOR_H
+
+#include "BaseFinal.h"
+#include "BasePatrones.h"
+#include <atomic>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Progreso de una búsqueda en curso
+ */
+struct ProgresoResolucion
+{
+    int profundidad;           // Movimientos desde la raíz del último nodo expandido
+    int cota;                  // Mayor cota inferior demostrada de la longitud de la solución
+    long long nodosExpandidos; // Nodos expandidos hasta el momento
+    long long nodosGenerados;  // Sucesores generados hasta el momento
+};
+
+/**
+ * @brief Opciones del resolutor
+ */
+struct OpcionesResolutor
+{
+    const BaseFinal *baseFinal;                // Base de finales opcional (nullptr = sin base)
+    std::vector<const BasePatrones *> patrones; // Bases de patrones opcionales
+    long long maxNodos;                        // Nodos expandidos máximos antes de rendirse
+    const std::atomic<bool> *cancelar;         // Bandera que detiene la búsqueda (nullptr = sin cancelación)
+    std::function<void(const ProgresoResolucion &)> progreso; // Aviso de progreso opcional (solo A*)
+    long long intervaloProgreso;               // Nodos expandidos entre dos avisos de progreso
+
+    OpcionesResolutor();
+};
+
+/**
+ * @brief Resultado de una resolución
+ */
+struct ResultadoResolucion
+{
+    bool resuelto;                       // true si se encontró una solución
+    bool cancelado;                      // true si la búsqueda se detuvo por la bandera de cancelación
+    std::vector<Movimiento> movimientos; // Movimientos de la solución (índices base 0)
+    long long nodosExpandidos;           // Nodos sacados de la lista abierta y expandidos
+    long long nodosGenerados;            // Sucesores generados
+
+    ResultadoResolucion();
+};
+
+/**
+ * @brief TAD Resolutor que busca soluciones óptimas con A*
+ */
+class Resolutor
+{
+public:
+    static const int COTA_INFINITA = BasePatrones::INALCANZABLE; // Posición sin solución
+
+private:
+    /**
+     * @brief Bases aplicables al tablero que se está resolviendo
+     */
+    struct ContextoCota
+    {
+        bool baseAplicable;
+        std::vector<const BasePatrones *> patrones;
+        bool patronesAditivos; // true si los colores de los patrones son disjuntos
+    };
+
+    OpcionesResolutor opciones;
+
+    ContextoCota prepararContexto(const EstadoCompacto &raiz) const;
+    int cotaInferior(const EstadoCompacto &estado, const ContextoCota &contexto, bool &exacta) const;
+    bool completarConBase(Tablero tablero, int distancia, std::vector<Movimiento> &movimientos) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea un resolutor con las opciones indicadas
+     * @param opciones - Opciones del resolutor
+     * @complexity O(1)
+     */
+    explicit Resolutor(const OpcionesResolutor &opciones = OpcionesResolutor());
+
+    /**
+     * @brief Busca una solución de longitud mínima
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Si se encuentra, la solución tiene el mínimo número de movimientos.
+     *       Se llama a opciones.progreso cada intervaloProgreso nodos
+     *       expandidos y cada vez que sube la cota, desde el hilo que resuelve
+     * @param inicial - Tablero de partida
+     * @return ResultadoResolucion - Solución y estadísticas de la búsqueda
+     * @complexity O(N log N) donde N es el número de nodos generados
+     */
+    ResultadoResolucion resolver(const Tablero &inicial) const;
+
+    /**
+     * @brief Busca una solución de longitud mínima con búsqueda bidireccional
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Si se encuentra, la solución tiene el mínimo número de movimientos;
+     *       no usa las bases de las opciones, solo maxNodos
+     * @param inicial - Tablero de partida
+     * @return ResultadoResolucion - Solución y estadísticas de la búsqueda
+     * @complexity O(b^(L/2)) nodos, donde b es el número de movimientos por
+     *             posición y L la longitud de la solución
+     */
+    ResultadoResolucion resolverBidireccional(const Tablero &inicial) const;
+
+    /**
+     * @brief Cota inferior básica del número de movimientos restantes
+     * @pre No hay precondiciones
+     * @post Devuelve el número de bolas que deben moverse al menos una vez: las
+     *       que están sobre la racha inferior de su tubo y, para cada color con
+     *       un único tubo final, las rachas inferiores salvo la mayor
+     * @param estado - Estado a evaluar
+     * @return int - Cota inferior admisible
+     * @complexity O(n) donde n es el número de bolas
+     */
+    static int heuristicaBasica(const EstadoCompacto &estado);
+
+    /**
+     * @brief Traduce un camino de claves canónicas a movimientos reales
+     * @pre claves[0] es la forma canónica de tablero
+     * @post Añade a movimientos un movimiento por paso del camino, con los
+     *       índices de tubo de tablero, y deja en tablero la posición final
+     * @param tablero - Tablero de partida; al terminar, tablero final del camino
+     * @param claves - Claves canónicas del camino, empezando por la del tablero
+     * @param movimientos - Vector al que se añaden los movimientos
+     * @return bool - false si algún paso no corresponde a un movimiento válido
+     * @complexity O(L * n^3 log n) donde L es la longitud del camino y n el número de pilas
+     */
+    static bool reconstruirCamino(Tablero &tablero, const std::vector<EstadoCompacto> &claves,
+                                  std::vector<Movimiento> &movimientos);
+};
+
+#endif // RESOLUTOR_H
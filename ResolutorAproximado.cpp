@@ -0,0 +1,319 @@
+/**
+ * @file ResolutorAproximado.cpp
+ * @brief Implementación del TAD ResolutorAproximado para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD ResolutorAproximado
+ * (ResolutorAproximado.h). Las dos fases usan Resolutor::heuristicaBasica como
+ * cota y Resolutor::reconstruirCamino para traducir el camino de claves
+ * canónicas a movimientos. El haz no repite estados vistos en capas
+ * anteriores; el A* ponderado reabre un nodo si encuentra un camino más corto.
+ */
+
+#include "ResolutorAproximado.h"
+#include <algorithm>
+#include <climits>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+OpcionesAproximado::OpcionesAproximado()
+{
+    anchuraHaz = 1000;
+    peso = 2.0;
+    segundosLimite = 10.0;
+    maxNodos = 2000000;
+    progreso = nullptr;
+}
+
+ResultadoAproximado::ResultadoAproximado()
+{
+    resuelto = false;
+    optima = false;
+    nodosExpandidos = 0;
+}
+
+/**
+ * Constructor
+ * @param opciones - Opciones del resolutor
+ * @complexity O(1)
+ */
+ResolutorAproximado::ResolutorAproximado(const OpcionesAproximado &opciones)
+    : opciones(opciones)
+{
+}
+
+/**
+ * Comprueba si se ha llegado al tiempo límite
+ */
+bool ResolutorAproximado::tiempoAgotado(Instante inicio) const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count() >=
+           opciones.segundosLimite;
+}
+
+/**
+ * Guarda una solución si es más corta que la mejor conocida
+ */
+void ResolutorAproximado::registrarSolucion(const Tablero &inicial, const std::vector<EstadoCompacto> &claves,
+                                            Instante inicio, ResultadoAproximado &resultado) const
+{
+    if (resultado.resuelto && claves.size() - 1 >= resultado.movimientos.size())
+    {
+        return;
+    }
+    Tablero tablero = inicial;
+    std::vector<Movimiento> movimientos;
+    if (!Resolutor::reconstruirCamino(tablero, claves, movimientos) || !tablero.juegoTerminado())
+    {
+        return; // Camino incoherente: no debería ocurrir
+    }
+
+    resultado.resuelto = true;
+    resultado.movimientos.swap(movimientos);
+    MejoraSolucion mejora;
+    mejora.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    mejora.longitud = (int)resultado.movimientos.size();
+    resultado.mejoras.push_back(mejora);
+    if (opciones.progreso != nullptr)
+    {
+        *opciones.progreso << "  " << mejora.segundos << " s: " << mejora.longitud << " movimientos" << std::endl;
+    }
+}
+
+/**
+ * Búsqueda en haz: cada capa conserva los anchuraHaz hijos nuevos con menor cota
+ */
+void ResolutorAproximado::buscarHaz(const Tablero &inicial, const EstadoCompacto &claveRaiz, Instante inicio,
+                                    ResultadoAproximado &resultado) const
+{
+    struct NodoHaz
+    {
+        EstadoCompacto clave;
+        int padre; // Posición del padre en la capa anterior
+    };
+    struct Candidato
+    {
+        int cota;
+        int padre;
+        EstadoCompacto clave;
+        bool operator<(const Candidato &otro) const
+        {
+            return cota < otro.cota;
+        }
+    };
+
+    std::vector<std::vector<NodoHaz>> capas(1, std::vector<NodoHaz>(1, NodoHaz{claveRaiz, -1}));
+    std::unordered_set<EstadoCompacto, HashEstadoCompacto> vistos;
+    vistos.insert(claveRaiz);
+    std::vector<Candidato> candidatos;
+    Tablero tablero;
+
+    while (!capas.back().empty() && (long long)vistos.size() < opciones.maxNodos && !tiempoAgotado(inicio))
+    {
+        const std::vector<NodoHaz> &capa = capas.back();
+        candidatos.clear();
+        for (size_t i = 0; i < capa.size(); i++)
+        {
+            capa[i].clave.aTablero(tablero);
+            resultado.nodosExpandidos++;
+            Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+            int numMovimientos = tablero.generarMovimientos(movimientos);
+            for (int m = 0; m < numMovimientos; m++)
+            {
+                int origen = movimientos[m].origen;
+                int destino = movimientos[m].destino;
+                EstadoCompacto hijo = capa[i].clave;
+                hijo.trasladarBola(origen, destino);
+                hijo = hijo.canonico();
+                if (!vistos.insert(hijo).second)
+                {
+                    continue;
+                }
+
+                Tablero tableroHijo;
+                hijo.aTablero(tableroHijo);
+                if (tableroHijo.juegoTerminado())
+                {
+                    // Camino de claves desde la raíz por los padres de cada capa
+                    std::vector<EstadoCompacto> claves(1, hijo);
+                    for (int c = (int)capas.size() - 1, p = (int)i; c >= 0; p = capas[c][p].padre, c--)
+                    {
+                        claves.push_back(capas[c][p].clave);
+                    }
+                    std::reverse(claves.begin(), claves.end());
+                    registrarSolucion(inicial, claves, inicio, resultado);
+                    return;
+                }
+                candidatos.push_back(Candidato{Resolutor::heuristicaBasica(hijo), (int)i, hijo});
+            }
+        }
+
+        // Los mejores candidatos, en el orden en que se generaron si empatan
+        size_t anchura = std::min(candidatos.size(), (size_t)opciones.anchuraHaz);
+        std::stable_sort(candidatos.begin(), candidatos.end());
+        std::vector<NodoHaz> siguiente(anchura);
+        for (size_t k = 0; k < anchura; k++)
+        {
+            siguiente[k] = NodoHaz{candidatos[k].clave, candidatos[k].padre};
+        }
+        capas.push_back(siguiente);
+    }
+}
+
+/**
+ * A* ponderado continuo: tras cada solución sigue con la misma lista abierta y
+ * poda los nodos cuya cota admisible no mejora la mejor solución
+ */
+void ResolutorAproximado::buscarPonderado(const Tablero &inicial, const EstadoCompacto &claveRaiz, Instante inicio,
+                                          ResultadoAproximado &resultado) const
+{
+    struct Nodo
+    {
+        EstadoCompacto padre; // Clave canónica del padre (igual a la propia en la raíz)
+        int coste;            // Movimientos desde la raíz
+        int cota;             // Cota inferior admisible de los movimientos restantes
+    };
+    struct Entrada
+    {
+        double f; // coste + peso * cota
+        int g;
+        EstadoCompacto clave;
+        bool operator<(const Entrada &otra) const
+        {
+            return f != otra.f ? f > otra.f : g < otra.g;
+        }
+    };
+
+    std::unordered_map<EstadoCompacto, Nodo, HashEstadoCompacto> nodos;
+    std::priority_queue<Entrada> abiertos;
+    int cotaRaiz = Resolutor::heuristicaBasica(claveRaiz);
+    nodos[claveRaiz] = Nodo{claveRaiz, 0, cotaRaiz};
+    abiertos.push(Entrada{opciones.peso * cotaRaiz, 0, claveRaiz});
+
+    // Camino de claves desde la raíz hasta un nodo guardado
+    auto camino = [&nodos, &claveRaiz](EstadoCompacto clave)
+    {
+        std::vector<EstadoCompacto> claves;
+        while (clave != claveRaiz)
+        {
+            claves.push_back(clave);
+            clave = nodos[clave].padre;
+        }
+        claves.push_back(claveRaiz);
+        std::reverse(claves.begin(), claves.end());
+        return claves;
+    };
+
+    Tablero tablero;
+    long long expandidos = 0;
+    while (!abiertos.empty())
+    {
+        if ((long long)nodos.size() >= opciones.maxNodos || (expandidos % 256 == 0 && tiempoAgotado(inicio)))
+        {
+            return;
+        }
+        int mejor = resultado.resuelto ? (int)resultado.movimientos.size() : INT_MAX;
+
+        Entrada entrada = abiertos.top();
+        abiertos.pop();
+        const Nodo nodo = nodos[entrada.clave];
+        if (entrada.g != nodo.coste || nodo.coste + nodo.cota >= mejor)
+        {
+            continue; // Entrada obsoleta, o no puede mejorar la mejor solución
+        }
+
+        expandidos++;
+        resultado.nodosExpandidos++;
+        entrada.clave.aTablero(tablero);
+        int coste = nodo.coste + 1;
+        Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+        int numMovimientos = tablero.generarMovimientos(movimientos);
+        for (int m = 0; m < numMovimientos; m++)
+        {
+            int origen = movimientos[m].origen;
+            int destino = movimientos[m].destino;
+            EstadoCompacto hijo = entrada.clave;
+            hijo.trasladarBola(origen, destino);
+            hijo = hijo.canonico();
+
+            Tablero tableroHijo;
+            hijo.aTablero(tableroHijo);
+            if (tableroHijo.juegoTerminado())
+            {
+                if (coste < mejor)
+                {
+                    std::vector<EstadoCompacto> claves = camino(entrada.clave);
+                    claves.push_back(hijo);
+                    registrarSolucion(inicial, claves, inicio, resultado);
+                    mejor = coste;
+                }
+                continue;
+            }
+
+            auto encontrado = nodos.find(hijo);
+            if (encontrado == nodos.end())
+            {
+                int cota = Resolutor::heuristicaBasica(hijo);
+                nodos[hijo] = Nodo{entrada.clave, coste, cota};
+                if (coste + cota < mejor)
+                {
+                    abiertos.push(Entrada{coste + opciones.peso * cota, coste, hijo});
+                }
+            }
+            else if (coste < encontrado->second.coste)
+            {
+                encontrado->second.padre = entrada.clave;
+                encontrado->second.coste = coste;
+                if (coste + encontrado->second.cota < mejor)
+                {
+                    abiertos.push(Entrada{coste + opciones.peso * encontrado->second.cota, coste, hijo});
+                }
+            }
+        }
+    }
+
+    // Lista abierta vacía: ningún nodo sin expandir puede mejorar la mejor solución
+    resultado.optima = resultado.resuelto;
+}
+
+/**
+ * Busca una solución y la mejora hasta el tiempo o la memoria límite
+ * @param inicial - Tablero de partida
+ * @return ResultadoAproximado - Mejor solución, mejoras y estadísticas
+ * @complexity O(W * L * m) para el haz más O(N log N) para el A* ponderado
+ */
+ResultadoAproximado ResolutorAproximado::resolver(const Tablero &inicial) const
+{
+    ResultadoAproximado resultado;
+    Instante inicio = std::chrono::steady_clock::now();
+
+    EstadoCompacto raiz;
+    if (!raiz.desdeTablero(inicial))
+    {
+        return resultado;
+    }
+    if (inicial.juegoTerminado())
+    {
+        resultado.resuelto = true;
+        resultado.optima = true;
+        return resultado;
+    }
+    EstadoCompacto claveRaiz = raiz.canonico();
+    int cotaRaiz = Resolutor::heuristicaBasica(claveRaiz);
+
+    if (opciones.anchuraHaz > 0)
+    {
+        buscarHaz(inicial, claveRaiz, inicio, resultado);
+    }
+    if (resultado.resuelto && (int)resultado.movimientos.size() == cotaRaiz)
+    {
+        resultado.optima = true; // La solución alcanza la cota inferior
+    }
+    if (opciones.peso > 0 && !resultado.optima)
+    {
+        buscarPonderado(inicial, claveRaiz, inicio, resultado);
+    }
+    return resultado;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file ResolutorAproximado.h
+ * @brief TAD ResolutorAproximado para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) ResolutorAproximado,
+ * pensado para los tableros grandes en los que A* no termina a tiempo. Busca
+ * en dos fases sobre estados canónicos, como el TAD Resolutor:
+ *
+ * - Búsqueda en haz: avanza capa a capa conservando solo los W estados con
+ *   menor cota inferior, así que da una primera solución enseguida con
+ *   memoria proporcional a W por la longitud de la solución.
+ * - A* ponderado continuo: ordena la lista abierta por g + p * h (p >= 1) y
+ *   sigue buscando después de cada solución, descartando los nodos cuya cota
+ *   admisible g + h no mejora la mejor solución. Si la lista abierta se vacía,
+ *   la mejor solución es óptima.
+ *
+ * La búsqueda se detiene al llegar al tiempo límite o al límite de nodos en
+ * memoria, y devuelve la mejor solución encontrada y la lista de mejoras.
+ */
+
+#ifndef RESOLUTOR_APROXIMADO_H
+#define RESOLUTOR_APROXIMADO_H
+
+#include "Resolutor.h"
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief Opciones del resolutor aproximado
+ */
+struct OpcionesAproximado
+{
+    int anchuraHaz;         // Estados que se conservan en cada capa del haz (0 = sin haz)
+    double peso;            // Peso p de la cota en el A* ponderado (0 = sin A* ponderado)
+    double segundosLimite;  // Tiempo máximo de búsqueda
+    long long maxNodos;     // Nodos guardados como máximo (límite de memoria)
+    std::ostream *progreso; // Salida opcional de las mejoras (nullptr = sin salida)
+
+    OpcionesAproximado();
+};
+
+/**
+ * @brief Mejora de la solución durante la búsqueda
+ */
+struct MejoraSolucion
+{
+    double segundos; // Tiempo desde el inicio de la búsqueda
+    int longitud;    // Movimientos de la nueva mejor solución
+};
+
+/**
+ * @brief Resultado de una resolución aproximada
+ */
+struct ResultadoAproximado
+{
+    bool resuelto;                       // true si se encontró alguna solución
+    bool optima;                         // true si se demostró que la solución es óptima
+    std::vector<Movimiento> movimientos; // Mejor solución (índices base 0)
+    std::vector<MejoraSolucion> mejoras; // Longitud de cada solución mejor que la anterior
+    long long nodosExpandidos;           // Nodos expandidos en las dos fases
+
+    ResultadoAproximado();
+};
+
+/**
+ * @brief TAD ResolutorAproximado con búsqueda en haz y A* ponderado continuo
+ */
+class ResolutorAproximado
+{
+private:
+    OpcionesAproximado opciones;
+
+    typedef std::chrono::steady_clock::time_point Instante;
+
+    bool tiempoAgotado(Instante inicio) const;
+    void buscarHaz(const Tablero &inicial, const EstadoCompacto &claveRaiz, Instante inicio,
+                   ResultadoAproximado &resultado) const;
+    void buscarPonderado(const Tablero &inicial, const EstadoCompacto &claveRaiz, Instante inicio,
+                         ResultadoAproximado &resultado) const;
+    void registrarSolucion(const Tablero &inicial, const std::vector<EstadoCompacto> &claves, Instante inicio,
+                           ResultadoAproximado &resultado) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea un resolutor con las opciones indicadas
+     * @param opciones - Opciones del resolutor
+     * @complexity O(1)
+     */
+    explicit ResolutorAproximado(const OpcionesAproximado &opciones = OpcionesAproximado());
+
+    /**
+     * @brief Busca una solución y la mejora hasta el tiempo o la memoria límite
+     * @pre Los colores del tablero están en la paleta de EstadoCompacto
+     * @post Si se encuentra, la solución es válida; optima indica si además es mínima
+     * @param inicial - Tablero de partida
+     * @return ResultadoAproximado - Mejor solución, mejoras y estadísticas
+     * @complexity O(W * L * m) para el haz, donde W es la anchura, L la longitud
+     *             de la solución y m los movimientos por posición, más
+     *             O(N log N) para el A* ponderado, donde N es el número de nodos
+     */
+    ResultadoAproximado resolver(const Tablero &inicial) const;
+};
+
+#endif // RESOLUTOR_APROXIMADO_H
@@ -0,0 +1,117 @@
+/**
+ * @file ResolutorAproximadoPruebas.cpp
+ * @brief Pruebas para el TAD ResolutorAproximado del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD ResolutorAproximado
+ * (ResolutorAproximado.h/ResolutorAproximado.cpp). Las soluciones se
+ * comprueban jugándolas sobre el tablero y sus longitudes se comparan con
+ * las óptimas del TAD Resolutor.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "ResolutorAproximado.h"
+#include "UtilidadesPruebas.h"
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ResolutorAproximado.cpp"
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD ResolutorAproximado..." << std::endl;
+
+    Tablero ejemplo = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    int optimo = (int)Resolutor().resolver(ejemplo).movimientos.size();
+
+    // Prueba 1: Solo búsqueda en haz
+    OpcionesAproximado soloHaz;
+    soloHaz.anchuraHaz = 20;
+    soloHaz.peso = 0;
+    ResultadoAproximado haz = ResolutorAproximado(soloHaz).resolver(ejemplo);
+    assert(haz.resuelto && resuelve(ejemplo, haz.movimientos));
+    assert((int)haz.movimientos.size() >= optimo);
+    assert(haz.mejoras.size() == 1 && haz.mejoras[0].longitud == (int)haz.movimientos.size());
+    std::cout << "Prueba 1 superada: Búsqueda en haz con " << haz.movimientos.size() << " movimientos (óptimo "
+              << optimo << ")" << std::endl;
+
+    // Prueba 2: El A* ponderado continuo mejora la solución hasta demostrar el óptimo
+    std::mt19937 generador(5);
+    std::string bolas;
+    const std::string COLORES = "RGBYMCOP";
+    for (char color : COLORES)
+    {
+        bolas += std::string(Pila::CAPACIDAD_MAXIMA, color);
+    }
+    std::shuffle(bolas.begin(), bolas.end(), generador);
+    std::vector<std::string> tubos;
+    for (size_t i = 0; i < COLORES.size(); i++)
+    {
+        tubos.push_back(bolas.substr(i * Pila::CAPACIDAD_MAXIMA, Pila::CAPACIDAD_MAXIMA));
+    }
+    Tablero grande = crearTablero(Tablero::MAX_PILAS, tubos);
+    OpcionesAproximado voraz;
+    voraz.anchuraHaz = 1;
+    voraz.peso = 3.0;
+    ResultadoAproximado mejorado = ResolutorAproximado(voraz).resolver(grande);
+    assert(mejorado.resuelto && mejorado.optima && resuelve(grande, mejorado.movimientos));
+    assert(mejorado.mejoras.size() > 1);
+    for (size_t i = 1; i < mejorado.mejoras.size(); i++)
+    {
+        assert(mejorado.mejoras[i].longitud < mejorado.mejoras[i - 1].longitud);
+        assert(mejorado.mejoras[i].segundos >= mejorado.mejoras[i - 1].segundos);
+    }
+    ResultadoResolucion exacto = Resolutor().resolver(grande);
+    assert(exacto.resuelto && mejorado.movimientos.size() == exacto.movimientos.size());
+    assert(mejorado.mejoras.back().longitud == (int)exacto.movimientos.size());
+    std::cout << "Prueba 2 superada: De " << mejorado.mejoras.front().longitud << " a " << mejorado.movimientos.size()
+              << " movimientos (óptimo demostrado) en un tablero de " << Tablero::MAX_PILAS << " tubos" << std::endl;
+
+    // Prueba 3: Límite de memoria y tableros triviales
+    OpcionesAproximado pocaMemoria;
+    pocaMemoria.anchuraHaz = 10;
+    pocaMemoria.maxNodos = 50;
+    ResultadoAproximado limitado = ResolutorAproximado(pocaMemoria).resolver(ejemplo);
+    assert(!limitado.optima);
+    assert(!limitado.resuelto || resuelve(ejemplo, limitado.movimientos));
+    Tablero resuelto = crearTablero(3, {"RRRR"});
+    ResultadoAproximado trivial = ResolutorAproximado().resolver(resuelto);
+    assert(trivial.resuelto && trivial.optima && trivial.movimientos.empty());
+    Tablero pequeno = crearTablero(4, {"RRRG", "GGGR"});
+    ResultadoAproximado corto = ResolutorAproximado().resolver(pequeno);
+    assert(corto.resuelto && corto.optima && corto.movimientos.size() == 3);
+    std::cout << "Prueba 3 superada: Límite de memoria y tableros triviales" << std::endl;
+
+    // Prueba 4: Tiempo límite
+    OpcionesAproximado sinTiempo;
+    sinTiempo.segundosLimite = 0.0;
+    ResultadoAproximado agotado = ResolutorAproximado(sinTiempo).resolver(grande);
+    assert(!agotado.resuelto && !agotado.optima && agotado.mejoras.empty());
+    OpcionesAproximado soloPonderado;
+    soloPonderado.anchuraHaz = 0;
+    soloPonderado.segundosLimite = 1.0;
+    ResultadoAproximado ponderado = ResolutorAproximado(soloPonderado).resolver(grande);
+    assert(ponderado.resuelto && resuelve(grande, ponderado.movimientos));
+    std::cout << "Prueba 4 superada: Tiempo límite" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD ResolutorAproximado han sido superadas!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,286 @@
+/**
+ * @file ResolutorPruebas.cpp
+ * @brief Pruebas para el TAD Resolutor y sus bases de datos del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD Resolutor (Resolutor.h/Resolutor.cpp)
+ * y de las bases de datos que usa (BaseFinal.h/BaseFinal.cpp y
+ * BasePatrones.h/BasePatrones.cpp). Las
+ * distancias se contrastan con una búsqueda en anchura en memoria sobre el
+ * nivel de ejemplo del juego, y la búsqueda bidireccional con una búsqueda
+ * en anchura solo hacia delante.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "Resolutor.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <unordered_map>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+
+/**
+ * @brief Crea el tablero del nivel de ejemplo (ballSort.cnf)
+ * @return Tablero - Tablero de 6 tubos con 4 colores
+ */
+Tablero tableroEjemplo()
+{
+    const char *tubos[4] = {"RBGY", "GYRB", "BYGR", "RGBY"};
+    Tablero tablero;
+    tablero.inicializar(6);
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            tablero.colocarBola(i, tubos[i][j]);
+        }
+    }
+    return tablero;
+}
+
+/**
+ * @brief Calcula la distancia exacta a la solución de todos los estados alcanzables
+ * @param inicial - Tablero de partida
+ * @return std::unordered_map - Distancia de cada estado que puede llegar a resolverse
+ */
+std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> distanciasExactas(const Tablero &inicial)
+{
+    // Enumerar estados y aristas hacia delante
+    std::vector<EstadoCompacto> estados(1);
+    estados[0].desdeTablero(inicial);
+    std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> indice;
+    indice[estados[0]] = 0;
+    std::vector<std::vector<int>> predecesores(1);
+    std::vector<int> resueltos;
+    for (size_t i = 0; i < estados.size(); i++)
+    {
+        Tablero tablero;
+        estados[i].aTablero(tablero);
+        if (tablero.juegoTerminado())
+        {
+            resueltos.push_back((int)i);
+        }
+        for (int o = 0; o < tablero.getNumPilas(); o++)
+        {
+            for (int d = 0; d < tablero.getNumPilas(); d++)
+            {
+                Tablero hijo = tablero;
+                EstadoCompacto sucesor;
+                if (!hijo.moverBola(o, d) || !sucesor.desdeTablero(hijo))
+                {
+                    continue;
+                }
+                auto insertado = indice.emplace(sucesor, (int)estados.size());
+                if (insertado.second)
+                {
+                    estados.push_back(sucesor);
+                    predecesores.push_back(std::vector<int>());
+                }
+                predecesores[insertado.first->second].push_back((int)i);
+            }
+        }
+    }
+
+    // Búsqueda en anchura hacia atrás desde los estados resueltos
+    std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> distancias;
+    std::vector<int> frontera = resueltos;
+    for (int r : resueltos)
+    {
+        distancias[estados[r]] = 0;
+    }
+    for (int d = 1; !frontera.empty(); d++)
+    {
+        std::vector<int> siguiente;
+        for (int i : frontera)
+        {
+            for (int p : predecesores[i])
+            {
+                if (distancias.emplace(estados[p], d).second)
+                {
+                    siguiente.push_back(p);
+                }
+            }
+        }
+        frontera.swap(siguiente);
+    }
+    return distancias;
+}
+
+/**
+ * @brief Cuenta los nodos que expande una búsqueda en anchura hacia delante hasta la solución
+ * @param inicial - Tablero de partida
+ * @return long long - Estados canónicos expandidos antes de generar uno resuelto
+ */
+long long expandidosEnAnchura(const Tablero &inicial)
+{
+    EstadoCompacto raiz;
+    raiz.desdeTablero(inicial);
+    std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> vistos;
+    std::vector<EstadoCompacto> cola(1, raiz.canonico());
+    vistos[cola[0]] = 0;
+    for (size_t i = 0; i < cola.size(); i++)
+    {
+        Tablero tablero;
+        cola[i].aTablero(tablero);
+        for (int o = 0; o < tablero.getNumPilas(); o++)
+        {
+            for (int d = 0; d < tablero.getNumPilas(); d++)
+            {
+                Tablero hijo = tablero;
+                EstadoCompacto sucesor;
+                if (hijo.moverBola(o, d) && sucesor.desdeTablero(hijo))
+                {
+                    if (hijo.juegoTerminado())
+                    {
+                        return (long long)i + 1;
+                    }
+                    if (vistos.emplace(sucesor.canonico(), 0).second)
+                    {
+                        cola.push_back(sucesor.canonico());
+                    }
+                }
+            }
+        }
+    }
+    return (long long)cola.size();
+}
+
+/**
+ * @brief Ejecuta las pruebas de los TADs Resolutor y BaseFinal
+ * @return int - 0 si todas las pruebas pasan correctamente
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD Resolutor..." << std::endl;
+
+    Tablero inicial = tableroEjemplo();
+    EstadoCompacto estadoInicial;
+    estadoInicial.desdeTablero(inicial);
+    std::unordered_map<EstadoCompacto, int, HashEstadoCompacto> distancias = distanciasExactas(inicial);
+    int optimo = distancias[estadoInicial];
+
+    // Prueba 1: La cota básica es admisible
+    for (const auto &par : distancias)
+    {
+        assert(Resolutor::heuristicaBasica(par.first) <= par.second);
+    }
+    std::cout << "Prueba 1 superada: Cota inferior admisible en " << distancias.size() << " estados" << std::endl;
+
+    // Prueba 2: Solución óptima sin base de finales
+    Resolutor resolutor;
+    ResultadoResolucion resultado = resolutor.resolver(inicial);
+    assert(resultado.resuelto);
+    assert((int)resultado.movimientos.size() == optimo);
+    assert(resuelve(inicial, resultado.movimientos));
+    std::cout << "Prueba 2 superada: Solución óptima de " << optimo << " movimientos" << std::endl;
+
+    // Prueba 3: Distancias de la base de finales
+    BaseFinal base;
+    assert(base.construir(6, "RGBY", 8));
+    assert(base.esAplicable(estadoInicial));
+    for (const auto &par : distancias)
+    {
+        int esperada = par.second <= 8 ? par.second : -1;
+        assert(base.distancia(par.first) == esperada);
+    }
+    std::cout << "Prueba 3 superada: Distancias exactas de la base (" << base.getNumPosiciones() << " posiciones)"
+              << std::endl;
+
+    // Prueba 4: Guardar, proyectar y resolver con la base
+    assert(base.guardar("base_pruebas.tmp"));
+    BaseFinal cargada;
+    assert(cargada.cargar("base_pruebas.tmp"));
+    assert(cargada.getProfundidad() == 8);
+    OpcionesResolutor opciones;
+    opciones.baseFinal = &cargada;
+    ResultadoResolucion conBase = Resolutor(opciones).resolver(inicial);
+    assert(conBase.resuelto);
+    assert((int)conBase.movimientos.size() == optimo);
+    assert(resuelve(inicial, conBase.movimientos));
+    assert(conBase.nodosExpandidos <= resultado.nodosExpandidos);
+    std::remove("base_pruebas.tmp");
+    std::cout << "Prueba 4 superada: Resolución con base de finales (" << conBase.nodosExpandidos
+              << " nodos frente a " << resultado.nodosExpandidos << ")" << std::endl;
+
+    // Prueba 5: La base no se aplica a otra forma
+    BaseFinal otraForma;
+    assert(otraForma.construir(5, "RGB", 2));
+    assert(!otraForma.esAplicable(estadoInicial));
+    std::cout << "Prueba 5 superada: Forma de la base" << std::endl;
+
+    // Prueba 6: Patrones disjuntos con cotas aditivas admisibles
+    BasePatrones rojoVerde, azulAmarillo;
+    assert(rojoVerde.construir(6, "RG", 2, 10000000));
+    assert(azulAmarillo.construir(6, "BY", 2, 10000000));
+    assert(rojoVerde.esCompleta() && azulAmarillo.esCompleta());
+    assert(rojoVerde.esAplicable(estadoInicial) && azulAmarillo.esAplicable(estadoInicial));
+    for (const auto &par : distancias)
+    {
+        assert(rojoVerde.cota(par.first) + azulAmarillo.cota(par.first) <= par.second);
+    }
+    assert(rojoVerde.cota(estadoInicial) + azulAmarillo.cota(estadoInicial) >
+           Resolutor::heuristicaBasica(estadoInicial));
+    std::cout << "Prueba 6 superada: Cotas de patrones admisibles (" << rojoVerde.getNumPosiciones() << " y "
+              << azulAmarillo.getNumPosiciones() << " posiciones)" << std::endl;
+
+    // Prueba 7: Guardar, cargar y resolver con patrones
+    assert(rojoVerde.guardar("patrones_pruebas.tmp"));
+    BasePatrones rojoVerdeCargada;
+    assert(rojoVerdeCargada.cargar("patrones_pruebas.tmp"));
+    BaseFinal otraBase;
+    assert(!otraBase.cargar("patrones_pruebas.tmp"));
+    std::remove("patrones_pruebas.tmp");
+    OpcionesResolutor conPatrones;
+    conPatrones.patrones.push_back(&rojoVerdeCargada);
+    conPatrones.patrones.push_back(&azulAmarillo);
+    ResultadoResolucion resultadoPatrones = Resolutor(conPatrones).resolver(inicial);
+    assert(resultadoPatrones.resuelto);
+    assert((int)resultadoPatrones.movimientos.size() == optimo);
+    assert(resuelve(inicial, resultadoPatrones.movimientos));
+    assert(resultadoPatrones.nodosExpandidos <= resultado.nodosExpandidos);
+    std::cout << "Prueba 7 superada: Resolución con patrones (" << resultadoPatrones.nodosExpandidos << " nodos)"
+              << std::endl;
+
+    // Prueba 8: Búsqueda bidireccional
+    ResultadoResolucion bidireccional = resolutor.resolverBidireccional(inicial);
+    assert(bidireccional.resuelto);
+    assert((int)bidireccional.movimientos.size() == optimo);
+    assert(resuelve(inicial, bidireccional.movimientos));
+    long long enAnchura = expandidosEnAnchura(inicial);
+    assert(bidireccional.nodosExpandidos < enAnchura);
+    Tablero pequeno;
+    pequeno.inicializar(4);
+    for (char color : std::string("RRRGGGGR"))
+    {
+        pequeno.colocarBola(pequeno.getPila(0).numElementos() < 4 ? 0 : 1, color);
+    }
+    ResultadoResolucion corto = resolutor.resolverBidireccional(pequeno);
+    assert(corto.resuelto && corto.movimientos.size() == 3 && resuelve(pequeno, corto.movimientos));
+    Tablero resuelto;
+    resuelto.inicializar(3);
+    for (int i = 0; i < 4; i++)
+    {
+        resuelto.colocarBola(1, 'R');
+    }
+    ResultadoResolucion vacio = resolutor.resolverBidireccional(resuelto);
+    assert(vacio.resuelto && vacio.movimientos.empty());
+    resuelto.colocarBola(0, 'G');
+    assert(!resolutor.resolverBidireccional(resuelto).resuelto);
+    std::cout << "Prueba 8 superada: Búsqueda bidireccional (" << bidireccional.nodosExpandidos
+              << " nodos frente a " << enAnchura << " en anchura)" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD Resolutor han sido superadas!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file ResolverNivel.cpp
+ * @brief Herramienta de resolución óptima de niveles
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa carga un nivel (.cnf), busca una solución de longitud mínima
+ * con el TAD Resolutor y muestra los movimientos en el mismo formato que se
+ * usa al jugar (tubos numerados desde 1). Opcionalmente usa una base de datos
+ * de finales construida con ConstructorBaseFinal y bases de patrones
+ * construidas con ConstructorPatrones, que se cargan al arrancar. Con
+ * --bidireccional usa la búsqueda bidireccional sin cota en lugar de A*. Con
+ * --aproximado usa el TAD ResolutorAproximado (haz y A* ponderado continuo)
+ * y muestra cada mejora de la solución hasta el tiempo límite.
+ *
+ * Uso: ResolverNivel <nivel.cnf> [--base archivo] [--patrones archivo]...
+ *                    [--max-nodos N] [--bidireccional]
+ *                    [--aproximado [--haz W] [--peso P] [--tiempo S]]
+ */
+
+#include "Juego.h"
+#include "Resolutor.h"
+#include "ResolutorAproximado.h"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ResolutorAproximado.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: ResolverNivel <nivel.cnf> [--base archivo] [--patrones archivo]..." << std::endl;
+    std::cerr << "                     [--max-nodos N] [--bidireccional]" << std::endl;
+    std::cerr << "                     [--aproximado [--haz W] [--peso P] [--tiempo S]]" << std::endl;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string nivel = argv[1];
+    OpcionesResolutor opciones;
+    BaseFinal base;
+    std::vector<std::unique_ptr<BasePatrones>> patrones;
+    bool bidireccional = false;
+    bool aproximado = false;
+    OpcionesAproximado opcionesAproximado;
+
+    for (int i = 2; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--base" && i + 1 < argc)
+        {
+            if (!base.cargar(argv[++i]))
+            {
+                std::cerr << "Error: No se pudo cargar la base de finales " << argv[i] << std::endl;
+                return 1;
+            }
+            opciones.baseFinal = &base;
+        }
+        else if (opcion == "--patrones" && i + 1 < argc)
+        {
+            patrones.emplace_back(new BasePatrones());
+            if (!patrones.back()->cargar(argv[++i]))
+            {
+                std::cerr << "Error: No se pudo cargar la base de patrones " << argv[i] << std::endl;
+                return 1;
+            }
+            opciones.patrones.push_back(patrones.back().get());
+        }
+        else if (opcion == "--max-nodos" && i + 1 < argc)
+        {
+            opciones.maxNodos = std::stoll(argv[++i]);
+            opcionesAproximado.maxNodos = opciones.maxNodos;
+        }
+        else if (opcion == "--bidireccional")
+        {
+            bidireccional = true;
+        }
+        else if (opcion == "--aproximado")
+        {
+            aproximado = true;
+        }
+        else if (opcion == "--haz" && i + 1 < argc)
+        {
+            opcionesAproximado.anchuraHaz = std::stoi(argv[++i]);
+        }
+        else if (opcion == "--peso" && i + 1 < argc)
+        {
+            opcionesAproximado.peso = std::stod(argv[++i]);
+        }
+        else if (opcion == "--tiempo" && i + 1 < argc)
+        {
+            opcionesAproximado.segundosLimite = std::stod(argv[++i]);
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    Juego juego;
+    if (!juego.inicializar(nivel))
+    {
+        std::cerr << "Error: No se pudo cargar el nivel " << nivel << std::endl;
+        return 1;
+    }
+
+    EstadoCompacto estado;
+    estado.desdeTablero(juego.getTablero());
+    if (opciones.baseFinal != nullptr && !base.esAplicable(estado))
+    {
+        std::cout << "Aviso: La base de finales no corresponde a la forma de este nivel" << std::endl;
+    }
+    for (const std::unique_ptr<BasePatrones> &patron : patrones)
+    {
+        if (!patron->esAplicable(estado))
+        {
+            std::cout << "Aviso: Una base de patrones no corresponde a la forma de este nivel" << std::endl;
+        }
+    }
+
+    if (aproximado)
+    {
+        std::cout << "Mejoras de la solución:" << std::endl;
+        opcionesAproximado.progreso = &std::cout;
+        ResultadoAproximado resultado = ResolutorAproximado(opcionesAproximado).resolver(juego.getTablero());
+        std::cout << "Nodos expandidos: " << resultado.nodosExpandidos << std::endl;
+        if (!resultado.resuelto)
+        {
+            std::cout << "No se encontró solución dentro de los límites." << std::endl;
+            return 2;
+        }
+        std::cout << "Solución " << (resultado.optima ? "óptima" : "sin demostrar que es óptima") << " en "
+                  << resultado.movimientos.size() << " movimientos:" << std::endl;
+        for (const Movimiento &movimiento : resultado.movimientos)
+        {
+            std::cout << movimiento.origen + 1 << " " << movimiento.destino + 1 << std::endl;
+        }
+        return 0;
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    Resolutor resolutor(opciones);
+    ResultadoResolucion resultado =
+        bidireccional ? resolutor.resolverBidireccional(juego.getTablero()) : resolutor.resolver(juego.getTablero());
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << "Nodos expandidos: " << resultado.nodosExpandidos << std::endl;
+    std::cout << "Nodos generados: " << resultado.nodosGenerados << std::endl;
+    std::cout << "Tiempo: " << segundos << " s" << std::endl;
+
+    if (!resultado.resuelto)
+    {
+        std::cout << "No se encontró solución dentro del límite de nodos." << std::endl;
+        return 2;
+    }
+
+    std::cout << "Solución óptima en " << resultado.movimientos.size() << " movimientos:" << std::endl;
+    for (const Movimiento &movimiento : resultado.movimientos)
+    {
+        std::cout << movimiento.origen + 1 << " " << movimiento.destino + 1 << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,938 @@
+/**
+ * @file ServidorJuego.cpp
+ * @brief Implementación del TAD ServidorJuego para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD ServidorJuego
+ * (ServidorJuego.h). Todos los sockets son no bloqueantes y se atienden desde
+ * un único hilo con epoll en modo por nivel. Las respuestas se acumulan en la
+ * sesión y se envían al final de cada lectura; lo que el socket no acepta se
+ * guarda hasta el siguiente evento de escritura. Cada evento lee como mucho
+ * MAX_LECTURA bytes de una conexión, y una conexión con más de MAX_PENDIENTE
+ * bytes sin enviar deja de leerse hasta que el cliente lea sus respuestas, de
+ * modo que ningún cliente acapara el bucle ni la memoria. Deshacer vuelve a
+ * cargar el nivel y repite el historial, porque las reglas no permiten siempre
+ * devolver la bola a su tubo.
+ *
+ * Las órdenes H van a una cola que atiende un hilo de pistas; al terminar cada
+ * una, el hilo la deja en otra cola y despierta al bucle con un eventfd. La
+ * sesión deja de leer mientras espera, y guarda lo que ya había recibido para
+ * atenderlo después de enviar la pista.
+ */
+
+#include "ServidorJuego.h"
+#include "Resolutor.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Eventos atendidos en cada llamada a epoll_wait
+static const int MAX_EVENTOS = 256;
+
+// Bytes de respuestas pendientes a partir de los cuales se deja de leer una conexión
+static const size_t MAX_PENDIENTE = 1 << 16;
+
+// Bytes leídos de una conexión en cada evento, para que ninguna acapare el bucle
+static const size_t MAX_LECTURA = 1 << 14;
+
+/**
+ * Escribe los tubos de un tablero de abajo arriba, separados por '.'
+ * @param tablero - Tablero a escribir
+ * @param texto - Cadena donde añadirlo
+ * @complexity O(n) donde n es el número de bolas
+ */
+static void escribirTubos(const Tablero &tablero, std::string &texto)
+{
+    for (int pila = 0; pila < tablero.getNumPilas(); pila++)
+    {
+        if (pila > 0)
+        {
+            texto += '.';
+        }
+        const Pila &p = tablero.getPila(pila);
+        if (p.estaVacia())
+        {
+            texto += '-';
+        }
+        for (int posicion = 0; posicion < p.numElementos(); posicion++)
+        {
+            texto += p.getElemento(posicion);
+        }
+    }
+}
+
+/**
+ * Separa una orden en su letra y sus argumentos
+ * @param linea - Orden recibida
+ * @param argumentos - Argumentos, sin los espacios del principio y del final
+ * @return char - Letra de la orden; '\0' si está vacía y '?' si la letra no va
+ *         seguida de un espacio
+ * @complexity O(l) donde l es la longitud de la orden
+ */
+static char separarOrden(const std::string &linea, std::string &argumentos)
+{
+    size_t inicio = linea.find_first_not_of(" \t");
+    size_t fin = linea.find_last_not_of(" \t\r");
+    argumentos.clear();
+    if (inicio == std::string::npos)
+    {
+        return '\0';
+    }
+    argumentos = inicio + 1 <= fin ? linea.substr(inicio + 1, fin - inicio) : "";
+    size_t primero = argumentos.find_first_not_of(" \t");
+    argumentos = primero == std::string::npos ? "" : argumentos.substr(primero);
+    if (!argumentos.empty() && primero == 0)
+    {
+        return '?';
+    }
+    return linea[inicio];
+}
+
+/**
+ * Lee los tubos de una orden M sin desbordar con números grandes
+ * @param argumentos - Argumentos de la orden
+ * @param origen - Tubo de origen, o 0 si el número no es un tubo posible
+ * @param destino - Tubo de destino, o 0 si el número no es un tubo posible
+ * @return bool - false si los argumentos no son exactamente dos números
+ * @complexity O(l) donde l es la longitud de los argumentos
+ */
+static bool leerTubos(const std::string &argumentos, int &origen, int &destino)
+{
+    const char *cursor = argumentos.c_str();
+    int *tubos[2] = {&origen, &destino};
+    for (int *tubo : tubos)
+    {
+        char *fin = nullptr;
+        errno = 0;
+        long valor = std::strtol(cursor, &fin, 10);
+        if (fin == cursor)
+        {
+            return false;
+        }
+        *tubo = errno == 0 && valor >= 1 && valor <= Tablero::MAX_PILAS ? (int)valor : 0;
+        cursor = fin;
+    }
+    return cursor[std::strspn(cursor, " \t")] == '\0';
+}
+
+/**
+ * Calcula la respuesta de una orden H
+ * @param tablero - Posición de la partida
+ * @param maxNodos - Nodos máximos del resolutor
+ * @param cancelar - Bandera que detiene la búsqueda (nullptr = sin cancelación)
+ * @return std::string - "PISTA origen destino" o "ERR sin pista"
+ * @complexity La de una búsqueda acotada por maxNodos
+ */
+static std::string calcularPista(const Tablero &tablero, long long maxNodos, const std::atomic<bool> *cancelar)
+{
+    OpcionesResolutor opciones;
+    opciones.maxNodos = maxNodos;
+    opciones.cancelar = cancelar;
+    ResultadoResolucion resultado = Resolutor(opciones).resolver(tablero);
+    if (!resultado.resuelto || resultado.movimientos.empty())
+    {
+        return "ERR sin pista";
+    }
+    return "PISTA " + std::to_string(resultado.movimientos[0].origen + 1) + " " +
+           std::to_string(resultado.movimientos[0].destino + 1);
+}
+
+/**
+ * Indica si una sesión puede atender más órdenes: no espera una pista y el
+ * cliente ha ido leyendo sus respuestas
+ * @param sesion - Sesión a comprobar
+ * @return bool - true si se pueden atender órdenes de la sesión
+ * @complexity O(1)
+ */
+static bool admiteOrdenes(const SesionServidor &sesion)
+{
+    return !sesion.esperandoPista && sesion.pendiente.size() <= MAX_PENDIENTE;
+}
+
+/**
+ * Constructor de la sesión
+ * @complexity O(1)
+ */
+SesionServidor::SesionServidor()
+{
+    nivel = -1;
+    tamEntrada = 0;
+    descartando = false;
+    numero = 0;
+    esperandoPista = false;
+    eventos = 0;
+}
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+ServidorJuego::ServidorJuego() : detenido(false), cancelarPistas(false)
+{
+    maxNodosPista = 200000;
+    escucha = -1;
+    epoll = -1;
+    numSesiones = 0;
+    ordenesAtendidas = 0;
+    numConexiones = 0;
+    avisoPistas = -1;
+    salirPistas = false;
+}
+
+/**
+ * Destructor
+ */
+ServidorJuego::~ServidorJuego()
+{
+    cerrarTodo();
+}
+
+/**
+ * Registra un nivel
+ * @param id - Identificador del nivel (sin espacios)
+ * @param tablero - Posición de partida del nivel
+ * @return bool - false si el identificador no es válido
+ * @complexity O(1)
+ */
+bool ServidorJuego::registrarNivel(const std::string &id, const Tablero &tablero)
+{
+    if (id.empty() || id.find_first_of(" \t\r\n") != std::string::npos)
+    {
+        return false;
+    }
+
+    std::unordered_map<std::string, int>::iterator it = indices.find(id);
+    if (it != indices.end())
+    {
+        niveles[it->second] = tablero;
+    }
+    else
+    {
+        indices[id] = (int)niveles.size();
+        niveles.push_back(tablero);
+    }
+    return true;
+}
+
+/**
+ * Fija el esfuerzo máximo de cada pista
+ * @param maxNodos - Nodos máximos
+ * @complexity O(1)
+ */
+void ServidorJuego::setMaxNodosPista(long long maxNodos)
+{
+    maxNodosPista = maxNodos;
+}
+
+/**
+ * Procesa una orden del protocolo
+ * @param sesion - Sesión que envía la orden
+ * @param linea - Orden recibida
+ * @param respuesta - Respuesta a la orden
+ * @return bool - false si la sesión pide cerrar la conexión
+ * @complexity O(1) salvo U (O(m) con m movimientos) y H (búsqueda acotada)
+ */
+bool ServidorJuego::procesarLinea(SesionServidor &sesion, const std::string &linea, std::string &respuesta) const
+{
+    std::string argumentos;
+    char orden = separarOrden(linea, argumentos);
+    if (orden == '\0')
+    {
+        respuesta = "ERR orden vacía";
+        return true;
+    }
+
+    switch (orden)
+    {
+    case 'Q':
+        return false;
+
+    case 'L':
+    {
+        std::unordered_map<std::string, int>::const_iterator it = indices.find(argumentos);
+        if (it == indices.end())
+        {
+            respuesta = "ERR nivel desconocido";
+            return true;
+        }
+        sesion.nivel = it->second;
+        sesion.juego.inicializar(niveles[sesion.nivel]);
+        sesion.historial.clear();
+        respuesta = "OK " + std::to_string(niveles[sesion.nivel].getNumPilas());
+        return true;
+    }
+
+    case 'S':
+        if (sesion.nivel < 0)
+        {
+            respuesta = "ERR sin nivel";
+            return true;
+        }
+        respuesta = "ESTADO " + std::to_string(sesion.juego.getNumMovimientos()) + " ";
+        escribirTubos(sesion.juego.getTablero(), respuesta);
+        return true;
+
+    case 'M':
+    {
+        int origen, destino;
+        if (!leerTubos(argumentos, origen, destino))
+        {
+            respuesta = "ERR formato: M origen destino";
+            return true;
+        }
+        if (sesion.nivel < 0)
+        {
+            respuesta = "ERR sin nivel";
+            return true;
+        }
+        if (!sesion.juego.realizarMovimiento(origen - 1, destino - 1))
+        {
+            respuesta = "ERR movimiento no válido";
+            return true;
+        }
+        sesion.historial.push_back((uint8_t)((origen - 1) << 4 | (destino - 1)));
+        respuesta = sesion.juego.juegoTerminado() ? "FIN " : "OK ";
+        respuesta += std::to_string(sesion.juego.getNumMovimientos());
+        return true;
+    }
+
+    case 'U':
+        if (sesion.historial.empty())
+        {
+            respuesta = "ERR nada que deshacer";
+            return true;
+        }
+        sesion.historial.pop_back();
+        sesion.juego.inicializar(niveles[sesion.nivel]);
+        for (uint8_t movimiento : sesion.historial)
+        {
+            sesion.juego.realizarMovimiento(movimiento >> 4, movimiento & 0xF);
+        }
+        respuesta = "OK " + std::to_string(sesion.juego.getNumMovimientos());
+        return true;
+
+    case 'H':
+        if (sesion.nivel < 0 || sesion.juego.juegoTerminado())
+        {
+            respuesta = "ERR sin partida en curso";
+            return true;
+        }
+        respuesta = calcularPista(sesion.juego.getTablero(), maxNodosPista, nullptr);
+        return true;
+
+    default:
+        respuesta = "ERR orden desconocida";
+        return true;
+    }
+}
+
+/**
+ * Atiende las órdenes completas de unos bytes recibidos
+ * @param descriptor - Socket de la conexión
+ * @param datos - Bytes recibidos
+ * @param tam - Número de bytes
+ * @return bool - false si la sesión pide cerrar la conexión
+ * @complexity O(b) donde b es el número de bytes, más el coste de las órdenes
+ */
+bool ServidorJuego::consumirEntrada(int descriptor, const char *datos, size_t tam)
+{
+    SesionServidor &sesion = *sesiones[descriptor];
+    std::string respuesta;
+    for (size_t i = 0; i < tam; i++)
+    {
+        if (!admiteOrdenes(sesion))
+        {
+            sesion.retenida.append(datos + i, tam - i); // Se atiende en enviarPendiente()
+            return true;
+        }
+        if (datos[i] != '\n')
+        {
+            if (sesion.tamEntrada < SesionServidor::TAM_LINEA)
+            {
+                sesion.entrada[sesion.tamEntrada++] = datos[i];
+            }
+            else
+            {
+                sesion.descartando = true;
+            }
+            continue;
+        }
+
+        std::string linea(sesion.entrada, sesion.tamEntrada);
+        bool descartada = sesion.descartando;
+        sesion.tamEntrada = 0;
+        sesion.descartando = false;
+        if (descartada)
+        {
+            respuesta = "ERR orden demasiado larga";
+        }
+        else if (pedirPista(descriptor, sesion, linea))
+        {
+            continue; // La respuesta la envía atenderPistas()
+        }
+        else if (!procesarLinea(sesion, linea, respuesta))
+        {
+            return false;
+        }
+        sesion.pendiente += respuesta;
+        sesion.pendiente += '\n';
+        ordenesAtendidas++;
+    }
+    return true;
+}
+
+/**
+ * Manda una orden H al hilo de pistas si hay una partida en curso
+ * @param descriptor - Socket de la conexión
+ * @param sesion - Sesión que envía la orden
+ * @param linea - Orden recibida
+ * @return bool - true si la pista se calculará en el hilo de pistas
+ * @complexity O(n) donde n es el número de bolas
+ */
+bool ServidorJuego::pedirPista(int descriptor, SesionServidor &sesion, const std::string &linea)
+{
+    std::string argumentos;
+    if (avisoPistas < 0 || separarOrden(linea, argumentos) != 'H' || sesion.nivel < 0 ||
+        sesion.juego.juegoTerminado())
+    {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojoPistas);
+        pistasPedidas.push_back(PeticionPista{descriptor, sesion.numero, maxNodosPista, sesion.juego.getTablero(), ""});
+    }
+    avisoHiloPistas.notify_one();
+    sesion.esperandoPista = true;
+    return true;
+}
+
+/**
+ * Interpreta una dirección como puerto TCP
+ * @param direccion - Puerto TCP o ruta del socket Unix
+ * @param puerto - Número de puerto, o 0 si no está entre 1 y 65535
+ * @return bool - true si la dirección es un número (y por tanto un puerto)
+ * @complexity O(l) donde l es la longitud de la dirección
+ */
+bool ServidorJuego::leerPuerto(const std::string &direccion, int &puerto)
+{
+    if (direccion.empty() || direccion.find_first_not_of("0123456789") != std::string::npos)
+    {
+        return false;
+    }
+    // Sin excepciones: se deja de acumular en cuanto el número pasa de 65535
+    long numero = 0;
+    for (size_t i = 0; i < direccion.size() && numero <= 65535; i++)
+    {
+        numero = numero * 10 + (direccion[i] - '0');
+    }
+    puerto = numero >= 1 && numero <= 65535 ? (int)numero : 0;
+    return true;
+}
+
+#ifdef __linux__
+
+/**
+ * Empieza a escuchar conexiones
+ * @param direccion - Puerto TCP o ruta del socket Unix
+ * @return bool - false si el puerto no es válido o no se pudo abrir el socket
+ * @complexity O(1)
+ */
+bool ServidorJuego::escuchar(const std::string &direccion)
+{
+    cerrarTodo();
+    int puerto = 0;
+
+    if (leerPuerto(direccion, puerto))
+    {
+        if (puerto == 0)
+        {
+            return false;
+        }
+        escucha = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        int activo = 1;
+        setsockopt(escucha, SOL_SOCKET, SO_REUSEADDR, &activo, sizeof(activo));
+        sockaddr_in direccionTcp;
+        std::memset(&direccionTcp, 0, sizeof(direccionTcp));
+        direccionTcp.sin_family = AF_INET;
+        direccionTcp.sin_port = htons((uint16_t)puerto);
+        direccionTcp.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (escucha < 0 || bind(escucha, (sockaddr *)&direccionTcp, sizeof(direccionTcp)) != 0)
+        {
+            cerrarTodo();
+            return false;
+        }
+    }
+    else
+    {
+        sockaddr_un direccionUnix;
+        if (direccion.empty() || direccion.size() >= sizeof(direccionUnix.sun_path))
+        {
+            return false;
+        }
+        escucha = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        std::memset(&direccionUnix, 0, sizeof(direccionUnix));
+        direccionUnix.sun_family = AF_UNIX;
+        std::memcpy(direccionUnix.sun_path, direccion.c_str(), direccion.size());
+        unlink(direccion.c_str());
+        if (escucha < 0 || bind(escucha, (sockaddr *)&direccionUnix, sizeof(direccionUnix)) != 0)
+        {
+            cerrarTodo();
+            return false;
+        }
+        rutaUnix = direccion;
+    }
+
+    epoll = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event evento;
+    evento.events = EPOLLIN;
+    evento.data.fd = escucha;
+    if (listen(escucha, SOMAXCONN) != 0 || epoll < 0 || epoll_ctl(epoll, EPOLL_CTL_ADD, escucha, &evento) != 0)
+    {
+        cerrarTodo();
+        return false;
+    }
+
+    avisoPistas = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    evento.events = EPOLLIN;
+    evento.data.fd = avisoPistas;
+    if (avisoPistas < 0 || epoll_ctl(epoll, EPOLL_CTL_ADD, avisoPistas, &evento) != 0)
+    {
+        cerrarTodo();
+        return false;
+    }
+    hiloPistas = std::thread(&ServidorJuego::bucleHiloPistas, this);
+    detenido = false;
+    return true;
+}
+
+/**
+ * Ejecuta el bucle de eventos
+ * @complexity O(E) donde E es el número de eventos atendidos
+ */
+void ServidorJuego::ejecutar()
+{
+    epoll_event eventos[MAX_EVENTOS];
+    while (epoll >= 0 && !detenido)
+    {
+        int numEventos = epoll_wait(epoll, eventos, MAX_EVENTOS, 100);
+        for (int i = 0; i < numEventos; i++)
+        {
+            int descriptor = eventos[i].data.fd;
+            if (descriptor == escucha)
+            {
+                aceptarConexiones();
+                continue;
+            }
+            if (descriptor == avisoPistas)
+            {
+                atenderPistas();
+                continue;
+            }
+
+            if (descriptor >= (int)sesiones.size() || !sesiones[descriptor])
+            {
+                continue;
+            }
+            if (!admiteOrdenes(*sesiones[descriptor]) && (eventos[i].events & (EPOLLHUP | EPOLLERR)))
+            {
+                cerrarConexion(descriptor); // El cliente se ha ido mientras la sesión no leía
+                continue;
+            }
+            if (eventos[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            {
+                leerConexion(descriptor);
+            }
+            if ((eventos[i].events & EPOLLOUT) && descriptor < (int)sesiones.size() && sesiones[descriptor])
+            {
+                enviarPendiente(descriptor);
+            }
+        }
+    }
+    cerrarTodo();
+}
+
+/**
+ * Acepta todas las conexiones en espera
+ * @complexity O(c) donde c es el número de conexiones en espera
+ */
+void ServidorJuego::aceptarConexiones()
+{
+    while (true)
+    {
+        int descriptor = accept4(escucha, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (descriptor < 0)
+        {
+            return;
+        }
+        if (rutaUnix.empty())
+        {
+            int activo = 1;
+            setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &activo, sizeof(activo));
+        }
+
+        epoll_event evento;
+        evento.events = EPOLLIN;
+        evento.data.fd = descriptor;
+        if (epoll_ctl(epoll, EPOLL_CTL_ADD, descriptor, &evento) != 0)
+        {
+            close(descriptor);
+            continue;
+        }
+        if (descriptor >= (int)sesiones.size())
+        {
+            sesiones.resize(descriptor + 1);
+        }
+        sesiones[descriptor].reset(new SesionServidor());
+        sesiones[descriptor]->numero = ++numConexiones;
+        sesiones[descriptor]->eventos = EPOLLIN;
+        numSesiones++;
+    }
+}
+
+/**
+ * Lee las órdenes disponibles de una conexión, hasta MAX_LECTURA bytes, y
+ * envía sus respuestas
+ * @param descriptor - Socket de la conexión
+ * @complexity O(b) donde b es el número de bytes leídos, más el coste de las órdenes
+ */
+void ServidorJuego::leerConexion(int descriptor)
+{
+    SesionServidor &sesion = *sesiones[descriptor];
+    char bufer[4096];
+    bool cerrar = false;
+    size_t total = 0;
+
+    // Lo que quede en el socket vuelve a avisar en la siguiente vuelta, porque epoll va por nivel
+    while (!cerrar && admiteOrdenes(sesion) && total < MAX_LECTURA)
+    {
+        ssize_t leidos = recv(descriptor, bufer, sizeof(bufer), 0);
+        if (leidos <= 0)
+        {
+            cerrar = leidos == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+            if (!cerrar && errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        total += (size_t)leidos;
+        cerrar = !consumirEntrada(descriptor, bufer, (size_t)leidos);
+    }
+
+    enviarPendiente(descriptor);
+    if (cerrar && descriptor < (int)sesiones.size() && sesiones[descriptor])
+    {
+        cerrarConexion(descriptor);
+    }
+}
+
+/**
+ * Calcula las pistas pedidas hasta que se pide salir
+ */
+void ServidorJuego::bucleHiloPistas()
+{
+    std::unique_lock<std::mutex> bloqueo(cerrojoPistas);
+    while (true)
+    {
+        avisoHiloPistas.wait(bloqueo, [this]() { return salirPistas || !pistasPedidas.empty(); });
+        if (salirPistas)
+        {
+            return;
+        }
+        PeticionPista pista = std::move(pistasPedidas.front());
+        pistasPedidas.pop_front();
+        bloqueo.unlock();
+
+        pista.respuesta = calcularPista(pista.tablero, pista.maxNodos, &cancelarPistas);
+
+        bloqueo.lock();
+        pistasCalculadas.push_back(std::move(pista));
+        uint64_t uno = 1;
+        if (write(avisoPistas, &uno, sizeof(uno)) < 0)
+        {
+            // El contador ya tiene avisos sin leer, así que el bucle despertará igualmente
+        }
+    }
+}
+
+/**
+ * Envía las pistas calculadas y atiende las órdenes retenidas tras ellas
+ * @complexity O(p) donde p es el número de pistas, más el coste de las órdenes retenidas
+ */
+void ServidorJuego::atenderPistas()
+{
+    uint64_t avisos;
+    if (read(avisoPistas, &avisos, sizeof(avisos)) < 0)
+    {
+        return; // Otro evento ya vació el contador
+    }
+    std::vector<PeticionPista> calculadas;
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojoPistas);
+        calculadas.swap(pistasCalculadas);
+    }
+
+    for (const PeticionPista &pista : calculadas)
+    {
+        int descriptor = pista.descriptor;
+        if (descriptor >= (int)sesiones.size() || !sesiones[descriptor] || sesiones[descriptor]->numero != pista.numero)
+        {
+            continue; // La conexión se cerró mientras se calculaba la pista
+        }
+        SesionServidor &sesion = *sesiones[descriptor];
+        sesion.pendiente += pista.respuesta;
+        sesion.pendiente += '\n';
+        ordenesAtendidas++;
+        sesion.esperandoPista = false;
+        enviarPendiente(descriptor);
+    }
+}
+
+/**
+ * Envía las respuestas pendientes de una conexión y, si la sesión vuelve a
+ * admitir órdenes, atiende las que tenía retenidas
+ * @param descriptor - Socket de la conexión
+ * @complexity O(p) donde p es el número de bytes pendientes, más el coste de
+ *             las órdenes retenidas
+ */
+void ServidorJuego::enviarPendiente(int descriptor)
+{
+    SesionServidor &sesion = *sesiones[descriptor];
+    bool cerrar = false;
+    while (true)
+    {
+        size_t enviados = 0;
+        while (enviados < sesion.pendiente.size())
+        {
+            ssize_t escritos = send(descriptor, sesion.pendiente.data() + enviados,
+                                    sesion.pendiente.size() - enviados, MSG_NOSIGNAL);
+            if (escritos < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    cerrarConexion(descriptor);
+                    return;
+                }
+                break;
+            }
+            enviados += (size_t)escritos;
+        }
+        sesion.pendiente.erase(0, enviados);
+
+        if (cerrar || sesion.retenida.empty() || !admiteOrdenes(sesion))
+        {
+            break;
+        }
+        std::string retenida;
+        retenida.swap(sesion.retenida);
+        cerrar = !consumirEntrada(descriptor, retenida.data(), retenida.size());
+    }
+
+    if (cerrar)
+    {
+        cerrarConexion(descriptor); // Tras intentar enviar la respuesta de las órdenes anteriores a Q
+        return;
+    }
+    if (sesion.pendiente.empty() && sesion.pendiente.capacity() > 256)
+    {
+        std::string().swap(sesion.pendiente); // Devolver la memoria tras una ráfaga
+    }
+    actualizarEventos(descriptor);
+}
+
+/**
+ * Registra los eventos que interesan de una conexión: lectura si admite órdenes
+ * y escritura si tiene respuestas pendientes
+ * @param descriptor - Socket de la conexión
+ * @complexity O(1)
+ */
+void ServidorJuego::actualizarEventos(int descriptor)
+{
+    SesionServidor &sesion = *sesiones[descriptor];
+    uint32_t eventos = 0;
+    if (admiteOrdenes(sesion))
+    {
+        eventos |= EPOLLIN;
+    }
+    if (!sesion.pendiente.empty())
+    {
+        eventos |= EPOLLOUT;
+    }
+    if (eventos != sesion.eventos)
+    {
+        epoll_event evento;
+        evento.events = eventos;
+        evento.data.fd = descriptor;
+        epoll_ctl(epoll, EPOLL_CTL_MOD, descriptor, &evento);
+        sesion.eventos = eventos;
+    }
+}
+
+/**
+ * Cierra una conexión y libera su sesión
+ * @param descriptor - Socket de la conexión
+ * @complexity O(1)
+ */
+void ServidorJuego::cerrarConexion(int descriptor)
+{
+    epoll_ctl(epoll, EPOLL_CTL_DEL, descriptor, nullptr);
+    close(descriptor);
+    sesiones[descriptor].reset();
+    numSesiones--;
+}
+
+/**
+ * Cierra todas las conexiones y el socket de escucha
+ * @complexity O(c) donde c es el número de conexiones
+ */
+void ServidorJuego::cerrarTodo()
+{
+    for (size_t descriptor = 0; descriptor < sesiones.size(); descriptor++)
+    {
+        if (sesiones[descriptor])
+        {
+            cerrarConexion((int)descriptor);
+        }
+    }
+    sesiones.clear();
+    if (hiloPistas.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> bloqueo(cerrojoPistas);
+            salirPistas = true;
+            cancelarPistas = true;
+        }
+        avisoHiloPistas.notify_all();
+        hiloPistas.join();
+        pistasPedidas.clear();
+        pistasCalculadas.clear();
+        salirPistas = false;
+        cancelarPistas = false;
+    }
+    if (avisoPistas >= 0)
+    {
+        close(avisoPistas);
+        avisoPistas = -1;
+    }
+    if (escucha >= 0)
+    {
+        close(escucha);
+        escucha = -1;
+    }
+    if (epoll >= 0)
+    {
+        close(epoll);
+        epoll = -1;
+    }
+    if (!rutaUnix.empty())
+    {
+        unlink(rutaUnix.c_str());
+        rutaUnix.clear();
+    }
+}
+
+#else
+
+/**
+ * Empieza a escuchar conexiones (no disponible fuera de Linux)
+ * @param direccion - Puerto TCP o ruta del socket Unix
+ * @return bool - Siempre false
+ * @complexity O(1)
+ */
+bool ServidorJuego::escuchar(const std::string &direccion)
+{
+    (void)direccion;
+    return false;
+}
+
+/**
+ * Ejecuta el bucle de eventos (no disponible fuera de Linux)
+ * @complexity O(1)
+ */
+void ServidorJuego::ejecutar()
+{
+}
+
+void ServidorJuego::aceptarConexiones()
+{
+}
+
+void ServidorJuego::leerConexion(int descriptor)
+{
+    (void)descriptor;
+}
+
+void ServidorJuego::bucleHiloPistas()
+{
+}
+
+void ServidorJuego::atenderPistas()
+{
+}
+
+void ServidorJuego::enviarPendiente(int descriptor)
+{
+    (void)descriptor;
+}
+
+void ServidorJuego::actualizarEventos(int descriptor)
+{
+    (void)descriptor;
+}
+
+void ServidorJuego::cerrarConexion(int descriptor)
+{
+    (void)descriptor;
+}
+
+void ServidorJuego::cerrarTodo()
+{
+}
+
+#endif
+
+/**
+ * Pide que el bucle de eventos termine
+ * @complexity O(1)
+ */
+void ServidorJuego::detener()
+{
+    detenido = true;
+}
+
+/**
+ * Obtiene el número de conexiones abiertas
+ * @return long long - Conexiones abiertas
+ * @complexity O(1)
+ */
+long long ServidorJuego::getNumSesiones() const
+{
+    return numSesiones;
+}
+
+/**
+ * Obtiene el número de órdenes atendidas
+ * @return long long - Órdenes procesadas desde el inicio
+ * @complexity O(1)
+ */
+long long ServidorJuego::getOrdenesAtendidas() const
+{
+    return ordenesAtendidas;
+}
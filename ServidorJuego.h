@@ -0,0 +1,232 @@
+/**
+ * @file ServidorJuego.h
+ * @brief TAD ServidorJuego para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) ServidorJuego, que
+ * aloja muchas partidas simultáneas (una por conexión) en un único hilo con un
+ * bucle de eventos epoll. Escucha en un socket de dominio Unix o en un puerto
+ * TCP de localhost y usa un protocolo de líneas de texto; cada orden recibe
+ * exactamente una línea de respuesta:
+ *
+ * - "L id": carga el nivel registrado con ese identificador
+ * - "M origen destino": realiza un movimiento (tubos numerados desde 1)
+ * - "U": deshace el último movimiento
+ * - "H": pide una pista (el primer movimiento de una solución óptima)
+ * - "S": pide el estado de la partida
+ * - "Q": cierra la conexión (sin respuesta)
+ *
+ * Las respuestas empiezan por "OK", "FIN" (el movimiento resuelve el nivel),
+ * "PISTA", "ESTADO" o "ERR". El estado de los tubos se escribe con sus bolas de
+ * abajo arriba, separados por '.', y '-' para los tubos vacíos.
+ *
+ * Cada sesión guarda su Juego, el nivel cargado y el historial de movimientos
+ * (un byte por movimiento), por lo que ocupa unos pocos cientos de bytes. Las
+ * pistas se calculan en un hilo aparte para no detener al resto de sesiones;
+ * mientras tanto la sesión que la pidió no atiende más órdenes, de modo que
+ * las respuestas siguen llegando en orden. Tampoco se leen órdenes de un
+ * cliente que no lee sus respuestas. El bucle de eventos solo está
+ * disponible en Linux; en otros sistemas escuchar() devuelve false, pero el
+ * protocolo se puede usar con procesarLinea(), que calcula las pistas en el
+ * momento.
+ */
+
+#ifndef SERVIDOR_JUEGO_H
+#define SERVIDOR_JUEGO_H
+
+#include "Juego.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Estado de una conexión con el servidor
+ */
+struct SesionServidor
+{
+    static const int TAM_LINEA = 64; // Longitud máxima de una orden
+
+    Juego juego;                    // Partida de la sesión
+    int nivel;                      // Índice del nivel cargado (-1 = ninguno)
+    std::vector<uint8_t> historial; // Movimientos realizados (origen << 4 | destino)
+    char entrada[TAM_LINEA];        // Orden recibida en parte
+    int tamEntrada;                 // Caracteres de la orden recibida en parte
+    bool descartando;               // La orden actual es demasiado larga y se ignora
+    std::string pendiente;          // Respuestas que el socket aún no ha aceptado
+    unsigned long long numero;      // Número de la conexión, para descartar pistas de conexiones ya cerradas
+    bool esperandoPista;            // Hay una pista en cálculo y no se atienden más órdenes
+    std::string retenida;           // Bytes recibidos que se atienden cuando la sesión vuelve a admitir órdenes
+    uint32_t eventos;               // Eventos de epoll registrados para la conexión
+
+    SesionServidor();
+};
+
+/**
+ * @brief Pista pedida al hilo de pistas, con su respuesta una vez calculada
+ */
+struct PeticionPista
+{
+    int descriptor;            // Socket de la conexión
+    unsigned long long numero; // Número de la conexión
+    long long maxNodos;        // Nodos máximos del resolutor
+    Tablero tablero;           // Posición de la partida al pedir la pista
+    std::string respuesta;     // Respuesta de la orden H
+};
+
+/**
+ * @brief TAD ServidorJuego con partidas simultáneas sobre epoll
+ */
+class ServidorJuego
+{
+private:
+    std::unordered_map<std::string, int> indices; // Posición de cada nivel en niveles
+    std::vector<Tablero> niveles;                  // Tablero de partida de cada nivel
+    long long maxNodosPista;                       // Nodos máximos del resolutor de pistas
+
+    int escucha;                                           // Socket de escucha (-1 = ninguno)
+    int epoll;                                             // Descriptor de epoll (-1 = ninguno)
+    std::string rutaUnix;                                  // Ruta del socket Unix, para borrarla al cerrar
+    std::vector<std::unique_ptr<SesionServidor>> sesiones; // Sesión de cada descriptor
+    std::atomic<bool> detenido;                            // Pide al bucle de eventos que termine
+    long long numSesiones;                                 // Conexiones abiertas
+    long long ordenesAtendidas;                            // Órdenes procesadas desde el inicio
+    unsigned long long numConexiones;                      // Conexiones aceptadas desde el inicio
+
+    int avisoPistas;                             // eventfd que despierta al bucle con pistas calculadas (-1 = ninguno)
+    std::thread hiloPistas;                      // Hilo que calcula las pistas
+    std::mutex cerrojoPistas;                    // Protege las dos colas de pistas y salirPistas
+    std::condition_variable avisoHiloPistas;     // Despierta al hilo de pistas
+    std::deque<PeticionPista> pistasPedidas;     // Pistas que el hilo aún no ha empezado
+    std::vector<PeticionPista> pistasCalculadas; // Pistas que el bucle aún no ha enviado
+    bool salirPistas;                            // Pide al hilo de pistas que termine
+    std::atomic<bool> cancelarPistas;            // Detiene la pista en curso al cerrar el servidor
+
+    void aceptarConexiones();
+    void leerConexion(int descriptor);
+    bool consumirEntrada(int descriptor, const char *datos, size_t tam);
+    bool pedirPista(int descriptor, SesionServidor &sesion, const std::string &linea);
+    void bucleHiloPistas();
+    void atenderPistas();
+    void enviarPendiente(int descriptor);
+    void actualizarEventos(int descriptor);
+    void cerrarConexion(int descriptor);
+    void cerrarTodo();
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea un servidor sin niveles que no escucha
+     * @complexity O(1)
+     */
+    ServidorJuego();
+
+    /**
+     * @brief Destructor
+     * @post Cierra todas las conexiones y el socket de escucha
+     */
+    ~ServidorJuego();
+
+    ServidorJuego(const ServidorJuego &) = delete;
+    ServidorJuego &operator=(const ServidorJuego &) = delete;
+
+    /**
+     * @brief Registra un nivel
+     * @pre No hay precondiciones
+     * @post Las órdenes "L id" cargan el tablero; si el identificador ya
+     *       existía se sustituye su tablero
+     * @param id - Identificador del nivel (sin espacios)
+     * @param tablero - Posición de partida del nivel
+     * @return bool - false si el identificador está vacío o contiene espacios
+     * @complexity O(1)
+     */
+    bool registrarNivel(const std::string &id, const Tablero &tablero);
+
+    /**
+     * @brief Fija el esfuerzo máximo de cada pista
+     * @pre maxNodos > 0
+     * @post Las pistas se rinden tras expandir maxNodos nodos del resolutor
+     * @param maxNodos - Nodos máximos
+     * @complexity O(1)
+     */
+    void setMaxNodosPista(long long maxNodos);
+
+    /**
+     * @brief Procesa una orden del protocolo
+     * @pre linea no contiene el salto de línea
+     * @post Se aplica la orden a la sesión y respuesta contiene su respuesta
+     *       (sin salto de línea)
+     * @param sesion - Sesión que envía la orden
+     * @param linea - Orden recibida
+     * @param respuesta - Respuesta a la orden
+     * @return bool - false si la sesión pide cerrar la conexión
+     * @complexity O(1) salvo U (O(m) con m movimientos) y H (búsqueda acotada)
+     */
+    bool procesarLinea(SesionServidor &sesion, const std::string &linea, std::string &respuesta) const;
+
+    /**
+     * @brief Empieza a escuchar conexiones
+     * @pre No hay precondiciones
+     * @post Si direccion es un número, escucha en ese puerto TCP de 127.0.0.1;
+     *       si no, en un socket de dominio Unix con esa ruta
+     * @param direccion - Puerto TCP o ruta del socket Unix
+     * @return bool - false si el puerto no está entre 1 y 65535, no se pudo abrir
+     *         el socket o el sistema no es Linux
+     * @complexity O(1)
+     */
+    bool escuchar(const std::string &direccion);
+
+    /**
+     * @brief Interpreta una dirección como puerto TCP, igual que escuchar()
+     * @pre No hay precondiciones
+     * @post Si direccion es un número, puerto es ese número si está entre 1 y
+     *       65535, o 0 si no lo está
+     * @param direccion - Puerto TCP o ruta del socket Unix
+     * @param puerto - Número de puerto
+     * @return bool - true si direccion es un número; false si es una ruta
+     * @complexity O(l) donde l es la longitud de la dirección
+     */
+    static bool leerPuerto(const std::string &direccion, int &puerto);
+
+    /**
+     * @brief Ejecuta el bucle de eventos
+     * @pre escuchar() ha tenido éxito
+     * @post Atiende conexiones hasta que se llama a detener(); después cierra
+     *       todas las conexiones y el socket de escucha
+     * @complexity O(E) donde E es el número de eventos atendidos
+     */
+    void ejecutar();
+
+    /**
+     * @brief Pide que el bucle de eventos termine
+     * @pre No hay precondiciones
+     * @post ejecutar() termina en menos de 100 ms; se puede llamar desde otro
+     *       hilo o desde un manejador de señales
+     * @complexity O(1)
+     */
+    void detener();
+
+    /**
+     * @brief Obtiene el número de conexiones abiertas
+     * @return long long - Conexiones abiertas
+     * @complexity O(1)
+     */
+    long long getNumSesiones() const;
+
+    /**
+     * @brief Obtiene el número de órdenes atendidas
+     * @return long long - Órdenes procesadas desde el inicio
+     * @complexity O(1)
+     */
+    long long getOrdenesAtendidas() const;
+};
+
+#endif // SERVIDOR_JUEGO_H
@@ -0,0 +1,267 @@
+/**
+ * @file ServidorJuegoPruebas.cpp
+ * @brief Pruebas para el TAD ServidorJuego del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD ServidorJuego
+ * (ServidorJuego.h/ServidorJuego.cpp). Primero se prueba el protocolo sobre
+ * una sesión sin sockets y después, en Linux, se juega una partida completa a
+ * través de un socket de dominio Unix con varias conexiones simultáneas.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "ServidorJuego.h"
+#include "Resolutor.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ServidorJuego.cpp"
+
+/**
+ * @brief Envía una orden a una sesión y devuelve la respuesta
+ * @param servidor - Servidor
+ * @param sesion - Sesión
+ * @param linea - Orden
+ * @return std::string - Respuesta
+ */
+std::string orden(const ServidorJuego &servidor, SesionServidor &sesion, const std::string &linea)
+{
+    std::string respuesta;
+    assert(servidor.procesarLinea(sesion, linea, respuesta));
+    return respuesta;
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Conecta con un socket de dominio Unix
+ * @param ruta - Ruta del socket
+ * @return int - Descriptor o -1
+ */
+int conectarUnix(const std::string &ruta)
+{
+    int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un destino;
+    std::memset(&destino, 0, sizeof(destino));
+    destino.sun_family = AF_UNIX;
+    std::strncpy(destino.sun_path, ruta.c_str(), sizeof(destino.sun_path) - 1);
+    if (connect(descriptor, (sockaddr *)&destino, sizeof(destino)) != 0)
+    {
+        close(descriptor);
+        return -1;
+    }
+    return descriptor;
+}
+
+/**
+ * @brief Envía órdenes por un socket y lee tantas líneas como órdenes
+ * @param descriptor - Socket conectado
+ * @param ordenes - Órdenes separadas por saltos de línea
+ * @param numLineas - Líneas de respuesta que se esperan
+ * @return std::vector<std::string> - Líneas recibidas
+ */
+std::vector<std::string> conversar(int descriptor, const std::string &ordenes, int numLineas)
+{
+    assert(send(descriptor, ordenes.data(), ordenes.size(), 0) == (ssize_t)ordenes.size());
+    std::vector<std::string> lineas;
+    std::string recibido;
+    char bufer[1024];
+    while ((int)lineas.size() < numLineas)
+    {
+        ssize_t leidos = recv(descriptor, bufer, sizeof(bufer), 0);
+        if (leidos <= 0)
+        {
+            break;
+        }
+        recibido.append(bufer, (size_t)leidos);
+        size_t salto;
+        while ((salto = recibido.find('\n')) != std::string::npos)
+        {
+            lineas.push_back(recibido.substr(0, salto));
+            recibido.erase(0, salto + 1);
+        }
+    }
+    return lineas;
+}
+
+#endif
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD ServidorJuego..." << std::endl;
+
+    Tablero ejemplo = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    ResultadoResolucion solucion = Resolutor().resolver(ejemplo);
+    assert(solucion.resuelto);
+
+    ServidorJuego servidor;
+    assert(servidor.registrarNivel("ejemplo", ejemplo));
+    assert(servidor.registrarNivel("pequeno", crearTablero(4, {"RRRG", "GGGR"})));
+    assert(!servidor.registrarNivel("con espacio", ejemplo));
+
+    // Prueba 1: Órdenes sin nivel y órdenes mal formadas
+    SesionServidor sesion;
+    assert(orden(servidor, sesion, "S") == "ERR sin nivel");
+    assert(orden(servidor, sesion, "M 1 5") == "ERR sin nivel");
+    assert(orden(servidor, sesion, "U") == "ERR nada que deshacer");
+    assert(orden(servidor, sesion, "H") == "ERR sin partida en curso");
+    assert(orden(servidor, sesion, "L otro") == "ERR nivel desconocido");
+    assert(orden(servidor, sesion, "") == "ERR orden vacía");
+    assert(orden(servidor, sesion, "X") == "ERR orden desconocida");
+    assert(orden(servidor, sesion, "M1 5") == "ERR orden desconocida");
+    assert(orden(servidor, sesion, "M 1") == "ERR formato: M origen destino");
+    assert(orden(servidor, sesion, "M 1 5 6") == "ERR formato: M origen destino");
+    std::string respuesta;
+    assert(!servidor.procesarLinea(sesion, "Q", respuesta));
+    std::cout << "Prueba 1 superada: Órdenes no válidas" << std::endl;
+
+    // Prueba 2: Carga, movimientos, deshacer y estado
+    assert(orden(servidor, sesion, "L ejemplo\r") == "OK 6");
+    assert(orden(servidor, sesion, "S") == "ESTADO 0 RBGY.GYRB.BYGR.RGBY.-.-");
+    assert(orden(servidor, sesion, "M 1 2") == "ERR movimiento no válido");
+    assert(orden(servidor, sesion, "M 99999999999999999999 5") == "ERR movimiento no válido");
+    assert(orden(servidor, sesion, "M 1 -2147483648") == "ERR movimiento no válido");
+    assert(orden(servidor, sesion, "M 1 5x") == "ERR formato: M origen destino");
+    assert(orden(servidor, sesion, "M 1 5") == "OK 1");
+    assert(orden(servidor, sesion, "  M 2 6 ") == "OK 2");
+    assert(orden(servidor, sesion, "S") == "ESTADO 2 RBG.GYR.BYGR.RGBY.Y.B");
+    assert(orden(servidor, sesion, "U") == "OK 1");
+    assert(orden(servidor, sesion, "S") == "ESTADO 1 RBG.GYRB.BYGR.RGBY.Y.-");
+    assert(orden(servidor, sesion, "U") == "OK 0");
+    assert(orden(servidor, sesion, "U") == "ERR nada que deshacer");
+    std::cout << "Prueba 2 superada: Movimientos, deshacer y estado" << std::endl;
+
+    // Prueba 3: Pistas y partida completa
+    assert(orden(servidor, sesion, "H").compare(0, 6, "PISTA ") == 0);
+    for (size_t i = 0; i < solucion.movimientos.size(); i++)
+    {
+        std::string linea = "M " + std::to_string(solucion.movimientos[i].origen + 1) + " " +
+                            std::to_string(solucion.movimientos[i].destino + 1);
+        std::string esperada = (i + 1 == solucion.movimientos.size() ? "FIN " : "OK ") + std::to_string(i + 1);
+        assert(orden(servidor, sesion, linea) == esperada);
+        if (i + 1 < solucion.movimientos.size())
+        {
+            std::string pista = orden(servidor, sesion, "H");
+            int origen, destino;
+            assert(std::sscanf(pista.c_str(), "PISTA %d %d", &origen, &destino) == 2);
+            assert(sesion.juego.getTablero().movimientoValido(origen - 1, destino - 1));
+        }
+    }
+    assert(orden(servidor, sesion, "H") == "ERR sin partida en curso");
+    assert(orden(servidor, sesion, "M 5 6") == "ERR movimiento no válido");
+    assert(orden(servidor, sesion, "L pequeno") == "OK 4");
+    assert(sesion.historial.empty() && sesion.juego.getNumMovimientos() == 0);
+    std::cout << "Prueba 3 superada: Pistas y partida completa (" << sizeof(SesionServidor) << " bytes por sesión)"
+              << std::endl;
+
+#ifdef __linux__
+    // Prueba 4: Partidas simultáneas a través de un socket Unix
+    assert(!servidor.escuchar("0") && !servidor.escuchar("65536"));
+    assert(!servidor.escuchar("99999999999999999999999"));
+    int puerto = -1;
+    assert(ServidorJuego::leerPuerto("8080", puerto) && puerto == 8080);
+    assert(ServidorJuego::leerPuerto("70000", puerto) && puerto == 0);
+    assert(!ServidorJuego::leerPuerto("/tmp/servidor.sock", puerto) && !ServidorJuego::leerPuerto("", puerto));
+    const std::string ruta = "servidor_pruebas.sock";
+    assert(servidor.escuchar(ruta));
+    std::thread bucle(&ServidorJuego::ejecutar, &servidor);
+
+    std::string partida = "L ejemplo\n";
+    for (const Movimiento &movimiento : solucion.movimientos)
+    {
+        partida += "M " + std::to_string(movimiento.origen + 1) + " " + std::to_string(movimiento.destino + 1) + "\n";
+    }
+    partida += "S\n";
+
+    std::vector<int> clientes;
+    for (int i = 0; i < 50; i++)
+    {
+        int descriptor = conectarUnix(ruta);
+        assert(descriptor >= 0);
+        clientes.push_back(descriptor);
+    }
+    for (int descriptor : clientes)
+    {
+        std::vector<std::string> lineas = conversar(descriptor, partida, (int)solucion.movimientos.size() + 2);
+        assert(lineas.size() == solucion.movimientos.size() + 2);
+        assert(lineas[0] == "OK 6");
+        assert(lineas[lineas.size() - 2] == "FIN " + std::to_string(solucion.movimientos.size()));
+        assert(lineas.back().compare(0, 7, "ESTADO ") == 0);
+    }
+
+    std::string larga = "L " + std::string(200, 'x') + "\nS\n";
+    std::vector<std::string> lineas = conversar(clientes[0], larga, 2);
+    assert(lineas.size() == 2 && lineas[0] == "ERR orden demasiado larga");
+    assert(lineas[1].compare(0, 7, "ESTADO ") == 0);
+
+    // Las órdenes que siguen a una pista esperan a que se calcule y responden en orden
+    lineas = conversar(clientes[2], "L ejemplo\nH\nS\nU\nH\n", 5);
+    assert(lineas.size() == 5 && lineas[0] == "OK 6");
+    assert(lineas[1].compare(0, 6, "PISTA ") == 0 && lineas[4] == lineas[1]);
+    assert(lineas[2].compare(0, 9, "ESTADO 0 ") == 0);
+    assert(lineas[3] == "ERR nada que deshacer");
+
+    // Un cliente que envía sin leer deja de leerse, pero el resto sigue jugando y no pierde respuestas
+    const int numRafaga = 20000;
+    std::string rafaga;
+    for (int i = 0; i < numRafaga; i++)
+    {
+        rafaga += "S\n";
+    }
+    std::thread emisor([&]() { assert(send(clientes[3], rafaga.data(), rafaga.size(), 0) == (ssize_t)rafaga.size()); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    lineas = conversar(clientes[4], "S\n", 1);
+    assert(lineas.size() == 1 && lineas[0].compare(0, 7, "ESTADO ") == 0);
+    lineas = conversar(clientes[3], "", numRafaga);
+    emisor.join();
+    assert(lineas.size() == (size_t)numRafaga && lineas.back() == lineas.front());
+
+    int cerrada = conectarUnix(ruta);
+    assert(cerrada >= 0);
+    assert(send(cerrada, "L ejemplo\nH\n", 12, 0) == 12);
+    close(cerrada); // La pista de una conexión cerrada se descarta
+
+    assert(send(clientes[1], "Q\n", 2, 0) == 2);
+    char byte;
+    assert(recv(clientes[1], &byte, 1, 0) == 0); // El servidor cierra la conexión
+    for (int descriptor : clientes)
+    {
+        close(descriptor);
+    }
+
+    servidor.detener();
+    bucle.join();
+    assert(servidor.getOrdenesAtendidas() >= 50 * (long long)(solucion.movimientos.size() + 2));
+    assert(servidor.getNumSesiones() == 0);
+    std::cout << "Prueba 4 superada: " << clientes.size() << " partidas simultáneas por socket Unix" << std::endl;
+#endif
+
+    std::cout << "¡Todas las pruebas del TAD ServidorJuego han sido superadas!" << std::endl;
+    return 0;
+}
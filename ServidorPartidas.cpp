@@ -0,0 +1,151 @@
+/**
+ * @file ServidorPartidas.cpp
+ * @brief Servidor de partidas simultáneas del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa carga los niveles indicados y atiende partidas con el TAD
+ * ServidorJuego en un socket de dominio Unix o en un puerto TCP de localhost,
+ * hasta que recibe Ctrl+C (SIGINT) o SIGTERM. El protocolo está descrito en
+ * ServidorJuego.h.
+ *
+ * Con --metricas archivo y el programa compilado con -DBALLSORT_INSTRUMENTACION,
+ * las métricas del TAD Instrumentacion se guardan en formato Prometheus cada
+ * --intervalo-metricas milisegundos (10000 por defecto) y al detenerse.
+ *
+ * Uso: ServidorPartidas <puerto | ruta.sock> --nivel id archivo.cnf... [--max-nodos-pista N]
+ *                       [--metricas archivo.prom] [--intervalo-metricas ms]
+ */
+
+#include "Juego.h"
+#include "ServidorJuego.h"
+#include "Instrumentacion.h"
+#include <csignal>
+#include <iostream>
+#include <string>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ServidorJuego.cpp"
+#include "Instrumentacion.cpp"
+
+// Servidor al que avisan los manejadores de señales
+static ServidorJuego *servidorActivo = nullptr;
+
+/**
+ * @brief Detiene el servidor al recibir una señal
+ * @param senal - Señal recibida
+ */
+void manejarSenal(int senal)
+{
+    (void)senal;
+    if (servidorActivo != nullptr)
+    {
+        servidorActivo->detener();
+    }
+}
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: ServidorPartidas <puerto | ruta.sock> --nivel id archivo.cnf... [--max-nodos-pista N]"
+              << std::endl;
+    std::cerr << "                        [--metricas archivo.prom] [--intervalo-metricas ms]" << std::endl;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string direccion = argv[1];
+    ServidorJuego servidor;
+    int numNiveles = 0;
+    std::string archivoMetricas;
+    int intervaloMetricas = 10000;
+    for (int i = 2; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--nivel" && i + 2 < argc)
+        {
+            std::string id = argv[++i];
+            std::string archivoNivel = argv[++i];
+            Juego juego;
+            if (!juego.inicializar(archivoNivel) || !servidor.registrarNivel(id, juego.getTablero()))
+            {
+                std::cerr << "Error: No se pudo cargar el nivel " << id << " de " << archivoNivel << std::endl;
+                return 1;
+            }
+            numNiveles++;
+        }
+        else if (opcion == "--max-nodos-pista" && i + 1 < argc)
+        {
+            servidor.setMaxNodosPista(std::max(1LL, std::stoll(argv[++i])));
+        }
+        else if (opcion == "--metricas" && i + 1 < argc)
+        {
+            archivoMetricas = argv[++i];
+        }
+        else if (opcion == "--intervalo-metricas" && i + 1 < argc)
+        {
+            intervaloMetricas = std::max(1, std::stoi(argv[++i]));
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+    if (numNiveles == 0)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    if (!servidor.escuchar(direccion))
+    {
+        std::cerr << "Error: No se pudo escuchar en " << direccion << std::endl;
+        return 1;
+    }
+
+    servidorActivo = &servidor;
+    std::signal(SIGINT, manejarSenal);
+    std::signal(SIGTERM, manejarSenal);
+    std::cout << "Escuchando en " << direccion << " con " << numNiveles << " niveles (" << sizeof(SesionServidor)
+              << " bytes por sesión)" << std::endl;
+
+    VolcadoInstrumentacion volcado;
+    if (!archivoMetricas.empty())
+    {
+        if (!Instrumentacion::ACTIVA)
+        {
+            std::cerr << "Aviso: El servidor se compiló sin -DBALLSORT_INSTRUMENTACION; las métricas están a cero"
+                      << std::endl;
+        }
+        volcado.iniciar(archivoMetricas, intervaloMetricas);
+    }
+
+    servidor.ejecutar();
+    volcado.detener();
+
+    std::cout << "Servidor detenido. Órdenes atendidas: " << servidor.getOrdenesAtendidas() << std::endl;
+    return 0;
+}
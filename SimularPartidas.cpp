@@ -0,0 +1,200 @@
+/**
+ * @file SimularPartidas.cpp
+ * @brief Herramienta de partidas simuladas del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa usa el TAD MotorMonteCarlo sobre un nivel en uno de tres modos:
+ * - resolver (por defecto): busca una solución con MCTS
+ * - pista: muestra la tasa de éxito de cada movimiento válido y el sugerido
+ * - rendimiento: mide las partidas simuladas por segundo en varios hilos
+ *
+ * Uso: SimularPartidas <nivel.cnf> [--pista | --rendimiento N] [--iteraciones N]
+ *                      [--semilla S] [--hilos N]
+ */
+
+#include "Juego.h"
+#include "MotorMonteCarlo.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "MotorMonteCarlo.cpp"
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: SimularPartidas <nivel.cnf> [--pista | --rendimiento N] [--iteraciones N]" << std::endl;
+    std::cerr << "                       [--semilla S] [--hilos N]" << std::endl;
+}
+
+/**
+ * @brief Mide las partidas simuladas por segundo
+ * @param tablero - Posición de partida de las partidas
+ * @param opciones - Opciones del motor
+ * @param partidasPorHilo - Partidas que juega cada hilo
+ * @param numHilos - Hilos de trabajo
+ */
+void medirRendimiento(const Tablero &tablero, const OpcionesMonteCarlo &opciones, long long partidasPorHilo,
+                      int numHilos)
+{
+    EstadoCompacto estado;
+    estado.desdeTablero(tablero);
+
+    std::vector<long long> movimientos(numHilos, 0);
+    std::vector<long long> exitos(numHilos, 0);
+    auto inicio = std::chrono::steady_clock::now();
+    std::vector<std::thread> hilos;
+    for (int h = 0; h < numHilos; h++)
+    {
+        hilos.emplace_back([&, h]()
+                           {
+                               OpcionesMonteCarlo propias = opciones;
+                               propias.semilla = opciones.semilla + h;
+                               MotorMonteCarlo motor(propias);
+                               for (long long i = 0; i < partidasPorHilo; i++)
+                               {
+                                   if (motor.jugarPartida(estado) >= 0)
+                                   {
+                                       exitos[h]++;
+                                   }
+                               }
+                               movimientos[h] = motor.getMovimientosJugados();
+                           });
+    }
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    long long totalMovimientos = 0;
+    long long totalExitos = 0;
+    for (int h = 0; h < numHilos; h++)
+    {
+        totalMovimientos += movimientos[h];
+        totalExitos += exitos[h];
+    }
+    long long totalPartidas = partidasPorHilo * numHilos;
+    std::cout << "Partidas: " << totalPartidas << " en " << numHilos << " hilos (" << segundos << " s)" << std::endl;
+    std::cout << "Partidas con éxito: " << totalExitos << std::endl;
+    std::cout << "Partidas por segundo: " << (long long)(totalPartidas / segundos) << " ("
+              << (long long)(totalPartidas / segundos / numHilos) << " por hilo)" << std::endl;
+    std::cout << "Movimientos por segundo: " << (long long)(totalMovimientos / segundos) << std::endl;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - Estado de salida del programa
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string nivel = argv[1];
+    OpcionesMonteCarlo opciones;
+    bool pista = false;
+    long long partidasRendimiento = 0;
+    int numHilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 2; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--pista")
+        {
+            pista = true;
+        }
+        else if (opcion == "--rendimiento" && i + 1 < argc)
+        {
+            partidasRendimiento = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--iteraciones" && i + 1 < argc)
+        {
+            opciones.iteracionesPorPaso = std::stoll(argv[++i]);
+        }
+        else if (opcion == "--semilla" && i + 1 < argc)
+        {
+            opciones.semilla = std::stoull(argv[++i]);
+        }
+        else if (opcion == "--hilos" && i + 1 < argc)
+        {
+            numHilos = std::max(1, std::stoi(argv[++i]));
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+
+    Juego juego;
+    if (!juego.inicializar(nivel))
+    {
+        std::cerr << "Error: No se pudo cargar el nivel " << nivel << std::endl;
+        return 1;
+    }
+
+    if (partidasRendimiento > 0)
+    {
+        medirRendimiento(juego.getTablero(), opciones, partidasRendimiento, numHilos);
+        return 0;
+    }
+
+    MotorMonteCarlo motor(opciones);
+    if (pista)
+    {
+        std::vector<EvaluacionMovimiento> evaluaciones = motor.evaluarMovimientos(juego.getTablero(), 200);
+        std::cout << "Movimiento  Éxito   Longitud media" << std::endl;
+        for (const EvaluacionMovimiento &evaluacion : evaluaciones)
+        {
+            std::cout << std::setw(4) << evaluacion.movimiento.origen + 1 << " " << std::setw(2)
+                      << evaluacion.movimiento.destino + 1 << "    " << std::fixed << std::setprecision(3)
+                      << evaluacion.tasaExito << "   " << std::setprecision(1) << evaluacion.longitudMedia
+                      << std::endl;
+        }
+        Movimiento sugerido;
+        if (motor.sugerirMovimiento(juego.getTablero(), sugerido))
+        {
+            std::cout << "Movimiento sugerido: " << sugerido.origen + 1 << " " << sugerido.destino + 1 << std::endl;
+        }
+        return 0;
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    ResultadoResolucion resultado = motor.resolver(juego.getTablero());
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << "Iteraciones del árbol: " << resultado.nodosExpandidos << std::endl;
+    std::cout << "Partidas simuladas: " << resultado.nodosGenerados << std::endl;
+    std::cout << "Tiempo: " << segundos << " s" << std::endl;
+    if (!resultado.resuelto)
+    {
+        std::cout << "No se encontró solución." << std::endl;
+        return 2;
+    }
+
+    std::cout << "Solución en " << resultado.movimientos.size() << " movimientos:" << std::endl;
+    for (const Movimiento &movimiento : resultado.movimientos)
+    {
+        std::cout << movimiento.origen + 1 << " " << movimiento.destino + 1 << std::endl;
+    }
+    return 0;
+}
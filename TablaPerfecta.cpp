@@ -0,0 +1,397 @@
+/**
+ * @file TablaPerfecta.cpp
+ * @brief Implementación del TAD TablaPerfecta para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD TablaPerfecta
+ * (TablaPerfecta.h). La construcción reparte las claves en n / 4 cubetas y,
+ * de mayor a menor cubeta, busca la primera semilla que coloca todas sus claves
+ * en huecos libres y distintos de una tabla con un 25 % de holgura. El bloque
+ * tiene el formato:
+ *
+ *   Cabecera | semillas (uint32 por cubeta, alineadas a 8) | claves | valores
+ *
+ * Los huecos vacíos tienen una clave sin pilas, que nunca coincide con un
+ * estado real.
+ */
+
+#include "TablaPerfecta.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char MAGIA_TABLA[4] = {'B', 'S', 'P', 'H'};
+static const uint32_t VERSION_TABLA = 1;
+static const uint32_t MAX_SEMILLA = 1u << 24; // Intentos máximos por cubeta
+
+/**
+ * Mezcla el hash de una clave con una semilla
+ */
+static uint64_t mezclarSemilla(uint64_t hash, uint64_t semilla)
+{
+    uint64_t h = hash + semilla * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+TablaPerfecta::TablaPerfecta()
+{
+    proyeccion = nullptr;
+    tamProyeccion = 0;
+#ifdef _WIN32
+    manejadorArchivo = nullptr;
+    manejadorProyeccion = nullptr;
+#endif
+    cabecera = nullptr;
+    semillas = nullptr;
+    claves = nullptr;
+    valores = nullptr;
+}
+
+TablaPerfecta::~TablaPerfecta()
+{
+    liberar();
+}
+
+/**
+ * Calcula el tamaño en bytes del bloque de una tabla
+ */
+size_t TablaPerfecta::tamBloque(uint64_t numHuecos, uint64_t numCubetas)
+{
+    size_t tamSemillas = (size_t)((numCubetas * sizeof(uint32_t) + 7) / 8 * 8);
+    return sizeof(Cabecera) + tamSemillas + (size_t)numHuecos * (sizeof(EstadoCompacto) + 1);
+}
+
+/**
+ * Apunta los campos de la tabla a las secciones de un bloque
+ * @return bool - true si el bloque tiene un formato válido
+ */
+bool TablaPerfecta::enlazar(const void *bloque, size_t tam)
+{
+    if (tam < sizeof(Cabecera))
+    {
+        return false;
+    }
+
+    const Cabecera *c = static_cast<const Cabecera *>(bloque);
+    if (std::memcmp(c->magia, MAGIA_TABLA, 4) != 0 || c->version != VERSION_TABLA ||
+        c->numHuecos == 0 || c->numCubetas == 0 || tam != tamBloque(c->numHuecos, c->numCubetas))
+    {
+        return false;
+    }
+
+    const unsigned char *bytes = static_cast<const unsigned char *>(bloque);
+    size_t tamSemillas = (size_t)((c->numCubetas * sizeof(uint32_t) + 7) / 8 * 8);
+    cabecera = c;
+    semillas = reinterpret_cast<const uint32_t *>(bytes + sizeof(Cabecera));
+    claves = reinterpret_cast<const EstadoCompacto *>(bytes + sizeof(Cabecera) + tamSemillas);
+    valores = bytes + sizeof(Cabecera) + tamSemillas + (size_t)c->numHuecos * sizeof(EstadoCompacto);
+    return true;
+}
+
+/**
+ * Libera la memoria propia o la proyección del archivo
+ */
+void TablaPerfecta::liberar()
+{
+    if (proyeccion != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(proyeccion);
+        CloseHandle((HANDLE)manejadorProyeccion);
+        CloseHandle((HANDLE)manejadorArchivo);
+        manejadorProyeccion = nullptr;
+        manejadorArchivo = nullptr;
+#else
+        munmap(proyeccion, tamProyeccion);
+#endif
+        proyeccion = nullptr;
+        tamProyeccion = 0;
+    }
+    memoriaPropia.clear();
+    memoriaPropia.shrink_to_fit();
+    cabecera = nullptr;
+    semillas = nullptr;
+    claves = nullptr;
+    valores = nullptr;
+}
+
+/**
+ * Construye la tabla en memoria
+ * @param entradas - Pares (clave, valor) a almacenar
+ * @param metadatos - Enteros que se guardan en la cabecera
+ * @return bool - true si se encontró una función hash perfecta
+ * @complexity O(n) esperado, donde n es el número de entradas
+ */
+bool TablaPerfecta::construir(const std::vector<std::pair<EstadoCompacto, uint8_t>> &entradas,
+                              const uint32_t metadatos[NUM_METADATOS])
+{
+    liberar();
+
+    uint64_t numClaves = entradas.size();
+    uint64_t numCubetas = std::max((uint64_t)1, numClaves / 4);
+    uint64_t numHuecos = numClaves + numClaves / 4 + 1;
+
+    // Repartir las claves en cubetas
+    std::vector<uint64_t> hashes(numClaves);
+    std::vector<std::vector<uint32_t>> cubetas(numCubetas);
+    for (uint64_t i = 0; i < numClaves; i++)
+    {
+        hashes[i] = entradas[i].first.hash();
+        cubetas[mezclarSemilla(hashes[i], 0) % numCubetas].push_back((uint32_t)i);
+    }
+
+    std::vector<uint32_t> orden(numCubetas);
+    for (uint64_t b = 0; b < numCubetas; b++)
+    {
+        orden[b] = (uint32_t)b;
+    }
+    std::sort(orden.begin(), orden.end(), [&cubetas](uint32_t a, uint32_t b)
+              { return cubetas[a].size() > cubetas[b].size(); });
+
+    // Buscar la semilla de cada cubeta, empezando por las más grandes
+    std::vector<uint32_t> semillasCubeta(numCubetas, 0);
+    std::vector<int64_t> hueco(numHuecos, -1); // Entrada asignada a cada hueco
+    std::vector<uint64_t> posiciones;
+    for (uint32_t b : orden)
+    {
+        const std::vector<uint32_t> &cubeta = cubetas[b];
+        if (cubeta.empty())
+        {
+            break;
+        }
+
+        bool encontrada = false;
+        for (uint32_t semilla = 1; semilla < MAX_SEMILLA && !encontrada; semilla++)
+        {
+            posiciones.clear();
+            encontrada = true;
+            for (uint32_t i : cubeta)
+            {
+                uint64_t p = mezclarSemilla(hashes[i], semilla) % numHuecos;
+                if (hueco[p] != -1 || std::find(posiciones.begin(), posiciones.end(), p) != posiciones.end())
+                {
+                    encontrada = false;
+                    break;
+                }
+                posiciones.push_back(p);
+            }
+
+            if (encontrada)
+            {
+                semillasCubeta[b] = semilla;
+                for (size_t k = 0; k < cubeta.size(); k++)
+                {
+                    hueco[posiciones[k]] = cubeta[k];
+                }
+            }
+        }
+
+        if (!encontrada)
+        {
+            return false;
+        }
+    }
+
+    // Volcar el bloque: cabecera, semillas, claves y valores
+    size_t tam = tamBloque(numHuecos, numCubetas);
+    memoriaPropia.assign((tam + 7) / 8, 0);
+    unsigned char *bytes = reinterpret_cast<unsigned char *>(memoriaPropia.data());
+
+    Cabecera c;
+    std::memset(&c, 0, sizeof(c));
+    std::memcpy(c.magia, MAGIA_TABLA, 4);
+    c.version = VERSION_TABLA;
+    c.numClaves = numClaves;
+    c.numHuecos = numHuecos;
+    c.numCubetas = numCubetas;
+    for (int i = 0; i < NUM_METADATOS; i++)
+    {
+        c.metadatos[i] = metadatos[i];
+    }
+    std::memcpy(bytes, &c, sizeof(c));
+
+    size_t tamSemillas = (size_t)((numCubetas * sizeof(uint32_t) + 7) / 8 * 8);
+    std::memcpy(bytes + sizeof(Cabecera), semillasCubeta.data(), numCubetas * sizeof(uint32_t));
+
+    EstadoCompacto *destinoClaves = reinterpret_cast<EstadoCompacto *>(bytes + sizeof(Cabecera) + tamSemillas);
+    uint8_t *destinoValores = bytes + sizeof(Cabecera) + tamSemillas + (size_t)numHuecos * sizeof(EstadoCompacto);
+    for (uint64_t p = 0; p < numHuecos; p++)
+    {
+        if (hueco[p] == -1)
+        {
+            destinoClaves[p] = EstadoCompacto();
+            destinoValores[p] = 0;
+        }
+        else
+        {
+            destinoClaves[p] = entradas[hueco[p]].first;
+            destinoValores[p] = entradas[hueco[p]].second;
+        }
+    }
+
+    return enlazar(bytes, tam);
+}
+
+/**
+ * Guarda la tabla en un archivo
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si se pudo escribir
+ * @complexity O(n)
+ */
+bool TablaPerfecta::guardar(const std::string &nombreArchivo) const
+{
+    if (!estaLista())
+    {
+        return false;
+    }
+
+    std::ofstream archivo(nombreArchivo, std::ios::binary | std::ios::trunc);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+    archivo.write(reinterpret_cast<const char *>(cabecera), tamBloque(cabecera->numHuecos, cabecera->numCubetas));
+    return archivo.good();
+}
+
+/**
+ * Carga una tabla proyectando el archivo en memoria
+ * @param nombreArchivo - Ruta del archivo
+ * @return bool - true si el archivo es una tabla válida
+ * @complexity O(1) (las páginas se cargan bajo demanda)
+ */
+bool TablaPerfecta::cargar(const std::string &nombreArchivo)
+{
+    liberar();
+
+#ifdef _WIN32
+    HANDLE archivo = CreateFileA(nombreArchivo.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (archivo == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER tam;
+    if (!GetFileSizeEx(archivo, &tam) || tam.QuadPart == 0)
+    {
+        CloseHandle(archivo);
+        return false;
+    }
+    HANDLE mapa = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapa == nullptr)
+    {
+        CloseHandle(archivo);
+        return false;
+    }
+    proyeccion = MapViewOfFile(mapa, FILE_MAP_READ, 0, 0, 0);
+    if (proyeccion == nullptr)
+    {
+        CloseHandle(mapa);
+        CloseHandle(archivo);
+        return false;
+    }
+    manejadorArchivo = archivo;
+    manejadorProyeccion = mapa;
+    tamProyeccion = (size_t)tam.QuadPart;
+#else
+    int descriptor = open(nombreArchivo.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || info.st_size == 0)
+    {
+        close(descriptor);
+        return false;
+    }
+    void *direccion = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (direccion == MAP_FAILED)
+    {
+        return false;
+    }
+    proyeccion = direccion;
+    tamProyeccion = (size_t)info.st_size;
+#endif
+
+    if (!enlazar(proyeccion, tamProyeccion))
+    {
+        liberar();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Busca el valor asociado a una clave
+ * @param clave - Estado a buscar
+ * @return int - Valor asociado o -1 si la clave no está en la tabla
+ * @complexity O(1)
+ */
+int TablaPerfecta::buscar(const EstadoCompacto &clave) const
+{
+    if (cabecera == nullptr)
+    {
+        return -1;
+    }
+
+    uint64_t hash = clave.hash();
+    uint32_t semilla = semillas[mezclarSemilla(hash, 0) % cabecera->numCubetas];
+    uint64_t p = mezclarSemilla(hash, semilla) % cabecera->numHuecos;
+    if (claves[p] == clave)
+    {
+        return valores[p];
+    }
+    return -1;
+}
+
+/**
+ * Comprueba si la tabla está construida o cargada
+ * @return bool - true si la tabla admite consultas
+ * @complexity O(1)
+ */
+bool TablaPerfecta::estaLista() const
+{
+    return cabecera != nullptr;
+}
+
+/**
+ * Obtiene el número de claves de la tabla
+ * @return uint64_t - Número de claves
+ * @complexity O(1)
+ */
+uint64_t TablaPerfecta::getNumClaves() const
+{
+    return cabecera != nullptr ? cabecera->numClaves : 0;
+}
+
+/**
+ * Obtiene un metadato de la cabecera
+ * @param indice - Índice del metadato
+ * @return uint32_t - Valor del metadato
+ * @complexity O(1)
+ */
+uint32_t TablaPerfecta::getMetadato(int indice) const
+{
+    return cabecera->metadatos[indice];
+}
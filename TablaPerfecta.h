@@ -0,0 +1,138 @@
+/**
+ * @file TablaPerfecta.h
+ * @brief TAD TablaPerfecta para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) TablaPerfecta, una tabla
+ * de solo lectura que asocia estados compactos con valores de un byte mediante
+ * una función hash perfecta (método de "hash y desplazamiento"): las claves se
+ * reparten en cubetas y para cada cubeta se guarda una semilla que envía todas
+ * sus claves a huecos distintos. Una consulta cuesta dos funciones hash y una
+ * comparación, sin sondeos.
+ *
+ * La tabla completa es un único bloque de memoria contiguo (cabecera, semillas,
+ * claves y valores), de modo que se guarda en disco tal cual y se carga
+ * proyectando el archivo en memoria (mmap) sin copiarlo ni reconstruirlo.
+ */
+
+#ifndef TABLA_PERFECTA_H
+#define TABLA_PERFECTA_H
+
+#include "EstadoCompacto.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief TAD TablaPerfecta de estados compactos a valores de un byte
+ */
+class TablaPerfecta
+{
+public:
+    static const int NUM_METADATOS = 4; // Enteros libres para el usuario de la tabla
+
+private:
+    /**
+     * @brief Cabecera del bloque de la tabla (también es la cabecera del archivo)
+     */
+    struct Cabecera
+    {
+        char magia[4];
+        uint32_t version;
+        uint64_t numClaves;
+        uint64_t numHuecos;
+        uint64_t numCubetas;
+        uint32_t metadatos[NUM_METADATOS];
+    };
+
+    std::vector<uint64_t> memoriaPropia; // Bloque de la tabla cuando se construye en memoria
+    void *proyeccion;                    // Archivo proyectado cuando se carga de disco
+    size_t tamProyeccion;
+#ifdef _WIN32
+    void *manejadorArchivo;
+    void *manejadorProyeccion;
+#endif
+
+    const Cabecera *cabecera;
+    const uint32_t *semillas;
+    const EstadoCompacto *claves;
+    const uint8_t *valores;
+
+    static size_t tamBloque(uint64_t numHuecos, uint64_t numCubetas);
+    bool enlazar(const void *bloque, size_t tam);
+    void liberar();
+
+public:
+    TablaPerfecta();
+    ~TablaPerfecta();
+    TablaPerfecta(const TablaPerfecta &) = delete;
+    TablaPerfecta &operator=(const TablaPerfecta &) = delete;
+
+    /**
+     * @brief Construye la tabla en memoria
+     * @pre Las claves de las entradas son distintas
+     * @post La tabla contiene exactamente las entradas indicadas
+     * @param entradas - Pares (clave, valor) a almacenar
+     * @param metadatos - NUM_METADATOS enteros que se guardan en la cabecera
+     * @return bool - true si se encontró una función hash perfecta
+     * @complexity O(n) esperado, donde n es el número de entradas
+     */
+    bool construir(const std::vector<std::pair<EstadoCompacto, uint8_t>> &entradas,
+                   const uint32_t metadatos[NUM_METADATOS]);
+
+    /**
+     * @brief Guarda la tabla en un archivo
+     * @pre La tabla está construida o cargada
+     * @post El archivo contiene el bloque de la tabla
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si se pudo escribir
+     * @complexity O(n)
+     */
+    bool guardar(const std::string &nombreArchivo) const;
+
+    /**
+     * @brief Carga una tabla proyectando el archivo en memoria
+     * @pre No hay precondiciones
+     * @post La tabla queda disponible para consultas sin copiar el archivo
+     * @param nombreArchivo - Ruta del archivo
+     * @return bool - true si el archivo es una tabla válida
+     * @complexity O(1) (las páginas se cargan bajo demanda)
+     */
+    bool cargar(const std::string &nombreArchivo);
+
+    /**
+     * @brief Busca el valor asociado a una clave
+     * @pre No hay precondiciones
+     * @post Devuelve el valor o -1 si la clave no está en la tabla
+     * @param clave - Estado a buscar
+     * @return int - Valor asociado o -1
+     * @complexity O(1)
+     */
+    int buscar(const EstadoCompacto &clave) const;
+
+    /**
+     * @brief Comprueba si la tabla está construida o cargada
+     * @return bool - true si la tabla admite consultas
+     * @complexity O(1)
+     */
+    bool estaLista() const;
+
+    /**
+     * @brief Obtiene el número de claves de la tabla
+     * @return uint64_t - Número de claves
+     * @complexity O(1)
+     */
+    uint64_t getNumClaves() const;
+
+    /**
+     * @brief Obtiene un metadato de la cabecera
+     * @pre 0 <= indice < NUM_METADATOS y la tabla está lista
+     * @return uint32_t - Valor del metadato
+     * @complexity O(1)
+     */
+    uint32_t getMetadato(int indice) const;
+};
+
+#endif // TABLA_PERFECTA_H
@@ -0,0 +1,100 @@
+/**
+ * @file TablaPerfectaPruebas.cpp
+ * @brief Pruebas para el TAD TablaPerfecta del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas unitarias del TAD TablaPerfecta
+ * (TablaPerfecta.h/TablaPerfecta.cpp). Comprueban que todas las claves
+ * insertadas se encuentran con su valor, que las claves ausentes no se
+ * encuentran y que la tabla se conserva al guardarla y proyectarla de disco.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "TablaPerfecta.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+
+/**
+ * @brief Genera un estado distinto para cada número
+ * @param n - Número del estado
+ * @return EstadoCompacto - Estado con los dígitos de n en base 4 como colores
+ */
+EstadoCompacto estadoDePrueba(int n)
+{
+    Tablero tablero;
+    tablero.inicializar(Tablero::MAX_PILAS);
+    for (int pila = 0; pila < 8 && n > 0; pila++)
+    {
+        tablero.colocarBola(pila, EstadoCompacto::colorIndice(1 + n % 4));
+        n /= 4;
+    }
+    EstadoCompacto estado;
+    estado.desdeTablero(tablero);
+    return estado;
+}
+
+/**
+ * @brief Ejecuta las pruebas del TAD TablaPerfecta
+ * @return int - 0 si todas las pruebas pasan correctamente
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD TablaPerfecta..." << std::endl;
+
+    // Prueba 1: Tabla sin construir
+    TablaPerfecta tabla;
+    assert(!tabla.estaLista());
+    assert(tabla.buscar(estadoDePrueba(1)) == -1);
+    std::cout << "Prueba 1 superada: Constructor y estado inicial" << std::endl;
+
+    // Prueba 2: Construir y buscar todas las claves
+    const int NUM_CLAVES = 20000;
+    std::vector<std::pair<EstadoCompacto, uint8_t>> entradas;
+    for (int i = 1; i <= NUM_CLAVES; i++)
+    {
+        entradas.push_back(std::make_pair(estadoDePrueba(i), (uint8_t)(i % 200)));
+    }
+    uint32_t metadatos[TablaPerfecta::NUM_METADATOS] = {7, 8, 9, 10};
+    assert(tabla.construir(entradas, metadatos));
+    assert(tabla.getNumClaves() == (uint64_t)NUM_CLAVES);
+    for (int i = 1; i <= NUM_CLAVES; i++)
+    {
+        assert(tabla.buscar(estadoDePrueba(i)) == i % 200);
+    }
+    std::cout << "Prueba 2 superada: Construir y buscar" << std::endl;
+
+    // Prueba 3: Claves ausentes
+    for (int i = NUM_CLAVES + 1; i <= NUM_CLAVES + 1000; i++)
+    {
+        assert(tabla.buscar(estadoDePrueba(i)) == -1);
+    }
+    std::cout << "Prueba 3 superada: Claves ausentes" << std::endl;
+
+    // Prueba 4: Guardar y proyectar desde disco
+    assert(tabla.guardar("tabla_pruebas.tmp"));
+    TablaPerfecta cargada;
+    assert(cargada.cargar("tabla_pruebas.tmp"));
+    assert(cargada.getNumClaves() == (uint64_t)NUM_CLAVES);
+    assert(cargada.getMetadato(3) == 10);
+    for (int i = 1; i <= NUM_CLAVES; i += 7)
+    {
+        assert(cargada.buscar(estadoDePrueba(i)) == i % 200);
+    }
+    assert(!cargada.cargar("no_existe.tmp"));
+    assert(!cargada.estaLista());
+    std::remove("tabla_pruebas.tmp");
+    std::cout << "Prueba 4 superada: Guardar y cargar" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD TablaPerfecta han sido superadas!" << std::endl;
+    return 0;
+}
@@ -12,6 +12,12 @@
  * El tablero se implementa como un array de objetos Pila, con un límite máximo
  * de 10 pilas por juego. Proporciona métodos para inicializar el tablero, colocar
  * bolas, realizar movimientos y verificar el estado del juego.
+ *
+ * Además mantiene un índice de las pilas como máscaras de bits: las vacías, las
+ * no vacías y, por cada color de cima, las pilas no llenas con ese color
+ * (cubetas). El índice se actualiza en cada cambio de una pila, de modo que
+ * generarMovimientos enumera los movimientos válidos en tiempo proporcional a
+ * su número, sin comprobar todos los pares de pilas.
  */
 
 #ifndef TABLERO_H
@@ -19,6 +25,33 @@
 
 #include "Pila.h"
 
+/**
+ * @brief Movimiento de la bola de la cima de una pila a otra
+ */
+struct Movimiento
+{
+    int origen;  // Índice de la pila origen
+    int destino; // Índice de la pila destino
+};
+
+/**
+ * @brief Resultado de comprobar un movimiento: válido o el motivo del rechazo
+ *
+ * Los motivos siguen el orden en que se comprueban las reglas, de modo que cada
+ * movimiento tiene un único motivo (el de la primera regla que incumple).
+ */
+enum ResultadoMovimiento
+{
+    MOVIMIENTO_VALIDO,           // El movimiento cumple las reglas
+    MOVIMIENTO_INDICE_NO_VALIDO, // El origen o el destino no es un tubo del tablero
+    MOVIMIENTO_MISMO_TUBO,       // El origen y el destino son el mismo tubo
+    MOVIMIENTO_ORIGEN_VACIO,     // El tubo origen no tiene bolas
+    MOVIMIENTO_DESTINO_LLENO,    // El tubo destino está lleno
+    MOVIMIENTO_COLOR_DISTINTO,   // La cima del destino es de otro color
+    MOVIMIENTO_JUEGO_TERMINADO,  // La partida ya no está en curso (solo lo devuelve Juego)
+    NUM_RESULTADOS_MOVIMIENTO
+};
+
 /**
  * @brief TAD Tablero para representar el estado del juego Ball Sort Puzzle
  *
@@ -27,11 +60,29 @@
  */
 class Tablero
 {
-private:
+public:
     static const int MAX_PILAS = 10; // Número máximo de pilas (tubos) en el tablero
+    static const int MAX_MOVIMIENTOS = MAX_PILAS * (MAX_PILAS - 1); // Movimientos posibles como máximo
+
+private:
     Pila pilas[MAX_PILAS];           // Array de pilas
     int numPilas;                    // Número actual de pilas en el tablero
 
+    // Índice de las pilas (bit i = pila i), en máscaras de 16 bits
+    static_assert(MAX_PILAS <= 16, "Las máscaras de pilas son unsigned short: una pila por bit");
+    unsigned short vacias;               // Pilas sin bolas
+    unsigned short ocupadas;             // Pilas con alguna bola
+    char coloresCubeta[MAX_PILAS];       // Color de cima de cada cubeta
+    unsigned short cubetas[MAX_PILAS];   // Pilas no llenas con ese color de cima (nunca 0)
+    int numCubetas;                      // Cubetas en uso
+
+    static constexpr Pila PILA_VACIA = Pila(); // Pila que devuelve getPila con un índice no válido
+
+    constexpr unsigned short cubeta(char color) const;
+    constexpr void anadirACubeta(char color, unsigned short bit);
+    constexpr void quitarDeCubeta(char color, unsigned short bit);
+    constexpr void actualizarIndice(int indicePila);
+
 public:
     /**
      * @brief Constructor por defecto
@@ -39,7 +90,7 @@ public:
      * @post Crea un tablero vacío
      * @complexity O(1)
      */
-    Tablero();
+    constexpr Tablero();
 
     /**
      * @brief Inicializa el tablero con un número dado de pilas
@@ -48,7 +99,7 @@ public:
      * @param numPilasIniciales - Número de pilas a inicializar
      * @complexity O(1)
      */
-    void inicializar(int numPilasIniciales);
+    constexpr void inicializar(int numPilasIniciales);
 
     /**
      * @brief Coloca una bola en una pila específica
@@ -59,7 +110,7 @@ public:
      * @return bool - true si se pudo colocar la bola, false en caso contrario
      * @complexity O(1)
      */
-    bool colocarBola(int indicePila, char color);
+    constexpr bool colocarBola(int indicePila, char color);
 
     /**
      * @brief Realiza un movimiento entre dos pilas
@@ -70,7 +121,19 @@ public:
      * @return bool - true si el movimiento se realizó correctamente
      * @complexity O(1)
      */
-    bool moverBola(int origen, int destino);
+    constexpr bool moverBola(int origen, int destino);
+
+    /**
+     * @brief Realiza un movimiento entre dos pilas e indica por qué no se pudo hacer
+     * @pre No hay precondiciones
+     * @post Mueve la bola de la cima de la pila origen a la pila destino si es válido
+     * @param origen - Índice de la pila origen
+     * @param destino - Índice de la pila destino
+     * @param resultado - MOVIMIENTO_VALIDO o el motivo del rechazo
+     * @return bool - true si el movimiento se realizó correctamente
+     * @complexity O(1)
+     */
+    constexpr bool moverBola(int origen, int destino, ResultadoMovimiento &resultado);
 
     /**
      * @brief Comprueba si un movimiento es válido
@@ -81,7 +144,29 @@ public:
      * @return bool - true si el movimiento es válido
      * @complexity O(1)
      */
-    bool movimientoValido(int origen, int destino) const;
+    constexpr bool movimientoValido(int origen, int destino) const;
+
+    /**
+     * @brief Comprueba un movimiento y devuelve el motivo si no es válido
+     * @pre No hay precondiciones
+     * @post Determina la primera regla que incumple el movimiento, si la hay
+     * @param origen - Índice de la pila origen
+     * @param destino - Índice de la pila destino
+     * @return ResultadoMovimiento - MOVIMIENTO_VALIDO o el motivo del rechazo
+     * @complexity O(1)
+     */
+    constexpr ResultadoMovimiento comprobarMovimiento(int origen, int destino) const;
+
+    /**
+     * @brief Enumera los movimientos válidos
+     * @pre movimientos tiene espacio para MAX_MOVIMIENTOS movimientos
+     * @post Escribe los movimientos para los que movimientoValido es true, por
+     *       origen y después por destino crecientes
+     * @param movimientos - Movimientos válidos
+     * @return int - Número de movimientos válidos
+     * @complexity O(n + m) donde n es el número de pilas y m el de movimientos válidos
+     */
+    constexpr int generarMovimientos(Movimiento movimientos[]) const;
 
     /**
      * @brief Comprueba si el juego ha terminado (todas las pilas están completas o vacías)
@@ -90,7 +175,7 @@ public:
      * @return bool - true si el juego ha terminado
      * @complexity O(n) donde n es el número de pilas
      */
-    bool juegoTerminado() const;
+    constexpr bool juegoTerminado() const;
 
     /**
      * @brief Obtiene el número de pilas en el tablero
@@ -99,7 +184,7 @@ public:
      * @return int - El número de pilas
      * @complexity O(1)
      */
-    int getNumPilas() const;
+    constexpr int getNumPilas() const;
 
     /**
      * @brief Obtiene una referencia constante a una pila específica
@@ -109,7 +194,352 @@ public:
      * @return const Pila & - Referencia constante a la pila
      * @complexity O(1)
      */
-    const Pila &getPila(int indicePila) const;
+    constexpr const Pila &getPila(int indicePila) const;
 };
 
+// Las operaciones son constexpr para poder usarlas en tiempo de compilación
+// (niveles integrados y static_assert), así que se definen en la cabecera.
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+constexpr Tablero::Tablero()
+    : pilas(), numPilas(0), vacias(0), ocupadas(0), coloresCubeta(), cubetas(), numCubetas(0)
+{
+}
+
+/**
+ * Inicializa el tablero con un número dado de pilas
+ * @param numPilasIniciales - Número de pilas a inicializar
+ * @complexity O(1)
+ */
+constexpr void Tablero::inicializar(int numPilasIniciales)
+{
+    if (numPilasIniciales >= 2 && numPilasIniciales <= MAX_PILAS)
+    {
+        numPilas = numPilasIniciales;
+
+        // Reconstruir el índice con las pilas que quedan en el tablero
+        vacias = 0;
+        ocupadas = 0;
+        numCubetas = 0;
+        for (int i = 0; i < numPilas; i++)
+        {
+            actualizarIndice(i);
+        }
+    }
+}
+
+/**
+ * Coloca una bola en una pila específica
+ * @param indicePila - Índice de la pila donde colocar la bola
+ * @param color - Color de la bola a colocar
+ * @return bool - true si se pudo colocar la bola, false en caso contrario
+ * @complexity O(1)
+ */
+constexpr bool Tablero::colocarBola(int indicePila, char color)
+{
+    // Verificar que el índice de la pila sea válido
+    if (indicePila >= 0 && indicePila < numPilas)
+    {
+        // Verificar que la pila no esté llena
+        if (!pilas[indicePila].estaLlena())
+        {
+            pilas[indicePila].apilar(color);
+            actualizarIndice(indicePila);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Realiza un movimiento entre dos pilas
+ * @param origen - Índice de la pila origen
+ * @param destino - Índice de la pila destino
+ * @return bool - true si el movimiento se realizó correctamente
+ * @complexity O(1)
+ */
+constexpr bool Tablero::moverBola(int origen, int destino)
+{
+    ResultadoMovimiento resultado = MOVIMIENTO_VALIDO;
+    return moverBola(origen, destino, resultado);
+}
+
+/**
+ * Realiza un movimiento entre dos pilas e indica por qué no se pudo hacer
+ * @param origen - Índice de la pila origen
+ * @param destino - Índice de la pila destino
+ * @param resultado - MOVIMIENTO_VALIDO o el motivo del rechazo
+ * @return bool - true si el movimiento se realizó correctamente
+ * @complexity O(1)
+ */
+constexpr bool Tablero::moverBola(int origen, int destino, ResultadoMovimiento &resultado)
+{
+    // Verificar que el movimiento sea válido
+    resultado = comprobarMovimiento(origen, destino);
+    if (resultado == MOVIMIENTO_VALIDO)
+    {
+        // Obtener el color de la bola en la cima de la pila origen
+        char color = pilas[origen].cimaPila();
+        bool origenLlena = pilas[origen].estaLlena();
+        bool destinoVacio = pilas[destino].estaVacia();
+
+        // Desapilar de la pila origen
+        pilas[origen].desapilar();
+
+        // Apilar en la pila destino
+        pilas[destino].apilar(color);
+
+        // Actualizar el índice: solo cambian las cubetas de las dos pilas
+        unsigned short bitOrigen = 1 << origen;
+        unsigned short bitDestino = 1 << destino;
+        if (!origenLlena)
+        {
+            quitarDeCubeta(color, bitOrigen);
+        }
+        if (pilas[origen].estaVacia())
+        {
+            vacias |= bitOrigen;
+            ocupadas &= ~bitOrigen;
+        }
+        else
+        {
+            anadirACubeta(pilas[origen].cimaPila(), bitOrigen);
+        }
+        if (destinoVacio)
+        {
+            vacias &= ~bitDestino;
+            ocupadas |= bitDestino;
+        }
+        else
+        {
+            quitarDeCubeta(color, bitDestino);
+        }
+        if (!pilas[destino].estaLlena())
+        {
+            anadirACubeta(color, bitDestino);
+        }
+
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Comprueba si un movimiento es válido
+ * @param origen - Índice de la pila origen
+ * @param destino - Índice de la pila destino
+ * @return bool - true si el movimiento es válido
+ * @complexity O(1)
+ */
+constexpr bool Tablero::movimientoValido(int origen, int destino) const
+{
+    return comprobarMovimiento(origen, destino) == MOVIMIENTO_VALIDO;
+}
+
+/**
+ * Comprueba un movimiento y devuelve el motivo si no es válido
+ * @param origen - Índice de la pila origen
+ * @param destino - Índice de la pila destino
+ * @return ResultadoMovimiento - MOVIMIENTO_VALIDO o el motivo del rechazo
+ * @complexity O(1)
+ */
+constexpr ResultadoMovimiento Tablero::comprobarMovimiento(int origen, int destino) const
+{
+    // Verificar que los índices sean válidos
+    if (origen < 0 || origen >= numPilas || destino < 0 || destino >= numPilas)
+    {
+        return MOVIMIENTO_INDICE_NO_VALIDO;
+    }
+    if (origen == destino)
+    {
+        return MOVIMIENTO_MISMO_TUBO;
+    }
+
+    // Verificar que la pila origen no esté vacía
+    if (pilas[origen].estaVacia())
+    {
+        return MOVIMIENTO_ORIGEN_VACIO;
+    }
+
+    // Verificar que la pila destino no esté llena
+    if (pilas[destino].estaLlena())
+    {
+        return MOVIMIENTO_DESTINO_LLENO;
+    }
+
+    // Verificar que la pila destino esté vacía o tenga el mismo color en la cima
+    if (!pilas[destino].estaVacia() && pilas[destino].cimaPila() != pilas[origen].cimaPila())
+    {
+        return MOVIMIENTO_COLOR_DISTINTO;
+    }
+
+    return MOVIMIENTO_VALIDO;
+}
+
+/**
+ * Enumera los movimientos válidos a partir del índice de pilas
+ * @param movimientos - Movimientos válidos
+ * @return int - Número de movimientos válidos
+ * @complexity O(n + m) donde n es el número de pilas y m el de movimientos válidos
+ */
+constexpr int Tablero::generarMovimientos(Movimiento movimientos[]) const
+{
+    int numMovimientos = 0;
+    for (unsigned origenes = ocupadas; origenes != 0; origenes &= origenes - 1)
+    {
+        int origen = __builtin_ctz(origenes);
+
+        // Destinos: pilas vacías y pilas no llenas con el mismo color de cima
+        unsigned destinos = (vacias | cubeta(pilas[origen].cimaPila())) & ~(1u << origen);
+        for (; destinos != 0; destinos &= destinos - 1)
+        {
+            movimientos[numMovimientos++] = Movimiento{origen, __builtin_ctz(destinos)};
+        }
+    }
+    return numMovimientos;
+}
+
+/**
+ * Devuelve las pilas no llenas con un color de cima
+ * @param color - Color de la cima
+ * @return unsigned short - Máscara de las pilas (0 si no hay ninguna)
+ * @complexity O(c) donde c es el número de cubetas (c <= n)
+ */
+constexpr unsigned short Tablero::cubeta(char color) const
+{
+    for (int k = 0; k < numCubetas; k++)
+    {
+        if (coloresCubeta[k] == color)
+        {
+            return cubetas[k];
+        }
+    }
+    return 0;
+}
+
+/**
+ * Añade una pila a la cubeta de un color, que se crea si no existe
+ * @param color - Color de la cima de la pila
+ * @param bit - Bit de la pila
+ * @complexity O(c) donde c es el número de cubetas (c <= n)
+ */
+constexpr void Tablero::anadirACubeta(char color, unsigned short bit)
+{
+    for (int k = 0; k < numCubetas; k++)
+    {
+        if (coloresCubeta[k] == color)
+        {
+            cubetas[k] |= bit;
+            return;
+        }
+    }
+    coloresCubeta[numCubetas] = color;
+    cubetas[numCubetas] = bit;
+    numCubetas++;
+}
+
+/**
+ * Quita una pila de la cubeta de un color; una cubeta vacía se sustituye por la última
+ * @param color - Color de la cima de la pila
+ * @param bit - Bit de la pila
+ * @complexity O(c) donde c es el número de cubetas (c <= n)
+ */
+constexpr void Tablero::quitarDeCubeta(char color, unsigned short bit)
+{
+    for (int k = 0; k < numCubetas; k++)
+    {
+        if (coloresCubeta[k] == color)
+        {
+            cubetas[k] &= ~bit;
+            if (cubetas[k] == 0)
+            {
+                numCubetas--;
+                cubetas[k] = cubetas[numCubetas];
+                coloresCubeta[k] = coloresCubeta[numCubetas];
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * Vuelve a calcular la entrada del índice de una pila tras un cambio cualquiera
+ * @param indicePila - Índice de la pila que ha cambiado
+ * @complexity O(c) donde c es el número de cubetas (c <= n)
+ */
+constexpr void Tablero::actualizarIndice(int indicePila)
+{
+    unsigned short bit = 1 << indicePila;
+    vacias &= ~bit;
+    ocupadas &= ~bit;
+    for (int k = 0; k < numCubetas; k++)
+    {
+        if (cubetas[k] & bit)
+        {
+            quitarDeCubeta(coloresCubeta[k], bit);
+            break;
+        }
+    }
+
+    const Pila &pila = pilas[indicePila];
+    if (pila.estaVacia())
+    {
+        vacias |= bit;
+        return;
+    }
+    ocupadas |= bit;
+    if (!pila.estaLlena())
+    {
+        anadirACubeta(pila.cimaPila(), bit);
+    }
+}
+
+/**
+ * Comprueba si el juego ha terminado (todas las pilas están completas o vacías)
+ * @return bool - true si el juego ha terminado
+ * @complexity O(n) donde n es el número de pilas
+ */
+constexpr bool Tablero::juegoTerminado() const
+{
+    for (int i = 0; i < numPilas; i++)
+    {
+        // Si una pila no está vacía y no está completa, el juego no ha terminado
+        if (!pilas[i].estaVacia() && !pilas[i].estaCompleta())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Obtiene el número de pilas en el tablero
+ * @return int - El número de pilas
+ * @complexity O(1)
+ */
+constexpr int Tablero::getNumPilas() const
+{
+    return numPilas;
+}
+
+/**
+ * Obtiene una referencia constante a una pila específica
+ * @param indicePila - Índice de la pila a obtener
+ * @return const Pila& - Referencia constante a la pila
+ * @complexity O(1)
+ */
+constexpr const Pila &Tablero::getPila(int indicePila) const
+{
+    if (indicePila >= 0 && indicePila < numPilas)
+    {
+        return pilas[indicePila];
+    }
+
+    // Si el índice es inválido, devolver una pila vacía
+    return PILA_VACIA;
+}
+
 #endif // TABLERO_H
\ No newline at end of file
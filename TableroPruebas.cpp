@@ -17,11 +17,39 @@
 #include "Tablero.h"
 #include <iostream>
 #include <cassert>
+#include <random>
 
 // Incluir las implementaciones directamente para evitar errores de "undefined reference"
 #include "Pila.cpp"
 #include "Tablero.cpp"
 
+/**
+ * @brief Comprueba que generarMovimientos da los mismos movimientos que movimientoValido
+ * @param tablero - Tablero a comprobar
+ * @return bool - true si coinciden los movimientos y su orden
+ */
+bool generacionCoincide(const Tablero &tablero)
+{
+    Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+    int numMovimientos = tablero.generarMovimientos(movimientos);
+    int k = 0;
+    for (int origen = 0; origen < tablero.getNumPilas(); origen++)
+    {
+        for (int destino = 0; destino < tablero.getNumPilas(); destino++)
+        {
+            if (tablero.movimientoValido(origen, destino))
+            {
+                if (k == numMovimientos || movimientos[k].origen != origen || movimientos[k].destino != destino)
+                {
+                    return false;
+                }
+                k++;
+            }
+        }
+    }
+    return k == numMovimientos;
+}
+
 /**
  * @brief Ejecuta las pruebas del TAD Tablero
  * @return int - 0 si todas las pruebas pasan correctamente
@@ -94,6 +122,77 @@ int main()
     assert(tableroCompleto.juegoTerminado());
     std::cout << "Prueba 6 superada: Comprobar juego terminado" << std::endl;
 
+    // Prueba 7: Motivos de rechazo de los movimientos
+    Tablero tableroMotivos;
+    tableroMotivos.inicializar(4);
+    for (int i = 0; i < 4; i++)
+    {
+        tableroMotivos.colocarBola(0, 'R');
+    }
+    tableroMotivos.colocarBola(1, 'G');
+    assert(tableroMotivos.comprobarMovimiento(-1, 2) == MOVIMIENTO_INDICE_NO_VALIDO);
+    assert(tableroMotivos.comprobarMovimiento(0, 4) == MOVIMIENTO_INDICE_NO_VALIDO);
+    assert(tableroMotivos.comprobarMovimiento(1, 1) == MOVIMIENTO_MISMO_TUBO);
+    assert(tableroMotivos.comprobarMovimiento(2, 0) == MOVIMIENTO_ORIGEN_VACIO);
+    assert(tableroMotivos.comprobarMovimiento(1, 0) == MOVIMIENTO_DESTINO_LLENO);
+    assert(tableroMotivos.comprobarMovimiento(0, 1) == MOVIMIENTO_COLOR_DISTINTO);
+    assert(tableroMotivos.comprobarMovimiento(0, 2) == MOVIMIENTO_VALIDO);
+
+    ResultadoMovimiento resultado;
+    assert(!tableroMotivos.moverBola(0, 1, resultado) && resultado == MOVIMIENTO_COLOR_DISTINTO);
+    assert(tableroMotivos.getPila(0).numElementos() == 4);
+    assert(tableroMotivos.moverBola(1, 3, resultado) && resultado == MOVIMIENTO_VALIDO);
+    assert(tableroMotivos.getPila(3).cimaPila() == 'G');
+    std::cout << "Prueba 7 superada: Motivos de rechazo de los movimientos" << std::endl;
+
+    // Prueba 8: Generación de movimientos con el índice de cimas
+    Tablero tableroVacio;
+    Movimiento movimientos[Tablero::MAX_MOVIMIENTOS];
+    assert(tableroVacio.generarMovimientos(movimientos) == 0);
+    assert(generacionCoincide(tableroMotivos));
+    std::mt19937 generador(45);
+    const char COLORES[] = "RGBYMCOP";
+    int comprobados = 0;
+    for (int partida = 0; partida < 20; partida++)
+    {
+        // Tablero de 10 tubos con 8 colores al azar, rellenado con colocarBola
+        Tablero aleatorio;
+        aleatorio.inicializar(Tablero::MAX_PILAS);
+        int restantes[8] = {4, 4, 4, 4, 4, 4, 4, 4};
+        for (int bola = 0; bola < 32; bola++)
+        {
+            int color = (int)(generador() % 8);
+            while (restantes[color] == 0)
+            {
+                color = (color + 1) % 8;
+            }
+            restantes[color]--;
+            int pila = (int)(generador() % Tablero::MAX_PILAS);
+            while (!aleatorio.colocarBola(pila, COLORES[color]))
+            {
+                pila = (pila + 1) % Tablero::MAX_PILAS;
+            }
+            assert(generacionCoincide(aleatorio));
+        }
+        // Partida al azar entre los movimientos generados
+        for (int paso = 0; paso < 200; paso++)
+        {
+            int numMovimientos = aleatorio.generarMovimientos(movimientos);
+            assert(generacionCoincide(aleatorio));
+            comprobados++;
+            if (numMovimientos == 0)
+            {
+                break;
+            }
+            const Movimiento &elegido = movimientos[generador() % numMovimientos];
+            assert(aleatorio.moverBola(elegido.origen, elegido.destino));
+        }
+        // Al reducir el número de pilas, el índice solo incluye las que quedan
+        aleatorio.inicializar(6);
+        assert(generacionCoincide(aleatorio));
+    }
+    std::cout << "Prueba 8 superada: Generación de movimientos en " << comprobados << " posiciones" << std::endl;
+
     std::cout << "¡Todas las pruebas del TAD Tablero han sido superadas!" << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,579 @@
+/**
+ * @file TorneoResolutores.cpp
+ * @brief Implementación del TAD TorneoResolutores para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD TorneoResolutores
+ * (TorneoResolutores.h). El proceso padre reparte las partidas entre hijos
+ * creados con fork, como mucho numProcesos a la vez, y los vigila: el hijo que
+ * supera el tiempo límite se mata con SIGKILL. Cada hijo limita su memoria
+ * virtual con setrlimit, juega su partida, comprueba la solución y manda el
+ * resultado por una tubería; si se queda sin memoria (std::bad_alloc) sale con
+ * un código propio. Al recoger al hijo, wait4 da su memoria residente máxima.
+ *
+ * Sin fork ni wait4 (Windows) no se pueden aislar ni limitar las partidas, y
+ * disputar no juega ninguna.
+ */
+
+#include "TorneoResolutores.h"
+#include "ResolutorAproximado.h"
+#include "MotorMonteCarlo.h"
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <thread>
+
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+static const int CODIGO_MEMORIA_AGOTADA = 3; // Código de salida del hijo sin memoria
+static const double MARGEN_APROXIMADO = 0.9; // Fracción del tiempo límite que se da al resolutor aproximado
+static const int ESPERA_VIGILANCIA_MS = 1;   // Pausa entre dos revisiones de los hijos
+
+/**
+ * @brief Mensaje que el hijo manda al padre por la tubería
+ */
+struct MensajePartida
+{
+    bool resuelto;   // Se encontró una solución
+    bool valida;     // La solución resuelve el nivel (o no hay solución)
+    bool optima;     // La solución es de longitud mínima demostrada
+    int longitud;    // Movimientos de la solución
+    long long nodos; // Nodos expandidos
+    double segundos; // Tiempo de la búsqueda
+};
+
+#ifndef _WIN32
+
+/**
+ * @brief Partida que se está jugando en un proceso hijo
+ */
+struct PartidaEnCurso
+{
+    pid_t pid;                                    // Proceso hijo
+    int tuberia;                                  // Extremo de lectura de la tubería
+    size_t concursante;                           // Configuración
+    size_t nivel;                                 // Nivel
+    std::chrono::steady_clock::time_point inicio; // Momento del fork
+    bool matada;                                  // Se mató por superar el tiempo
+};
+
+#endif
+
+/**
+ * Constructor de ConcursanteTorneo con A* sin bases
+ */
+ConcursanteTorneo::ConcursanteTorneo()
+{
+    nombre = "astar";
+    estrategia = ESTRATEGIA_ASTAR;
+    parametro = 0.0;
+    conBases = false;
+}
+
+/**
+ * Constructor de OpcionesTorneo con valores por defecto
+ */
+OpcionesTorneo::OpcionesTorneo()
+{
+    segundosLimite = 10.0;
+    memoriaMaximaMB = 2048;
+    maxNodos = 2000000;
+    numProcesos = 0;
+    semilla = 1;
+    baseFinal = nullptr;
+}
+
+/**
+ * Constructor de ResultadoPartida sin resultado
+ */
+ResultadoPartida::ResultadoPartida()
+{
+    fin = FIN_ERROR;
+    resuelto = false;
+    optima = false;
+    longitud = -1;
+    nodos = 0;
+    segundos = 0.0;
+    memoriaPicoKB = 0;
+}
+
+/**
+ * Constructor de ResumenConcursante vacío
+ */
+ResumenConcursante::ResumenConcursante()
+{
+    resueltos = 0;
+    tiemposAgotados = 0;
+    memoriasAgotadas = 0;
+    errores = 0;
+    mejores = 0;
+    longitudMediaComun = -1.0;
+    nodosMedios = 0.0;
+    segundosTotales = 0.0;
+    memoriaPicoKB = 0;
+}
+
+/**
+ * Constructor
+ * @param opciones - Opciones del torneo
+ * @complexity O(1)
+ */
+TorneoResolutores::TorneoResolutores(const OpcionesTorneo &opciones) : opciones(opciones)
+{
+}
+
+/**
+ * Interpreta el texto de una configuración
+ * @param texto - Texto de la configuración
+ * @param concursante - Configuración
+ * @return bool - false si el texto no es válido
+ * @complexity O(n) donde n es la longitud del texto
+ */
+bool TorneoResolutores::concursanteDesdeTexto(const std::string &texto, ConcursanteTorneo &concursante)
+{
+    ConcursanteTorneo leido;
+    leido.nombre = texto;
+    std::string nombre = texto;
+
+    const std::string sufijoBases = "+bases";
+    if (nombre.size() > sufijoBases.size() &&
+        nombre.compare(nombre.size() - sufijoBases.size(), sufijoBases.size(), sufijoBases) == 0)
+    {
+        leido.conBases = true;
+        nombre.erase(nombre.size() - sufijoBases.size());
+    }
+
+    size_t dosPuntos = nombre.find(':');
+    if (dosPuntos != std::string::npos)
+    {
+        std::string valor = nombre.substr(dosPuntos + 1);
+        nombre.erase(dosPuntos);
+        size_t leidos = 0;
+        try
+        {
+            leido.parametro = std::stod(valor, &leidos);
+        }
+        catch (...)
+        {
+            return false;
+        }
+        if (leidos != valor.size() || !(leido.parametro > 0.0))
+        {
+            return false;
+        }
+    }
+
+    if (nombre == "astar")
+    {
+        leido.estrategia = ESTRATEGIA_ASTAR;
+    }
+    else if (nombre == "bidireccional")
+    {
+        leido.estrategia = ESTRATEGIA_BIDIRECCIONAL;
+    }
+    else if (nombre == "aproximado")
+    {
+        leido.estrategia = ESTRATEGIA_APROXIMADO;
+    }
+    else if (nombre == "haz")
+    {
+        leido.estrategia = ESTRATEGIA_HAZ;
+    }
+    else if (nombre == "ponderado")
+    {
+        leido.estrategia = ESTRATEGIA_PONDERADO;
+    }
+    else if (nombre == "montecarlo")
+    {
+        leido.estrategia = ESTRATEGIA_MONTECARLO;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Solo A* y la búsqueda bidireccional usan las bases; solo haz, ponderado y Monte Carlo tienen parámetro
+    bool admiteBases = leido.estrategia == ESTRATEGIA_ASTAR || leido.estrategia == ESTRATEGIA_BIDIRECCIONAL;
+    bool admiteParametro = leido.estrategia == ESTRATEGIA_HAZ || leido.estrategia == ESTRATEGIA_PONDERADO ||
+                           leido.estrategia == ESTRATEGIA_MONTECARLO;
+    if ((leido.conBases && !admiteBases) || (dosPuntos != std::string::npos && !admiteParametro))
+    {
+        return false;
+    }
+    concursante = leido;
+    return true;
+}
+
+/**
+ * Juega una partida en el proceso actual
+ * @param concursante - Configuración
+ * @param nivel - Nivel
+ * @param indiceNivel - Número del nivel (para la semilla de Monte Carlo)
+ * @return ResultadoPartida - Resultado sin fin ni memoria
+ */
+ResultadoPartida TorneoResolutores::jugar(const ConcursanteTorneo &concursante, const Tablero &nivel,
+                                          int indiceNivel) const
+{
+    ResultadoPartida partida;
+    std::vector<Movimiento> movimientos;
+    auto inicio = std::chrono::steady_clock::now();
+
+    switch (concursante.estrategia)
+    {
+    case ESTRATEGIA_ASTAR:
+    case ESTRATEGIA_BIDIRECCIONAL:
+    {
+        OpcionesResolutor opcionesResolutor;
+        opcionesResolutor.maxNodos = opciones.maxNodos;
+        if (concursante.conBases)
+        {
+            opcionesResolutor.baseFinal = opciones.baseFinal;
+            opcionesResolutor.patrones = opciones.patrones;
+        }
+        Resolutor resolutor(opcionesResolutor);
+        ResultadoResolucion resultado = concursante.estrategia == ESTRATEGIA_ASTAR
+                                            ? resolutor.resolver(nivel)
+                                            : resolutor.resolverBidireccional(nivel);
+        partida.resuelto = resultado.resuelto;
+        partida.optima = resultado.resuelto;
+        partida.nodos = resultado.nodosExpandidos;
+        movimientos = resultado.movimientos;
+        break;
+    }
+
+    case ESTRATEGIA_APROXIMADO:
+    case ESTRATEGIA_HAZ:
+    case ESTRATEGIA_PONDERADO:
+    {
+        OpcionesAproximado opcionesAproximado;
+        opcionesAproximado.maxNodos = opciones.maxNodos;
+        opcionesAproximado.segundosLimite = opciones.segundosLimite * MARGEN_APROXIMADO;
+        if (concursante.estrategia == ESTRATEGIA_HAZ)
+        {
+            opcionesAproximado.peso = 0.0;
+            if (concursante.parametro > 0.0)
+            {
+                opcionesAproximado.anchuraHaz = (int)concursante.parametro;
+            }
+        }
+        else if (concursante.estrategia == ESTRATEGIA_PONDERADO)
+        {
+            opcionesAproximado.anchuraHaz = 0;
+            if (concursante.parametro > 0.0)
+            {
+                opcionesAproximado.peso = concursante.parametro;
+            }
+        }
+        ResultadoAproximado resultado = ResolutorAproximado(opcionesAproximado).resolver(nivel);
+        partida.resuelto = resultado.resuelto;
+        partida.optima = resultado.optima;
+        partida.nodos = resultado.nodosExpandidos;
+        movimientos = resultado.movimientos;
+        break;
+    }
+
+    case ESTRATEGIA_MONTECARLO:
+    {
+        OpcionesMonteCarlo opcionesMonteCarlo;
+        opcionesMonteCarlo.semilla = opciones.semilla + (uint64_t)indiceNivel * 0x9E3779B97F4A7C15ULL;
+        if (concursante.parametro > 0.0)
+        {
+            opcionesMonteCarlo.iteracionesPorPaso = (long long)concursante.parametro;
+        }
+        ResultadoResolucion resultado = MotorMonteCarlo(opcionesMonteCarlo).resolver(nivel);
+        partida.resuelto = resultado.resuelto;
+        partida.nodos = resultado.nodosExpandidos;
+        movimientos = resultado.movimientos;
+        break;
+    }
+    }
+
+    partida.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    partida.fin = FIN_COMPLETADA;
+    if (partida.resuelto)
+    {
+        Tablero tablero = nivel;
+        for (const Movimiento &movimiento : movimientos)
+        {
+            if (!tablero.moverBola(movimiento.origen, movimiento.destino))
+            {
+                partida.fin = FIN_ERROR;
+                break;
+            }
+        }
+        if (!tablero.juegoTerminado())
+        {
+            partida.fin = FIN_ERROR;
+        }
+        partida.longitud = (int)movimientos.size();
+    }
+    return partida;
+}
+
+#ifndef _WIN32
+
+/**
+ * Juega todas las configuraciones en todos los niveles, cada partida en un proceso hijo
+ * @param concursantes - Configuraciones
+ * @param niveles - Niveles
+ * @param resultados - Resultados de cada configuración y nivel
+ * @return bool - false si no se pudo crear un proceso
+ * @complexity O(C * N * T / procesos)
+ */
+bool TorneoResolutores::disputar(const std::vector<ConcursanteTorneo> &concursantes,
+                                 const std::vector<Tablero> &niveles,
+                                 std::vector<std::vector<ResultadoPartida>> &resultados) const
+{
+    resultados.assign(concursantes.size(), std::vector<ResultadoPartida>(niveles.size()));
+    int numProcesos = opciones.numProcesos > 0 ? opciones.numProcesos
+                                               : std::max(1, (int)std::thread::hardware_concurrency());
+    size_t total = concursantes.size() * niveles.size();
+    size_t siguiente = 0;
+    std::vector<PartidaEnCurso> enCurso;
+    bool correcto = true;
+
+    while ((correcto && siguiente < total) || !enCurso.empty())
+    {
+        // Lanza partidas hasta llenar los procesos; las configuraciones de un nivel van seguidas
+        while (correcto && siguiente < total && (int)enCurso.size() < numProcesos)
+        {
+            PartidaEnCurso partida;
+            partida.nivel = siguiente / concursantes.size();
+            partida.concursante = siguiente % concursantes.size();
+            partida.matada = false;
+            int extremos[2];
+            if (pipe(extremos) != 0)
+            {
+                correcto = false;
+                break;
+            }
+            partida.inicio = std::chrono::steady_clock::now();
+            partida.pid = fork();
+            if (partida.pid < 0)
+            {
+                close(extremos[0]);
+                close(extremos[1]);
+                correcto = false;
+                break;
+            }
+            if (partida.pid == 0)
+            {
+                // Proceso hijo: se sale con _exit para no vaciar los búferes heredados del padre
+                close(extremos[0]);
+                if (opciones.memoriaMaximaMB > 0)
+                {
+                    struct rlimit limite;
+                    limite.rlim_cur = limite.rlim_max = (rlim_t)opciones.memoriaMaximaMB * 1024 * 1024;
+                    setrlimit(RLIMIT_AS, &limite);
+                }
+                MensajePartida mensaje = MensajePartida();
+                try
+                {
+                    ResultadoPartida resultado =
+                        jugar(concursantes[partida.concursante], niveles[partida.nivel], (int)partida.nivel);
+                    mensaje.resuelto = resultado.resuelto;
+                    mensaje.valida = resultado.fin == FIN_COMPLETADA;
+                    mensaje.optima = resultado.optima;
+                    mensaje.longitud = resultado.longitud;
+                    mensaje.nodos = resultado.nodos;
+                    mensaje.segundos = resultado.segundos;
+                }
+                catch (const std::bad_alloc &)
+                {
+                    _exit(CODIGO_MEMORIA_AGOTADA);
+                }
+                bool escrito = write(extremos[1], &mensaje, sizeof(mensaje)) == (ssize_t)sizeof(mensaje);
+                _exit(escrito ? 0 : 1);
+            }
+            close(extremos[1]);
+            partida.tuberia = extremos[0];
+            enCurso.push_back(partida);
+            siguiente++;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(ESPERA_VIGILANCIA_MS));
+
+        // Recoge las partidas terminadas y mata las que superan el tiempo
+        for (size_t i = 0; i < enCurso.size();)
+        {
+            PartidaEnCurso &partida = enCurso[i];
+            int estado = 0;
+            struct rusage uso;
+            pid_t recogido = wait4(partida.pid, &estado, WNOHANG, &uso);
+            if (recogido == 0)
+            {
+                double segundos =
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - partida.inicio).count();
+                if (!partida.matada && segundos > opciones.segundosLimite)
+                {
+                    kill(partida.pid, SIGKILL);
+                    partida.matada = true;
+                }
+                i++;
+                continue;
+            }
+
+            ResultadoPartida &resultado = resultados[partida.concursante][partida.nivel];
+            MensajePartida mensaje;
+            bool leido = read(partida.tuberia, &mensaje, sizeof(mensaje)) == (ssize_t)sizeof(mensaje);
+            close(partida.tuberia);
+            resultado.memoriaPicoKB = recogido == partida.pid ? (long long)uso.ru_maxrss : 0;
+            if (partida.matada)
+            {
+                resultado.fin = FIN_TIEMPO_AGOTADO;
+                resultado.segundos = opciones.segundosLimite;
+            }
+            else if (recogido == partida.pid && WIFEXITED(estado) &&
+                     WEXITSTATUS(estado) == CODIGO_MEMORIA_AGOTADA)
+            {
+                resultado.fin = FIN_MEMORIA_AGOTADA;
+                resultado.segundos =
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - partida.inicio).count();
+            }
+            else if (recogido == partida.pid && WIFEXITED(estado) && WEXITSTATUS(estado) == 0 && leido)
+            {
+                resultado.fin = mensaje.valida ? FIN_COMPLETADA : FIN_ERROR;
+                resultado.resuelto = mensaje.resuelto && mensaje.valida;
+                resultado.optima = mensaje.optima && resultado.resuelto;
+                resultado.longitud = resultado.resuelto ? mensaje.longitud : -1;
+                resultado.nodos = mensaje.nodos;
+                resultado.segundos = mensaje.segundos;
+            }
+            else
+            {
+                resultado.fin = FIN_ERROR;
+            }
+            enCurso.erase(enCurso.begin() + i);
+        }
+    }
+    return correcto;
+}
+
+#else
+
+/**
+ * Juega todas las configuraciones en todos los niveles (no disponible sin fork)
+ * @param concursantes - Configuraciones
+ * @param niveles - Niveles
+ * @param resultados - Resultados de cada configuración y nivel, todos FIN_ERROR
+ * @return bool - Siempre false
+ * @complexity O(C * N)
+ */
+bool TorneoResolutores::disputar(const std::vector<ConcursanteTorneo> &concursantes,
+                                 const std::vector<Tablero> &niveles,
+                                 std::vector<std::vector<ResultadoPartida>> &resultados) const
+{
+    resultados.assign(concursantes.size(), std::vector<ResultadoPartida>(niveles.size()));
+    return false;
+}
+
+#endif
+
+/**
+ * Resume los resultados de cada configuración
+ * @param resultados - Resultados de disputar
+ * @return std::vector<ResumenConcursante> - Resúmenes
+ * @complexity O(C * N)
+ */
+std::vector<ResumenConcursante> TorneoResolutores::resumir(
+    const std::vector<std::vector<ResultadoPartida>> &resultados)
+{
+    std::vector<ResumenConcursante> resumenes(resultados.size());
+    if (resultados.empty())
+    {
+        return resumenes;
+    }
+    size_t numNiveles = resultados[0].size();
+
+    std::vector<int> mejorLongitud(numNiveles, -1);
+    std::vector<bool> comun(numNiveles, true);
+    for (const std::vector<ResultadoPartida> &partidas : resultados)
+    {
+        for (size_t n = 0; n < numNiveles; n++)
+        {
+            if (partidas[n].resuelto)
+            {
+                if (mejorLongitud[n] < 0 || partidas[n].longitud < mejorLongitud[n])
+                {
+                    mejorLongitud[n] = partidas[n].longitud;
+                }
+            }
+            else
+            {
+                comun[n] = false;
+            }
+        }
+    }
+
+    for (size_t c = 0; c < resultados.size(); c++)
+    {
+        ResumenConcursante &resumen = resumenes[c];
+        long long longitudComun = 0;
+        int nivelesComunes = 0;
+        long long nodos = 0;
+        int completadas = 0;
+        for (size_t n = 0; n < numNiveles; n++)
+        {
+            const ResultadoPartida &partida = resultados[c][n];
+            resumen.segundosTotales += partida.segundos;
+            resumen.memoriaPicoKB = std::max(resumen.memoriaPicoKB, partida.memoriaPicoKB);
+            switch (partida.fin)
+            {
+            case FIN_COMPLETADA:
+                completadas++;
+                nodos += partida.nodos;
+                break;
+            case FIN_TIEMPO_AGOTADO:
+                resumen.tiemposAgotados++;
+                break;
+            case FIN_MEMORIA_AGOTADA:
+                resumen.memoriasAgotadas++;
+                break;
+            case FIN_ERROR:
+                resumen.errores++;
+                break;
+            }
+            if (partida.resuelto)
+            {
+                resumen.resueltos++;
+                resumen.mejores += partida.longitud == mejorLongitud[n];
+            }
+            if (comun[n])
+            {
+                longitudComun += partida.longitud;
+                nivelesComunes++;
+            }
+        }
+        resumen.nodosMedios = completadas > 0 ? (double)nodos / completadas : 0.0;
+        resumen.longitudMediaComun = nivelesComunes > 0 ? (double)longitudComun / nivelesComunes : -1.0;
+    }
+    return resumenes;
+}
+
+/**
+ * Obtiene el nombre de un final de partida
+ * @param fin - Final de partida
+ * @return std::string - Nombre para mostrar
+ * @complexity O(1)
+ */
+std::string TorneoResolutores::nombreFin(FinPartida fin)
+{
+    switch (fin)
+    {
+    case FIN_COMPLETADA:
+        return "completada";
+    case FIN_TIEMPO_AGOTADO:
+        return "tiempo";
+    case FIN_MEMORIA_AGOTADA:
+        return "memoria";
+    case FIN_ERROR:
+        return "error";
+    }
+    return "?";
+}
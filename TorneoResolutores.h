@@ -0,0 +1,190 @@
+/**
+ * @file TorneoResolutores.h
+ * @brief TAD TorneoResolutores para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) TorneoResolutores, que
+ * enfrenta varias configuraciones de resolución (A* con o sin bases de datos,
+ * búsqueda bidireccional, haz, A* ponderado y Monte Carlo) sobre un conjunto
+ * fijo de niveles y reúne, para cada par configuración-nivel, si se resolvió,
+ * la longitud de la solución, los nodos, la memoria máxima y el tiempo.
+ *
+ * Cada partida se juega en un proceso hijo (fork), con varios hijos a la vez:
+ * así el límite de memoria (RLIMIT_AS) y el de tiempo (el padre mata al hijo
+ * que lo supera) afectan solo a esa partida, y la memoria máxima medida
+ * (ru_maxrss de wait4) es la de esa partida, no la de todo el torneo. Las
+ * bases de datos se cargan antes y los hijos las heredan sin copiarlas.
+ *
+ * Los resultados no dependen del número de procesos: Monte Carlo usa una
+ * semilla derivada de la del torneo y del número del nivel, y las soluciones se
+ * comprueban sobre el tablero antes de darlas por buenas. Solo las partidas que
+ * rozan el límite de tiempo pueden cambiar de una ejecución a otra.
+ *
+ * Necesita fork, wait4 y setrlimit, así que solo juega partidas en sistemas
+ * POSIX; en Windows disputar devuelve false.
+ */
+
+#ifndef TORNEO_RESOLUTORES_H
+#define TORNEO_RESOLUTORES_H
+
+#include "Resolutor.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Algoritmo de una configuración del torneo
+ */
+enum EstrategiaTorneo
+{
+    ESTRATEGIA_ASTAR,         // Resolutor::resolver
+    ESTRATEGIA_BIDIRECCIONAL, // Resolutor::resolverBidireccional
+    ESTRATEGIA_APROXIMADO,    // ResolutorAproximado con haz y A* ponderado
+    ESTRATEGIA_HAZ,           // ResolutorAproximado solo con haz
+    ESTRATEGIA_PONDERADO,     // ResolutorAproximado solo con A* ponderado
+    ESTRATEGIA_MONTECARLO     // MotorMonteCarlo::resolver
+};
+
+/**
+ * @brief Configuración de resolución que participa en el torneo
+ */
+struct ConcursanteTorneo
+{
+    std::string nombre;          // Texto de la configuración ("haz:500", "astar+bases"...)
+    EstrategiaTorneo estrategia; // Algoritmo
+    double parametro;            // Anchura del haz, peso o iteraciones por paso (0 = valor por defecto)
+    bool conBases;               // Usa la base de finales y los patrones del torneo
+
+    ConcursanteTorneo();
+};
+
+/**
+ * @brief Opciones del torneo
+ */
+struct OpcionesTorneo
+{
+    double segundosLimite;                      // Tiempo máximo de cada partida
+    long long memoriaMaximaMB;                  // Memoria virtual máxima de cada partida (0 = sin límite)
+    long long maxNodos;                         // Nodos máximos de los resolutores
+    int numProcesos;                            // Partidas a la vez (0 = todos los núcleos)
+    unsigned long long semilla;                 // Semilla de Monte Carlo
+    const BaseFinal *baseFinal;                 // Base de finales de los concursantes "+bases"
+    std::vector<const BasePatrones *> patrones; // Bases de patrones de los concursantes "+bases"
+
+    OpcionesTorneo();
+};
+
+/**
+ * @brief Cómo terminó una partida
+ */
+enum FinPartida
+{
+    FIN_COMPLETADA,      // El resolutor terminó (con o sin solución)
+    FIN_TIEMPO_AGOTADO,  // Se superó el tiempo límite
+    FIN_MEMORIA_AGOTADA, // Se superó el límite de memoria
+    FIN_ERROR            // El proceso falló o devolvió una solución que no resuelve el nivel
+};
+
+/**
+ * @brief Resultado de una configuración en un nivel
+ */
+struct ResultadoPartida
+{
+    FinPartida fin;          // Cómo terminó
+    bool resuelto;           // true si se encontró una solución válida
+    bool optima;             // true si la solución es de longitud mínima demostrada
+    int longitud;            // Movimientos de la solución (-1 sin solución)
+    long long nodos;         // Nodos expandidos (iteraciones en Monte Carlo)
+    double segundos;         // Tiempo de pared
+    long long memoriaPicoKB; // Memoria residente máxima del proceso
+
+    ResultadoPartida();
+};
+
+/**
+ * @brief Resumen de una configuración en todos los niveles
+ */
+struct ResumenConcursante
+{
+    int resueltos;             // Niveles resueltos
+    int tiemposAgotados;       // Partidas sin terminar por tiempo
+    int memoriasAgotadas;      // Partidas sin terminar por memoria
+    int errores;               // Partidas con error
+    int mejores;               // Niveles en los que iguala la solución más corta del torneo
+    double longitudMediaComun; // Longitud media en los niveles que resuelven todos (-1 si no hay)
+    double nodosMedios;        // Nodos medios por partida completada
+    double segundosTotales;    // Tiempo sumado de todas las partidas
+    long long memoriaPicoKB;   // Mayor memoria residente de una partida
+
+    ResumenConcursante();
+};
+
+/**
+ * @brief TAD TorneoResolutores que compara configuraciones de resolución
+ */
+class TorneoResolutores
+{
+private:
+    OpcionesTorneo opciones; // Opciones del torneo
+
+    ResultadoPartida jugar(const ConcursanteTorneo &concursante, const Tablero &nivel, int indiceNivel) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @pre No hay precondiciones
+     * @post Crea un torneo con las opciones dadas
+     * @param opciones - Opciones del torneo
+     * @complexity O(1)
+     */
+    explicit TorneoResolutores(const OpcionesTorneo &opciones = OpcionesTorneo());
+
+    /**
+     * @brief Interpreta el texto de una configuración
+     * @pre No hay precondiciones
+     * @post Si el texto es válido, concursante es la configuración que describe.
+     *       Textos válidos: "astar", "bidireccional", "aproximado", "haz[:W]",
+     *       "ponderado[:P]" y "montecarlo[:I]", los dos primeros con "+bases"
+     *       opcional para usar las bases de datos del torneo
+     * @param texto - Texto de la configuración
+     * @param concursante - Configuración
+     * @return bool - false si el texto no es válido
+     * @complexity O(n) donde n es la longitud del texto
+     */
+    static bool concursanteDesdeTexto(const std::string &texto, ConcursanteTorneo &concursante);
+
+    /**
+     * @brief Juega todas las configuraciones en todos los niveles
+     * @pre Los colores de los niveles están en la paleta de EstadoCompacto
+     * @post resultados[c][n] es el resultado de la configuración c en el nivel n
+     * @param concursantes - Configuraciones
+     * @param niveles - Niveles
+     * @param resultados - Resultados de cada configuración y nivel
+     * @return bool - false si no se pudo crear un proceso o el sistema no tiene
+     *         fork (Windows)
+     * @complexity O(C * N * T / procesos) donde C es el número de configuraciones,
+     *             N el de niveles y T el tiempo límite
+     */
+    bool disputar(const std::vector<ConcursanteTorneo> &concursantes, const std::vector<Tablero> &niveles,
+                  std::vector<std::vector<ResultadoPartida>> &resultados) const;
+
+    /**
+     * @brief Resume los resultados de cada configuración
+     * @pre resultados tiene el mismo número de niveles para todas las configuraciones
+     * @post Devuelve un resumen por configuración, en el mismo orden
+     * @param resultados - Resultados de disputar
+     * @return std::vector<ResumenConcursante> - Resúmenes
+     * @complexity O(C * N)
+     */
+    static std::vector<ResumenConcursante> resumir(const std::vector<std::vector<ResultadoPartida>> &resultados);
+
+    /**
+     * @brief Obtiene el nombre de un final de partida
+     * @param fin - Final de partida
+     * @return std::string - Nombre para mostrar
+     * @complexity O(1)
+     */
+    static std::string nombreFin(FinPartida fin);
+};
+
+#endif // TORNEO_RESOLUTORES_H
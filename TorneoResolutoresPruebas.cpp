@@ -0,0 +1,158 @@
+/**
+ * @file TorneoResolutoresPruebas.cpp
+ * @brief Pruebas para el TAD TorneoResolutores del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD TorneoResolutores
+ * (TorneoResolutores.h/TorneoResolutores.cpp). Se juegan torneos pequeños con
+ * uno y varios procesos, se fuerzan los límites de tiempo y de memoria y se
+ * comprueba el resumen con resultados preparados a mano.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "TorneoResolutores.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "ResolutorAproximado.cpp"
+#include "MotorMonteCarlo.cpp"
+#include "TorneoResolutores.cpp"
+
+/**
+ * @brief Lee una lista de configuraciones
+ */
+std::vector<ConcursanteTorneo> concursantesDe(const std::vector<std::string> &textos)
+{
+    std::vector<ConcursanteTorneo> concursantes;
+    for (const std::string &texto : textos)
+    {
+        ConcursanteTorneo concursante;
+        assert(TorneoResolutores::concursanteDesdeTexto(texto, concursante));
+        concursantes.push_back(concursante);
+    }
+    return concursantes;
+}
+
+/**
+ * @brief Ejecuta las pruebas del TAD TorneoResolutores
+ * @return int - 0 si todas las pruebas pasan correctamente
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD TorneoResolutores..." << std::endl;
+
+    // Prueba 1: Textos de configuración
+    ConcursanteTorneo concursante;
+    assert(TorneoResolutores::concursanteDesdeTexto("haz:250", concursante));
+    assert(concursante.estrategia == ESTRATEGIA_HAZ && concursante.parametro == 250 && concursante.nombre == "haz:250");
+    assert(TorneoResolutores::concursanteDesdeTexto("bidireccional+bases", concursante));
+    assert(concursante.estrategia == ESTRATEGIA_BIDIRECCIONAL && concursante.conBases);
+    assert(TorneoResolutores::concursanteDesdeTexto("montecarlo", concursante) && concursante.parametro == 0);
+    assert(!TorneoResolutores::concursanteDesdeTexto("haz:", concursante));
+    assert(!TorneoResolutores::concursanteDesdeTexto("haz:-3", concursante));
+    assert(!TorneoResolutores::concursanteDesdeTexto("astar:2", concursante));
+    assert(!TorneoResolutores::concursanteDesdeTexto("montecarlo+bases", concursante));
+    assert(!TorneoResolutores::concursanteDesdeTexto("dijkstra", concursante));
+    assert(concursante.estrategia == ESTRATEGIA_MONTECARLO);
+    std::cout << "Prueba 1 superada: Textos de configuración" << std::endl;
+
+#ifndef _WIN32
+    // Prueba 2: Torneo completo con soluciones comprobadas
+    std::vector<Tablero> niveles = {crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"}),
+                                    crearTablero(5, {"RGBR", "GBRG", "BRGB"})};
+    std::vector<ConcursanteTorneo> concursantes = concursantesDe({"astar", "haz:100", "montecarlo:200"});
+    OpcionesTorneo opciones;
+    opciones.numProcesos = 1;
+    std::vector<std::vector<ResultadoPartida>> resultados;
+    assert(TorneoResolutores(opciones).disputar(concursantes, niveles, resultados));
+    assert(resultados.size() == 3 && resultados[0].size() == 2);
+    for (const std::vector<ResultadoPartida> &partidas : resultados)
+    {
+        for (const ResultadoPartida &partida : partidas)
+        {
+            assert(partida.fin == FIN_COMPLETADA && partida.resuelto && partida.memoriaPicoKB > 0);
+        }
+    }
+    std::vector<ResumenConcursante> resumenes = TorneoResolutores::resumir(resultados);
+    assert(resultados[0][0].optima && resumenes[0].resueltos == 2 && resumenes[0].mejores == 2);
+    assert(resumenes[0].longitudMediaComun <= resumenes[1].longitudMediaComun);
+    assert(resumenes[0].longitudMediaComun <= resumenes[2].longitudMediaComun);
+    std::cout << "Prueba 2 superada: 3 configuraciones en 2 niveles, longitud media óptima "
+              << resumenes[0].longitudMediaComun << std::endl;
+
+    // Prueba 3: Mismos resultados con varios procesos
+    opciones.numProcesos = 3;
+    std::vector<std::vector<ResultadoPartida>> enParalelo;
+    assert(TorneoResolutores(opciones).disputar(concursantes, niveles, enParalelo));
+    for (size_t c = 0; c < resultados.size(); c++)
+    {
+        for (size_t n = 0; n < niveles.size(); n++)
+        {
+            assert(enParalelo[c][n].longitud == resultados[c][n].longitud);
+            assert(enParalelo[c][n].nodos == resultados[c][n].nodos);
+        }
+    }
+    std::cout << "Prueba 3 superada: Mismos resultados con 1 y 3 procesos" << std::endl;
+
+    // Prueba 4: Límites de tiempo y de memoria
+    OpcionesTorneo limitadas;
+    limitadas.numProcesos = 2;
+    limitadas.segundosLimite = 0.2;
+    std::vector<std::vector<ResultadoPartida>> limitados;
+    assert(TorneoResolutores(limitadas).disputar(concursantesDe({"montecarlo:100000000"}), niveles, limitados));
+    assert(limitados[0][0].fin == FIN_TIEMPO_AGOTADO && !limitados[0][0].resuelto);
+    assert(TorneoResolutores::resumir(limitados)[0].tiemposAgotados == 2);
+    limitadas.segundosLimite = 10.0;
+    limitadas.memoriaMaximaMB = 3;
+    assert(TorneoResolutores(limitadas).disputar(concursantesDe({"bidireccional"}), niveles, limitados));
+    assert(limitados[0][0].fin == FIN_MEMORIA_AGOTADA && limitados[0][1].fin != FIN_ERROR);
+    assert(TorneoResolutores::resumir(limitados)[0].memoriasAgotadas >= 1);
+    assert(TorneoResolutores::nombreFin(FIN_MEMORIA_AGOTADA) == "memoria");
+    std::cout << "Prueba 4 superada: Límites de tiempo y de memoria" << std::endl;
+
+#else
+    std::vector<std::vector<ResultadoPartida>> resultados;
+    assert(!TorneoResolutores().disputar(std::vector<ConcursanteTorneo>(1), std::vector<Tablero>(2), resultados));
+    assert(resultados.size() == 1 && resultados[0].size() == 2 && resultados[0][0].fin == FIN_ERROR);
+    std::cout << "Pruebas 2 a 4 omitidas: el torneo necesita fork (sistemas POSIX)" << std::endl;
+#endif
+
+    // Prueba 5: Resumen de resultados preparados
+    std::vector<std::vector<ResultadoPartida>> preparados(2, std::vector<ResultadoPartida>(3));
+    int longitudes[2][3] = {{10, 20, -1}, {12, 20, 30}};
+    for (int c = 0; c < 2; c++)
+    {
+        for (int n = 0; n < 3; n++)
+        {
+            ResultadoPartida &partida = preparados[c][n];
+            partida.fin = longitudes[c][n] < 0 ? FIN_TIEMPO_AGOTADO : FIN_COMPLETADA;
+            partida.resuelto = longitudes[c][n] >= 0;
+            partida.longitud = longitudes[c][n];
+            partida.nodos = partida.resuelto ? 100 * (c + 1) : 0;
+            partida.segundos = 1.0;
+            partida.memoriaPicoKB = 1000 * (n + 1);
+        }
+    }
+    std::vector<ResumenConcursante> preparado = TorneoResolutores::resumir(preparados);
+    assert(preparado[0].resueltos == 2 && preparado[0].tiemposAgotados == 1 && preparado[0].mejores == 2);
+    assert(preparado[1].resueltos == 3 && preparado[1].mejores == 2);
+    assert(preparado[0].longitudMediaComun == 15.0 && preparado[1].longitudMediaComun == 16.0);
+    assert(preparado[0].nodosMedios == 100.0 && preparado[1].nodosMedios == 200.0);
+    assert(preparado[0].segundosTotales == 3.0 && preparado[1].memoriaPicoKB == 3000);
+    std::cout << "Prueba 5 superada: Resumen de resultados preparados" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD TorneoResolutores han sido superadas!" << std::endl;
+    return 0;
+}
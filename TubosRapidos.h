@@ -0,0 +1,186 @@
+/**
+ * @file TubosRapidos.h
+ * @brief Tubos empaquetados para reproducir partidas del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define TubosRapidos, una copia local de un EstadoCompacto con el
+ * código de 16 bits (4 bits por bola desde el fondo) y la altura de cada tubo,
+ * de modo que mover una bola son unas pocas operaciones de bits y no hace falta
+ * recalcular alturas. Lo usan el TAD MotorMonteCarlo para sus partidas
+ * simuladas y el TAD VerificadorSesiones para reproducir las de los jugadores.
+ *
+ * Es una estructura pequeña usada en bucles internos, por lo que su
+ * implementación está en este archivo.
+ */
+
+#ifndef TUBOS_RAPIDOS_H
+#define TUBOS_RAPIDOS_H
+
+#include "EstadoCompacto.h"
+#include <cstdint>
+
+static_assert(Pila::CAPACIDAD_MAXIMA == 4, "TubosRapidos guarda cada tubo en 16 bits, a 4 bits por bola");
+
+/**
+ * @brief Tubos de una partida, empaquetados a 4 bits por bola
+ */
+struct TubosRapidos
+{
+    int numPilas;
+    uint16_t codigo[Tablero::MAX_PILAS];
+    int altura[Tablero::MAX_PILAS];
+
+    /**
+     * @brief Copia los tubos de un estado
+     * @complexity O(n) donde n es el número de bolas
+     */
+    explicit TubosRapidos(const EstadoCompacto &estado)
+    {
+        numPilas = estado.getNumPilas();
+        for (int pila = 0; pila < numPilas; pila++)
+        {
+            codigo[pila] = 0;
+            altura[pila] = estado.getAltura(pila);
+            for (int posicion = 0; posicion < altura[pila]; posicion++)
+            {
+                codigo[pila] |= (uint16_t)(estado.getBola(pila, posicion) << (4 * posicion));
+            }
+        }
+    }
+
+    /**
+     * @brief Color de la bola de arriba de una pila no vacía
+     */
+    int cima(int pila) const
+    {
+        return (codigo[pila] >> (4 * (altura[pila] - 1))) & 0xF;
+    }
+
+    /**
+     * @brief Comprueba las reglas de Tablero::movimientoValido, índices incluidos
+     * @complexity O(1)
+     */
+    bool movimientoValido(int origen, int destino) const
+    {
+        return origen >= 0 && origen < numPilas && destino >= 0 && destino < numPilas && origen != destino &&
+               altura[origen] > 0 && altura[destino] < Pila::CAPACIDAD_MAXIMA &&
+               (altura[destino] == 0 || cima(destino) == cima(origen));
+    }
+
+    /**
+     * @brief Mueve la bola de arriba de origen a destino
+     * @pre movimientoValido(origen, destino)
+     * @complexity O(1)
+     */
+    void mover(int origen, int destino)
+    {
+        int bola = cima(origen);
+        altura[origen]--;
+        codigo[origen] &= (uint16_t)~(0xF << (4 * altura[origen]));
+        codigo[destino] |= (uint16_t)(bola << (4 * altura[destino]));
+        altura[destino]++;
+    }
+
+    /**
+     * @brief Indica si todas las bolas de una pila son del color de la de abajo
+     */
+    bool uniforme(int pila) const
+    {
+        return codigo[pila] == (uint16_t)((codigo[pila] & 0xF) * ((1u << (4 * altura[pila])) - 1) / 0xF);
+    }
+
+    /**
+     * @brief Comprueba la condición de Tablero::juegoTerminado
+     * @complexity O(n) donde n es el número de pilas
+     */
+    bool resuelto() const
+    {
+        for (int pila = 0; pila < numPilas; pila++)
+        {
+            if (altura[pila] != 0 && (altura[pila] != Pila::CAPACIDAD_MAXIMA || !uniforme(pila)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Cuenta las bolas que no forman parte de la racha inferior de su tubo
+     * @complexity O(n) donde n es el número de bolas
+     */
+    int desorden() const
+    {
+        int total = 0;
+        for (int pila = 0; pila < numPilas; pila++)
+        {
+            int fondo = codigo[pila] & 0xF;
+            int racha = 0;
+            while (racha < altura[pila] && ((codigo[pila] >> (4 * racha)) & 0xF) == fondo)
+            {
+                racha++;
+            }
+            total += altura[pila] - racha;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Enumera los movimientos válidos, con un solo tubo vacío como destino
+     * @param validos - Movimientos válidos
+     * @param voraces - Los válidos que juntan colores
+     * @param numVoraces - Número de movimientos voraces
+     * @return int - Número de movimientos válidos
+     * @complexity O(n^2) donde n es el número de pilas
+     */
+    int movimientosValidos(Movimiento *validos, Movimiento *voraces, int &numVoraces) const
+    {
+        int primeraVacia = -1;
+        for (int pila = 0; pila < numPilas && primeraVacia < 0; pila++)
+        {
+            if (altura[pila] == 0)
+            {
+                primeraVacia = pila;
+            }
+        }
+
+        int numValidos = 0;
+        numVoraces = 0;
+        for (int origen = 0; origen < numPilas; origen++)
+        {
+            if (altura[origen] == 0)
+            {
+                continue;
+            }
+            int bola = cima(origen);
+            for (int destino = 0; destino < numPilas; destino++)
+            {
+                if (destino == origen || altura[destino] == Pila::CAPACIDAD_MAXIMA)
+                {
+                    continue;
+                }
+                if (altura[destino] == 0)
+                {
+                    if (destino == primeraVacia)
+                    {
+                        validos[numValidos++] = Movimiento{origen, destino};
+                        // Vaciar un tubo uniforme en otro vacío no sirve de nada
+                        if (!uniforme(origen))
+                        {
+                            voraces[numVoraces++] = Movimiento{origen, destino};
+                        }
+                    }
+                }
+                else if (cima(destino) == bola)
+                {
+                    validos[numValidos++] = Movimiento{origen, destino};
+                    voraces[numVoraces++] = Movimiento{origen, destino};
+                }
+            }
+        }
+        return numValidos;
+    }
+};
+
+#endif // TUBOS_RAPIDOS_H
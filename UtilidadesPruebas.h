@@ -0,0 +1,62 @@
+/**
+ * @file UtilidadesPruebas.h
+ * @brief Funciones comunes de los programas de pruebas del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo reúne las funciones que comparten los archivos *Pruebas.cpp
+ * para preparar tableros y comprobar soluciones. Solo lo incluyen las
+ * pruebas; las funciones son inline porque cada prueba es un único programa
+ * que incluye las implementaciones directamente.
+ */
+
+#ifndef UTILIDADES_PRUEBAS_H
+#define UTILIDADES_PRUEBAS_H
+
+#include "Tablero.h"
+#include <cassert>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Crea un tablero a partir de sus tubos
+ * @pre Cada tubo cabe en una pila y hay como mucho numPilas tubos
+ * @param numPilas - Número total de tubos
+ * @param tubos - Contenido de los primeros tubos, de abajo arriba
+ * @return Tablero - Tablero con el resto de tubos vacíos
+ */
+inline Tablero crearTablero(int numPilas, const std::vector<std::string> &tubos)
+{
+    Tablero tablero;
+    tablero.inicializar(numPilas);
+    for (size_t i = 0; i < tubos.size(); i++)
+    {
+        for (char color : tubos[i])
+        {
+            bool colocada = tablero.colocarBola((int)i, color);
+            assert(colocada);
+            (void)colocada;
+        }
+    }
+    return tablero;
+}
+
+/**
+ * @brief Comprueba que una lista de movimientos resuelve un tablero
+ * @param tablero - Tablero de partida
+ * @param movimientos - Movimientos a aplicar
+ * @return bool - true si todos son válidos y el tablero queda resuelto
+ */
+inline bool resuelve(Tablero tablero, const std::vector<Movimiento> &movimientos)
+{
+    for (const Movimiento &m : movimientos)
+    {
+        if (!tablero.moverBola(m.origen, m.destino))
+        {
+            return false;
+        }
+    }
+    return tablero.juegoTerminado();
+}
+
+#endif // UTILIDADES_PRUEBAS_H
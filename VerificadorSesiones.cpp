@@ -0,0 +1,280 @@
+/**
+ * @file VerificadorSesiones.cpp
+ * @brief Implementación del TAD VerificadorSesiones para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo implementa las operaciones definidas en el TAD VerificadorSesiones
+ * (VerificadorSesiones.h). Cada sesión se reproduce sobre TubosRapidos
+ * (TubosRapidos.h), de modo que un movimiento es una comparación de cimas y
+ * dos operaciones de bits. Las líneas se interpretan sin crear cadenas ni
+ * lanzar excepciones (el nivel se busca con un std::string_view sobre la
+ * propia línea), y los hilos toman bloques de líneas de un contador atómico.
+ */
+
+#include "VerificadorSesiones.h"
+#include "TubosRapidos.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+// Líneas que toma cada hilo de una vez
+static const size_t LINEAS_POR_BLOQUE = 4096;
+
+/**
+ * Lee un número sin signo saltando los espacios anteriores
+ * @param cursor - Posición de lectura, que avanza tras el número
+ * @param fin - Fin de la línea
+ * @param valor - Número leído
+ * @return int - 1 si se leyó un número, 0 si se llegó al final y -1 si hay un carácter no válido
+ * @complexity O(d) donde d es el número de cifras
+ */
+static int leerNumeroSesion(const char *&cursor, const char *fin, int &valor)
+{
+    while (cursor < fin && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r'))
+    {
+        cursor++;
+    }
+    if (cursor == fin)
+    {
+        return 0;
+    }
+    if (*cursor < '0' || *cursor > '9')
+    {
+        return -1;
+    }
+
+    valor = 0;
+    while (cursor < fin && *cursor >= '0' && *cursor <= '9')
+    {
+        valor = std::min(valor * 10 + (*cursor - '0'), 1000000);
+        cursor++;
+    }
+    return 1;
+}
+
+/**
+ * Constructor por defecto
+ * @complexity O(1)
+ */
+VerificadorSesiones::VerificadorSesiones()
+{
+}
+
+/**
+ * Registra un nivel
+ * @param id - Identificador del nivel (sin espacios)
+ * @param tablero - Posición de partida del nivel
+ * @return bool - false si el identificador o el tablero no son válidos
+ * @complexity O(n) donde n es el número de bolas
+ */
+bool VerificadorSesiones::registrarNivel(const std::string &id, const Tablero &tablero)
+{
+    EstadoCompacto estado;
+    if (id.empty() || id.find_first_of(" \t\r\n") != std::string::npos || id[0] == '#' ||
+        !estado.desdeTablero(tablero))
+    {
+        return false;
+    }
+
+    std::unordered_map<std::string_view, int>::iterator it = indices.find(id);
+    if (it != indices.end())
+    {
+        niveles[it->second] = estado;
+    }
+    else
+    {
+        ids.push_back(id);
+        indices[ids.back()] = (int)niveles.size();
+        niveles.push_back(estado);
+    }
+    return true;
+}
+
+/**
+ * Obtiene el número de niveles registrados
+ * @return int - Número de niveles
+ * @complexity O(1)
+ */
+int VerificadorSesiones::getNumNiveles() const
+{
+    return (int)niveles.size();
+}
+
+/**
+ * Verifica una sesión
+ * @param id - Identificador del nivel
+ * @param movimientos - Movimientos del jugador
+ * @return ResultadoSesion - Resultado con linea = 0
+ * @complexity O(m + n) donde m es el número de movimientos y n el de pilas
+ */
+ResultadoSesion VerificadorSesiones::verificar(const std::string &id,
+                                               const std::vector<Movimiento> &movimientos) const
+{
+    ResultadoSesion resultado = {0, SESION_NIVEL_DESCONOCIDO, 0};
+    std::unordered_map<std::string_view, int>::const_iterator it = indices.find(id);
+    if (it == indices.end())
+    {
+        return resultado;
+    }
+
+    TubosRapidos tubos(niveles[it->second]);
+    for (const Movimiento &movimiento : movimientos)
+    {
+        if (!tubos.movimientoValido(movimiento.origen, movimiento.destino))
+        {
+            resultado.estado = SESION_MOVIMIENTO_ILEGAL;
+            return resultado;
+        }
+        tubos.mover(movimiento.origen, movimiento.destino);
+        resultado.movimientosValidos++;
+    }
+    resultado.estado = tubos.resuelto() ? SESION_RESUELTA : SESION_SIN_TERMINAR;
+    return resultado;
+}
+
+/**
+ * Verifica una línea de un archivo de sesiones
+ * @param inicio - Primer carácter de la línea
+ * @param fin - Fin de la línea (sin el salto)
+ * @param linea - Número de línea
+ * @return ResultadoSesion - Resultado de la sesión
+ * @complexity O(L) donde L es la longitud de la línea
+ */
+ResultadoSesion VerificadorSesiones::verificarLinea(const char *inicio, const char *fin, long long linea) const
+{
+    ResultadoSesion resultado = {linea, SESION_MAL_FORMADA, 0};
+
+    while (inicio < fin && (*inicio == ' ' || *inicio == '\t'))
+    {
+        inicio++;
+    }
+    const char *finId = inicio;
+    while (finId < fin && *finId != ' ' && *finId != '\t' && *finId != '\r')
+    {
+        finId++;
+    }
+
+    std::unordered_map<std::string_view, int>::const_iterator it =
+        indices.find(std::string_view(inicio, (size_t)(finId - inicio)));
+    if (it == indices.end())
+    {
+        resultado.estado = SESION_NIVEL_DESCONOCIDO;
+        return resultado;
+    }
+
+    TubosRapidos tubos(niveles[it->second]);
+    const char *cursor = finId;
+    while (true)
+    {
+        int origen, destino;
+        int leido = leerNumeroSesion(cursor, fin, origen);
+        if (leido == 0)
+        {
+            break;
+        }
+        if (leido < 0 || leerNumeroSesion(cursor, fin, destino) <= 0)
+        {
+            resultado.estado = SESION_MAL_FORMADA;
+            return resultado;
+        }
+        if (!tubos.movimientoValido(origen - 1, destino - 1))
+        {
+            resultado.estado = SESION_MOVIMIENTO_ILEGAL;
+            return resultado;
+        }
+        tubos.mover(origen - 1, destino - 1);
+        resultado.movimientosValidos++;
+    }
+
+    resultado.estado = tubos.resuelto() ? SESION_RESUELTA : SESION_SIN_TERMINAR;
+    return resultado;
+}
+
+/**
+ * Verifica un bloque de texto con una sesión por línea
+ * @param texto - Contenido de un archivo de sesiones
+ * @param resultados - Resultados de las sesiones
+ * @param numHilos - Hilos de trabajo (0 = uno por núcleo)
+ * @complexity O(T / h) donde T es el tamaño del texto y h el número de hilos
+ */
+void VerificadorSesiones::verificarTexto(const std::string &texto, std::vector<ResultadoSesion> &resultados,
+                                         int numHilos) const
+{
+    // Inicio de cada línea con sesión y su número de línea
+    std::vector<size_t> inicios;
+    std::vector<long long> numerosLinea;
+    long long numeroLinea = 0;
+    for (size_t posicion = 0; posicion < texto.size();)
+    {
+        numeroLinea++;
+        size_t salto = texto.find('\n', posicion);
+        size_t finLinea = salto == std::string::npos ? texto.size() : salto;
+        size_t primero = texto.find_first_not_of(" \t\r", posicion);
+        if (primero < finLinea && texto[primero] != '#')
+        {
+            inicios.push_back(posicion);
+            numerosLinea.push_back(numeroLinea);
+        }
+        posicion = finLinea + 1;
+    }
+
+    resultados.resize(inicios.size());
+    if (numHilos <= 0)
+    {
+        numHilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t numBloques = (inicios.size() + LINEAS_POR_BLOQUE - 1) / LINEAS_POR_BLOQUE;
+    numHilos = (int)std::min((size_t)numHilos, std::max((size_t)1, numBloques));
+
+    std::atomic<size_t> siguienteBloque(0);
+    auto trabajar = [&]()
+    {
+        for (size_t bloque = siguienteBloque++; bloque < numBloques; bloque = siguienteBloque++)
+        {
+            size_t ultimo = std::min(inicios.size(), (bloque + 1) * LINEAS_POR_BLOQUE);
+            for (size_t i = bloque * LINEAS_POR_BLOQUE; i < ultimo; i++)
+            {
+                const char *inicio = texto.data() + inicios[i];
+                const char *fin = texto.data() + texto.size();
+                const char *salto = std::find(inicio, fin, '\n');
+                resultados[i] = verificarLinea(inicio, salto, numerosLinea[i]);
+            }
+        }
+    };
+
+    std::vector<std::thread> hilos;
+    for (int h = 1; h < numHilos; h++)
+    {
+        hilos.emplace_back(trabajar);
+    }
+    trabajar();
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+}
+
+/**
+ * Verifica un archivo de sesiones
+ * @param nombreArchivo - Ruta del archivo
+ * @param resultados - Resultados de las sesiones
+ * @param numHilos - Hilos de trabajo (0 = uno por núcleo)
+ * @return bool - false si no se pudo leer el archivo
+ * @complexity O(T / h) donde T es el tamaño del archivo y h el número de hilos
+ */
+bool VerificadorSesiones::verificarArchivo(const std::string &nombreArchivo, std::vector<ResultadoSesion> &resultados,
+                                           int numHilos) const
+{
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    if (!archivo.is_open())
+    {
+        return false;
+    }
+
+    std::string texto((std::istreambuf_iterator<char>(archivo)), std::istreambuf_iterator<char>());
+    verificarTexto(texto, resultados, numHilos);
+    return true;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file VerificadorSesiones.h
+ * @brief TAD VerificadorSesiones para el juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo define el Tipo Abstracto de Datos (TAD) VerificadorSesiones,
+ * que comprueba en bloque secuencias de movimientos de jugadores. Cada sesión
+ * es un identificador de nivel y una lista de movimientos; el verificador la
+ * reproduce sobre una copia empaquetada del nivel (16 bits y una altura por
+ * tubo, sin objetos Tablero ni entrada/salida por consola), aplica las mismas
+ * reglas que Tablero::movimientoValido y comprueba al final la misma condición
+ * que Tablero::juegoTerminado.
+ *
+ * Los archivos de sesiones tienen una sesión por línea:
+ *
+ *     idNivel origen destino origen destino ...
+ *
+ * con los tubos numerados desde 1, como en la interfaz del juego. Las líneas
+ * vacías y las que empiezan por '#' se ignoran. Las líneas se reparten por
+ * bloques entre varios hilos.
+ */
+
+#ifndef VERIFICADOR_SESIONES_H
+#define VERIFICADOR_SESIONES_H
+
+#include "EstadoCompacto.h"
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Resultado de la verificación de una sesión
+ */
+enum EstadoSesion
+{
+    SESION_RESUELTA,          // Todos los movimientos son válidos y el nivel queda resuelto
+    SESION_MOVIMIENTO_ILEGAL, // Algún movimiento incumple las reglas
+    SESION_SIN_TERMINAR,      // Los movimientos son válidos pero el nivel no queda resuelto
+    SESION_NIVEL_DESCONOCIDO, // El identificador de nivel no está registrado
+    SESION_MAL_FORMADA        // La línea no se puede interpretar
+};
+
+/**
+ * @brief Resultado de una sesión
+ */
+struct ResultadoSesion
+{
+    long long linea;        // Línea del archivo (1 en adelante; 0 si no procede de un archivo)
+    EstadoSesion estado;    // Resultado de la verificación
+    int movimientosValidos; // Movimientos aceptados antes del primero ilegal
+};
+
+/**
+ * @brief TAD VerificadorSesiones que valida movimientos de jugadores en bloque
+ */
+class VerificadorSesiones
+{
+private:
+    std::deque<std::string> ids;                       // Identificador de cada nivel (no se mueven al crecer)
+    std::unordered_map<std::string_view, int> indices; // Posición en niveles de cada identificador de ids
+    std::vector<EstadoCompacto> niveles;               // Posición de partida de cada nivel
+
+    ResultadoSesion verificarLinea(const char *inicio, const char *fin, long long linea) const;
+
+public:
+    /**
+     * @brief Constructor por defecto
+     * @pre No hay precondiciones
+     * @post Crea un verificador sin niveles
+     * @complexity O(1)
+     */
+    VerificadorSesiones();
+
+    // Las claves de indices apuntan a ids, así que el verificador no se copia
+    VerificadorSesiones(const VerificadorSesiones &) = delete;
+    VerificadorSesiones &operator=(const VerificadorSesiones &) = delete;
+
+    /**
+     * @brief Registra un nivel
+     * @pre No hay precondiciones
+     * @post Las sesiones con el identificador dado empiezan en el tablero; si el
+     *       identificador ya existía se sustituye su tablero
+     * @param id - Identificador del nivel (sin espacios)
+     * @param tablero - Posición de partida del nivel
+     * @return bool - false si el identificador está vacío o contiene espacios,
+     *         o si algún color no está en la paleta de EstadoCompacto
+     * @complexity O(n) donde n es el número de bolas
+     */
+    bool registrarNivel(const std::string &id, const Tablero &tablero);
+
+    /**
+     * @brief Obtiene el número de niveles registrados
+     * @return int - Número de niveles
+     * @complexity O(1)
+     */
+    int getNumNiveles() const;
+
+    /**
+     * @brief Verifica una sesión
+     * @pre No hay precondiciones
+     * @post Devuelve el resultado de reproducir los movimientos (índices desde 0)
+     * @param id - Identificador del nivel
+     * @param movimientos - Movimientos del jugador
+     * @return ResultadoSesion - Resultado con linea = 0
+     * @complexity O(m + n) donde m es el número de movimientos y n el de pilas
+     */
+    ResultadoSesion verificar(const std::string &id, const std::vector<Movimiento> &movimientos) const;
+
+    /**
+     * @brief Verifica un bloque de texto con una sesión por línea
+     * @pre No hay precondiciones
+     * @post resultados contiene una entrada por sesión en el orden del texto
+     * @param texto - Contenido de un archivo de sesiones
+     * @param resultados - Resultados de las sesiones
+     * @param numHilos - Hilos de trabajo (0 = uno por núcleo)
+     * @complexity O(T / h) donde T es el tamaño del texto y h el número de hilos
+     */
+    void verificarTexto(const std::string &texto, std::vector<ResultadoSesion> &resultados, int numHilos = 0) const;
+
+    /**
+     * @brief Verifica un archivo de sesiones
+     * @pre No hay precondiciones
+     * @post resultados contiene una entrada por sesión en el orden del archivo
+     * @param nombreArchivo - Ruta del archivo
+     * @param resultados - Resultados de las sesiones
+     * @param numHilos - Hilos de trabajo (0 = uno por núcleo)
+     * @return bool - false si no se pudo leer el archivo
+     * @complexity O(T / h) donde T es el tamaño del archivo y h el número de hilos
+     */
+    bool verificarArchivo(const std::string &nombreArchivo, std::vector<ResultadoSesion> &resultados,
+                          int numHilos = 0) const;
+};
+
+#endif // VERIFICADOR_SESIONES_H
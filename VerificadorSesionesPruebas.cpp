@@ -0,0 +1,155 @@
+/**
+ * @file VerificadorSesionesPruebas.cpp
+ * @brief Pruebas para el TAD VerificadorSesiones del juego Ball Sort Puzzle
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este archivo contiene las pruebas del TAD VerificadorSesiones
+ * (VerificadorSesiones.h/VerificadorSesiones.cpp). Los resultados se comparan
+ * con los de reproducir las mismas sesiones sobre un Tablero.
+ *
+ * Cada prueba utiliza assert para verificar que el comportamiento sea correcto,
+ * y muestra mensajes informativos sobre el progreso de las pruebas en la consola.
+ */
+
+#include "VerificadorSesiones.h"
+#include "Resolutor.h"
+#include "UtilidadesPruebas.h"
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <sstream>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "EstadoCompacto.cpp"
+#include "TablaPerfecta.cpp"
+#include "BaseFinal.cpp"
+#include "BasePatrones.cpp"
+#include "Resolutor.cpp"
+#include "VerificadorSesiones.cpp"
+
+/**
+ * @brief Escribe una sesión en el formato de los archivos de sesiones
+ * @param id - Identificador del nivel
+ * @param movimientos - Movimientos (índices desde 0)
+ * @return std::string - Línea de la sesión
+ */
+std::string lineaSesion(const std::string &id, const std::vector<Movimiento> &movimientos)
+{
+    std::ostringstream linea;
+    linea << id;
+    for (const Movimiento &movimiento : movimientos)
+    {
+        linea << " " << movimiento.origen + 1 << " " << movimiento.destino + 1;
+    }
+    return linea.str();
+}
+
+/**
+ * @brief Función principal que ejecuta todas las pruebas
+ * @return int - Código de salida (0 si todas las pruebas son exitosas)
+ */
+int main()
+{
+    std::cout << "Iniciando pruebas del TAD VerificadorSesiones..." << std::endl;
+
+    Tablero ejemplo = crearTablero(6, {"RBGY", "GYRB", "BYGR", "RGBY"});
+    Tablero pequeno = crearTablero(4, {"RRRG", "GGGR"});
+    ResultadoResolucion solucion = Resolutor().resolver(ejemplo);
+    assert(solucion.resuelto);
+
+    // Prueba 1: Registro de niveles
+    VerificadorSesiones verificador;
+    assert(verificador.registrarNivel("ejemplo", ejemplo));
+    assert(verificador.registrarNivel("pequeno", pequeno));
+    assert(!verificador.registrarNivel("", ejemplo));
+    assert(!verificador.registrarNivel("con espacio", ejemplo));
+    assert(!verificador.registrarNivel("raro", crearTablero(3, {"XXXX"})));
+    assert(verificador.registrarNivel("ejemplo", ejemplo)); // Sustituye al anterior
+    assert(verificador.getNumNiveles() == 2);
+    std::cout << "Prueba 1 superada: Registro de niveles" << std::endl;
+
+    // Prueba 2: Verificación de sesiones sueltas
+    ResultadoSesion resultado = verificador.verificar("ejemplo", solucion.movimientos);
+    assert(resultado.estado == SESION_RESUELTA && resultado.movimientosValidos == 15);
+    std::vector<Movimiento> incompleta(solucion.movimientos.begin(), solucion.movimientos.end() - 1);
+    resultado = verificador.verificar("ejemplo", incompleta);
+    assert(resultado.estado == SESION_SIN_TERMINAR && resultado.movimientosValidos == 14);
+    std::vector<Movimiento> ilegal = solucion.movimientos;
+    ilegal.insert(ilegal.begin() + 3, Movimiento{2, 2});
+    resultado = verificador.verificar("ejemplo", ilegal);
+    assert(resultado.estado == SESION_MOVIMIENTO_ILEGAL && resultado.movimientosValidos == 3);
+    assert(verificador.verificar("otro", solucion.movimientos).estado == SESION_NIVEL_DESCONOCIDO);
+    std::vector<Movimiento> resuelvePequeno = {Movimiento{0, 2}, Movimiento{1, 3}, Movimiento{2, 1}, Movimiento{3, 0}};
+    assert(verificador.verificar("pequeno", resuelvePequeno).estado == SESION_RESUELTA);
+    std::cout << "Prueba 2 superada: Sesiones sueltas" << std::endl;
+
+    // Prueba 3: Mismos resultados que Tablero en sesiones aleatorias
+    std::mt19937 generador(33);
+    std::string texto;
+    std::vector<ResultadoSesion> esperados;
+    for (int sesion = 0; sesion < 3000; sesion++)
+    {
+        Tablero tablero = ejemplo;
+        std::vector<Movimiento> movimientos;
+        int longitud = (int)(generador() % 60);
+        ResultadoSesion esperado = {0, SESION_SIN_TERMINAR, 0};
+        for (int i = 0; i < longitud; i++)
+        {
+            Movimiento movimiento = {(int)(generador() % 7), (int)(generador() % 7)};
+            movimientos.push_back(movimiento);
+            if (esperado.estado == SESION_SIN_TERMINAR)
+            {
+                if (tablero.moverBola(movimiento.origen, movimiento.destino))
+                {
+                    esperado.movimientosValidos++;
+                }
+                else
+                {
+                    esperado.estado = SESION_MOVIMIENTO_ILEGAL;
+                }
+            }
+        }
+        if (esperado.estado == SESION_SIN_TERMINAR && tablero.juegoTerminado())
+        {
+            esperado.estado = SESION_RESUELTA;
+        }
+
+        resultado = verificador.verificar("ejemplo", movimientos);
+        assert(resultado.estado == esperado.estado);
+        assert(resultado.movimientosValidos == esperado.movimientosValidos);
+        texto += lineaSesion("ejemplo", movimientos) + "\n";
+        esperados.push_back(esperado);
+    }
+    std::cout << "Prueba 3 superada: Coincidencia con Tablero en 3000 sesiones" << std::endl;
+
+    // Prueba 4: Archivos de sesiones con varios hilos
+    std::string cabecera = "# Sesiones de prueba\n\n" + lineaSesion("ejemplo", solucion.movimientos) + "\r\n" +
+                           "desconocido 1 2\n" + "ejemplo 1 x\n" + "ejemplo 1 5 2\n";
+    std::vector<ResultadoSesion> resultados;
+    verificador.verificarTexto(cabecera + texto, resultados, 4);
+    assert(resultados.size() == 4 + esperados.size());
+    assert(resultados[0].linea == 3 && resultados[0].estado == SESION_RESUELTA);
+    assert(resultados[1].linea == 4 && resultados[1].estado == SESION_NIVEL_DESCONOCIDO);
+    assert(resultados[2].estado == SESION_MAL_FORMADA);
+    assert(resultados[3].estado == SESION_MAL_FORMADA && resultados[3].movimientosValidos == 1);
+    for (size_t i = 0; i < esperados.size(); i++)
+    {
+        assert(resultados[4 + i].linea == (long long)(7 + i));
+        assert(resultados[4 + i].estado == esperados[i].estado);
+        assert(resultados[4 + i].movimientosValidos == esperados[i].movimientosValidos);
+    }
+    std::vector<ResultadoSesion> unHilo;
+    verificador.verificarTexto(cabecera + texto, unHilo, 1);
+    for (size_t i = 0; i < resultados.size(); i++)
+    {
+        assert(unHilo[i].estado == resultados[i].estado && unHilo[i].linea == resultados[i].linea);
+    }
+    assert(!verificador.verificarArchivo("no_existe.txt", resultados));
+    std::cout << "Prueba 4 superada: Archivo de " << resultados.size() << " sesiones en varios hilos" << std::endl;
+
+    std::cout << "¡Todas las pruebas del TAD VerificadorSesiones han sido superadas!" << std::endl;
+    return 0;
+}
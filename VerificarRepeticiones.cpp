@@ -0,0 +1,301 @@
+/**
+ * @file VerificarRepeticiones.cpp
+ * @brief Herramienta de verificación masiva de partidas grabadas
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa lee archivos de repetición (cada uno con una o varias partidas
+ * concatenadas), vuelve a ejecutar cada partida con el TAD Repeticion a través
+ * de Juego::realizarMovimiento y la clasifica como válida, con un movimiento
+ * ilegal, sin terminar o dañada. Las partidas válidas en las que más de la
+ * mitad de los movimientos se hicieron por debajo de un umbral de tiempo se
+ * marcan como sospechosas. Las partidas de cada archivo se delimitan antes de
+ * descodificarlas y se reparten entre varios hilos en bloques de
+ * PARTIDAS_POR_BLOQUE, de modo que un archivo grande también usa todos los
+ * hilos; a cambio, todos los archivos se cargan en memoria a la vez.
+ *
+ * Uso: VerificarRepeticiones <archivo.rep>... [--hilos N] [--umbral-ms N]
+ */
+
+#include "Juego.h"
+#include "Repeticion.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "Repeticion.cpp"
+
+// Partidas que toma cada hilo de una vez
+static const size_t PARTIDAS_POR_BLOQUE = 1024;
+
+/**
+ * @brief Archivo de repetición cargado y dividido en partidas
+ */
+struct ArchivoRepeticiones
+{
+    std::string nombre;          // Ruta del archivo
+    std::vector<uint8_t> datos;  // Contenido del archivo
+    std::vector<size_t> inicios; // Byte donde empieza cada partida, más el final de la última
+    std::string incidencia;      // Archivo ilegible o registro dañado tras la última partida delimitada
+};
+
+/**
+ * @brief Bloque de partidas consecutivas de un archivo
+ */
+struct BloquePartidas
+{
+    size_t archivo; // Índice del archivo
+    size_t primera; // Primera partida del bloque
+    size_t fin;     // Partida siguiente a la última del bloque
+};
+
+/**
+ * @brief Resultado de la verificación de un bloque de partidas
+ */
+struct VerificacionBloque
+{
+    long long validas;                    // Partidas resueltas con movimientos válidos
+    long long noValidas;                  // Partidas dañadas, con movimientos ilegales o sin terminar
+    long long sospechosas;                // Partidas válidas jugadas demasiado rápido
+    long long movimientos;                // Movimientos reproducidos
+    std::vector<std::string> incidencias; // Partidas no válidas o sospechosas
+};
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: VerificarRepeticiones <archivo.rep>... [--hilos N] [--umbral-ms N]" << std::endl;
+}
+
+/**
+ * @brief Reparte tareas numeradas entre varios hilos, que las toman de un contador atómico
+ * @param numHilos - Hilos como máximo
+ * @param numTareas - Número de tareas
+ * @param tarea - Función que ejecuta la tarea de un índice
+ * @return int - Hilos usados
+ */
+int repartir(int numHilos, size_t numTareas, const std::function<void(size_t)> &tarea)
+{
+    std::atomic<size_t> siguiente(0);
+    std::vector<std::thread> hilos;
+    for (size_t h = 0; h < std::min((size_t)numHilos, std::max((size_t)1, numTareas)); h++)
+    {
+        hilos.emplace_back([&]()
+                           {
+                               for (size_t i = siguiente++; i < numTareas; i = siguiente++)
+                               {
+                                   tarea(i);
+                               }
+                           });
+    }
+    for (std::thread &hilo : hilos)
+    {
+        hilo.join();
+    }
+    return (int)hilos.size();
+}
+
+/**
+ * @brief Carga un archivo y localiza el comienzo de cada partida sin descodificarlas
+ * @param archivo - Archivo con el nombre ya puesto
+ */
+void delimitarPartidas(ArchivoRepeticiones &archivo)
+{
+    std::ifstream entrada(archivo.nombre, std::ios::binary);
+    if (!entrada.is_open())
+    {
+        archivo.incidencia = archivo.nombre + ": no se pudo abrir";
+        return;
+    }
+    archivo.datos.assign(std::istreambuf_iterator<char>(entrada), std::istreambuf_iterator<char>());
+
+    size_t posicion = 0;
+    archivo.inicios.push_back(0);
+    while (posicion < archivo.datos.size())
+    {
+        size_t longitud;
+        if (!Repeticion::medirRegistro(archivo.datos.data() + posicion, archivo.datos.size() - posicion, longitud))
+        {
+            // Sin registro válido no se puede saber dónde empieza el siguiente
+            archivo.incidencia = archivo.nombre + " #" + std::to_string(archivo.inicios.size()) +
+                                 ": registro dañado en el byte " + std::to_string(posicion);
+            return;
+        }
+        posicion += longitud;
+        archivo.inicios.push_back(posicion);
+    }
+}
+
+/**
+ * @brief Verifica un bloque de partidas de un archivo
+ * @param archivo - Archivo ya delimitado
+ * @param bloque - Partidas a verificar
+ * @param umbralMs - Milisegundos por debajo de los cuales un movimiento es rápido
+ * @param resultado - Resultado de la verificación
+ */
+void verificarBloque(const ArchivoRepeticiones &archivo, const BloquePartidas &bloque, uint32_t umbralMs,
+                     VerificacionBloque &resultado)
+{
+    resultado.validas = 0;
+    resultado.noValidas = 0;
+    resultado.sospechosas = 0;
+    resultado.movimientos = 0;
+
+    Repeticion repeticion;
+    Juego juego;
+    for (size_t partida = bloque.primera; partida < bloque.fin; partida++)
+    {
+        std::string prefijo = archivo.nombre + " #" + std::to_string(partida + 1) + ": ";
+        size_t inicio = archivo.inicios[partida];
+        size_t leidos;
+        if (!repeticion.descodificar(archivo.datos.data() + inicio, archivo.inicios[partida + 1] - inicio, leidos))
+        {
+            resultado.incidencias.push_back(prefijo + "registro dañado en el byte " + std::to_string(inicio));
+            resultado.noValidas++;
+            continue; // El registro está delimitado, así que se sigue con el siguiente
+        }
+
+        int movimientosValidos;
+        bool resuelta = repeticion.reproducir(juego, movimientosValidos);
+        resultado.movimientos += movimientosValidos;
+        if (movimientosValidos < (int)repeticion.getMovimientos().size())
+        {
+            resultado.incidencias.push_back(prefijo + "movimiento ilegal en la posición " +
+                                            std::to_string(movimientosValidos + 1));
+            resultado.noValidas++;
+            continue;
+        }
+        if (!resuelta)
+        {
+            resultado.incidencias.push_back(prefijo + "partida sin terminar");
+            resultado.noValidas++;
+            continue;
+        }
+
+        const std::vector<uint32_t> &tiempos = repeticion.getTiempos();
+        size_t rapidos = std::count_if(tiempos.begin(), tiempos.end(), [umbralMs](uint32_t t)
+                                       { return t < umbralMs; });
+        if (!tiempos.empty() && 2 * rapidos > tiempos.size())
+        {
+            resultado.incidencias.push_back(prefijo + "sospechosa (" + std::to_string(rapidos) + " de " +
+                                            std::to_string(tiempos.size()) + " movimientos en menos de " +
+                                            std::to_string(umbralMs) + " ms)");
+            resultado.sospechosas++;
+        }
+        resultado.validas++;
+    }
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - 0 si todas las partidas son válidas, 2 si alguna no lo es
+ */
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> archivos;
+    int numHilos = (int)std::max(1u, std::thread::hardware_concurrency());
+    uint32_t umbralMs = 100;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--hilos" && i + 1 < argc)
+        {
+            numHilos = std::max(1, std::stoi(argv[++i]));
+        }
+        else if (opcion == "--umbral-ms" && i + 1 < argc)
+        {
+            umbralMs = (uint32_t)std::stoul(argv[++i]);
+        }
+        else if (opcion.compare(0, 2, "--") == 0)
+        {
+            mostrarUso();
+            return 1;
+        }
+        else
+        {
+            archivos.push_back(opcion);
+        }
+    }
+    if (archivos.empty())
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    // Primero se delimitan las partidas de cada archivo, que es solo recorrer sus
+    // bytes, y después se reparten en bloques para que un archivo grande no
+    // quede en un solo hilo
+    std::vector<ArchivoRepeticiones> cargados(archivos.size());
+    auto inicio = std::chrono::steady_clock::now();
+    repartir(numHilos, archivos.size(), [&](size_t i)
+             {
+                 cargados[i].nombre = archivos[i];
+                 delimitarPartidas(cargados[i]);
+             });
+
+    std::vector<BloquePartidas> bloques;
+    for (size_t i = 0; i < cargados.size(); i++)
+    {
+        size_t numPartidas = cargados[i].inicios.empty() ? 0 : cargados[i].inicios.size() - 1;
+        for (size_t primera = 0; primera < numPartidas; primera += PARTIDAS_POR_BLOQUE)
+        {
+            bloques.push_back(BloquePartidas{i, primera, std::min(numPartidas, primera + PARTIDAS_POR_BLOQUE)});
+        }
+    }
+    std::vector<VerificacionBloque> resultados(bloques.size());
+    int hilosUsados = repartir(numHilos, bloques.size(), [&](size_t b)
+                               { verificarBloque(cargados[bloques[b].archivo], bloques[b], umbralMs, resultados[b]); });
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    // Las incidencias salen en el orden de los archivos y de las partidas en cada uno
+    long long validas = 0;
+    long long noValidas = 0;
+    long long sospechosas = 0;
+    long long movimientos = 0;
+    size_t b = 0;
+    for (size_t i = 0; i < cargados.size(); i++)
+    {
+        for (; b < bloques.size() && bloques[b].archivo == i; b++)
+        {
+            validas += resultados[b].validas;
+            noValidas += resultados[b].noValidas;
+            sospechosas += resultados[b].sospechosas;
+            movimientos += resultados[b].movimientos;
+            for (const std::string &incidencia : resultados[b].incidencias)
+            {
+                std::cout << incidencia << std::endl;
+            }
+        }
+        if (!cargados[i].incidencia.empty())
+        {
+            std::cout << cargados[i].incidencia << std::endl;
+            noValidas++;
+        }
+    }
+
+    long long partidas = validas + noValidas;
+    segundos = std::max(segundos, 1e-9);
+    std::cout << "Partidas: " << partidas << " (" << validas << " válidas, " << noValidas << " no válidas, "
+              << sospechosas << " sospechosas)" << std::endl;
+    std::cout << "Tiempo: " << segundos << " s en " << hilosUsados << " hilos" << std::endl;
+    std::cout << "Partidas por segundo: " << (long long)(partidas / segundos) << std::endl;
+    std::cout << "Movimientos por segundo: " << (long long)(movimientos / segundos) << std::endl;
+    return noValidas > 0 ? 2 : 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file VerificarSesiones.cpp
+ * @brief Herramienta de verificación en bloque de sesiones de jugadores
+ * @author Ricardo Lucas Fernández
+ * @date Mayo 2025
+ *
+ * Este programa carga los niveles indicados, verifica con el TAD
+ * VerificadorSesiones un archivo con una sesión por línea
+ * ("idNivel origen destino origen destino ...") y escribe el resultado de cada
+ * sesión en un archivo de salida, una línea por sesión:
+ *
+ *     linea resultado movimientosValidos
+ *
+ * donde resultado es RESUELTA, ILEGAL, SIN_TERMINAR, NIVEL_DESCONOCIDO o
+ * MAL_FORMADA. En la consola solo se muestra el resumen y el rendimiento.
+ *
+ * Uso: VerificarSesiones <sesiones.txt> --nivel id archivo.cnf... [--salida archivo]
+ *                        [--hilos N]
+ */
+
+#include "Juego.h"
+#include "VerificadorSesiones.h"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Incluir las implementaciones directamente para evitar errores de "undefined reference"
+#include "Pila.cpp"
+#include "Tablero.cpp"
+#include "Juego.cpp"
+#include "EstadoCompacto.cpp"
+#include "VerificadorSesiones.cpp"
+
+// Nombre de cada resultado en el archivo de salida
+static const char *NOMBRES_ESTADO[] = {"RESUELTA", "ILEGAL", "SIN_TERMINAR", "NIVEL_DESCONOCIDO", "MAL_FORMADA"};
+
+/**
+ * @brief Muestra la forma de uso del programa
+ */
+void mostrarUso()
+{
+    std::cerr << "Uso: VerificarSesiones <sesiones.txt> --nivel id archivo.cnf... [--salida archivo]" << std::endl;
+    std::cerr << "                        [--hilos N]" << std::endl;
+}
+
+/**
+ * @brief Escribe el resultado de cada sesión
+ * @param nombreArchivo - Ruta del archivo de salida
+ * @param resultados - Resultados de las sesiones
+ * @return bool - true si se pudo escribir
+ */
+bool escribirResultados(const std::string &nombreArchivo, const std::vector<ResultadoSesion> &resultados)
+{
+    FILE *archivo = std::fopen(nombreArchivo.c_str(), "w");
+    if (archivo == nullptr)
+    {
+        return false;
+    }
+    for (const ResultadoSesion &resultado : resultados)
+    {
+        std::fprintf(archivo, "%lld %s %d\n", resultado.linea, NOMBRES_ESTADO[resultado.estado],
+                     resultado.movimientosValidos);
+    }
+    return std::fclose(archivo) == 0;
+}
+
+/**
+ * @brief Función principal
+ * @param argc - Número de argumentos
+ * @param argv - Argumentos de la línea de órdenes
+ * @return int - 0 si todas las sesiones están resueltas, 2 si alguna no lo está
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::string archivoSesiones = argv[1];
+    std::string archivoSalida;
+    int numHilos = 0;
+    VerificadorSesiones verificador;
+    for (int i = 2; i < argc; i++)
+    {
+        std::string opcion = argv[i];
+        if (opcion == "--nivel" && i + 2 < argc)
+        {
+            std::string id = argv[++i];
+            std::string archivoNivel = argv[++i];
+            Juego juego;
+            if (!juego.inicializar(archivoNivel) || !verificador.registrarNivel(id, juego.getTablero()))
+            {
+                std::cerr << "Error: No se pudo cargar el nivel " << id << " de " << archivoNivel << std::endl;
+                return 1;
+            }
+        }
+        else if (opcion == "--salida" && i + 1 < argc)
+        {
+            archivoSalida = argv[++i];
+        }
+        else if (opcion == "--hilos" && i + 1 < argc)
+        {
+            numHilos = std::max(1, std::stoi(argv[++i]));
+        }
+        else
+        {
+            mostrarUso();
+            return 1;
+        }
+    }
+    if (verificador.getNumNiveles() == 0)
+    {
+        mostrarUso();
+        return 1;
+    }
+
+    std::vector<ResultadoSesion> resultados;
+    auto inicio = std::chrono::steady_clock::now();
+    if (!verificador.verificarArchivo(archivoSesiones, resultados, numHilos))
+    {
+        std::cerr << "Error: No se pudo leer " << archivoSesiones << std::endl;
+        return 1;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    if (!archivoSalida.empty() && !escribirResultados(archivoSalida, resultados))
+    {
+        std::cerr << "Error: No se pudo escribir " << archivoSalida << std::endl;
+        return 1;
+    }
+
+    long long porEstado[SESION_MAL_FORMADA + 1] = {0, 0, 0, 0, 0};
+    long long movimientos = 0;
+    for (const ResultadoSesion &resultado : resultados)
+    {
+        porEstado[resultado.estado]++;
+        movimientos += resultado.movimientosValidos;
+    }
+
+    segundos = std::max(segundos, 1e-9);
+    std::cout << "Sesiones: " << resultados.size() << " (" << segundos << " s)" << std::endl;
+    for (int estado = SESION_RESUELTA; estado <= SESION_MAL_FORMADA; estado++)
+    {
+        std::cout << "  " << NOMBRES_ESTADO[estado] << ": " << porEstado[estado] << std::endl;
+    }
+    std::cout << "Sesiones por segundo: " << (long long)(resultados.size() / segundos) << std::endl;
+    std::cout << "Movimientos por segundo: " << (long long)(movimientos / segundos) << std::endl;
+    return porEstado[SESION_RESUELTA] == (long long)resultados.size() ? 0 : 2;
+}